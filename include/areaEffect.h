@@ -0,0 +1,62 @@
+#ifndef AREA_EFFECT_H
+#define AREA_EFFECT_H
+
+#include "piece.h"
+#include "effectScheduler.h"
+#include "pieceTable.h"
+#include "globals.h"
+#include <array>
+#include <cstdint>
+#include <functional>
+
+class QueenOfBones;
+
+// Abilities that hit several squares at once: the NecroPawn sacrifice, QueenOfDestruction's mass destruction
+// and the GhostKnight stun. Squares are bits of a 64-bit mask, row * BOARD_SIZE + col like the Howler's targets.
+// The running game's PieceTable is synced with the list on construction, so resolving an effect costs the squares
+// it touches rather than a search of the piece list per square.
+class AreaEffect
+{
+public:
+    using SquareMask = std::uint64_t;
+
+    // Offered a fallen QueenOfBones after the pieces are off the board; the queen is destroyed when it returns
+    using QueenOfBonesFallen = std::function<void(QueenOfBones &)>;
+
+    explicit AreaEffect(std::vector<std::unique_ptr<Piece>> &pieces);
+
+    // -1 off the board
+    static int squareOf(const sf::Vector2f &position);
+    static SquareMask squareMask(const sf::Vector2f &position);
+
+    // The eight squares around the position
+    static SquareMask adjacentSquares(const sf::Vector2f &position);
+
+    SquareMask occupiedBy(Piece::Color color) const;
+
+    // First piece on each queen line from the position, looking through the squares in transparent
+    SquareMask lineOfSight(const sf::Vector2f &position, SquareMask transparent) const;
+
+    // Enemies the QueenOfDestruction destroys when the capturing piece takes her
+    SquareMask massDestructionTargets(const Piece &queen, const Piece *capturingPiece) const;
+
+    // Takes the pieces on squares off the board together with everything their deaths set off: a QueenOfDestruction
+    // among them destroys the enemies in her lines, looking through the capturing piece and through the pieces
+    // that fell before her. The capturing piece itself is only removed when its square is in squares.
+    // Returns the squares that were emptied.
+    SquareMask capture(SquareMask squares, const Piece *capturingPiece, const QueenOfBonesFallen &onQueenOfBonesFallen);
+
+    // Stuns every piece on squares until the end of the owner's next turn
+    void stun(SquareMask squares, EffectScheduler &effects);
+
+private:
+    std::vector<std::unique_ptr<Piece>> &pieces;
+    PieceTable ownTable; // read from the list only when no game has installed its table
+    PieceTable &table;
+    std::array<SquareMask, 2> occupiedBySide; // White first; squares leave it as a capture resolves
+
+    void indexBoard();
+    SquareMask destructionTargets(const Piece &queen, SquareMask capturer) const;
+};
+
+#endif // AREA_EFFECT_H
@@ -0,0 +1,67 @@
+#ifndef ASSET_LOADER_H
+#define ASSET_LOADER_H
+
+#include "resourceArchive.h"
+#include "textureManager.h"
+#include <SFML/Graphics.hpp>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// The game's textures and font, read from the packed archive once per process. The constructor maps the archive
+// and loads what the menu needs (font and background); the piece images are copied out of the mapping on a worker
+// thread while the menu is up and become textures the first time a game asks for them. Owned by main, above every
+// Game, so a rematch finds everything resident and reads nothing from disk.
+class AssetLoader
+{
+public:
+    // What the cache holds in memory
+    struct MemoryUsage
+    {
+        std::size_t archiveBytes = 0; // mapped archive, font data included
+        std::size_t textureCount = 0;
+        std::size_t textureBytes = 0; // piece textures and menu background, RGBA
+        long textureUsers = 0;        // games holding the piece textures
+    };
+
+    // Throws std::runtime_error when the archive cannot be opened or lacks the font or menu background
+    explicit AssetLoader(const std::string &archivePath = defaultArchivePath());
+    ~AssetLoader();
+    AssetLoader(const AssetLoader &) = delete;
+    AssetLoader &operator=(const AssetLoader &) = delete;
+
+    sf::Font &getFont() { return font; }
+    const sf::Texture &getMenuBackground() const { return menuBackground; }
+
+    // Shares the piece textures with a game for as long as it holds the pointer. Waits for the worker if it is
+    // still going and uploads every image the first time; later calls return at once.
+    // Throws std::runtime_error when a texture cannot be created.
+    std::shared_ptr<TextureManager> acquireTextures();
+
+    MemoryUsage getMemoryUsage() const;
+
+    bool isDecoded() const { return decoded.load(); }
+
+    // BATTLECHESS_ARCHIVE from the environment, else the archive the build wrote, so the game runs from any directory
+    static std::string defaultArchivePath();
+
+private:
+    void decodeImages();
+
+    ResourceArchive archive;
+    sf::Font font; // reads its glyphs from the mapping, which stays open as long as the loader
+    sf::Texture menuBackground;
+
+    std::vector<std::pair<std::string, sf::Image>> images;
+    std::atomic<bool> decoded;
+    std::thread worker;
+
+    // Also held by every game using them, so they outlive the pieces drawn with them
+    std::shared_ptr<TextureManager> textures;
+    bool uploaded = false;
+};
+
+#endif // ASSET_LOADER_H
@@ -16,7 +16,7 @@ public:
 
     bool canMoveTo(const sf::Vector2f &target, const std::vector<std::unique_ptr<Piece>> &pieces) const override;
 
-    void highlightValidMoves(std::vector<std::vector<Square>> &board, const std::vector<std::unique_ptr<Piece>> &pieces) const override;
+    void highlightValidMoves(Board &board, const std::vector<std::unique_ptr<Piece>> &pieces) const override;
 
     std::string getType() const override { return "BeastDruid"; }
 };
@@ -17,9 +17,9 @@ public:
 
     bool canMoveTo(const sf::Vector2f &target, const std::vector<std::unique_ptr<Piece>> &pieces) const override;
 
-    void highlightValidMoves(std::vector<std::vector<Square>> &board, const std::vector<std::unique_ptr<Piece>> &pieces) const override;
+    void highlightValidMoves(Board &board, const std::vector<std::unique_ptr<Piece>> &pieces) const override;
 
-    void highlightCaptureZones(std::vector<std::vector<Square>> &board, const std::vector<std::unique_ptr<Piece>> &pieces) const;
+    void highlightCaptureZones(Board &board, const std::vector<std::unique_ptr<Piece>> &pieces) const override;
 
     void capture(const sf::Vector2f &target, std::vector<std::unique_ptr<Piece>> &pieces) override;
 
@@ -0,0 +1,104 @@
+#ifndef BOARD_H
+#define BOARD_H
+
+#include "globals.h"
+#include <SFML/Graphics.hpp>
+#include <array>
+#include <cstdint>
+
+// The chessboard's squares: a fill colour per square, and the highlights as one 64-bit mask per highlight colour.
+// Squares are row * BOARD_SIZE + col like the AreaEffect and Howler masks. A piece collects the squares it highlights
+// in a Highlights and hands them to the board in one call; board[row][col] still reads one square.
+// A square has at most one highlight colour; highlighting it again replaces the colour.
+class Board
+{
+public:
+    using SquareMask = std::uint64_t;
+
+    static constexpr int SquareCount = BOARD_SIZE * BOARD_SIZE;
+    static constexpr SquareMask AllSquares = ~SquareMask(0);
+    static constexpr int MaxHighlightColors = 8;
+
+    struct HighlightLayer
+    {
+        sf::Color color;
+        SquareMask squares = 0;
+    };
+
+    // What a piece highlights when it is selected, one mask per colour
+    struct Highlights
+    {
+        SquareMask moves = 0;     // yellow
+        SquareMask captures = 0;  // red
+        SquareMask abilities = 0; // green: ability targets such as portal swaps and revivals
+    };
+
+    // One square of the board, read-only; its highlight is a bit in the board's masks
+    class SquareRef
+    {
+    public:
+        SquareRef(Board &board, int sq) : board(board), sq(sq) {}
+
+        bool getHighlight() const { return board.isHighlighted(sq); }
+
+    private:
+        Board &board;
+        int sq;
+    };
+
+    class Row
+    {
+    public:
+        Row(Board &board, int row) : board(board), row(row) {}
+
+        SquareRef operator[](int col) const { return SquareRef(board, row * BOARD_SIZE + col); }
+
+    private:
+        Board &board;
+        int row;
+    };
+
+    // Squares alternate between the two colours, light in the top left corner
+    Board(const sf::Color &light, const sf::Color &dark);
+
+    Row operator[](int row) { return Row(*this, row); }
+
+    // -1 off the board
+    static int squareAt(const sf::Vector2f &position);
+    static SquareMask squareMask(const sf::Vector2f &position);
+    static SquareMask squareMask(int row, int col); // 0 off the board
+    static sf::Vector2f positionOf(int sq);
+
+    const sf::Color &getFillColor(int sq) const { return fills[sq]; }
+    SquareMask squaresFilled(const sf::Color &color) const;
+
+    void setHighlight(int sq, bool highlight, const sf::Color &color = sf::Color::Yellow);
+
+    // Highlights every square in squares with color
+    void highlight(SquareMask squares, const sf::Color &color = sf::Color::Yellow);
+
+    // Applies a piece's highlights in the order moves, captures, abilities, so a later mask wins a shared square
+    void highlight(const Highlights &highlights);
+
+    void clearHighlights(SquareMask squares = AllSquares);
+
+    SquareMask highlighted() const { return highlightedSquares; }
+    bool isHighlighted(int sq) const { return sq >= 0 && sq < SquareCount && (highlightedSquares >> sq & 1); }
+
+    int getHighlightLayerCount() const { return layerCount; }
+    const HighlightLayer &getHighlightLayer(int layer) const { return layers[layer]; }
+
+    // Changes whenever a highlight does, so a renderer knows when its overlay is stale
+    std::uint32_t getHighlightVersion() const { return highlightVersion; }
+
+private:
+    std::array<sf::Color, SquareCount> fills;
+    std::array<HighlightLayer, MaxHighlightColors> layers;
+    int layerCount = 0;
+    SquareMask highlightedSquares = 0;
+    std::uint32_t highlightVersion = 0;
+
+    int layerOf(const sf::Color &color) const;
+};
+
+#endif // BOARD_H
@@ -0,0 +1,39 @@
+#ifndef BOARD_LAYER_H
+#define BOARD_LAYER_H
+
+#include "board.h"
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <vector>
+
+// The board as drawn: the squares' fills are rendered once into a texture, and the highlighted squares are an
+// overlay of outlines built from the board's highlight masks, rebuilt only when a highlight has changed.
+// A frame costs two draw calls instead of one per square.
+class BoardLayer
+{
+public:
+    static constexpr float OutlineThickness = 5.0f;
+
+    explicit BoardLayer(const Board &board);
+    BoardLayer(const BoardLayer &) = delete;
+    BoardLayer &operator=(const BoardLayer &) = delete;
+
+    // Renders the squares' fills again; the board pattern never changes during a game, so only needed if it does
+    void renderSquares(const Board &board);
+
+    // Draws the board with the highlights it has now
+    void draw(sf::RenderTarget &target, const Board &board);
+
+private:
+    sf::RenderTexture squaresTexture;
+    sf::Sprite squaresSprite;
+    bool rendered = false; // false when no render texture could be created; the squares are then drawn one by one
+    std::vector<sf::RectangleShape> squareShapes;
+
+    sf::VertexArray overlay;
+    std::uint32_t overlayVersion;
+
+    void updateOverlay(const Board &board);
+};
+
+#endif // BOARD_LAYER_H
@@ -12,13 +12,13 @@ public:
 
     bool canMoveTo(const sf::Vector2f &target, const std::vector<std::unique_ptr<Piece>> &pieces) const override;
 
-    void highlightValidMoves(std::vector<std::vector<Square>> &board, const std::vector<std::unique_ptr<Piece>> &pieces) const override;
+    void highlightValidMoves(Board &board, const std::vector<std::unique_ptr<Piece>> &pieces) const override;
 
-    void highlightDeadCaptureZones(std::vector<std::vector<Square>> &board, const std::vector<std::unique_ptr<Piece>> &pieces);
+    void highlightCaptureZones(Board &board, const std::vector<std::unique_ptr<Piece>> &pieces) const override;
 
     void capture(const sf::Vector2f &target, std::vector<std::unique_ptr<Piece>> &pieces) override;
 
-    void highlightAdjacentPawns(std::vector<std::unique_ptr<Piece>> &pieces, std::vector<std::vector<Square>> &board);
+    void highlightAdjacentPawns(std::vector<std::unique_ptr<Piece>> &pieces, Board &board);
 
     bool isTargetWithinRange(const sf::Vector2f &target) const;
 
@@ -0,0 +1,55 @@
+#ifndef EFFECT_SCHEDULER_H
+#define EFFECT_SCHEDULER_H
+
+#include "piece.h"
+#include "textureManager.h"
+#include <deque>
+#include <vector>
+
+// Timed effects of the piece abilities. Each effect is queued under the turn it expires at, so ending
+// a turn only touches the pieces whose effects run out. Turns are this client's own turns: the
+// opponent's packets already carry the state of their pieces.
+class EffectScheduler
+{
+public:
+    enum class Effect
+    {
+        Stun,       // cannot be selected (GhostKnight)
+        Domination, // a piece turned into a QueenOfDomination reverts (QueenOfDomination)
+        Stone,      // cannot be captured until woken (Familiar)
+        Removal     // taken off the board (HellPawn after infecting)
+    };
+
+    // Effects that only end when cancelled
+    static constexpr int UntilCancelled = -1;
+
+    // Applies the effect to the piece and expires it after turnCount more turns have ended: 0 expires at the end
+    // of the current turn
+    void schedule(Effect effect, Piece &piece, int turnCount);
+
+    // Ends the effect early (a Familiar waking up); safe when nothing is scheduled
+    void cancel(Effect effect, Piece &piece);
+
+    // Expires the effects of the turn that just ended and moves on to the next turn
+    void endTurn(std::vector<std::unique_ptr<Piece>> &pieces, TextureManager &textureManager);
+
+    // Queues the expiry of stuns the opponent put on the side's pieces, which arrive in a packet rather than
+    // through schedule(); they wear off at the end of the side's current turn
+    void adoptStuns(const std::vector<std::unique_ptr<Piece>> &pieces, Piece::Color side);
+
+    bool isPending(Effect effect, int pieceId) const;
+
+private:
+    // Pieces are replaced by their id (domination, infection, network updates), so entries never hold pointers
+    // and a copy of the scheduler goes with a cloned piece list
+    struct Entry
+    {
+        Effect effect;
+        int pieceId;
+    };
+
+    std::deque<std::vector<Entry>> turns; // turns.front() expires at the end of the current turn
+    std::vector<Entry> untilCancelled;
+};
+
+#endif // EFFECT_SCHEDULER_H
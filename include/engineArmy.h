@@ -0,0 +1,82 @@
+#ifndef ENGINE_ARMY_H
+#define ENGINE_ARMY_H
+
+#include "engineSelfPlay.h"
+#include "engineThreadPool.h"
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace engine
+{
+    // Army menu layout: slots 0-7 are the back rank from the left, 8-15 the pawns
+    constexpr int ARMY_SLOTS = 16;
+    constexpr int ARMY_BUDGET = 20; // gemstones available in every army menu
+
+    Base slotBase(int slot);
+    int slotCost(int slot); // costsText in the army menus
+
+    // One army menu selection: each set bit upgrades that slot to the race's piece
+    struct ArmyBuild
+    {
+        Race race = Standard;
+        std::uint16_t upgrades = 0;
+
+        int cost() const;
+        bool isLegal() const { return race == Standard ? upgrades == 0 : cost() <= ARMY_BUDGET; }
+        Kind kindAt(int slot) const;
+        std::string describe() const;
+
+        bool operator<(const ArmyBuild &other) const
+        {
+            return race != other.race ? race < other.race : upgrades < other.upgrades;
+        }
+    };
+
+    // Start position with White playing the white build and Black the black build
+    Position armyStartPosition(const ArmyBuild &white, const ArmyBuild &black);
+
+    struct ArmyScore
+    {
+        ArmyBuild build;
+        double points = 0.0; // wins plus half the draws
+        int games = 0;
+
+        double winRate() const { return games ? points / games : 0.0; }
+    };
+
+    struct OptimizerOptions
+    {
+        int population = 24;        // candidates per race
+        int generations = 20;
+        int gamesPerCandidate = 8;  // new games per candidate per generation, colours alternate
+        int elites = 4;             // best builds per race carried over unchanged
+        double mutationRate = 0.1;  // chance to flip each slot
+        std::uint32_t seed = 1;
+        SelfPlayOptions play;
+    };
+
+    // Genetic search over legal upgrade selections for each race. Candidates are scored by
+    // self-play against the standard army and the current elites of every race; scores
+    // accumulate over generations so builds that survive get more games.
+    class ArmyOptimizer
+    {
+    public:
+        using ProgressCallback = std::function<void(int generation, const std::vector<ArmyScore> &best)>;
+        using RecordCallback = std::function<void(const std::vector<std::string> &positions, float result)>;
+
+        // Games of a generation run as tasks on pool
+        explicit ArmyOptimizer(const OptimizerOptions &options, ThreadPool &pool = ThreadPool::shared());
+
+        // Returns every evaluated build, strongest first
+        std::vector<ArmyScore> run(const std::vector<Race> &races, const ProgressCallback &onGeneration = ProgressCallback(),
+                                   const RecordCallback &onGame = RecordCallback());
+
+    private:
+        OptimizerOptions options;
+        ThreadPool &pool;
+    };
+}
+
+#endif // ENGINE_ARMY_H
@@ -0,0 +1,42 @@
+#ifndef ENGINE_ATTACKS_H
+#define ENGINE_ATTACKS_H
+
+#include "engineTypes.h"
+
+namespace engine
+{
+    // Fixed neighbourhoods the abilities use; piece movement itself is compiled from the piece
+    // catalog (enginePieces.h)
+    template <typename Geometry>
+    struct BasicAttackTables
+    {
+        using Mask = typename Geometry::Mask;
+
+        Mask king[Geometry::squares];       // 8 neighbours (stuns, sacrifices, raising, loading)
+        Mask orthogonal[Geometry::squares]; // 4 neighbours (Necromancer placement)
+        Mask knight[Geometry::squares];     // (2,1) leaper
+
+        // What a Howler's captured families add, indexed by its family set (FlagHowlerFamilies):
+        // the union of their leaps and their slide flags, so any set costs one lookup
+        Mask howlLeaps[HowlerFamilySets][Geometry::squares];
+        std::uint8_t howlSlides[HowlerFamilySets];
+    };
+
+    using AttackTables = BasicAttackTables<Board8>;
+
+    template <typename Geometry>
+    const BasicAttackTables<Geometry> &attackTablesFor();
+
+    inline const AttackTables &attackTables() { return attackTablesFor<Board8>(); }
+
+    // Squares reached by sliding until (and including) the first occupied square.
+    // Rules code templated on the geometry must name it: the default only fits 8x8 masks.
+    template <typename Geometry = Board8>
+    typename Geometry::Mask slidingAttacks(int sq, const typename Geometry::Mask &occupied, bool orthogonal, bool diagonal);
+
+    // Squares a QueenOfDestruction standing on sq sees, treating ignoreSquare as empty
+    template <typename Geometry = Board8>
+    typename Geometry::Mask queenLineTargets(int sq, const typename Geometry::Mask &occupied, int ignoreSquare);
+}
+
+#endif // ENGINE_ATTACKS_H
@@ -0,0 +1,39 @@
+#ifndef ENGINE_BATCH_H
+#define ENGINE_BATCH_H
+
+#include "engineEval.h"
+#include "engineThreadPool.h"
+#include <cstddef>
+#include <vector>
+
+namespace engine
+{
+    constexpr int EVAL_BLOCK = 64; // positions transposed together into bitboard planes
+
+    struct BatchResults
+    {
+        std::vector<int> scores;     // evaluate() of each position, side to move's view
+        std::vector<int> moveCounts; // moves generateMoves() produces in each position
+    };
+
+    // Static evaluation and move counting for large sets of positions. Positions are
+    // transposed block by block into structure-of-arrays bitboard planes and every
+    // evaluation term is a popcount loop across the block; blocks are spread over a ThreadPool.
+    class BatchEvaluator
+    {
+    public:
+        explicit BatchEvaluator(const EvalParams &params = defaultEvalParams(), ThreadPool &pool = ThreadPool::shared());
+
+        // Either output may be null; scores alone never build a Position unless mobility is weighted
+        void run(const PackedPosition *positions, std::size_t count, int *scores, int *moveCounts) const;
+        BatchResults run(const std::vector<PackedPosition> &positions, bool withMoveCounts = true) const;
+
+    private:
+        void runBlock(const PackedPosition *positions, int count, int *scores, int *moveCounts) const;
+
+        EvalParams params;
+        ThreadPool &pool;
+    };
+}
+
+#endif // ENGINE_BATCH_H
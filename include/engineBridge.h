@@ -0,0 +1,19 @@
+#ifndef ENGINE_BRIDGE_H
+#define ENGINE_BRIDGE_H
+
+#include "enginePosition.h"
+#include "piece.h"
+#include "pieceReserve.h"
+#include <SFML/Graphics.hpp>
+#include <memory>
+#include <vector>
+
+// Builds the engine Position for the pieces on the GUI board, with the given side to move; pieces held in
+// reserve go to the matching engine reserve slots
+engine::Position positionFromPieces(const std::vector<std::unique_ptr<Piece>> &pieces, const PieceReserve &reserve, bool isWhiteTurn);
+
+// Converts between engine square indices and the pixel positions pieces are stored at
+int squareFromPixels(const sf::Vector2f &position);
+sf::Vector2f pixelsFromSquare(int sq);
+
+#endif // ENGINE_BRIDGE_H
@@ -0,0 +1,67 @@
+#ifndef ENGINE_CLUSTER_H
+#define ENGINE_CLUSTER_H
+
+#include "enginePosition.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace engine
+{
+    // One independent piece of a split job
+    struct WorkUnit
+    {
+        enum Type
+        {
+            Perft, // leaf count of notation at depth
+            Search // score of move in notation searched to depth, from the side to move's view
+        };
+
+        Type type = Perft;
+        std::string notation;
+        int depth = 1;
+        std::string move;  // Search only, in Position::moveToString form
+        std::string label; // moves leading to the unit, for reporting
+    };
+
+    // Perft units for every move sequence of splitDepth plies (fewer when the tree ends early)
+    std::vector<WorkUnit> splitPerft(const Position &position, int depth, int splitDepth);
+
+    // One Search unit per root move
+    std::vector<WorkUnit> splitSearch(const Position &position, int depth);
+
+    struct ClusterOptions
+    {
+        int workers = 2;
+        std::string workerCommand;  // executable started as "<command> --worker <socket> --threads N"
+        std::string socketPath;     // Unix-domain socket, defaults to a per-process path in /tmp
+        int workerThreads = 1;      // ThreadPool size inside each worker
+        int unitTimeoutMs = 0;      // kill a worker that holds a unit longer than this, 0 = never
+        int maxRestarts = 8;        // replacement workers started after failures
+        int failAfter = 0;          // fault injection: the first worker dies on receiving its n-th unit
+    };
+
+    // Farms work units to worker processes over a Unix-domain socket. Each worker holds one unit
+    // at a time; when a worker disconnects or times out its unit goes back to the front of the
+    // queue and a replacement process is started. Throws std::runtime_error when the socket
+    // cannot be set up or every worker keeps failing.
+    class ClusterCoordinator
+    {
+    public:
+        explicit ClusterCoordinator(const ClusterOptions &options);
+
+        // Returns one value per unit: leaf count for Perft, score for Search
+        std::vector<std::int64_t> run(const std::vector<WorkUnit> &units);
+
+        int reassignedUnits() const { return reassigned; }
+
+    private:
+        ClusterOptions options;
+        int reassigned = 0;
+    };
+
+    // Worker side: connects to socketPath and answers units until told to quit; returns the exit code
+    int runClusterWorker(const std::string &socketPath, int threads, int failAfter);
+}
+
+#endif // ENGINE_CLUSTER_H
@@ -0,0 +1,58 @@
+#ifndef ENGINE_EVAL_H
+#define ENGINE_EVAL_H
+
+#include "enginePosition.h"
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+namespace engine
+{
+    // Index of each tunable weight; material takes one slot per Kind
+    enum EvalTerm : int
+    {
+        TermMaterial = 0,
+        TermCentralization = KindCount, // per step closer to the centre for non-king pieces
+        TermPawnAdvance,                // per row a pawn-type piece has advanced
+        TermStunned,                    // a stunned piece loses its next turn (stored as a bonus, so negative)
+        TermLoaded,                     // loaded DeadLauncher
+        TermAbilityReady,               // unused one-shot ability (GhoulKing raise, QueenOfDomination)
+        TermKingCount,                  // each king beyond the first
+        TermMobility,                   // per available move, only computed when non-zero
+        EvalTermCount
+    };
+
+    // Tunable evaluation weights in centipawns
+    struct EvalParams
+    {
+        int weights[EvalTermCount];
+
+        EvalParams();
+
+        int material(Kind kind) const { return weights[TermMaterial + kind]; }
+
+        static std::string termName(int term);
+
+        // Reads "name value" lines as written by save(); unknown names throw std::runtime_error
+        static EvalParams load(const std::string &path);
+        void save(std::ostream &out) const;
+    };
+
+    const EvalParams &defaultEvalParams();
+
+    // Static evaluation from the side to move's point of view
+    int evaluate(const Position &position, const EvalParams &params = defaultEvalParams());
+
+    // One non-zero evaluation input: evaluate() from White's view is the sum of weight * value
+    struct EvalFeature
+    {
+        std::uint16_t term;
+        std::int16_t value;
+    };
+
+    // Sparse features of position from White's point of view, mobility included
+    void evalFeatures(const Position &position, std::vector<EvalFeature> &features);
+}
+
+#endif // ENGINE_EVAL_H
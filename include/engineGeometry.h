@@ -0,0 +1,187 @@
+#ifndef ENGINE_GEOMETRY_H
+#define ENGINE_GEOMETRY_H
+
+#include <cstdint>
+
+namespace engine
+{
+    // Square index, row * dim + col; every supported board fits in a byte with NO_SQUARE to spare
+    using Square = std::uint8_t;
+    constexpr Square NO_SQUARE = 0xFF;
+
+    // Occupancy mask of more than 64 squares, least significant word first. It supports the
+    // operators the rules code uses on a plain 64-bit mask, so the same templates serve both.
+    template <int Words>
+    struct WideMask
+    {
+        std::uint64_t words[Words];
+
+        constexpr WideMask() : words{} {}
+        constexpr WideMask(std::uint64_t low) : words{low} {}
+
+        explicit operator bool() const
+        {
+            std::uint64_t any = 0;
+            for (int i = 0; i < Words; ++i)
+            {
+                any |= words[i];
+            }
+            return any != 0;
+        }
+
+        WideMask &operator&=(const WideMask &other)
+        {
+            for (int i = 0; i < Words; ++i)
+            {
+                words[i] &= other.words[i];
+            }
+            return *this;
+        }
+        WideMask &operator|=(const WideMask &other)
+        {
+            for (int i = 0; i < Words; ++i)
+            {
+                words[i] |= other.words[i];
+            }
+            return *this;
+        }
+        WideMask &operator^=(const WideMask &other)
+        {
+            for (int i = 0; i < Words; ++i)
+            {
+                words[i] ^= other.words[i];
+            }
+            return *this;
+        }
+        WideMask operator~() const
+        {
+            WideMask result;
+            for (int i = 0; i < Words; ++i)
+            {
+                result.words[i] = ~words[i];
+            }
+            return result;
+        }
+        // Only ever shifts a single low bit into place, so shift < 64 * Words
+        WideMask operator<<(int shift) const
+        {
+            WideMask result;
+            int wordShift = shift / 64;
+            int bitShift = shift % 64;
+            for (int i = Words - 1; i >= wordShift; --i)
+            {
+                std::uint64_t value = words[i - wordShift] << bitShift;
+                if (bitShift && i - wordShift > 0)
+                {
+                    value |= words[i - wordShift - 1] >> (64 - bitShift);
+                }
+                result.words[i] = value;
+            }
+            return result;
+        }
+
+        friend WideMask operator&(WideMask left, const WideMask &right) { return left &= right; }
+        friend WideMask operator|(WideMask left, const WideMask &right) { return left |= right; }
+        friend WideMask operator^(WideMask left, const WideMask &right) { return left ^= right; }
+        friend bool operator==(const WideMask &left, const WideMask &right)
+        {
+            for (int i = 0; i < Words; ++i)
+            {
+                if (left.words[i] != right.words[i])
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+        friend bool operator!=(const WideMask &left, const WideMask &right) { return !(left == right); }
+    };
+
+    using Mask128 = WideMask<2>; // 10x10
+    using Mask192 = WideMask<3>; // 12x12
+
+    template <int Dim>
+    struct MaskFor
+    {
+        using type = WideMask<(Dim * Dim + 63) / 64>;
+    };
+
+    template <>
+    struct MaskFor<8>
+    {
+        using type = std::uint64_t;
+    };
+
+    // Board dimensions as compile-time constants. Everything that indexes squares takes the
+    // geometry as a template parameter, so 8x8 keeps its 64-bit masks and folded arithmetic.
+    template <int Dim>
+    struct BoardGeometry
+    {
+        static_assert(Dim >= 8 && Dim * Dim < NO_SQUARE, "squares must fit in a Square");
+
+        using Mask = typename MaskFor<Dim>::type;
+
+        static constexpr int dim = Dim;
+        static constexpr int squares = Dim * Dim;
+
+        static constexpr int rowOf(int sq) { return sq / Dim; }
+        static constexpr int colOf(int sq) { return sq % Dim; }
+        static constexpr int makeSquare(int row, int col) { return row * Dim + col; }
+        static constexpr bool onBoard(int row, int col) { return row >= 0 && row < Dim && col >= 0 && col < Dim; }
+        static Mask squareBit(int sq) { return Mask(1) << sq; }
+    };
+
+    using Board8 = BoardGeometry<8>;
+    using Board10 = BoardGeometry<10>;
+    using Board12 = BoardGeometry<12>;
+
+    inline int popCount(std::uint64_t mask) { return __builtin_popcountll(mask); }
+    inline int lsb(std::uint64_t mask) { return __builtin_ctzll(mask); }
+    inline int popLsb(std::uint64_t &mask)
+    {
+        int sq = lsb(mask);
+        mask &= mask - 1;
+        return sq;
+    }
+
+    template <int Words>
+    int popCount(const WideMask<Words> &mask)
+    {
+        int count = 0;
+        for (int i = 0; i < Words; ++i)
+        {
+            count += __builtin_popcountll(mask.words[i]);
+        }
+        return count;
+    }
+
+    template <int Words>
+    int lsb(const WideMask<Words> &mask)
+    {
+        for (int i = 0; i < Words; ++i)
+        {
+            if (mask.words[i])
+            {
+                return i * 64 + __builtin_ctzll(mask.words[i]);
+            }
+        }
+        return -1;
+    }
+
+    template <int Words>
+    int popLsb(WideMask<Words> &mask)
+    {
+        for (int i = 0; i < Words; ++i)
+        {
+            if (mask.words[i])
+            {
+                int sq = i * 64 + __builtin_ctzll(mask.words[i]);
+                mask.words[i] &= mask.words[i] - 1;
+                return sq;
+            }
+        }
+        return -1;
+    }
+}
+
+#endif // ENGINE_GEOMETRY_H
@@ -0,0 +1,65 @@
+#ifndef ENGINE_HINT_H
+#define ENGINE_HINT_H
+
+#include "engineSearch.h"
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+namespace engine
+{
+    // Latest hint as seen by the renderer
+    struct HintSnapshot
+    {
+        bool valid = false;
+        int from = NO_SQUARE;
+        int to = NO_SQUARE;
+        int score = 0; // centipawns for the side to move
+        int depth = 0;
+    };
+
+    // Time-bounded best-move searches on a persistent worker thread.
+    // Every completed depth is packed into one 64-bit atomic, so snapshot() never locks and never
+    // sees a half-written result; results from superseded requests are filtered by generation.
+    class HintEngine
+    {
+    public:
+        explicit HintEngine(std::size_t hashMegabytes = 16);
+        ~HintEngine();
+
+        HintEngine(const HintEngine &) = delete;
+        HintEngine &operator=(const HintEngine &) = delete;
+
+        // Starts a search of position limited to the piece on fromSquare (NO_SQUARE for every piece),
+        // replacing any search in progress. Returns immediately.
+        void request(const Position &position, int fromSquare, int timeMs);
+
+        // Drops the current hint and stops its search
+        void cancel();
+
+        HintSnapshot snapshot() const;
+
+    private:
+        void workerLoop();
+        void publish(std::uint32_t jobGeneration, const SearchInfo &info);
+
+        TranspositionTable tt;
+        Search search;
+        std::thread worker;
+
+        std::mutex jobMutex;
+        std::condition_variable jobReady;
+        bool hasJob = false;
+        bool quitting = false;
+        Position jobPosition;
+        SearchLimits jobLimits;
+        std::uint32_t jobGeneration = 0;
+
+        std::atomic<std::uint32_t> generation; // of the most recent request
+        std::atomic<std::uint64_t> packed;     // generation | from | to | depth | score
+    };
+}
+
+#endif // ENGINE_HINT_H
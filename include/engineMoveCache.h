@@ -0,0 +1,87 @@
+#ifndef ENGINE_MOVE_CACHE_H
+#define ENGINE_MOVE_CACHE_H
+
+#include "engineMoveGen.h"
+#include <array>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace engine
+{
+    // Every move of the side to move in one position, generated once and read by any number of lookups
+    struct LegalMoves
+    {
+        std::uint64_t key = 0;
+        MoveList list;
+
+        // Per from square: squares reached by a plain move and by a capture (move-in, ranged, hop, infect)
+        std::array<Bitboard, NUM_SQUARES> quietTargets;
+        std::array<Bitboard, NUM_SQUARES> captureTargets;
+
+        // From squares with at least one other move (abilities, captures that place a pawn, Prowler pass);
+        // their targets alone do not describe what selecting the piece offers
+        Bitboard abilitySquares = 0;
+
+        // Hashes of the positions every move leads to, sorted
+        std::vector<std::uint64_t> successors;
+
+        explicit LegalMoves(const Position &position);
+
+        bool hasAbilities(int from) const { return (abilitySquares & squareBit(from)) != 0; }
+
+        // True when one move of the list turns this position into the one with the given hash
+        bool leadsTo(std::uint64_t hash) const;
+    };
+
+    // Legal move lists keyed by position hash. prepare() generates a position's moves on a worker thread,
+    // typically right after the opponent's move arrives, so the lookups made while the player clicks through
+    // pieces find them ready; lookup() generates them in place on a miss. Holds the last few positions,
+    // oldest replaced first, and hands entries out as shared pointers so a replaced entry stays valid for
+    // whoever still holds it.
+    class LegalMoveCache
+    {
+    public:
+        static constexpr int Entries = 8;
+
+        LegalMoveCache();
+        ~LegalMoveCache();
+
+        LegalMoveCache(const LegalMoveCache &) = delete;
+        LegalMoveCache &operator=(const LegalMoveCache &) = delete;
+
+        // Queues the position for the worker, replacing a queued position it has not started yet. Returns immediately.
+        void prepare(const Position &position);
+
+        // nullptr when the position has not been generated yet
+        std::shared_ptr<const LegalMoves> find(std::uint64_t hash) const;
+
+        // The cached moves, generated now when the worker has not got to the position yet
+        std::shared_ptr<const LegalMoves> lookup(const Position &position);
+
+        std::uint64_t hits() const;
+        std::uint64_t misses() const;
+
+    private:
+        void workerLoop();
+        std::shared_ptr<const LegalMoves> findLocked(std::uint64_t hash) const;
+        void store(const std::shared_ptr<const LegalMoves> &moves);
+
+        mutable std::mutex mutex;
+        std::array<std::shared_ptr<const LegalMoves>, Entries> entries;
+        int nextEntry = 0;
+        mutable std::uint64_t hitCount = 0;
+        mutable std::uint64_t missCount = 0;
+
+        std::condition_variable jobReady;
+        bool hasJob = false;
+        bool quitting = false;
+        Position jobPosition;
+        std::thread worker;
+    };
+}
+
+#endif // ENGINE_MOVE_CACHE_H
@@ -0,0 +1,67 @@
+#ifndef ENGINE_MOVEGEN_H
+#define ENGINE_MOVEGEN_H
+
+#include "enginePosition.h"
+#include <cstdint>
+#include <string>
+
+namespace engine
+{
+    constexpr int MAX_MOVES = 512;
+
+    // Fixed-capacity move buffer so generation never allocates
+    struct MoveList
+    {
+        Move moves[MAX_MOVES];
+        int count = 0;
+
+        void add(const Move &move)
+        {
+            if (count < MAX_MOVES)
+            {
+                moves[count++] = move;
+            }
+        }
+        Move *begin() { return moves; }
+        Move *end() { return moves + count; }
+        const Move *begin() const { return moves; }
+        const Move *end() const { return moves + count; }
+        int size() const { return count; }
+        bool empty() const { return count == 0; }
+    };
+
+    // Every function below is instantiated for Position, Position10 and Position12.
+
+    // Generates every move and ability available to the side to move.
+    // There is no check rule in Battle Chess, so pseudo-legal moves are legal.
+    template <typename Geometry>
+    void generateMoves(const BasicPosition<Geometry> &position, MoveList &list);
+
+    // The number of moves generateMoves produces. Plain pieces are counted from their target masks
+    // without listing their moves; used where only the count matters (batch move counts, mobility)
+    template <typename Geometry>
+    int countMoves(const BasicPosition<Geometry> &position);
+
+    // Captures only (move-in, ranged, infect and hop captures), used by quiescence search
+    template <typename Geometry>
+    void generateCaptures(const BasicPosition<Geometry> &position, MoveList &list);
+
+    // Matches protocol text such as "e2e4" or "c1f4g4" against the generated moves
+    template <typename Geometry>
+    bool parseMove(const BasicPosition<Geometry> &position, const std::string &text, Move &move);
+
+    // Game over when the side to move has lost every king
+    template <typename Geometry>
+    inline bool isLost(const BasicPosition<Geometry> &position) { return !position.hasKing(position.sideToMove()); }
+
+    class ThreadPool;
+
+    template <typename Geometry>
+    std::uint64_t perft(const BasicPosition<Geometry> &position, int depth);
+
+    // Same count with the subtrees of the upper plies forked as tasks on pool
+    template <typename Geometry>
+    std::uint64_t perft(const BasicPosition<Geometry> &position, int depth, ThreadPool &pool);
+}
+
+#endif // ENGINE_MOVEGEN_H
@@ -0,0 +1,123 @@
+#ifndef ENGINE_PIECES_H
+#define ENGINE_PIECES_H
+
+#include "engineTypes.h"
+#include <cstdint>
+#include <istream>
+#include <string>
+#include <vector>
+
+namespace engine
+{
+    // How a kind's steps are produced. The pawn families keep their own forward-step rules;
+    // every other kind is described by its Betza movement.
+    enum PieceFamily : std::uint8_t
+    {
+        FamilyBetza = 0,
+        FamilyPawn,     // single/double step forward, diagonal captures
+        FamilyYoungWiz, // pawn steps, captures straight ahead without moving
+        FamilyHopper    // pawn steps, double step jumping and capturing the piece in between
+    };
+
+    // Abilities a definition can grant; each is implemented once in move generation or makeMove
+    enum Ability : std::uint16_t
+    {
+        AbilitySacrifice = 1 << 0,        // removes itself and every neighbour (NecroPawn)
+        AbilityStun = 1 << 1,             // stuns adjacent enemies after moving (GhostKnight)
+        AbilityRaiseDead = 1 << 2,        // places a pawn beside what it captured (Necromancer)
+        AbilityLoad = 1 << 3,             // ranged captures need a loaded pawn (DeadLauncher)
+        AbilityRaise = 1 << 4,            // once per game places a pawn of its race beside it (GhoulKing)
+        AbilityStone = 1 << 5,            // turns to stone and cannot be captured (Familiar)
+        AbilitySwap = 1 << 6,             // swaps with a friendly pawn (QueenOfIllusions)
+        AbilityColumnShot = 1 << 7,       // ranged capture of the second piece up or down its column (WizardKing)
+        AbilityDominate = 1 << 8,         // once per game turns an adjacent friend into a Queen (QueenOfDomination)
+        AbilityInfect = 1 << 9,           // pawn captures convert non-pawns (HellPawn)
+        AbilityExtraMove = 1 << 10,       // moves again after capturing (Prowler)
+        AbilityHowl = 1 << 11,            // gains the movement of the families it captures (Howler)
+        AbilityMassDestruction = 1 << 12, // destroys the capturer's pieces in its lines when taken (QueenOfDestruction)
+        AbilityPortal = 1 << 13           // moves adjacent friends into and out of the side's reserve (Portal)
+    };
+
+    // One line of a piece file: the movement and abilities of a kind. The race and the army slot
+    // a piece fills come from its kind; the Custom race holds six free kinds for new pieces.
+    struct PieceDefinition
+    {
+        std::string movement;       // Betza string, or pawn/youngwiz/hopper for the pawn families
+        std::uint16_t abilities = 0;
+    };
+
+    // Movement of every kind. Piece files list "<kind> <movement> [ability ...]" lines, e.g.
+    //   Beholder     mWxHxDxNxF
+    //   CustomKnight NmD         stun
+    // Atoms W F D N A H C Z G, K R B Q shorthands, WW and FF riders; modifiers m (move only),
+    // c (capture only), x (ranged capture without moving), s and v (sideways or vertical half).
+    struct PieceCatalog
+    {
+        PieceDefinition pieces[KindCount];
+
+        // The rules the GUI pieces implement; Custom kinds move like the standard slot they fill
+        static const PieceCatalog &builtIn();
+
+        // Reads lines on top of the built-in catalog; errors throw std::runtime_error naming the line
+        static PieceCatalog load(const std::string &path);
+        static PieceCatalog parse(std::istream &in, const std::string &source);
+    };
+
+    enum SlideFlag : std::uint8_t
+    {
+        SlideOrthogonal = 1 << 0,
+        SlideDiagonal = 1 << 1
+    };
+
+    // A kind's movement compiled for Geometry. Leaps are per-square target tables shared by every
+    // kind with the same leaps (an all-empty table when a mode has none); slides are ray flags.
+    template <typename Geometry>
+    struct CompiledPiece
+    {
+        using Mask = typename Geometry::Mask;
+
+        const Mask *quiet = nullptr;   // moves to empty squares
+        const Mask *capture = nullptr; // captures by moving onto the target
+        const Mask *ranged = nullptr;  // captures without moving, preferred over capture on the same square
+        std::uint8_t quietSlides = 0;
+        std::uint8_t captureSlides = 0;
+        std::uint8_t rangedSlides = 0;
+        PieceFamily family = FamilyBetza;
+        std::uint16_t abilities = 0;
+        // Moves and captures share quiet/quietSlides, nothing is ranged and no ability reshapes the
+        // targets: the common case, generated without looking at the other modes
+        bool plain = false;
+    };
+
+    template <typename Geometry>
+    struct PieceTables
+    {
+        using Mask = typename Geometry::Mask;
+
+        // kinds point into leaps, so tables can be moved but not copied
+        PieceTables() = default;
+        PieceTables(const PieceTables &) = delete;
+        PieceTables &operator=(const PieceTables &) = delete;
+        PieceTables(PieceTables &&) = default;
+        PieceTables &operator=(PieceTables &&) = default;
+
+        CompiledPiece<Geometry> kinds[KindCount];
+        // Abilities any piece of a set of races may use, indexed by a BasicPosition::races() value
+        std::uint16_t abilitiesOfRaces[1 << RaceCount];
+
+        std::vector<std::vector<Mask>> leaps; // backing storage of the leap tables
+    };
+
+    // Tables of the active catalog, compiled for 8x8, 10x10 and 12x12
+    template <typename Geometry>
+    const PieceTables<Geometry> &pieceTablesFor();
+
+    const PieceCatalog &pieceCatalog();
+
+    // Recompiles every geometry's tables; not safe while another thread generates moves
+    void setPieceCatalog(const PieceCatalog &catalog);
+
+    inline std::uint16_t kindAbilities(Kind kind) { return pieceCatalog().pieces[kind].abilities; }
+}
+
+#endif // ENGINE_PIECES_H
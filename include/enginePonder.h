@@ -0,0 +1,70 @@
+#ifndef ENGINE_PONDER_H
+#define ENGINE_PONDER_H
+
+#include "engineSearch.h"
+#include <atomic>
+#include <mutex>
+#include <thread>
+
+namespace engine
+{
+    // Searches on the opponent's time. After our move a background thread predicts the reply and
+    // searches the position behind it; when the real reply arrives the search either carries on
+    // (predicted move, the work so far counts) or is cancelled and restarted on the real position.
+    // The transposition table is kept across searches in both cases.
+    class Ponderer
+    {
+    public:
+        explicit Ponderer(std::size_t hashMegabytes = 32);
+        ~Ponderer();
+
+        Ponderer(const Ponderer &) = delete;
+        Ponderer &operator=(const Ponderer &) = delete;
+
+        // Call right after our move is played; returns at once, the prediction runs on the worker.
+        // ourLimits is the thinking budget for our next move, which only starts counting once the
+        // opponent has replied.
+        void startPondering(const Position &afterOurMove, const SearchLimits &ourLimits);
+
+        // Call when the opponent's move arrives; returns true when it was the predicted move
+        bool opponentMoved(const Position &actual);
+
+        // Non-blocking: fills result once the search for our move has finished
+        bool poll(SearchResult &result);
+
+        // Non-blocking: the deepest line reported so far for the position we will move in
+        bool latestInfo(SearchInfo &info) const;
+
+        // Stops any search immediately and discards its result
+        void cancel();
+
+        bool isPondering() const { return pondering.load(); }
+        // Null until the worker has predicted the reply
+        Move predictedMove() const;
+
+    private:
+        void launch(const Position &root, const SearchLimits &limits);
+        void ponder(const Position &afterOurMove);
+        void runSearch(const Position &root, const SearchLimits &limits);
+        Move predictReply(const Position &afterOurMove);
+
+        TranspositionTable tt;
+        Search search;
+        std::thread worker;
+
+        SearchLimits moveLimits;
+        std::atomic<bool> pondering;
+
+        // Guards the prediction as well as the result: the worker sets it while the game loop compares
+        // the opponent's position against it
+        mutable std::mutex resultMutex;
+        Position ponderRoot; // position after the predicted reply
+        Move predicted;
+        SearchResult result;
+        bool resultReady = false;
+        SearchInfo info;
+        bool hasInfo = false;
+    };
+}
+
+#endif // ENGINE_PONDER_H
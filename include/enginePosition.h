@@ -0,0 +1,127 @@
+#ifndef ENGINE_POSITION_H
+#define ENGINE_POSITION_H
+
+#include "engineTypes.h"
+#include <array>
+#include <cstdint>
+#include <string>
+
+namespace engine
+{
+    // Fixed-size binary form of a position for bulk storage and batch evaluation.
+    // Pieces are listed in ascending square order of occupied; dominated pieces keep their
+    // original kind like in the notation.
+    template <typename Geometry>
+    struct BasicPackedPosition
+    {
+        static constexpr int maxPieces = 5 * Geometry::dim;
+
+        typename Geometry::Mask occupied = 0;
+        std::uint8_t kinds[maxPieces]; // Kind, plus PACKED_BLACK for Black pieces
+        std::uint16_t flags[maxPieces];
+        std::uint8_t sideToMove = White;
+        std::uint8_t prowlerSquare = NO_SQUARE;
+        std::uint8_t reserveKinds[2][ReserveSlots]; // Kind, NoKind for an empty slot
+        std::uint16_t reserveFlags[2][ReserveSlots];
+    };
+
+    using PackedPosition = BasicPackedPosition<Board8>;
+    constexpr int PACKED_MAX_PIECES = PackedPosition::maxPieces;
+    constexpr std::uint8_t PACKED_BLACK = 0x80;
+
+    // Compact board state used by the headless engine.
+    // Mailbox arrays hold kind/side/flags per square, bitboards mirror occupancy, and the
+    // Zobrist hash is updated incrementally by every mutation. Instantiated for Board8 (Position),
+    // Board10 and Board12.
+    template <typename Geometry>
+    class BasicPosition
+    {
+    public:
+        using Mask = typename Geometry::Mask;
+        using Packed = BasicPackedPosition<Geometry>;
+
+        BasicPosition();
+
+        // Larger boards centre the 8x8 back rank and fill the extra columns with knights beside the rooks
+        static BasicPosition startPosition();
+
+        // Compact notation: rows from White's back rank separated by '/', digits for empty runs,
+        // piece letter (upper case White) with an optional race tag d/w/f/h/c and optional [flags],
+        // followed by the side to move, an optional pending Prowler square ('-' for none) and an optional
+        // comma-separated reserve list of slot=piece entries, the piece written like on the board.
+        // e.g. "RNdBKQBNR/PPPPPPPP/8/8/8/8/pppppppp/rnbkqbnr w" or "... w - p=Nd,p=q"
+        static BasicPosition fromNotation(const std::string &notation);
+        std::string toNotation() const;
+        std::string toDisplay() const;
+
+        // Binary round trip through Packed; pack() throws std::runtime_error above Packed::maxPieces pieces
+        Packed pack() const;
+        static BasicPosition unpack(const Packed &packed);
+        // The same board without the Zobrist hash, for work that only generates moves (batch move counts);
+        // hash() of the result is 0 and it must not be used where positions are compared or stored
+        static BasicPosition unpackBoard(const Packed &packed);
+
+        Kind kindAt(int sq) const { return static_cast<Kind>(kinds[sq]); }
+        Side sideAt(int sq) const { return static_cast<Side>(sides[sq]); }
+        std::uint16_t flagsAt(int sq) const { return flags[sq]; }
+        Kind originalKindAt(int sq) const { return static_cast<Kind>(originalKinds[sq]); }
+        bool isEmpty(int sq) const { return kinds[sq] == NoKind; }
+
+        Mask occupancy(Side side) const { return occupied[side]; }
+        Mask occupancy() const { return occupied[White] | occupied[Black]; }
+        Mask kings(Side side) const { return kingSquares[side]; }
+        bool hasKing(Side side) const { return static_cast<bool>(kingSquares[side]); }
+        // Bit per Race of every piece ever put for side; pieces leaving the board do not clear it
+        std::uint8_t races(Side side) const { return raceMasks[side]; }
+
+        // Piece a side holds off the board in slot, NoKind when the slot is empty
+        Kind reserveKind(Side side, ReserveSlot slot) const { return static_cast<Kind>(reserveKinds[side][slot]); }
+        std::uint16_t reserveFlagsAt(Side side, ReserveSlot slot) const { return reserveFlags[side][slot]; }
+
+        Side sideToMove() const { return toMove; }
+        int pendingProwler() const { return prowlerSquare; }
+        std::uint64_t hash() const { return key; }
+
+        // Board editing primitives, each keeps the hash and bitboards in sync
+        void put(int sq, Kind kind, Side side, std::uint16_t pieceFlags = 0);
+        void remove(int sq);
+        void relocate(int from, int to);
+        void setFlags(int sq, std::uint16_t pieceFlags);
+        void setSideToMove(Side side);
+        void putReserve(Side side, ReserveSlot slot, Kind kind, std::uint16_t pieceFlags = 0);
+        void clearReserve(Side side, ReserveSlot slot);
+
+        // Applies a move produced by generateMoves, including all ability side effects
+        void makeMove(const Move &move);
+
+        // Null move for search pruning: hands the turn over without touching the board
+        void makeNullMove();
+
+        static std::string moveToString(const Move &move);
+
+    private:
+        void resolveCapture(int target, int capturer);
+        void massDestruction(int queenSquare, int capturer);
+        void stunAdjacentEnemies(int sq, Side side);
+        void endTurn(Side mover);
+
+        std::array<std::uint8_t, Geometry::squares> kinds;
+        std::array<std::uint8_t, Geometry::squares> sides;
+        std::array<std::uint16_t, Geometry::squares> flags;
+        std::array<std::uint8_t, Geometry::squares> originalKinds; // Kind to restore when a domination expires
+        Mask occupied[2];
+        Mask kingSquares[2];
+        std::uint8_t raceMasks[2];
+        std::uint8_t reserveKinds[2][ReserveSlots];
+        std::uint16_t reserveFlags[2][ReserveSlots];
+        Side toMove;
+        std::uint8_t prowlerSquare;
+        std::uint64_t key;
+    };
+
+    using Position = BasicPosition<Board8>;
+    using Position10 = BasicPosition<Board10>;
+    using Position12 = BasicPosition<Board12>;
+}
+
+#endif // ENGINE_POSITION_H
@@ -0,0 +1,62 @@
+#ifndef ENGINE_PROTOCOL_H
+#define ENGINE_PROTOCOL_H
+
+#include "engineSearch.h"
+#include <condition_variable>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+
+namespace engine
+{
+    // Line-based UCI-like protocol over a pair of streams.
+    // Commands: uci, isready, ucinewgame, setoption, position, go, stop, ponderhit, quit,
+    // plus the debugging helpers d (print board), eval, perft and stats (counters of the last search).
+    class EngineProtocol
+    {
+    public:
+        EngineProtocol(std::istream &input, std::ostream &output);
+        ~EngineProtocol();
+
+        // Reads commands until quit or end of input
+        int run();
+
+        // Handles one command line; returns false when the engine should exit
+        bool handleCommand(const std::string &line);
+
+    private:
+        void send(const std::string &line);
+        void sendInfo(const SearchInfo &info);
+
+        void cmdSetOption(std::istringstream &args);
+        void cmdPosition(std::istringstream &args);
+        void cmdGo(std::istringstream &args);
+        void cmdPerft(std::istringstream &args);
+        void reportStats(const SearchStats &stats);
+        void releaseBestMove();
+        void stopSearch();
+
+        std::istream &in;
+        std::ostream &out;
+        std::mutex outputMutex;
+
+        TranspositionTable tt;
+        Search search;
+        Position position;
+        EvalParams evalParams;
+        int multiPV = 1;
+        bool statsAfterSearch = false; // Stats option: "info string stats <json>" before every bestmove
+        std::string statsFile;         // StatsFile option: one JSON line appended per search
+        std::mutex statsMutex;
+        SearchStats lastStats;
+
+        std::thread worker;
+        std::mutex holdMutex;
+        std::condition_variable holdChanged;
+        bool holdBestMove = false; // go infinite / go ponder keep bestmove back until stop or ponderhit
+    };
+}
+
+#endif // ENGINE_PROTOCOL_H
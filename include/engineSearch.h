@@ -0,0 +1,147 @@
+#ifndef ENGINE_SEARCH_H
+#define ENGINE_SEARCH_H
+
+#include "engineEval.h"
+#include "engineMoveGen.h"
+#include "engineStats.h"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace engine
+{
+    enum Bound : std::uint8_t
+    {
+        BoundNone = 0,
+        BoundUpper,
+        BoundLower,
+        BoundExact
+    };
+
+    struct TTEntry
+    {
+        std::uint64_t key = 0;
+        Move move;
+        std::int16_t score = 0;
+        std::int8_t depth = -1;
+        std::uint8_t bound = BoundNone;
+    };
+
+    // Always-replace-if-deeper hash table shared by successive searches
+    class TranspositionTable
+    {
+    public:
+        explicit TranspositionTable(std::size_t megabytes = 16);
+
+        void resize(std::size_t megabytes);
+        void clear();
+        // collision, when given, is set if the slot holds a different position
+        bool probe(std::uint64_t key, TTEntry &entry, bool *collision = nullptr) const;
+        void store(std::uint64_t key, const Move &move, int score, int depth, Bound bound);
+        int hashfull() const; // per mille of the first thousand slots in use
+
+    private:
+        std::vector<TTEntry> entries;
+    };
+
+    struct SearchLimits
+    {
+        int depth = 0;            // 0 = no depth limit
+        std::uint64_t nodes = 0;  // 0 = no node limit
+        int moveTime = 0;         // milliseconds, 0 = use the clock
+        int time[2] = {0, 0};     // remaining milliseconds per side
+        int increment[2] = {0, 0};
+        int movesToGo = 0;
+        bool infinite = false;
+        bool ponder = false;
+        int multiPV = 1;
+        std::vector<Move> searchMoves; // restrict the root to these moves, empty = all moves
+    };
+
+    // One reported line of the principal variation
+    struct SearchInfo
+    {
+        int depth = 0;
+        int selDepth = 0;
+        int multiPV = 1;
+        int score = 0;
+        std::uint64_t nodes = 0;
+        int timeMs = 0;
+        int hashfull = 0;
+        std::vector<Move> pv;
+    };
+
+    struct SearchResult
+    {
+        Move best;
+        Move ponder;
+        int score = 0;
+        int depth = 0;
+        std::uint64_t nodes = 0;
+    };
+
+    // Iterative deepening alpha-beta with quiescence, transposition table and killer/history ordering.
+    // A Prowler's extra move keeps the same side to move, so the search only negates scores when the
+    // turn actually passes.
+    class Search
+    {
+    public:
+        using InfoCallback = std::function<void(const SearchInfo &)>;
+
+        explicit Search(TranspositionTable &table);
+
+        SearchResult run(const Position &root, const SearchLimits &limits, const InfoCallback &onInfo = InfoCallback());
+
+        // Safe to call from another thread while run() is in progress. Both requests stay set, even
+        // if they arrive before run() starts, until resetStop() is called ahead of the next search.
+        void stop() { stopRequested.store(true); }
+        void resetStop()
+        {
+            stopRequested.store(false);
+            ponderHitRequested.store(false);
+        }
+        void ponderHit();
+
+        void setEvalParams(const EvalParams &params) { evalParams = params; }
+
+        // Counters of the last (or current) run(); only read them from another thread once run() returned
+        const SearchStats &stats() const { return counters; }
+
+    private:
+        int searchNode(const Position &position, int depth, int alpha, int beta, int ply, bool allowNull);
+        int quiescence(const Position &position, int alpha, int beta, int ply);
+        void orderMoves(const Position &position, MoveList &list, const Move &ttMove, int ply) const;
+        bool shouldStop();
+        bool stopped() const { return limitReached || stopRequested.load(std::memory_order_relaxed); }
+        int elapsedMs() const;
+        void startClock(const Position &root);
+
+        TranspositionTable &tt;
+        EvalParams evalParams;
+        SearchLimits limits;
+        std::atomic<bool> stopRequested;
+        bool limitReached = false; // node or time limit hit inside this search
+        std::atomic<bool> pondering;
+        std::atomic<bool> ponderHitRequested; // a ponder search started after the hit is not pondering
+        std::atomic<std::chrono::steady_clock::rep> startTicks; // reset by ponderHit from another thread
+        int timeBudgetMs = 0;
+        std::uint64_t nodes = 0;
+        int selDepth = 0;
+        SearchStats counters;
+
+        bool skipAtRoot(const Move &move) const;
+
+        std::vector<Move> excludedRootMoves; // lines already reported in multi-PV mode
+        Move killers[MAX_PLY][2];
+        int history[NUM_SQUARES][NUM_SQUARES];
+        Move pvTable[MAX_PLY][MAX_PLY];
+        int pvLength[MAX_PLY];
+    };
+
+    // Converts a search score into the protocol's "cp N" / "mate N" form
+    std::string scoreToString(int score);
+}
+
+#endif // ENGINE_SEARCH_H
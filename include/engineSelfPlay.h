@@ -0,0 +1,37 @@
+#ifndef ENGINE_SELFPLAY_H
+#define ENGINE_SELFPLAY_H
+
+#include "engineSearch.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace engine
+{
+    struct SelfPlayOptions
+    {
+        std::uint64_t nodesPerMove = 2000;
+        int maxPlies = 200;          // adjudicated as a draw after this many moves
+        int randomOpeningPlies = 2;  // random first moves so repeated pairings produce different games
+        int recordEvery = 4;         // keep every n-th position when recording
+    };
+
+    // Plays engine-vs-engine games with a node-limited search on the calling thread.
+    // One SelfPlayer per thread; each owns a small transposition table.
+    class SelfPlayer
+    {
+    public:
+        explicit SelfPlayer(std::size_t hashMegabytes = 1);
+
+        // Returns the result from White's view (1, 0.5 or 0). When positions is given it receives
+        // the notation of sampled positions, ready to be labelled with the result for the tuner.
+        float play(const Position &start, const SelfPlayOptions &options, std::uint32_t seed,
+                   std::vector<std::string> *positions = nullptr);
+
+    private:
+        TranspositionTable tt;
+        Search search;
+    };
+}
+
+#endif // ENGINE_SELFPLAY_H
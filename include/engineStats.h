@@ -0,0 +1,50 @@
+#ifndef ENGINE_STATS_H
+#define ENGINE_STATS_H
+
+#include "engineTypes.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace engine
+{
+    // One completed iterative deepening iteration
+    struct IterationStats
+    {
+        int depth = 0;
+        std::uint64_t nodes = 0; // spent in this iteration alone
+        int timeMs = 0;          // since the search started
+    };
+
+    // Counters of one search. Every Search owns one and bumps plain integers with no
+    // synchronization; searches on several threads are combined afterwards with merge().
+    struct SearchStats
+    {
+        std::uint64_t nodes = 0;            // every node, quiescence included
+        std::uint64_t qnodes = 0;           // quiescence nodes
+        std::uint64_t ttProbes = 0;
+        std::uint64_t ttHits = 0;
+        std::uint64_t ttCollisions = 0;     // slot held by another position
+        std::uint64_t betaCutoffs = 0;
+        std::uint64_t firstMoveCutoffs = 0; // cutoffs by the first move searched, a measure of move ordering
+        std::uint64_t movesSearched = 0;    // moves played in the main search
+        std::uint64_t abilityMoves = 0;     // of which neither a plain move nor a plain capture
+        std::vector<IterationStats> iterations;
+
+        void reset() { *this = SearchStats(); }
+        void merge(const SearchStats &other);
+
+        double ttHitRate() const;
+        double firstMoveCutoffRate() const;
+        double abilityMoveShare() const;
+        // Average growth in nodes per extra ply over the completed iterations, 0 with fewer than two
+        double branchingFactor() const;
+
+        // Single-line JSON object with every counter, the derived rates and the iterations
+        std::string toJson() const;
+    };
+
+    inline bool isAbilityMove(const Move &move) { return move.type != MoveQuiet && move.type != MoveCapture; }
+}
+
+#endif // ENGINE_STATS_H
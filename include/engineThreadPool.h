@@ -0,0 +1,145 @@
+#ifndef ENGINE_THREAD_POOL_H
+#define ENGINE_THREAD_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace engine
+{
+    // Shared flag for stopping a group of tasks; copies refer to the same flag
+    class CancellationToken
+    {
+    public:
+        CancellationToken() : flag(std::make_shared<std::atomic<bool>>(false)) {}
+
+        void cancel() const { flag->store(true, std::memory_order_relaxed); }
+        bool cancelled() const { return flag->load(std::memory_order_relaxed); }
+
+    private:
+        std::shared_ptr<std::atomic<bool>> flag;
+    };
+
+    class TaskGroup;
+
+    // Work-stealing pool. Every worker owns a deque: tasks spawned by a worker go to the back of
+    // its own deque and are popped LIFO, idle workers steal the oldest task from the front of
+    // another deque, and tasks from outside the pool enter through a shared queue.
+    // A thread waiting on a TaskGroup runs queued tasks until the group is done, so nested
+    // fork/join never blocks a worker and the waiting thread counts towards the concurrency.
+    // When there is nothing left to run it sleeps until a task is queued or the group finishes.
+    class ThreadPool
+    {
+    public:
+        // concurrency is the total number of threads running tasks, including the waiting caller,
+        // so concurrency - 1 workers are started. 0 means one per hardware thread.
+        explicit ThreadPool(int concurrency = 0);
+        ~ThreadPool();
+
+        ThreadPool(const ThreadPool &) = delete;
+        ThreadPool &operator=(const ThreadPool &) = delete;
+
+        int concurrency() const { return static_cast<int>(workers.size()) + 1; }
+
+        // Process-wide pool sized to the machine, for subsystems that have no pool of their own
+        static ThreadPool &shared();
+
+    private:
+        friend class TaskGroup;
+
+        struct Task
+        {
+            std::function<void()> work;
+            TaskGroup *group;
+        };
+
+        struct Queue
+        {
+            std::mutex mutex;
+            std::deque<Task> tasks;
+        };
+
+        void push(Task task);
+        bool tryRunOne();
+        void runUntilDone(const std::atomic<int> &outstanding);
+        void groupDone();
+        bool takeTask(Task &task);
+        void workerLoop(int index);
+
+        std::vector<std::unique_ptr<Queue>> queues; // one per worker, then the shared injection queue
+        std::vector<std::thread> workers;
+        std::atomic<int> queued;
+        std::mutex sleepMutex;
+        std::condition_variable wake;
+        bool stopping = false;
+    };
+
+    // Tasks that are waited for together. Tasks of a cancelled group that have not started are
+    // skipped; running tasks can poll token().cancelled(). The first exception thrown by a task
+    // cancels the group and is rethrown by wait().
+    class TaskGroup
+    {
+    public:
+        explicit TaskGroup(ThreadPool &pool, CancellationToken token = CancellationToken());
+        ~TaskGroup();
+
+        TaskGroup(const TaskGroup &) = delete;
+        TaskGroup &operator=(const TaskGroup &) = delete;
+
+        void run(std::function<void()> work);
+        void wait();
+
+        void cancel() { cancellation.cancel(); }
+        const CancellationToken &token() const { return cancellation; }
+
+    private:
+        friend class ThreadPool;
+
+        void execute(ThreadPool::Task &task);
+
+        ThreadPool &pool;
+        CancellationToken cancellation;
+        std::atomic<int> outstanding;
+        std::mutex errorMutex;
+        std::exception_ptr error;
+    };
+
+    // Calls body(begin, end) on disjoint ranges covering [0, count), each at most grain long.
+    // Ranges are split recursively so idle workers steal large halves rather than single items.
+    template <typename Body>
+    void parallelFor(ThreadPool &pool, std::size_t count, std::size_t grain, const Body &body,
+                     CancellationToken token = CancellationToken())
+    {
+        TaskGroup group(pool, token);
+        grain = grain == 0 ? 1 : grain;
+        std::function<void(std::size_t, std::size_t)> split = [&](std::size_t begin, std::size_t end)
+        {
+            while (end - begin > grain && !group.token().cancelled())
+            {
+                std::size_t middle = begin + (end - begin) / 2;
+                group.run([&split, middle, end]()
+                          { split(middle, end); });
+                end = middle;
+            }
+            if (!group.token().cancelled())
+            {
+                body(begin, end);
+            }
+        };
+        if (count > 0)
+        {
+            group.run([&split, count]()
+                      { split(0, count); });
+        }
+        group.wait();
+    }
+}
+
+#endif // ENGINE_THREAD_POOL_H
@@ -0,0 +1,74 @@
+#ifndef ENGINE_TUNE_H
+#define ENGINE_TUNE_H
+
+#include "engineEval.h"
+#include "engineThreadPool.h"
+#include <cstdint>
+#include <functional>
+#include <istream>
+#include <string>
+#include <vector>
+
+namespace engine
+{
+    // Positions reduced to sparse evaluation features, stored flat so millions fit in memory
+    struct TuningSet
+    {
+        std::vector<std::uint32_t> offsets = {0}; // features of position i are [offsets[i], offsets[i + 1])
+        std::vector<EvalFeature> features;
+        std::vector<float> results; // game result from White's view: 1, 0.5 or 0
+
+        std::size_t size() const { return results.size(); }
+        void add(const std::vector<EvalFeature> &positionFeatures, float result);
+        void append(const TuningSet &other);
+    };
+
+    // Parses one record "<position notation> ; <result>" where result is 1-0, 0-1, 1/2-1/2 or a number
+    bool parseRecord(const std::string &line, Position &position, float &result);
+
+    // Streams records from input, extracting features on the pool's threads
+    TuningSet loadTuningSet(std::istream &input, std::size_t &skipped, ThreadPool &pool = ThreadPool::shared());
+
+    struct TunerOptions
+    {
+        int epochs = 400;
+        double learningRate = 2.0; // Adam step size in centipawns
+        double scaling = 0.0;      // logistic scale K, 0 = fit it to the starting weights
+    };
+
+    // Texel-style tuning: minimises the squared error between the game result and
+    // sigmoid(K * eval / 400) with full-batch Adam, the gradient summed over the pool's threads
+    class Tuner
+    {
+    public:
+        using ProgressCallback = std::function<void(int epoch, double loss)>;
+
+        Tuner(const TuningSet &set, const TunerOptions &options, ThreadPool &pool = ThreadPool::shared());
+
+        double fitScaling(const EvalParams &params);
+        double loss(const std::vector<double> &weights) const;
+        EvalParams run(const EvalParams &start, const ProgressCallback &onProgress = ProgressCallback());
+
+        double scaling() const { return scale; }
+
+    private:
+        double accumulate(const std::vector<double> &weights, std::vector<double> *gradient) const;
+
+        const TuningSet &data;
+        TunerOptions options;
+        ThreadPool &pool;
+        double scale;
+    };
+
+    struct GemstoneSuggestion
+    {
+        Kind kind;
+        int current;   // price in the army menus
+        int suggested; // from the tuned material gain over the standard piece
+    };
+
+    // Suggested army menu prices for every race piece under params
+    std::vector<GemstoneSuggestion> suggestGemstoneCosts(const EvalParams &params);
+}
+
+#endif // ENGINE_TUNE_H
@@ -0,0 +1,190 @@
+#ifndef ENGINE_TYPES_H
+#define ENGINE_TYPES_H
+
+#include "engineGeometry.h"
+#include <cstdint>
+#include <string>
+
+// Headless rules core shared by the engine binary and the tools built on it.
+// Nothing in the engine namespace depends on SFML.
+namespace engine
+{
+    // The standard 8x8 board every search, evaluation and GUI path plays on; the rules core
+    // (positions, attack tables, move generation) also instantiates Board10 and Board12
+    using Bitboard = Board8::Mask;
+
+    constexpr int BOARD_DIM = Board8::dim;
+    constexpr int NUM_SQUARES = Board8::squares;
+
+    // Square index is row * BOARD_DIM + col, row 0 being White's back rank (top of the GUI board)
+    constexpr int rowOf(int sq) { return Board8::rowOf(sq); }
+    constexpr int colOf(int sq) { return Board8::colOf(sq); }
+    constexpr int makeSquare(int row, int col) { return Board8::makeSquare(row, col); }
+    constexpr bool onBoard(int row, int col) { return Board8::onBoard(row, col); }
+    constexpr Bitboard squareBit(int sq) { return Bitboard(1) << sq; }
+
+    enum Side : std::uint8_t
+    {
+        White = 0,
+        Black = 1
+    };
+
+    inline Side opponent(Side side) { return side == White ? Black : White; }
+
+    // Races as chosen in chooseRaceMenu; Standard holds the classic chess pieces.
+    // Custom has no GUI menu and exists for prototyping pieces in the engine tools.
+    enum Race : std::uint8_t
+    {
+        Standard = 0,
+        Necro,
+        WizardRace,
+        Beast,
+        Hell,
+        Custom, // free slots for pieces defined in a piece file (enginePieces.h)
+        RaceCount
+    };
+
+    // The six base slots every army fills (pawn, knight, bishop, rook, queen, king)
+    enum Base : std::uint8_t
+    {
+        PawnBase = 0,
+        KnightBase,
+        BishopBase,
+        RookBase,
+        QueenBase,
+        KingBase,
+        BaseCount
+    };
+
+    // Piece kinds, ordered race-major so that kind = race * BaseCount + base
+    enum Kind : std::uint8_t
+    {
+        Pawn = 0,
+        Knight,
+        Bishop,
+        Rook,
+        Queen,
+        King,
+        NecroPawn,
+        GhostKnight,
+        Necromancer,
+        DeadLauncher,
+        QueenOfBones,
+        GhoulKing,
+        YoungWiz,
+        Familiar,
+        Wizard,
+        Portal,
+        QueenOfIllusions,
+        WizardKing,
+        PawnHopper,
+        BeastKnight,
+        BeastDruid,
+        BoulderThrower,
+        QueenOfDomination,
+        FrogKing,
+        HellPawn,
+        Prowler,
+        Howler,
+        Beholder,
+        QueenOfDestruction,
+        HellKing,
+        CustomPawn,
+        CustomKnight,
+        CustomBishop,
+        CustomRook,
+        CustomQueen,
+        CustomKing,
+        KindCount,
+        NoKind = 0xFF
+    };
+
+    inline Base baseOf(Kind kind) { return static_cast<Base>(kind % BaseCount); }
+    inline Race raceOf(Kind kind) { return static_cast<Race>(kind / BaseCount); }
+    inline Kind makeKind(Race race, Base base) { return static_cast<Kind>(race * BaseCount + base); }
+
+    // Per-piece state flags
+    enum PieceFlag : std::uint16_t
+    {
+        FlagStunned = 1 << 0,       // GhostKnight stun, cannot act on its owner's next turn
+        FlagStone = 1 << 1,         // Familiar turned to stone, cannot be captured
+        FlagLoaded = 1 << 2,        // DeadLauncher carries a pawn
+        FlagAbilityUsed = 1 << 3,   // GhoulKing raised its NecroPawn / QueenOfDomination used its ability
+        FlagDominated = 1 << 4,     // Piece temporarily turned into a Queen by a QueenOfDomination
+        FlagDominationNew = 1 << 5, // Domination applied this turn, survives the owner's next move
+        FlagHowlerRook = 1 << 8,    // Howler ability families gained by capturing
+        FlagHowlerKnight = 1 << 9,
+        FlagHowlerPawn = 1 << 10,
+        FlagHowlerQueen = 1 << 11,
+        FlagHowlerKing = 1 << 12
+    };
+
+    // The Howler family flags as one index: (flags & FlagHowlerFamilies) >> HowlerFamilyShift
+    constexpr std::uint16_t FlagHowlerFamilies = FlagHowlerRook | FlagHowlerKnight | FlagHowlerPawn | FlagHowlerQueen | FlagHowlerKing;
+    constexpr int HowlerFamilyShift = 8;
+    constexpr int HowlerFamilySets = (FlagHowlerFamilies >> HowlerFamilyShift) + 1;
+
+    // Off-board pieces a side holds. Each slot belongs to one ability, so the slot index is a stable
+    // handle that moves, the hash and the notation name directly
+    enum ReserveSlot : std::uint8_t
+    {
+        PortalReserve = 0, // the piece inside the side's Portals, shared by all of them
+        ReserveSlots
+    };
+
+    enum MoveType : std::uint8_t
+    {
+        MoveQuiet = 0,   // Move to an empty square
+        MoveCapture,     // Capture by moving onto the target (Necromancer may place a pawn on extra)
+        MoveRanged,      // Capture without moving (BoulderThrower, Beholder, Wizard, loaded DeadLauncher...)
+        MoveHop,         // PawnHopper double step capturing the hopped piece
+        MoveInfect,      // HellPawn converts the captured non-pawn piece
+        MoveSacrifice,   // NecroPawn removes itself and every neighbour
+        MoveStone,       // Familiar turns to stone
+        MoveRaise,       // GhoulKing places a NecroPawn on extra
+        MoveLoad,        // DeadLauncher loads the friendly pawn on to
+        MoveSwap,        // QueenOfIllusions swaps with the friendly pawn on to
+        MoveDominate,    // QueenOfDomination turns the adjacent friendly piece on to into a Queen
+        MovePortalEnter, // The friendly piece on to goes into the Portal reserve
+        MovePortalExit,  // The reserve piece comes out of the Portal on extra
+        MovePass         // Prowler declines its additional move
+    };
+
+    struct Move
+    {
+        std::uint8_t from = NO_SQUARE;
+        std::uint8_t to = NO_SQUARE;
+        std::uint8_t extra = NO_SQUARE;
+        std::uint8_t type = MoveQuiet;
+
+        Move() = default;
+        Move(int f, int t, MoveType mt, int e = NO_SQUARE)
+            : from(static_cast<std::uint8_t>(f)), to(static_cast<std::uint8_t>(t)),
+              extra(static_cast<std::uint8_t>(e)), type(mt) {}
+
+        bool isNull() const { return from == NO_SQUARE; }
+        bool isCapture() const { return type == MoveCapture || type == MoveRanged || type == MoveHop || type == MoveInfect; }
+        bool operator==(const Move &other) const
+        {
+            return from == other.from && to == other.to && extra == other.extra && type == other.type;
+        }
+        bool operator!=(const Move &other) const { return !(*this == other); }
+    };
+
+    // Scores are centipawns from the side to move's point of view
+    constexpr int SCORE_INFINITE = 32000;
+    constexpr int SCORE_MATE = 31000;
+    constexpr int MAX_PLY = 128;
+
+    inline bool isMateScore(int score) { return score > SCORE_MATE - MAX_PLY || score < -SCORE_MATE + MAX_PLY; }
+
+    // Square names run a..l and 1..12 on the larger boards
+    template <typename Geometry = Board8>
+    std::string squareToString(int sq);
+    template <typename Geometry = Board8>
+    int squareFromString(const std::string &text, std::size_t &pos);
+    std::string kindName(Kind kind);
+    Kind kindFromName(const std::string &name);
+}
+
+#endif // ENGINE_TYPES_H
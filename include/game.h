@@ -6,13 +6,16 @@
 #include <vector>
 #include <memory>
 #include "piece.h"
-#include "square.h"
+#include "board.h"
 #include "necromancer.h"
+#include "assetLoader.h"
 
 class Game
 {
 public:
-    void runChessGame(sf::RenderWindow &window, std::unique_ptr<sf::TcpSocket> &socket);
+    // Plays one game as playerColor; the game's IDs and settings live in its own GameContext, the textures and
+    // font come from assets and are shared by every game
+    void runChessGame(sf::RenderWindow &window, std::unique_ptr<sf::TcpSocket> &socket, Piece::Color playerColor, AssetLoader &assets);
 };
 
 #endif
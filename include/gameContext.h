@@ -0,0 +1,47 @@
+#ifndef GAME_CONTEXT_H
+#define GAME_CONTEXT_H
+
+#include "piece.h"
+#include "piecePool.h"
+#include "textureManager.h"
+#include <algorithm>
+
+// Settings of one game
+struct GameSettings
+{
+    int engineMoveTimeMs = 2000; // pondered reply to the opponent's move
+    int hintTimeMs = 1500;       // hint search for the selected piece
+    unsigned int frameRateLimit = 60;
+    std::size_t piecePoolCapacity = PiecePool::DefaultCapacity;
+};
+
+// Everything one game used to keep in globals: which side the local player has, the piece ID counter, the
+// textures pieces are created with and the game's settings. Passed to whatever creates pieces or needs the
+// player's side, so several games can run in one process, each on its own thread.
+class GameContext
+{
+public:
+    // The textures are only read, so one loaded TextureManager can serve every game
+    GameContext(TextureManager &textures, Piece::Color playerColor, const GameSettings &settings = GameSettings());
+    GameContext(const GameContext &) = delete;
+    GameContext &operator=(const GameContext &) = delete;
+
+    // IDs count up from 0 in every game, so both players and a replay of the game hand out the same IDs
+    int nextId() { return nextPieceId++; }
+    // Moves the counter past an ID the opponent handed out, so no local piece is given it as well
+    void observeId(int id) { nextPieceId = std::max(nextPieceId, id + 1); }
+
+    Piece::Color getPlayerColor() const { return playerColor; }
+    bool isPlayerWhite() const { return playerColor == Piece::Color::White; }
+
+    TextureManager &getTextures() const { return textures; }
+    const GameSettings &getSettings() const { return settings; }
+
+private:
+    TextureManager &textures;
+    Piece::Color playerColor;
+    GameSettings settings;
+    int nextPieceId = 0;
+};
+
+#endif // GAME_CONTEXT_H
@@ -2,6 +2,7 @@
 #define GHOSTKNIGHT_H
 
 #include "piece.h"
+#include "effectScheduler.h"
 
 class GhostKnight : public Piece
 {
@@ -11,9 +12,9 @@ public:
 
     bool canMoveTo(const sf::Vector2f &target, const std::vector<std::unique_ptr<Piece>> &pieces) const override;
 
-    void highlightValidMoves(std::vector<std::vector<Square>> &board, const std::vector<std::unique_ptr<Piece>> &pieces) const override;
+    void highlightValidMoves(Board &board, const std::vector<std::unique_ptr<Piece>> &pieces) const override;
 
-    void stunAdjacentEnemies(const sf::Vector2f &position, std::vector<std::unique_ptr<Piece>> &pieces, std::vector<std::vector<Square>> &board); // Stun adjacent enemies
+    void stunAdjacentEnemies(const sf::Vector2f &position, std::vector<std::unique_ptr<Piece>> &pieces, EffectScheduler &effects); // Stun adjacent enemies
 
     std::string getType() const override { return "GhostKnight"; }
 
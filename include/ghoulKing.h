@@ -12,13 +12,13 @@ public:
 
     bool canMoveTo(const sf::Vector2f &target, const std::vector<std::unique_ptr<Piece>> &pieces) const override;
 
-    void highlightValidMoves(std::vector<std::vector<Square>> &board, const std::vector<std::unique_ptr<Piece>> &pieces) const override;
+    void highlightValidMoves(Board &board, const std::vector<std::unique_ptr<Piece>> &pieces) const override;
 
     std::vector<sf::Vector2f> getPerimeterPositions(const sf::Vector2f &position) const;
 
     sf::Texture &getNecroPawnTexture(TextureManager &textureManager) const;
 
-    bool raiseNecroPawn(const sf::Vector2f &targetPosition, std::vector<std::vector<Square>> &board, std::vector<std::unique_ptr<Piece>> &pieces, TextureManager &textureManager);
+    bool raiseNecroPawn(const sf::Vector2f &targetPosition, Board &board, std::vector<std::unique_ptr<Piece>> &pieces, TextureManager &textureManager);
 
     std::string getType() const override { return "GhoulKing"; }
 
@@ -4,75 +4,15 @@
 
 #include <SFML/Graphics.hpp>
 
-extern const int BOARD_SIZE;
-extern const int TILE_SIZE;
-extern const int WINDOW_WIDTH;
-extern const int BUTTON_SIZE;
-extern const int BUTTON_SPACING;
-extern bool isPlayerWhite;
+// Compile-time so every pixel/tile conversion folds to constant arithmetic
+constexpr int BOARD_SIZE = 8;
+constexpr int TILE_SIZE = 80;
+constexpr int WINDOW_WIDTH = BOARD_SIZE * TILE_SIZE;
+constexpr int BUTTON_SIZE = 50;
+constexpr int BUTTON_SPACING = 10;
 
-// iterator
-extern int currentID;
-int getNextID();
+// Column or row of a piece's pixel coordinate. Pieces sit on tile corners, so truncating
+// first gives the same index as dividing the float
+constexpr int tileIndex(float pixels) { return static_cast<int>(pixels) / TILE_SIZE; }
 
-extern sf::Texture whiteRookTexture;
-extern sf::Texture blackRookTexture;
-extern sf::Texture whitePawnTexture;
-extern sf::Texture blackPawnTexture;
-extern sf::Texture whiteKingTexture;
-extern sf::Texture blackKingTexture;
-extern sf::Texture whiteQueenTexture;
-extern sf::Texture blackQueenTexture;
-extern sf::Texture whiteBishopTexture;
-extern sf::Texture blackBishopTexture;
-extern sf::Texture whiteKnightTexture;
-extern sf::Texture blackKnightTexture;
-extern sf::Texture whiteWizardTexture;
-extern sf::Texture blackWizardTexture;
-extern sf::Texture whiteNecromancerTexture;
-extern sf::Texture blackNecromancerTexture;
-extern sf::Texture whiteNecroPawnTexture;
-extern sf::Texture blackNecroPawnTexture;
-extern sf::Texture whiteBeastKnightTexture;
-extern sf::Texture blackBeastKnightTexture;
-extern sf::Texture blackBoulderThrowerTexture;
-extern sf::Texture whiteBoulderThrowerTexture;
-extern sf::Texture blackHowlerTexture;
-extern sf::Texture whiteHowlerTexture;
-extern sf::Texture blackProwlerTexture;
-extern sf::Texture whiteProwlerTexture;
-extern sf::Texture blackHellPawnTexture;
-extern sf::Texture whiteHellPawnTexture;
-extern sf::Texture blackYoungWizTexture;
-extern sf::Texture whiteYoungWizTexture;
-extern sf::Texture blackPawnHopperTexture;
-extern sf::Texture whitePawnHopperTexture;
-extern sf::Texture blackBeastDruidTexture;
-extern sf::Texture whiteBeastDruidTexture;
-extern sf::Texture blackGhostKnightTexture;
-extern sf::Texture whiteGhostKnightTexture;
-extern sf::Texture blackFamiliarTexture;
-extern sf::Texture whiteFamiliarTexture;
-extern sf::Texture blackDeadLauncherTexture;
-extern sf::Texture whiteDeadLauncherTexture;
-extern sf::Texture blackPortalTexture;
-extern sf::Texture whitePortalTexture;
-extern sf::Texture blackBeholderTexture;
-extern sf::Texture whiteBeholderTexture;
-extern sf::Texture blackQueenOfIllusionsTexture;
-extern sf::Texture whiteQueenOfIllusionsTexture;
-extern sf::Texture blackQueenOfBonesTexture;
-extern sf::Texture whiteQueenOfBonesTexture;
-extern sf::Texture blackQueenOfDominationTexture;
-extern sf::Texture whiteQueenOfDominationTexture;
-extern sf::Texture blackQueenOfDestructionTexture;
-extern sf::Texture whiteQueenOfDestructionTexture;
-extern sf::Texture whiteWizardKingTexture;
-extern sf::Texture blackWizardKingTexture;
-extern sf::Texture whiteGhoulKingTexture;
-extern sf::Texture blackGhoulKingTexture;
-extern sf::Texture whiteFrogKingTexture;
-extern sf::Texture blackFrogKingTexture;
-extern sf::Texture whiteHellKingTexture;
-extern sf::Texture blackHellKingTexture;
 #endif // GLOBALS_H
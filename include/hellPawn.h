@@ -2,19 +2,19 @@
 #define HELLPAWN_H
 
 #include "piece.h"
-#include "textureManager.h"
+#include "gameContext.h"
 
 class HellPawn : public Piece
 {
 public:
     HellPawn(int id, sf::Texture &texture, const sf::Vector2f &initialPosition, Color color)
-        : Piece(id, texture, initialPosition, color) {}
+        : Piece(id, texture, initialPosition, color), toBeRemoved(false) {}
 
     bool canMoveTo(const sf::Vector2f &target, const std::vector<std::unique_ptr<Piece>> &pieces) const override;
 
-    void highlightValidMoves(std::vector<std::vector<Square>> &board, const std::vector<std::unique_ptr<Piece>> &pieces) const override;
+    void highlightValidMoves(Board &board, const std::vector<std::unique_ptr<Piece>> &pieces) const override;
 
-    void infect(const Piece *capturingPiece, std::vector<std::unique_ptr<Piece>> &pieces, std::vector<std::vector<Square>> &board, TextureManager &textureManager);
+    void infect(const Piece *capturingPiece, std::vector<std::unique_ptr<Piece>> &pieces, Board &board, GameContext &context);
 
     std::string getType() const override { return "HellPawn"; }
 
@@ -48,7 +48,7 @@ public:
     sf::Texture &getHellKingTexture() const;
     sf::Texture &getWizardKingTexture() const;
 
-    bool toBeRemoved; // Flag to indicate whether this HellPawn should be removed after capture
+    bool toBeRemoved; // Set by infect; the game schedules the HellPawn's removal at the end of the turn
 };
 
 #endif // HELLPAWN_H
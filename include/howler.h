@@ -1,58 +1,60 @@
 #ifndef HOWLER_H
 #define HOWLER_H
 
-#include "bishop.h"
-#include <unordered_set>
-#include <functional>
+#include "piece.h"
+#include <cstdint>
 
 class Howler : public Piece
 {
 public:
+    // Movement families the Howler holds; the order of the captured families matches the engine's
+    // FlagHowler* bits so the bridge can shift them across
+    enum Family : std::uint8_t
+    {
+        RookFamily = 1 << 0,
+        KnightFamily = 1 << 1,
+        PawnFamily = 1 << 2,
+        QueenFamily = 1 << 3,
+        KingFamily = 1 << 4,
+        BishopFamily = 1 << 5
+    };
+
     Howler(int id, sf::Texture &texture, const sf::Vector2f &initialPosition, Color color)
         : Piece(id, texture, initialPosition, color),
-          bishopAbilities(false),
-          rookAbilities(false),
-          knightAbilities(false),
-          pawnAbilities(false),
-          queenAbilities(false),
-          kingAbilities(false)
+          families(0)
     {
         gainInitialAbilities();
     }
 
     bool canMoveTo(const sf::Vector2f &target, const std::vector<std::unique_ptr<Piece>> &pieces) const override;
-    void highlightValidMoves(std::vector<std::vector<Square>> &board, const std::vector<std::unique_ptr<Piece>> &pieces) const override;
+    void highlightValidMoves(Board &board, const std::vector<std::unique_ptr<Piece>> &pieces) const override;
 
     void capture(const sf::Vector2f &target, std::vector<std::unique_ptr<Piece>> &pieces) override;
 
     std::string getType() const override { return "Howler"; }
 
+    // Abilities are plain bits, so a copy moves exactly like the original
     std::unique_ptr<Piece> clone() const override
     {
         return std::make_unique<Howler>(*this);
     }
 
-    bool bishopAbilities;
-    bool rookAbilities;
-    bool knightAbilities;
-    bool pawnAbilities;
-    bool queenAbilities;
-    bool kingAbilities;
+    bool hasFamily(Family family) const { return (families & family) != 0; }
+    std::uint8_t getFamilies() const { return families; }
+    // Replaces the captured families, e.g. with those of an engine position; the starting Bishop family is kept
+    void setFamilies(std::uint8_t value) { families = value | BishopFamily; }
 
 private:
-    std::vector<std::function<bool(const sf::Vector2f &, const std::vector<std::unique_ptr<Piece>> &)>> movementAbilities;
-    std::vector<std::function<void(std::vector<std::vector<Square>> &, const std::vector<std::unique_ptr<Piece>> &)>> highlightAbilities;
-    std::vector<std::function<void(const sf::Vector2f &, std::vector<std::unique_ptr<Piece>> &)>> captureAbilities;
+    std::uint8_t families;
+
+    // Squares the Howler can move to or capture on, one bit per square (row * BOARD_SIZE + col);
+    // enemy receives the squares holding opponent pieces
+    std::uint64_t moveTargets(const std::vector<std::unique_ptr<Piece>> &pieces, std::uint64_t &enemy) const;
 
     void gainInitialAbilities();
-    void gainBishopAbilities();
-    void gainRookAbilities();
-    void gainKnightAbilities();
-    void gainPawnAbilities();
-    void gainQueenAbilities();
-    void gainKingAbilities();
+    void gainFamily(Family family);
 
     void gainAbilitiesFromCapturedPiece(const Piece &capturedPiece);
 };
 
-#endif // HOWLER_H
\ No newline at end of file
+#endif // HOWLER_H
@@ -4,7 +4,7 @@
 #include <SFML/Graphics.hpp>
 
 void chooseRaceMenu(sf::RenderWindow &window, sf::Font &font, bool &inRaceMenu);
-void showMainMenu(sf::RenderWindow &window, sf::Font &font, bool &inMainMenu);
+void showMainMenu(sf::RenderWindow &window, sf::Font &font, const sf::Texture &backgroundTexture, bool &inMainMenu);
 void necroArmyMenu(sf::RenderWindow &window, sf::Font &font, bool &inBuildMenu);
 
 #endif
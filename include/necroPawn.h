@@ -2,6 +2,7 @@
 #define NECROPAWN_H
 
 #include "piece.h"
+#include "areaEffect.h"
 
 class NecroPawn : public Piece
 {
@@ -11,9 +12,10 @@ public:
 
     bool canMoveTo(const sf::Vector2f &target, const std::vector<std::unique_ptr<Piece>> &pieces) const override;
 
-    void sacrifice(std::vector<std::unique_ptr<Piece>> &pieces);
+    // Captures itself and every piece around it; the NecroPawn is destroyed by the time this returns
+    void sacrifice(std::vector<std::unique_ptr<Piece>> &pieces, const AreaEffect::QueenOfBonesFallen &onQueenOfBonesFallen);
 
-    void highlightValidMoves(std::vector<std::vector<Square>> &board, const std::vector<std::unique_ptr<Piece>> &pieces) const override;
+    void highlightValidMoves(Board &board, const std::vector<std::unique_ptr<Piece>> &pieces) const override;
 
     std::string getType() const override { return "NecroPawn"; }
 
@@ -21,8 +23,6 @@ public:
     {
         return std::make_unique<NecroPawn>(*this);
     }
-
-    std::vector<sf::Vector2f> getCapturePositions() const;
 };
 
 #endif // NECROPAWN_H
@@ -13,9 +13,9 @@ public:
 
     bool canMoveTo(const sf::Vector2f &target, const std::vector<std::unique_ptr<Piece>> &pieces) const override;
 
-    void highlightValidMoves(std::vector<std::vector<Square>> &board, const std::vector<std::unique_ptr<Piece>> &pieces) const override;
+    void highlightValidMoves(Board &board, const std::vector<std::unique_ptr<Piece>> &pieces) const override;
 
-    bool raiseDead(const sf::Vector2f &targetPosition, std::vector<std::vector<Square>> &board, std::vector<std::unique_ptr<Piece>> &pieces, TextureManager &textureManager);
+    bool raiseDead(const sf::Vector2f &targetPosition, Board &board, std::vector<std::unique_ptr<Piece>> &pieces, TextureManager &textureManager);
 
     std::string getType() const override { return "Necromancer"; }
 
@@ -1,6 +1,7 @@
 #ifndef NETWORK_H
 #define NETWORK_H
 
+#include "gameContext.h"
 #include "piece.h"
 #include <SFML/Network.hpp>
 #include <SFML/Graphics.hpp>
@@ -15,9 +16,13 @@ struct PieceData
 sf::Packet &operator<<(sf::Packet &packet, const PieceData &data);
 sf::Packet &operator>>(sf::Packet &packet, PieceData &data);
 
-std::unique_ptr<sf::TcpSocket> initialConnect();
+// The server plays White, the client Black; playerColor is set to the side this process plays
+std::unique_ptr<sf::TcpSocket> initialConnect(Piece::Color &playerColor);
 
-void sendPacket(std::unique_ptr<sf::TcpSocket> &socket, const std::vector<std::unique_ptr<Piece>> &currentPack);
-void receivePacket(std::unique_ptr<sf::TcpSocket> &socket, std::vector<std::unique_ptr<Piece>> &currentPack, TextureManager &textureManager, Piece::Color color);
+// turnComplete is false for a move that leaves the sender on turn, such as the first of a Prowler's two moves
+void sendPacket(std::unique_ptr<sf::TcpSocket> &socket, const std::vector<std::unique_ptr<Piece>> &currentPack, bool turnComplete);
+// Returns true when a packet arrived and currentPack was updated from it; the received IDs are passed
+// to context.observeId so locally created pieces never reuse them, and turnComplete receives the sender's flag
+bool receivePacket(std::unique_ptr<sf::TcpSocket> &socket, std::vector<std::unique_ptr<Piece>> &currentPack, GameContext &context, Piece::Color color, bool &turnComplete);
 
 #endif
\ No newline at end of file
@@ -0,0 +1,35 @@
+#ifndef PENDING_ACTION_H
+#define PENDING_ACTION_H
+
+#include "piecePool.h"
+
+// A multi-click ability the game loop is waiting on. While one is active the next click on the board goes to it
+// instead of selecting a piece and the turn is not handed over; the loop keeps receiving packets and drawing
+// frames in the meantime, so nothing waits on a nested event loop.
+struct PendingAction
+{
+    enum class Kind
+    {
+        None,
+        NecromancerPawn,    // square for the pawn a Necromancer raises after its capture
+        GhoulKingNecroPawn, // square for the NecroPawn a GhoulKing raises
+        PortalUnload,       // square the reserve piece leaves the Portal on
+        DominationTarget,   // friendly piece the QueenOfDomination turns into a Queen
+        QueenOfBonesRevival // two pawns to sacrifice for a fallen QueenOfBones, or her square to decline
+    };
+
+    Kind kind = Kind::None;
+
+    // The piece using its ability; resolves to nullptr once it has left the board
+    PiecePool::Handle actor;
+
+    bool isActive() const { return kind != Kind::None; }
+    void start(Kind pendingKind, PiecePool::Handle pendingActor = PiecePool::Handle())
+    {
+        kind = pendingKind;
+        actor = pendingActor;
+    }
+    void clear() { *this = PendingAction(); }
+};
+
+#endif // PENDING_ACTION_H
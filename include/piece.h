@@ -10,7 +10,9 @@
 #include <SFML/Graphics.hpp>
 #include <vector>
 #include <memory>
-#include "square.h"
+#include "board.h"
+
+class PieceTable;
 
 class Piece
 {
@@ -35,8 +37,12 @@ public:
                 this->getColor() != other.getColor());
     }
 
-    // Virtual destructor to ensure proper cleanup of derived classes.
-    virtual ~Piece() = default;
+    // Virtual destructor to ensure proper cleanup of derived classes. Drops the piece from the PieceTable it reports to.
+    virtual ~Piece();
+
+    // Every piece, whichever path creates it, takes a slot from the running game's PiecePool (piecePool.cpp).
+    static void *operator new(std::size_t size);
+    static void operator delete(void *memory) noexcept;
     virtual std::unique_ptr<Piece> clone() const = 0;
 
     // Virtual function to get the type of the piece.
@@ -53,6 +59,7 @@ public:
     {
         position = pos;
         sprite.setPosition(position);
+        reportChange();
     }
 
     // Returns the current position of the piece.
@@ -62,7 +69,11 @@ public:
     Color getColor() const { return color; }
 
     // Sets the color of the piece.
-    void setColor(Color newColor) { color = newColor; }
+    void setColor(Color newColor)
+    {
+        color = newColor;
+        reportChange();
+    }
 
     void print(std::ostream &os) const
     {
@@ -88,7 +99,10 @@ public:
     virtual bool canMoveTo(const sf::Vector2f &target, const std::vector<std::unique_ptr<Piece>> &pieces) const = 0;
 
     // Virtual function to highlight all valid moves for the piece on the chessboard. Must be implemented by derived classes.
-    virtual void highlightValidMoves(std::vector<std::vector<Square>> &board, const std::vector<std::unique_ptr<Piece>> &pieces) const = 0;
+    virtual void highlightValidMoves(Board &board, const std::vector<std::unique_ptr<Piece>> &pieces) const = 0;
+
+    // Highlights the captures the piece makes without moving into the square (ranged and launched captures); most pieces have none.
+    virtual void highlightCaptureZones(Board & /*board*/, const std::vector<std::unique_ptr<Piece>> & /*pieces*/) const {}
 
     // Moves the piece to the target position and removes any opponent piece at that position. Updates the position of the capturing piece.
     virtual void capture(const sf::Vector2f &target, std::vector<std::unique_ptr<Piece>> &pieces)
@@ -105,9 +119,17 @@ public:
     }
 
     bool isStunned() const { return stunned; }
-    void setStunned(bool value) { stunned = value; }
+    void setStunned(bool value)
+    {
+        stunned = value;
+        reportChange();
+    }
     bool isStone() const { return stone; }
-    void setStone(bool value) { stone = value; }
+    void setStone(bool value)
+    {
+        stone = value;
+        reportChange();
+    }
 
 protected:
     sf::Texture texture;
@@ -117,6 +139,24 @@ protected:
     bool stunned = false;
     bool stone = false;
     int id;
+
+private:
+    friend class PieceTable;
+
+    // The PieceTable row the piece reports to, set when an installed table reads it; a clone starts without one
+    struct TableRow
+    {
+        PieceTable *table = nullptr;
+        std::size_t row = 0;
+
+        TableRow() = default;
+        TableRow(const TableRow &) {}
+        TableRow &operator=(const TableRow &) { return *this; }
+    };
+    TableRow tableRow;
+
+    // Passes a change of square, colour or flags on to the PieceTable row
+    void reportChange() const;
 };
 
 // Declare operator<< for Piece outside the class
@@ -0,0 +1,87 @@
+#ifndef PIECE_POOL_H
+#define PIECE_POOL_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+class Piece;
+
+// Storage for the pieces of one game. Piece::operator new takes a slot from the installed pool, so every
+// std::make_unique of a piece (spawns, conversions, domination swaps, respawns, clones) reuses memory freed by
+// earlier captures instead of going to the heap. A full pool adds another block of slots, so every piece of the
+// game has a handle. Each slot starts with a header naming its pool, which Piece::operator delete frees it to.
+class PiecePool
+{
+public:
+    static constexpr std::uint32_t NoSlot = 0xFFFFFFFF;
+    static constexpr std::size_t DefaultCapacity = 256; // slots per block
+
+    // Names a piece by slot and generation; the generation changes whenever the slot is freed, so a handle
+    // to a captured piece never resolves to whatever was allocated in its place
+    struct Handle
+    {
+        std::uint32_t slot = NoSlot;
+        std::uint32_t generation = 0;
+
+        bool operator==(const Handle &other) const { return slot == other.slot && generation == other.generation; }
+        bool operator!=(const Handle &other) const { return !(*this == other); }
+    };
+
+    struct Counters
+    {
+        std::size_t allocations = 0; // pieces placed in a slot
+        std::size_t releases = 0;    // slots handed back
+        std::size_t live = 0;        // slots in use now
+        std::size_t peak = 0;        // most slots in use at once
+        std::size_t blocks = 0;      // blocks of slots allocated, the first included
+    };
+
+    // capacity is the number of slots in each block
+    explicit PiecePool(std::size_t capacity = DefaultCapacity);
+    PiecePool(const PiecePool &) = delete;
+    PiecePool &operator=(const PiecePool &) = delete;
+
+    // nullptr when size does not fit a slot, which only a piece class missing from the slot size can ask for
+    void *allocate(std::size_t size);
+
+    // memory is a piece from Piece::operator new; false when it belongs to another pool or to the heap
+    bool release(void *memory);
+
+    // Handle of a piece in this pool; a piece of another pool or of the heap gets a handle with NoSlot
+    Handle handleOf(const Piece *piece) const;
+
+    // The piece the handle was taken from, or nullptr once it has been destroyed
+    Piece *resolve(Handle handle) const;
+
+    const Counters &getCounters() const { return counters; }
+
+    // Pool Piece::operator new allocates from on this thread, nullptr when pieces go to the heap
+    static PiecePool *current();
+
+    // Installs a pool for its own lifetime. Declare it before the pieces, so they are gone when it ends.
+    class Scope
+    {
+    public:
+        explicit Scope(PiecePool &pool);
+        ~Scope();
+        Scope(const Scope &) = delete;
+        Scope &operator=(const Scope &) = delete;
+
+    private:
+        PiecePool *previous;
+    };
+
+private:
+    std::size_t blockSlots;
+    std::vector<std::unique_ptr<std::max_align_t[]>> blocks; // never moved, so pieces keep their address
+    std::vector<std::uint32_t> generations;                  // odd while the slot holds a piece
+    std::vector<std::uint32_t> freeSlots;                    // taken from the back, so a freed slot is reused first
+    Counters counters;
+
+    void grow();
+    unsigned char *slotAddress(std::uint32_t slot) const;
+};
+
+#endif // PIECE_POOL_H
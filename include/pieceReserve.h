@@ -0,0 +1,34 @@
+#ifndef PIECE_RESERVE_H
+#define PIECE_RESERVE_H
+
+#include "piece.h"
+#include "engineTypes.h"
+#include <array>
+#include <memory>
+
+// Pieces the sides hold off the board, laid out like the engine's reserve: one slot per ReserveSlot and side.
+// The reserve owns what it holds, and abilities refer to their slot by Handle rather than by pointer, so every
+// Portal of a side sees the same piece and a cloned Portal never shares or leaks it.
+class PieceReserve
+{
+public:
+    // Stable for the whole game: slot * 2 + side, White first
+    using Handle = int;
+    static constexpr Handle NoHandle = -1;
+
+    static Handle handleFor(engine::ReserveSlot slot, Piece::Color color);
+
+    // Takes the piece into an empty slot; a full slot leaves the piece with the caller and returns false
+    bool store(Handle handle, std::unique_ptr<Piece> &piece);
+
+    // Gives the piece back to the caller and empties the slot (nullptr when it was empty)
+    std::unique_ptr<Piece> take(Handle handle);
+
+    const Piece *get(Handle handle) const;
+    bool isEmpty(Handle handle) const { return get(handle) == nullptr; }
+
+private:
+    std::array<std::unique_ptr<Piece>, engine::ReserveSlots * 2> slots;
+};
+
+#endif // PIECE_RESERVE_H
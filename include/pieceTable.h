@@ -0,0 +1,118 @@
+#ifndef PIECE_TABLE_H
+#define PIECE_TABLE_H
+
+#include "piece.h"
+#include "engineTypes.h"
+#include "globals.h"
+#include <array>
+#include <cstdint>
+#include <initializer_list>
+#include <vector>
+
+// The piece list as parallel columns: kind, colour, square, flags and id, one row per piece in list order.
+// Scans that only look at those attributes read a few contiguous bytes per piece instead of following a pointer
+// into each Piece and its texture and sprite. Each row keeps a pointer back to its Piece for drawing and for the
+// piece's own rules. Squares are row * BOARD_SIZE + col like the AreaEffect masks.
+// A game keeps one table next to its piece list and installs it with a Scope, the way it installs its PiecePool.
+// The installed table links every piece it reads to its row, and the piece reports its moves, colour, stun and stone
+// changes and its destruction straight to that row; sync() adds the pieces that joined the list and drops those that
+// left it, without reading the others again. Tables that are not installed are snapshots and link nothing.
+class PieceTable
+{
+public:
+    using SquareMask = std::uint64_t;
+    using KindSet = std::uint64_t; // bit per engine::Kind
+
+    static constexpr int OffBoard = -1;
+
+    enum Flag : std::uint8_t
+    {
+        Stunned = 1 << 0,
+        Stone = 1 << 1
+    };
+
+    PieceTable();
+    explicit PieceTable(const std::vector<std::unique_ptr<Piece>> &pieces);
+
+    // Reads every piece again
+    void rebuild(const std::vector<std::unique_ptr<Piece>> &pieces);
+
+    // Brings the rows in line with the list: pieces that joined it are read, rows of pieces that left it are
+    // dropped, and pieces already in the table are not read again
+    void sync(const std::vector<std::unique_ptr<Piece>> &pieces);
+
+    // Re-reads the colour, square and flags of the piece's row and moves it in the square index; nothing when the
+    // piece is not in the table
+    void update(const Piece &piece);
+
+    // Drops the row of a piece being destroyed, so a piece later created at its address is not taken for it
+    void forget(const Piece *piece);
+
+    // Table of the game running on this thread, nullptr outside a game
+    static PieceTable *current();
+
+    // The running game's table synced with pieces, or fallback read from pieces when no game is running
+    static PieceTable &synced(const std::vector<std::unique_ptr<Piece>> &pieces, PieceTable &fallback);
+
+    // Installs a table for its own lifetime; install it before it reads the pieces so they are linked to it.
+    // Declare the table before the pieces, so they are gone when it ends; pieces still alive are unlinked.
+    class Scope
+    {
+    public:
+        explicit Scope(PieceTable &table);
+        ~Scope();
+        Scope(const Scope &) = delete;
+        Scope &operator=(const Scope &) = delete;
+
+    private:
+        PieceTable &table;
+        PieceTable *previous;
+    };
+
+    static KindSet kindSet(std::initializer_list<engine::Kind> kinds);
+
+    std::size_t size() const { return ids.size(); }
+    engine::Kind kind(std::size_t row) const { return static_cast<engine::Kind>(kinds[row]); }
+    Piece::Color color(std::size_t row) const { return colors[row] ? Piece::Color::Black : Piece::Color::White; }
+    int square(std::size_t row) const { return squares[row]; }
+    std::uint8_t flags(std::size_t row) const { return flagBits[row]; }
+    int id(std::size_t row) const { return ids[row]; }
+    Piece &piece(std::size_t row) const { return *views[row]; }
+
+    // nullptr for an empty square
+    Piece *at(int square) const;
+
+    SquareMask occupiedBy(Piece::Color color) const { return occupiedBySide[color == Piece::Color::White ? 0 : 1]; }
+    SquareMask occupied() const { return occupiedBySide[0] | occupiedBySide[1]; }
+
+    // Squares of the colour's pieces whose kind is in kinds
+    SquareMask squaresOf(Piece::Color color, KindSet kinds) const;
+
+    // The colour's pieces whose kind is in kinds, in list order
+    std::vector<Piece *> select(Piece::Color color, KindSet kinds) const;
+
+private:
+    std::vector<std::uint8_t> kinds;
+    std::vector<std::uint8_t> colors; // 0 White, 1 Black
+    std::vector<std::int8_t> squares;
+    std::vector<std::uint8_t> flagBits;
+    std::vector<int> ids;
+    std::vector<Piece *> views; // nullptr once the piece is destroyed, until the next sync
+    bool linking = false;       // installed: pieces read are linked to their rows
+
+    void resize(std::size_t count);
+    void read(std::size_t row, Piece &piece);
+    void unlink(std::size_t row);
+    void index();
+    bool holds(const Piece &piece) const; // the piece is linked to a row of this table
+
+    // A row leaving or entering its square in the square index and side masks
+    void leave(std::size_t row);
+    void enter(std::size_t row);
+
+    std::array<std::int16_t, BOARD_SIZE * BOARD_SIZE> rowAt; // -1 for an empty square; the last row when several share it
+    std::array<SquareMask, 2> occupiedBySide;                // White first
+    std::array<std::array<std::uint8_t, BOARD_SIZE * BOARD_SIZE>, 2> rowsOn; // rows per side on each square
+};
+
+#endif // PIECE_TABLE_H
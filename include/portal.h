@@ -2,6 +2,7 @@
 #define PORTAL_H
 
 #include "piece.h"
+#include "pieceReserve.h"
 #include <SFML/Graphics.hpp>
 
 class Portal : public Piece
@@ -12,23 +13,32 @@ public:
 
     bool canMoveTo(const sf::Vector2f &target, const std::vector<std::unique_ptr<Piece>> &pieces) const override;
 
-    void highlightValidMoves(std::vector<std::vector<Square>> &board, const std::vector<std::unique_ptr<Piece>> &pieces) const override;
+    void highlightValidMoves(Board &board, const std::vector<std::unique_ptr<Piece>> &pieces) const override;
 
-    void captureWithPortals(const sf::Vector2f &target, std::vector<std::unique_ptr<Piece>> &pieces, std::vector<Portal *> &portals, std::vector<std::vector<Square>> &board);
+    // Moves the friendly piece on target into the side's Portal slot of reserve, which all of the side's Portals share
+    void captureWithPortals(const sf::Vector2f &target, std::vector<std::unique_ptr<Piece>> &pieces, PieceReserve &reserve, Board &board);
 
-    void teleport(sf::RenderWindow &window, std::vector<std::vector<Square>> &board, std::vector<std::unique_ptr<Piece>> &pieces, bool isWhiteTurn, std::vector<Portal *> &portals);
+    // Second click of an unload: puts the reserve piece on target if highlightValidUnloadPos highlighted it, then clears
+    // the highlights either way. Returns true when the piece came out.
+    bool teleport(const sf::Vector2f &target, Board &board, std::vector<std::unique_ptr<Piece>> &pieces, PieceReserve &reserve);
 
-    void highlightValidUnloadPos(const sf::Vector2f &position, std::vector<std::vector<Square>> &board, const std::vector<std::unique_ptr<Piece>> &pieces);
+    void highlightValidUnloadPos(const sf::Vector2f &position, Board &board, const std::vector<std::unique_ptr<Piece>> &pieces);
 
-    void highlightAdjacentPieces(std::vector<std::unique_ptr<Piece>> &pieces, std::vector<std::vector<Square>> &board, bool isWhiteTurn);
+    void highlightAdjacentPieces(std::vector<std::unique_ptr<Piece>> &pieces, Board &board, bool isWhiteTurn);
+
+    // Kings stay on the board, as the engine counts a side without one as lost
+    static bool canEnter(const Piece &piece);
+
+    // Looked up from the colour each time, so a Portal that changes sides uses its new side's slot
+    PieceReserve::Handle reserveHandle() const { return PieceReserve::handleFor(engine::PortalReserve, getColor()); }
+    bool isLoaded(const PieceReserve &reserve) const { return !reserve.isEmpty(reserveHandle()); }
 
     // variables
-    bool pieceLoaded = false;
     const int directions[8][2] = {{-1, -1}, {-1, 0}, {-1, 1}, {0, -1}, {0, 1}, {1, -1}, {1, 0}, {1, 1}};
-    Piece *pieceInPortal;
 
     std::string getType() const override { return "Portal"; }
 
+    // The loaded piece lives in the PieceReserve, so a copy holds no pointer to it
     std::unique_ptr<Piece> clone() const override
     {
         return std::make_unique<Portal>(*this);
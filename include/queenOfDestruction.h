@@ -2,6 +2,7 @@
 #define QUEENOFDESTRUCTION_H
 
 #include "piece.h"
+#include "areaEffect.h"
 
 class QueenOfDestruction : public Piece
 {
@@ -11,13 +12,10 @@ public:
 
     bool canMoveTo(const sf::Vector2f &target, const std::vector<std::unique_ptr<Piece>> &pieces) const override;
 
-    void highlightValidMoves(std::vector<std::vector<Square>> &board, const std::vector<std::unique_ptr<Piece>> &pieces) const override;
+    void highlightValidMoves(Board &board, const std::vector<std::unique_ptr<Piece>> &pieces) const override;
 
-    void massDestruction(const Piece *capturingPiece, std::vector<std::unique_ptr<Piece>> &pieces, std::vector<std::vector<Square>> &boards);
-
-    bool canMoveToIgnoringPiece(const sf::Vector2f &target, const std::vector<std::unique_ptr<Piece>> &pieces, const Piece *ignorePiece) const;
-
-    bool isPathClearIgnoringPiece(const sf::Vector2f &start, const sf::Vector2f &end, const std::vector<std::unique_ptr<Piece>> &pieces, const Piece *ignorePiece) const;
+    // Destroys the enemies in her lines as the capturing piece takes her; she stays on the board for the capture itself
+    void massDestruction(const Piece *capturingPiece, std::vector<std::unique_ptr<Piece>> &pieces, const AreaEffect::QueenOfBonesFallen &onQueenOfBonesFallen);
 
     std::string getType() const override
     {
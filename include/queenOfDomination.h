@@ -3,7 +3,7 @@
 
 #include "piece.h"
 #include "textureManager.h"
-#include "square.h"
+#include "board.h"
 #include <vector>
 
 class QueenOfDomination : public Piece
@@ -14,7 +14,7 @@ public:
 
     bool canMoveTo(const sf::Vector2f &target, const std::vector<std::unique_ptr<Piece>> &pieces) const override;
 
-    void highlightValidMoves(std::vector<std::vector<Square>> &board, const std::vector<std::unique_ptr<Piece>> &pieces) const override;
+    void highlightValidMoves(Board &board, const std::vector<std::unique_ptr<Piece>> &pieces) const override;
 
     std::string getType() const override { return "QueenOfDomination"; }
 
@@ -24,14 +24,16 @@ public:
     }
 
     // New methods for this piece
-    void highlightAdjacentFriendlyPieces(std::vector<std::vector<Square>> &board, const std::vector<std::unique_ptr<Piece>> &pieces) const;
-    void toggleAdjacentFriendlyHighlights(std::vector<std::vector<Square>> &board, const std::vector<std::unique_ptr<Piece>> &pieces) const;
-    void clearHighlights(std::vector<std::vector<Square>> &board) const;
-    void applyDominationAbility(Piece *targetPiece, std::vector<std::unique_ptr<Piece>> &pieces, TextureManager &textureManager) const;
+    void highlightAdjacentFriendlyPieces(Board &board, const std::vector<std::unique_ptr<Piece>> &pieces) const;
+    void toggleAdjacentFriendlyHighlights(Board &board, const std::vector<std::unique_ptr<Piece>> &pieces) const;
+    void clearHighlights(Board &board) const;
+    // Returns the Queen that replaced targetPiece, or nullptr when the ability could not be used
+    Piece *applyDominationAbility(Piece *targetPiece, std::vector<std::unique_ptr<Piece>> &pieces, TextureManager &textureManager) const;
     void returnOriginalSprite(std::vector<std::unique_ptr<Piece>> &pieces, TextureManager &textureManager);
 
     // Check if the ability has been used
     bool hasUsedAbility() const;
+    void setAbilityUsed(bool value) { abilityUsed = value; }
 
     // Tracks the piece that has been dominated
     mutable std::string originalType = "None";
@@ -11,9 +11,9 @@ public:
 
     bool canMoveTo(const sf::Vector2f &target, const std::vector<std::unique_ptr<Piece>> &pieces) const override;
 
-    void highlightValidMoves(std::vector<std::vector<Square>> &board, const std::vector<std::unique_ptr<Piece>> &pieces) const override;
+    void highlightValidMoves(Board &board, const std::vector<std::unique_ptr<Piece>> &pieces) const override;
 
-    void swap(Piece *targetPiece, std::vector<std::vector<Square>> &board);
+    void swap(Piece *targetPiece, Board &board);
 
     std::string getType() const override { return "QueenOfIllusions"; }
 
@@ -0,0 +1,77 @@
+#ifndef RESOURCE_ARCHIVE_H
+#define RESOURCE_ARCHIVE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// One file holding every texture and the font: a header, an index of fixed-size entries sorted by name and the
+// entries' bytes. Images are stored decoded as 8-bit RGBA, so reading one is a copy out of the mapped file.
+// Written by the battlechess_pack build step on the machine that runs the game, in its byte order.
+class ResourceArchive
+{
+public:
+    static constexpr std::uint32_t Version = 1;
+    static constexpr std::size_t NameLength = 48;
+
+    enum class Type : std::uint32_t
+    {
+        Image = 1, // width * height RGBA pixels
+        Font = 2,  // the font file as is
+        Raw = 3
+    };
+
+    struct Entry
+    {
+        char name[NameLength]; // without the file extension, zero padded
+        Type type;
+        std::uint32_t width;
+        std::uint32_t height;
+        std::uint32_t reserved;
+        std::uint64_t offset; // from the start of the archive
+        std::uint64_t size;
+    };
+
+    // An entry to be written, with its bytes
+    struct Item
+    {
+        std::string name;
+        Type type = Type::Raw;
+        std::uint32_t width = 0;
+        std::uint32_t height = 0;
+        std::vector<unsigned char> bytes;
+    };
+
+    ResourceArchive() = default;
+    ~ResourceArchive();
+    ResourceArchive(const ResourceArchive &) = delete;
+    ResourceArchive &operator=(const ResourceArchive &) = delete;
+
+    // Maps the file read-only; false when it is missing, truncated or from another version
+    bool open(const std::string &path);
+    void close();
+    bool isOpen() const { return base != nullptr; }
+
+    std::size_t size() const { return entryCount; }
+    std::size_t mappedBytes() const { return length; }
+    const Entry &entry(std::size_t index) const { return entries()[index]; }
+
+    // Binary search of the index, nullptr when there is no such entry
+    const Entry *find(const std::string &name) const;
+
+    // The entry's bytes inside the mapping; valid until the archive is closed
+    const unsigned char *data(const Entry &entry) const { return base + entry.offset; }
+
+    static bool write(const std::string &path, std::vector<Item> items);
+
+private:
+    const Entry *entries() const;
+
+    const unsigned char *base = nullptr;
+    std::size_t length = 0;
+    std::size_t entryCount = 0;
+    std::vector<unsigned char> buffer; // holds the file where it cannot be mapped
+};
+
+#endif // RESOURCE_ARCHIVE_H
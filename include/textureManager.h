@@ -9,8 +9,13 @@ class TextureManager
 {
 public:
     bool loadTexture(const std::string &name, const std::string &filePath);
+    bool loadTexture(const std::string &name, const sf::Image &image);
     sf::Texture *getTexture(const std::string &name);
 
+    std::size_t size() const { return textures.size(); }
+    // RGBA bytes of every texture, what they take in video memory
+    std::size_t memoryBytes() const;
+
 private:
     std::map<std::string, sf::Texture> textures;
 };
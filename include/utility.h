@@ -9,6 +9,7 @@
 #include <memory>
 #include "button.h"
 #include "textureManager.h"
+#include "gameContext.h"
 #include <vector>
 #include <memory>
 
@@ -20,19 +21,15 @@ using PieceFactory = std::function<std::unique_ptr<Piece>(int &, sf::Texture &,
 
 bool isPathClear(const sf::Vector2f &start, const sf::Vector2f &end, const std::vector<std::unique_ptr<Piece>> &pieces);
 
-void loadTextures(TextureManager &textureManager);
-
-void createPieces(TextureManager &textureManager, std::vector<std::unique_ptr<Piece>> &pieces);
+void createPieces(GameContext &context, std::vector<std::unique_ptr<Piece>> &pieces);
 
 Piece *getPieceAtPosition(const sf::Vector2f &position, const std::vector<std::unique_ptr<Piece>> &pieces);
 
 bool isOpponentPiece(const sf::Vector2f &position, const std::vector<std::unique_ptr<Piece>> &pieces, Piece::Color currentPlayerColor);
 
-void drawChessboard(sf::RenderWindow &window, std::vector<std::vector<Square>> &board);
-
-void pushPawn(std::vector<std::unique_ptr<Piece>> &pieces, sf::Texture &pawnTexture, const sf::Vector2f &position, Piece::Color pieceColor);
+void pushPawn(GameContext &context, std::vector<std::unique_ptr<Piece>> &pieces, sf::Texture &pawnTexture, const sf::Vector2f &position, Piece::Color pieceColor);
 
-void pushNecroPawn(std::vector<std::unique_ptr<Piece>> &pieces, sf::Texture &necroPawnTexture, const sf::Vector2f &position, Piece::Color pieceColor);
+void pushNecroPawn(GameContext &context, std::vector<std::unique_ptr<Piece>> &pieces, sf::Texture &necroPawnTexture, const sf::Vector2f &position, Piece::Color pieceColor);
 
 void highlightButtonOnHover(sf::RenderWindow &window, Button &button, const sf::Color &normalColor, const sf::Color &hoverColor);
 
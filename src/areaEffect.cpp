@@ -0,0 +1,240 @@
+// Filename: areaEffect.cpp
+// Description: Implementation of the AreaEffect class, which resolves abilities that capture or stun several pieces at once.
+
+// Main Classes:
+// - AreaEffect: Looks the board up in the game's PieceTable and applies removals and stuns to masks of squares.
+
+// Main Functions:
+// - AreaEffect::SquareMask AreaEffect::adjacentSquares(const sf::Vector2f &position): Perimeter of a square from a precomputed table.
+// - AreaEffect::SquareMask AreaEffect::lineOfSight(const sf::Vector2f &position, SquareMask transparent) const:
+//   First piece on each queen line, found with one bit scan per line.
+// - AreaEffect::SquareMask AreaEffect::capture(SquareMask squares, const Piece *capturingPiece, const QueenOfBonesFallen &onQueenOfBonesFallen):
+//   Removes a set of pieces and the chain reactions they start in one pass over the piece list.
+// - void AreaEffect::stun(SquareMask squares, EffectScheduler &effects): Stuns the pieces on a set of squares.
+
+// Special Features or Notes:
+// - Captures resolve in waves: every piece of a wave leaves the board before the QueenOfDestruction among them look
+//   down their lines, so the result does not depend on the order the pieces are stored in.
+// - Mass destruction follows QueenOfDestruction::massDestruction: the first piece on each line is destroyed when it
+//   belongs to the opponent, and the capturing piece neither blocks a line nor is destroyed.
+// - A QueenOfBones is moved out of the piece list rather than destroyed, so the game can offer her revival with the
+//   board already cleared.
+// - Rays use the same layout as the Howler tables: the first four step to higher square indices and stop at the
+//   lowest set bit, the last four at the highest.
+
+// Usage or Context:
+// - Used by NecroPawn::sacrifice, QueenOfDestruction::massDestruction and GhostKnight::stunAdjacentEnemies.
+
+#include "areaEffect.h"
+#include "queenOfBones.h"
+#include <algorithm>
+#include <iostream>
+
+namespace
+{
+    constexpr int SquareCount = BOARD_SIZE * BOARD_SIZE;
+    constexpr int RayCount = 8;
+
+    static_assert(SquareCount <= 64, "Area effects are a 64-bit mask");
+
+    const int rayDirections[RayCount][2] = {{1, 0}, {0, 1}, {1, 1}, {-1, 1}, {-1, 0}, {0, -1}, {-1, -1}, {1, -1}};
+
+    struct AreaTables
+    {
+        AreaEffect::SquareMask adjacent[SquareCount];
+        AreaEffect::SquareMask rayMasks[RayCount][SquareCount]; // whole ray up to the edge
+    };
+
+    AreaEffect::SquareMask squareBit(int col, int row)
+    {
+        if (col < 0 || col >= BOARD_SIZE || row < 0 || row >= BOARD_SIZE)
+        {
+            return 0;
+        }
+        return AreaEffect::SquareMask(1) << (row * BOARD_SIZE + col);
+    }
+
+    void buildTables(AreaTables &tables)
+    {
+        for (int sq = 0; sq < SquareCount; ++sq)
+        {
+            int col = sq % BOARD_SIZE;
+            int row = sq / BOARD_SIZE;
+
+            tables.adjacent[sq] = 0;
+            for (int ray = 0; ray < RayCount; ++ray)
+            {
+                int dx = rayDirections[ray][0];
+                int dy = rayDirections[ray][1];
+                tables.adjacent[sq] |= squareBit(col + dx, row + dy);
+
+                AreaEffect::SquareMask mask = 0;
+                for (int step = 1; squareBit(col + step * dx, row + step * dy); ++step)
+                {
+                    mask |= squareBit(col + step * dx, row + step * dy);
+                }
+                tables.rayMasks[ray][sq] = mask;
+            }
+        }
+    }
+
+    const AreaTables &areaTables()
+    {
+        static AreaTables tables;
+        static const bool built = (buildTables(tables), true);
+        (void)built;
+        return tables;
+    }
+
+    int sideIndex(Piece::Color color)
+    {
+        return color == Piece::Color::White ? 0 : 1;
+    }
+}
+
+AreaEffect::AreaEffect(std::vector<std::unique_ptr<Piece>> &pieces)
+    : pieces(pieces), table(PieceTable::current() ? *PieceTable::current() : ownTable)
+{
+    indexBoard();
+}
+
+// Square of every piece, looked up instead of searching the piece list
+void AreaEffect::indexBoard()
+{
+    table.sync(pieces);
+    occupiedBySide = {table.occupiedBy(Piece::Color::White), table.occupiedBy(Piece::Color::Black)};
+}
+
+int AreaEffect::squareOf(const sf::Vector2f &position)
+{
+    int col = tileIndex(position.x);
+    int row = tileIndex(position.y);
+    if (position.x < 0 || position.y < 0 || col >= BOARD_SIZE || row >= BOARD_SIZE)
+    {
+        return -1;
+    }
+    return row * BOARD_SIZE + col;
+}
+
+AreaEffect::SquareMask AreaEffect::squareMask(const sf::Vector2f &position)
+{
+    int sq = squareOf(position);
+    return sq < 0 ? 0 : SquareMask(1) << sq;
+}
+
+AreaEffect::SquareMask AreaEffect::adjacentSquares(const sf::Vector2f &position)
+{
+    int sq = squareOf(position);
+    return sq < 0 ? 0 : areaTables().adjacent[sq];
+}
+
+AreaEffect::SquareMask AreaEffect::occupiedBy(Piece::Color color) const
+{
+    return occupiedBySide[sideIndex(color)];
+}
+
+// A ray stops on its first piece: drop everything the blocker's own ray would reach, keep the blocker
+AreaEffect::SquareMask AreaEffect::lineOfSight(const sf::Vector2f &position, SquareMask transparent) const
+{
+    int from = squareOf(position);
+    if (from < 0)
+    {
+        return 0;
+    }
+
+    const AreaTables &tables = areaTables();
+    SquareMask occupied = (occupiedBySide[0] | occupiedBySide[1]) & ~transparent;
+    SquareMask seen = 0;
+    for (int ray = 0; ray < RayCount; ++ray)
+    {
+        SquareMask blockers = tables.rayMasks[ray][from] & occupied;
+        if (blockers)
+        {
+            int blocker = ray < 4 ? __builtin_ctzll(blockers) : 63 - __builtin_clzll(blockers);
+            seen |= SquareMask(1) << blocker;
+        }
+    }
+    return seen;
+}
+
+AreaEffect::SquareMask AreaEffect::destructionTargets(const Piece &queen, SquareMask capturer) const
+{
+    Piece::Color enemy = queen.getColor() == Piece::Color::White ? Piece::Color::Black : Piece::Color::White;
+    return lineOfSight(queen.getPosition(), capturer) & occupiedBy(enemy) & ~capturer;
+}
+
+AreaEffect::SquareMask AreaEffect::massDestructionTargets(const Piece &queen, const Piece *capturingPiece) const
+{
+    return destructionTargets(queen, capturingPiece ? squareMask(capturingPiece->getPosition()) : 0);
+}
+
+AreaEffect::SquareMask AreaEffect::capture(SquareMask squares, const Piece *capturingPiece, const QueenOfBonesFallen &onQueenOfBonesFallen)
+{
+    SquareMask capturer = capturingPiece ? squareMask(capturingPiece->getPosition()) : 0;
+    SquareMask removed = 0;
+    SquareMask wave = squares & (occupiedBySide[0] | occupiedBySide[1]);
+    PieceTable::KindSet destruction = PieceTable::kindSet({engine::QueenOfDestruction});
+    SquareMask destructionQueens = table.squaresOf(Piece::Color::White, destruction) | table.squaresOf(Piece::Color::Black, destruction);
+
+    // Each wave leaves the board at once, then the QueenOfDestruction in it pick the next wave
+    while (wave)
+    {
+        removed |= wave;
+        occupiedBySide[0] &= ~wave;
+        occupiedBySide[1] &= ~wave;
+
+        SquareMask next = 0;
+        for (SquareMask rest = wave & destructionQueens; rest; rest &= rest - 1)
+        {
+            std::cout << "QueenOfDestruction destroyed: mass destruction triggered.\n";
+            next |= destructionTargets(*table.at(__builtin_ctzll(rest)), capturer);
+        }
+        wave = next;
+    }
+
+    if (!removed)
+    {
+        return 0;
+    }
+
+    // One pass over the piece list; a fallen QueenOfBones is kept aside for her revival
+    std::vector<std::unique_ptr<Piece>> fallenQueens;
+    for (auto &piece : pieces)
+    {
+        int sq = squareOf(piece->getPosition());
+        if (sq >= 0 && (removed & (SquareMask(1) << sq)) && table.at(sq) == piece.get())
+        {
+            std::cout << "Capturing piece at position: (" << sq % BOARD_SIZE << ", " << sq / BOARD_SIZE << ")\n";
+            if (piece->getType() == "QueenOfBones")
+            {
+                fallenQueens.push_back(std::move(piece));
+            }
+            else
+            {
+                piece.reset();
+            }
+        }
+    }
+    auto it = std::remove(pieces.begin(), pieces.end(), nullptr);
+    pieces.erase(it, pieces.end());
+
+    for (auto &queen : fallenQueens)
+    {
+        if (onQueenOfBonesFallen)
+        {
+            onQueenOfBonesFallen(static_cast<QueenOfBones &>(*queen));
+        }
+    }
+    // The table still has the fallen queens, and revivals sacrifice pawns and put queens back
+    indexBoard();
+    return removed;
+}
+
+void AreaEffect::stun(SquareMask squares, EffectScheduler &effects)
+{
+    for (SquareMask rest = squares & (occupiedBySide[0] | occupiedBySide[1]); rest; rest &= rest - 1)
+    {
+        // The owner's next turn is over by the end of ours
+        effects.schedule(EffectScheduler::Effect::Stun, *table.at(__builtin_ctzll(rest)), 1);
+    }
+}
@@ -0,0 +1,158 @@
+// Filename: armyMain.cpp
+// Description: Entry point of the battlechess_army tool, which searches for strong gemstone army builds.
+
+// Main Functions:
+// - int main(int argc, char *argv[]): Runs the army optimizer and prints the best builds of every race.
+
+// Special Features or Notes:
+// - Options: --races necro,wizard,beast,hell,custom --population N --generations N --games N --nodes N
+//   --threads N --seed N --top N --records <file> --pieces <file>.
+// - --pieces loads a piece file before any game starts; with the custom race it plays newly defined
+//   pieces against the built-in armies without recompiling.
+// - With --records every self-play game is appended as "<position notation> ; <result>" lines,
+//   the input format of battlechess_tune.
+
+// Usage or Context:
+// - battlechess_army --threads 16 --generations 30 --records selfplay.txt
+
+#include "engineArmy.h"
+#include "enginePieces.h"
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+
+namespace
+{
+    engine::Race parseRace(const std::string &name)
+    {
+        if (name == "necro")
+            return engine::Necro;
+        if (name == "wizard")
+            return engine::WizardRace;
+        if (name == "beast")
+            return engine::Beast;
+        if (name == "hell")
+            return engine::Hell;
+        if (name == "custom")
+            return engine::Custom;
+        throw std::runtime_error("Unknown race " + name);
+    }
+
+    void printScore(const engine::ArmyScore &score)
+    {
+        std::cout << std::fixed << std::setprecision(1) << std::setw(6) << score.winRate() * 100.0 << "% "
+                  << std::setw(5) << score.games << " games  " << score.build.describe() << std::endl;
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    engine::OptimizerOptions options;
+    int threads = 0;
+    std::vector<engine::Race> races = {engine::Necro, engine::WizardRace, engine::Beast, engine::Hell};
+    std::string recordsPath;
+    int top = 5;
+
+    try
+    {
+        for (int i = 1; i < argc; i += 2)
+        {
+            std::string flag = argv[i];
+            if (i + 1 >= argc)
+                throw std::runtime_error("Missing value for " + flag);
+            std::string value = argv[i + 1];
+            if (flag == "--races")
+            {
+                races.clear();
+                std::istringstream list(value);
+                std::string name;
+                while (std::getline(list, name, ','))
+                {
+                    races.push_back(parseRace(name));
+                }
+            }
+            else if (flag == "--population")
+                options.population = std::stoi(value);
+            else if (flag == "--generations")
+                options.generations = std::stoi(value);
+            else if (flag == "--games")
+                options.gamesPerCandidate = std::stoi(value);
+            else if (flag == "--nodes")
+                options.play.nodesPerMove = std::stoull(value);
+            else if (flag == "--threads")
+                threads = std::stoi(value);
+            else if (flag == "--seed")
+                options.seed = static_cast<std::uint32_t>(std::stoul(value));
+            else if (flag == "--top")
+                top = std::stoi(value);
+            else if (flag == "--records")
+                recordsPath = value;
+            else if (flag == "--pieces")
+                engine::setPieceCatalog(engine::PieceCatalog::load(value));
+            else
+                throw std::runtime_error("Unknown option " + flag);
+        }
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << "Error: " << e.what() << std::endl;
+        std::cerr << "Usage: battlechess_army [--races necro,wizard,beast,hell,custom] [--population N] [--generations N] [--games N] [--nodes N] [--threads N] [--seed N] [--top N] [--records file] [--pieces file]" << std::endl;
+        return 1;
+    }
+
+    std::ofstream records;
+    if (!recordsPath.empty())
+    {
+        records.open(recordsPath, std::ios::app);
+        if (!records)
+        {
+            std::cerr << "Error: unable to open " << recordsPath << std::endl;
+            return 1;
+        }
+    }
+
+    auto started = std::chrono::steady_clock::now();
+    std::size_t gamesPlayed = 0;
+    engine::ThreadPool pool(threads);
+    engine::ArmyOptimizer optimizer(options, pool);
+    std::vector<engine::ArmyScore> results = optimizer.run(
+        races,
+        [&](int generation, const std::vector<engine::ArmyScore> &best)
+        {
+            double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+            std::cerr << "generation " << generation << " (" << gamesPlayed << " games, " << seconds << "s)" << std::endl;
+            for (const engine::ArmyScore &score : best)
+            {
+                std::cerr << "  best " << score.build.describe() << " " << score.winRate() * 100.0 << "%" << std::endl;
+            }
+        },
+        [&](const std::vector<std::string> &positions, float result)
+        {
+            ++gamesPlayed;
+            if (records.is_open())
+            {
+                for (const std::string &notation : positions)
+                {
+                    records << notation << " ; " << result << "\n";
+                }
+            }
+        });
+
+    std::cout << "Top builds (win rate against the standard army and the elites):" << std::endl;
+    for (engine::Race race : races)
+    {
+        int shown = 0;
+        for (const engine::ArmyScore &score : results)
+        {
+            if (score.build.race == race && shown < top)
+            {
+                printScore(score);
+                ++shown;
+            }
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,123 @@
+// Filename: assetLoader.cpp
+// Description: Implementation of the AssetLoader class, which loads the game's textures and font from the packed archive.
+
+// Main Classes:
+// - AssetLoader: Maps the resource archive, loads the menu's font and background and prepares the piece textures.
+
+// Main Functions:
+// - AssetLoader::AssetLoader(const std::string &archivePath): Opens the archive and starts the image worker.
+// - std::shared_ptr<TextureManager> AssetLoader::acquireTextures(): Shares the piece textures, uploading them once per process.
+// - AssetLoader::MemoryUsage AssetLoader::getMemoryUsage() const: Reports what the cache keeps resident.
+// - std::string AssetLoader::defaultArchivePath(): Where the archive is looked for.
+
+// Special Features or Notes:
+// - Images are stored decoded, so nothing is decompressed at startup: the worker only copies pixels out of the mapping.
+// - The worker never touches OpenGL; textures are uploaded on the thread that asks for them.
+// - The archive's path is fixed when the game is built (BATTLECHESS_ARCHIVE_PATH), so the game no longer
+//   depends on being started from the build directory.
+// - The piece textures are reference counted: the loader keeps one reference and each running game another,
+//   so the count tells how many games are drawing with them and none is freed under a game.
+
+// Usage or Context:
+// - Created by main before the menu opens; the menu uses the font and background and every game the textures.
+
+#include "assetLoader.h"
+#include <cstdlib>
+#include <stdexcept>
+
+#ifndef BATTLECHESS_ARCHIVE_PATH
+#define BATTLECHESS_ARCHIVE_PATH "battlechess.pak"
+#endif
+
+namespace
+{
+    const char *const FontName = "JmhcthulhumbusarcadeugRegular-JleB";
+    const char *const MenuBackgroundName = "BustedMenu";
+
+    sf::Image imageOf(const ResourceArchive &archive, const ResourceArchive::Entry &entry)
+    {
+        sf::Image image;
+        image.create(entry.width, entry.height, archive.data(entry));
+        return image;
+    }
+}
+
+AssetLoader::AssetLoader(const std::string &archivePath)
+    : decoded(false), textures(std::make_shared<TextureManager>())
+{
+    if (!archive.open(archivePath))
+    {
+        throw std::runtime_error("Failed to open resource archive " + archivePath);
+    }
+
+    const ResourceArchive::Entry *fontEntry = archive.find(FontName);
+    if (!fontEntry || !font.loadFromMemory(archive.data(*fontEntry), static_cast<std::size_t>(fontEntry->size)))
+    {
+        throw std::runtime_error(std::string("Failed to load font ") + FontName);
+    }
+
+    const ResourceArchive::Entry *backgroundEntry = archive.find(MenuBackgroundName);
+    if (!backgroundEntry || backgroundEntry->type != ResourceArchive::Type::Image ||
+        !menuBackground.loadFromImage(imageOf(archive, *backgroundEntry)))
+    {
+        throw std::runtime_error(std::string("Failed to load ") + MenuBackgroundName);
+    }
+
+    worker = std::thread(&AssetLoader::decodeImages, this);
+}
+
+AssetLoader::~AssetLoader()
+{
+    if (worker.joinable())
+    {
+        worker.join();
+    }
+}
+
+void AssetLoader::decodeImages()
+{
+    for (std::size_t i = 0; i < archive.size(); ++i)
+    {
+        const ResourceArchive::Entry &entry = archive.entry(i);
+        if (entry.type == ResourceArchive::Type::Image && entry.name != std::string(MenuBackgroundName))
+        {
+            images.emplace_back(entry.name, imageOf(archive, entry));
+        }
+    }
+    decoded.store(true);
+}
+
+std::shared_ptr<TextureManager> AssetLoader::acquireTextures()
+{
+    if (!uploaded)
+    {
+        if (worker.joinable())
+        {
+            worker.join();
+        }
+        for (const auto &image : images)
+        {
+            textures->loadTexture(image.first, image.second);
+        }
+        images.clear();
+        images.shrink_to_fit();
+        uploaded = true;
+    }
+    return textures;
+}
+
+AssetLoader::MemoryUsage AssetLoader::getMemoryUsage() const
+{
+    MemoryUsage usage;
+    usage.archiveBytes = archive.mappedBytes();
+    usage.textureCount = textures->size() + 1;
+    usage.textureBytes = textures->memoryBytes() + std::size_t(menuBackground.getSize().x) * menuBackground.getSize().y * 4;
+    usage.textureUsers = textures.use_count() - 1;
+    return usage;
+}
+
+std::string AssetLoader::defaultArchivePath()
+{
+    const char *path = std::getenv("BATTLECHESS_ARCHIVE");
+    return path ? path : BATTLECHESS_ARCHIVE_PATH;
+}
@@ -0,0 +1,173 @@
+// Filename: batchBench.cpp
+// Description: Entry point of battlechess_batchbench, which measures batch evaluation throughput.
+
+// Main Functions:
+// - int main(int argc, char *argv[]): Builds a position set, checks the batch results against evaluate()
+//   and prints positions per second for the per-position loop and the batch API at each thread count.
+
+// Special Features or Notes:
+// - Options: --positions N (default 1000000), --threads N (default: all cores), --records <file>.
+// - Without --records the set comes from random playouts of random army builds, which covers every race.
+// - With --records the positions are read from "<position notation> ; <result>" lines (battlechess_tune format).
+
+// Usage or Context:
+// - battlechess_batchbench --positions 2000000 --threads 8
+
+#include "engineArmy.h"
+#include "engineBatch.h"
+#include "engineMoveGen.h"
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <thread>
+
+namespace
+{
+    std::vector<engine::PackedPosition> randomPositions(std::size_t count)
+    {
+        std::mt19937 rng(7);
+        std::vector<engine::PackedPosition> positions;
+        positions.reserve(count);
+        while (positions.size() < count)
+        {
+            engine::ArmyBuild builds[2];
+            for (engine::ArmyBuild &build : builds)
+            {
+                build.race = static_cast<engine::Race>(1 + rng() % (engine::RaceCount - 1));
+                build.upgrades = static_cast<std::uint16_t>(rng());
+                while (!build.isLegal())
+                {
+                    build.upgrades &= static_cast<std::uint16_t>(rng());
+                }
+            }
+
+            engine::Position position = engine::armyStartPosition(builds[0], builds[1]);
+            for (int ply = 0; ply < 120 && positions.size() < count && !engine::isLost(position); ++ply)
+            {
+                engine::MoveList list;
+                engine::generateMoves(position, list);
+                if (list.empty())
+                {
+                    break;
+                }
+                position.makeMove(list.moves[rng() % list.size()]);
+                positions.push_back(position.pack());
+            }
+        }
+        return positions;
+    }
+
+    std::vector<engine::PackedPosition> recordPositions(const std::string &path, std::size_t limit)
+    {
+        std::ifstream file(path);
+        if (!file)
+        {
+            throw std::runtime_error("Unable to open " + path);
+        }
+        std::vector<engine::PackedPosition> positions;
+        std::string line;
+        while (positions.size() < limit && std::getline(file, line))
+        {
+            std::size_t separator = line.find(';');
+            if (line.empty() || line[0] == '#')
+            {
+                continue;
+            }
+            positions.push_back(engine::Position::fromNotation(line.substr(0, separator)).pack());
+        }
+        return positions;
+    }
+
+    template <typename Work>
+    double positionsPerSecond(std::size_t count, Work work)
+    {
+        auto started = std::chrono::steady_clock::now();
+        work();
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+        return count / std::max(seconds, 1e-9);
+    }
+
+    void report(const std::string &label, double rate)
+    {
+        std::cout << std::left << std::setw(36) << label << std::right << std::fixed << std::setprecision(0)
+                  << std::setw(14) << rate << " positions/s" << std::endl;
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    std::size_t count = 1000000;
+    int maxThreads = std::max(1u, std::thread::hardware_concurrency());
+    std::string recordsPath;
+
+    std::vector<engine::PackedPosition> positions;
+    try
+    {
+        for (int i = 1; i + 1 < argc; i += 2)
+        {
+            std::string flag = argv[i];
+            std::string value = argv[i + 1];
+            if (flag == "--positions")
+                count = std::stoull(value);
+            else if (flag == "--threads")
+                maxThreads = std::max(1, std::stoi(value));
+            else if (flag == "--records")
+                recordsPath = value;
+            else
+                throw std::runtime_error("Unknown option " + flag);
+        }
+        positions = recordsPath.empty() ? randomPositions(count) : recordPositions(recordsPath, count);
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << "Error: " << e.what() << std::endl;
+        std::cerr << "Usage: battlechess_batchbench [--positions N] [--threads N] [--records file]" << std::endl;
+        return 1;
+    }
+    count = positions.size();
+    std::cout << count << " positions, " << sizeof(engine::PackedPosition) << " bytes each" << std::endl;
+
+    // Reference: one Position and one evaluate()/generateMoves() call per entry
+    std::vector<int> expectedScores(count), expectedMoves(count);
+    report("per position, eval", positionsPerSecond(count, [&]()
+                                                     {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            expectedScores[i] = engine::evaluate(engine::Position::unpack(positions[i]));
+        } }));
+    report("per position, eval + moves", positionsPerSecond(count, [&]()
+                                                             {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            engine::Position position = engine::Position::unpack(positions[i]);
+            engine::MoveList list;
+            engine::generateMoves(position, list);
+            expectedScores[i] = engine::evaluate(position);
+            expectedMoves[i] = list.size();
+        } }));
+
+    std::vector<int> scores(count), moves(count);
+    for (int threads = 1; threads <= maxThreads; threads *= 2)
+    {
+        engine::ThreadPool pool(threads);
+        engine::BatchEvaluator evaluator(engine::defaultEvalParams(), pool);
+        std::string suffix = ", " + std::to_string(threads) + (threads == 1 ? " thread" : " threads");
+        report("batch eval" + suffix, positionsPerSecond(count, [&]()
+                                                         { evaluator.run(positions.data(), count, scores.data(), nullptr); }));
+        report("batch eval + moves" + suffix, positionsPerSecond(count, [&]()
+                                                                 { evaluator.run(positions.data(), count, scores.data(), moves.data()); }));
+        if (scores != expectedScores || moves != expectedMoves)
+        {
+            std::cerr << "Error: batch results differ from evaluate()/generateMoves()" << std::endl;
+            return 1;
+        }
+        if (threads < maxThreads && threads * 2 > maxThreads)
+        {
+            threads = maxThreads / 2;
+        }
+    }
+    return 0;
+}
@@ -7,7 +7,7 @@
 // Main Functions:
 // - bool BeastDruid::canMoveTo(const sf::Vector2f &target, const std::vector<std::unique_ptr<Piece>> &pieces) const:
 //   Checks if the BeastDruid can legally move to the specified target position on the chessboard.
-// - void BeastDruid::highlightValidMoves(std::vector<std::vector<Square>> &board, const std::vector<std::unique_ptr<Piece>> &pieces) const:
+// - void BeastDruid::highlightValidMoves(Board &board, const std::vector<std::unique_ptr<Piece>> &pieces) const:
 //   Highlights all valid moves for the BeastDruid on the provided chessboard, considering its current position and game rules.
 
 // Special Features or Notes:
@@ -47,8 +47,9 @@ bool BeastDruid::canMoveTo(const sf::Vector2f &target, const std::vector<std::un
 }
 
 // Highlight valid moves for the BeastDruid on the provided board
-void BeastDruid::highlightValidMoves(std::vector<std::vector<Square>> &board, const std::vector<std::unique_ptr<Piece>> &pieces) const
+void BeastDruid::highlightValidMoves(Board &board, const std::vector<std::unique_ptr<Piece>> &pieces) const
 {
+    Board::Highlights highlights;
     sf::Vector2f currentPosition = getPosition();
     Piece::Color currentPlayerColor = getColor();
 
@@ -60,8 +61,8 @@ void BeastDruid::highlightValidMoves(std::vector<std::vector<Square>> &board, co
             // Check valid moves in each diagonal direction
             for (float i = 1; i < BOARD_SIZE; ++i)
             {
-                int newX = static_cast<int>(currentPosition.x / TILE_SIZE) + i * dx;
-                int newY = static_cast<int>(currentPosition.y / TILE_SIZE) + i * dy;
+                int newX = tileIndex(currentPosition.x) + i * dx;
+                int newY = tileIndex(currentPosition.y) + i * dy;
 
                 // Check if the new position is within the board bounds
                 if (newX >= 0 && newX < BOARD_SIZE && newY >= 0 && newY < BOARD_SIZE)
@@ -74,12 +75,12 @@ void BeastDruid::highlightValidMoves(std::vector<std::vector<Square>> &board, co
                         if (!isOpponentPiece(newPosition, pieces, currentPlayerColor))
                         {
                             // Highlight unoccupied squares yellow where BeastDruid can move
-                            board[newY][newX].setHighlight(true);
+                            highlights.moves |= Board::squareMask(newY, newX);
                         }
                         else if (isOpponentPiece(newPosition, pieces, currentPlayerColor))
                         {
                             // Highlight squares red where Bishop can move and capture opponent's piece
-                            board[newY][newX].setHighlight(true, sf::Color::Red);
+                            highlights.captures |= Board::squareMask(newY, newX);
                         }
 
                         // If the position is occupied by an opponent's piece, stop highlighting in this direction
@@ -95,33 +96,36 @@ void BeastDruid::highlightValidMoves(std::vector<std::vector<Square>> &board, co
                     }
                 }
                 else
-                { // Move anywhere in the perimeter of the BeastDruid
-                    std::vector<sf::Vector2f> moves = {
-                        {currentPosition.x, currentPosition.y + TILE_SIZE},
-                        {currentPosition.x, currentPosition.y - TILE_SIZE},
-                        {currentPosition.x - TILE_SIZE, currentPosition.y},
-                        {currentPosition.x + TILE_SIZE, currentPosition.y}};
-
-                    for (const auto &move : moves)
-                    {
-                        int col = move.x / TILE_SIZE;
-                        int row = move.y / TILE_SIZE;
-
-                        // space is occupied by an opponent piece
-                        if (col >= 0 && col < BOARD_SIZE && row >= 0 && row < BOARD_SIZE && canMoveTo(move, pieces) && isOpponentPiece(move, pieces, getColor()))
-                        {
-                            board[row][col].setHighlight(true, sf::Color::Red);
-                        }
-                        // space is unoccupied
-                        else if (col >= 0 && col < BOARD_SIZE && row >= 0 && row < BOARD_SIZE && canMoveTo(move, pieces))
-                        {
-                            board[row][col].setHighlight(true);
-                        }
-                    }
+                {
                     // If the new position is out of bounds, stop highlighting in this direction
                     break;
                 }
             }
         }
     }
+
+    // Move anywhere in the perimeter of the BeastDruid, whether or not the diagonals reach the edge
+    std::vector<sf::Vector2f> moves = {
+        {currentPosition.x, currentPosition.y + TILE_SIZE},
+        {currentPosition.x, currentPosition.y - TILE_SIZE},
+        {currentPosition.x - TILE_SIZE, currentPosition.y},
+        {currentPosition.x + TILE_SIZE, currentPosition.y}};
+
+    for (const auto &move : moves)
+    {
+        int col = tileIndex(move.x);
+        int row = tileIndex(move.y);
+
+        // space is occupied by an opponent piece
+        if (col >= 0 && col < BOARD_SIZE && row >= 0 && row < BOARD_SIZE && canMoveTo(move, pieces) && isOpponentPiece(move, pieces, getColor()))
+        {
+            highlights.captures |= Board::squareMask(row, col);
+        }
+        // space is unoccupied
+        else if (col >= 0 && col < BOARD_SIZE && row >= 0 && row < BOARD_SIZE && canMoveTo(move, pieces))
+        {
+            highlights.moves |= Board::squareMask(row, col);
+        }
+    }
+    board.highlight(highlights);
 }
\ No newline at end of file
@@ -7,7 +7,7 @@
 // Main Functions:
 // - bool BeastKnight::canMoveTo(const sf::Vector2f &target, const std::vector<std::unique_ptr<Piece>> &pieces) const:
 //   Checks if the BeastKnight can legally move to the specified target position on the chessboard.
-// - void BeastKnight::highlightValidMoves(std::vector<std::vector<Square>> &board, const std::vector<std::unique_ptr<Piece>> &pieces) const:
+// - void BeastKnight::highlightValidMoves(Board &board, const std::vector<std::unique_ptr<Piece>> &pieces) const:
 //   Highlights all valid moves for the BeastKnight on the provided chessboard, considering its current position and game rules.
 
 // Special Features or Notes:
@@ -24,7 +24,7 @@
 #include "beastKnight.h"
 #include "utility.h"
 #include "globals.h"
-#include "square.h"
+#include "board.h"
 #include <vector>
 
 // Determine if the BeastKnight can move to a specified target position
@@ -43,8 +43,9 @@ bool BeastKnight::canMoveTo(const sf::Vector2f &target, const std::vector<std::u
 }
 
 // Highlight valid moves for the BeastKnight on the provided board
-void BeastKnight::highlightValidMoves(std::vector<std::vector<Square>> &board, const std::vector<std::unique_ptr<Piece>> &pieces) const
+void BeastKnight::highlightValidMoves(Board &board, const std::vector<std::unique_ptr<Piece>> &pieces) const
 {
+    Board::Highlights highlights;
     sf::Vector2f currentPosition = getPosition();
 
     // Define all possible move positions for the BeastKnight
@@ -61,17 +62,18 @@ void BeastKnight::highlightValidMoves(std::vector<std::vector<Square>> &board, c
     // Iterate through each possible move and highlight valid moves on the board
     for (const auto &move : moves)
     {
-        int col = move.x / TILE_SIZE;
-        int row = move.y / TILE_SIZE;
+        int col = tileIndex(move.x);
+        int row = tileIndex(move.y);
         if (col >= 0 && col < BOARD_SIZE && row >= 0 && row < BOARD_SIZE && canMoveTo(move, pieces) && isOpponentPiece(move, pieces, getColor()))
         {
             // Highlight squares where BeastKnight can move and capture opponent's piece
-            board[row][col].setHighlight(true, sf::Color::Red);
+            highlights.captures |= Board::squareMask(row, col);
         }
         else if (col >= 0 && col < BOARD_SIZE && row >= 0 && row < BOARD_SIZE && canMoveTo(move, pieces))
         {
             // Highlight squares where BeastKnight can move
-            board[row][col].setHighlight(true);
+            highlights.moves |= Board::squareMask(row, col);
         }
     }
+    board.highlight(highlights);
 };
\ No newline at end of file
@@ -7,9 +7,9 @@
 // Main Functions:
 // - bool Beholder::canMoveTo(const sf::Vector2f &target, const std::vector<std::unique_ptr<Piece>> &pieces) const:
 //   Checks if the Beholder can legally move to the specified target position on the chessboard.
-// - void Beholder::highlightValidMoves(std::vector<std::vector<Square>> &board, const std::vector<std::unique_ptr<Piece>> &pieces) const:
+// - void Beholder::highlightValidMoves(Board &board, const std::vector<std::unique_ptr<Piece>> &pieces) const:
 //   Highlights all valid moves for the Beholder on the provided chessboard, considering its current position and game rules.
-// - void Beholder::highlightCaptureZones(std::vector<std::vector<Square>> &board, const std::vector<std::unique_ptr<Piece>> &pieces) const:
+// - void Beholder::highlightCaptureZones(Board &board, const std::vector<std::unique_ptr<Piece>> &pieces) const:
 //   Highlights all valid capture options for the Beholder on the provided chessboard, considering its current position and game rules.
 // - void Beholder::capture(const sf::Vector2f &target, std::vector<std::unique_ptr<Piece>> &pieces):
 //   Captures an enemy piece. Overwrites the capture function from the Piece class.
@@ -28,7 +28,7 @@
 #include "beholder.h"
 #include "utility.h"
 #include "globals.h"
-#include "square.h"
+#include "board.h"
 #include <vector>
 
 // Determine if the Beholder can move to a specified target position
@@ -46,8 +46,9 @@ bool Beholder::canMoveTo(const sf::Vector2f &target, const std::vector<std::uniq
 }
 
 // Highlight valid moves for the Beholder on the provided board
-void Beholder::highlightValidMoves(std::vector<std::vector<Square>> &board, const std::vector<std::unique_ptr<Piece>> &pieces) const
+void Beholder::highlightValidMoves(Board &board, const std::vector<std::unique_ptr<Piece>> &pieces) const
 {
+    Board::Highlights highlights;
     sf::Vector2f currentPosition = getPosition();
     std::vector<sf::Vector2f> moves = {
         {currentPosition.x, currentPosition.y + TILE_SIZE},
@@ -61,28 +62,30 @@ void Beholder::highlightValidMoves(std::vector<std::vector<Square>> &board, cons
 
     for (const auto &move : moves)
     {
-        int col = move.x / TILE_SIZE;
-        int row = move.y / TILE_SIZE;
+        int col = tileIndex(move.x);
+        int row = tileIndex(move.y);
 
         // space is occupied by an opponent piece
         if (col >= 0 && col < BOARD_SIZE && row >= 0 && row < BOARD_SIZE && canMoveTo(move, pieces) && isOpponentPiece(move, pieces, getColor()))
         {
-            board[row][col].setHighlight(true, sf::Color::Red);
+            highlights.captures |= Board::squareMask(row, col);
         }
         // space is unoccupied
         else if (col >= 0 && col < BOARD_SIZE && row >= 0 && row < BOARD_SIZE && canMoveTo(move, pieces))
         {
-            board[row][col].setHighlight(true);
+            highlights.moves |= Board::squareMask(row, col);
         }
     }
+    board.highlight(highlights);
 }
 
 // Highlight potential capture zones for the Beholder on the provided board
-void Beholder::highlightCaptureZones(std::vector<std::vector<Square>> &board, const std::vector<std::unique_ptr<Piece>> &pieces) const
+void Beholder::highlightCaptureZones(Board &board, const std::vector<std::unique_ptr<Piece>> &pieces) const
 {
+    Board::Highlights highlights;
     sf::Vector2f currentPosition = getPosition();
-    int startX = currentPosition.x / TILE_SIZE;
-    int startY = currentPosition.y / TILE_SIZE;
+    int startX = tileIndex(currentPosition.x);
+    int startY = tileIndex(currentPosition.y);
 
     // Define the possible capture positions (dx, dy) where dx and dy are combinations that sum to 3
     std::vector<std::pair<int, int>> captureOffsets =
@@ -102,10 +105,11 @@ void Beholder::highlightCaptureZones(std::vector<std::vector<Square>> &board, co
             // Highlight squares where BoulderThrower can capture opponent's piece
             if (isOpponentPiece(target, pieces, getColor()))
             {
-                board[row][col].setHighlight(true, sf::Color::Red);
+                highlights.captures |= Board::squareMask(row, col);
             }
         }
     }
+    board.highlight(highlights);
 }
 
 // Execute the capture of an opponent piece located at the specified target position
@@ -7,7 +7,7 @@
 // Main Functions:
 // - bool Bishop::canMoveTo(const sf::Vector2f &target, const std::vector<std::unique_ptr<Piece>> &pieces) const:
 //   Checks if the Bishop can legally move to the specified target position on the chessboard.
-// - void Bishop::highlightValidMoves(std::vector<std::vector<Square>> &board, const std::vector<std::unique_ptr<Piece>> &pieces) const:
+// - void Bishop::highlightValidMoves(Board &board, const std::vector<std::unique_ptr<Piece>> &pieces) const:
 //   Highlights all valid moves for the Bishop on the provided chessboard, considering its current position and game rules.
 
 // Special Features or Notes:
@@ -38,8 +38,9 @@ bool Bishop::canMoveTo(const sf::Vector2f &target, const std::vector<std::unique
 }
 
 // Highlight valid moves for the Bishop on the provided board
-void Bishop::highlightValidMoves(std::vector<std::vector<Square>> &board, const std::vector<std::unique_ptr<Piece>> &pieces) const
+void Bishop::highlightValidMoves(Board &board, const std::vector<std::unique_ptr<Piece>> &pieces) const
 {
+    Board::Highlights highlights;
     sf::Vector2f currentPosition = getPosition();
     Piece::Color currentPlayerColor = getColor();
 
@@ -51,8 +52,8 @@ void Bishop::highlightValidMoves(std::vector<std::vector<Square>> &board, const
             // Check valid moves in each diagonal direction
             for (float i = 1; i < BOARD_SIZE; ++i)
             {
-                int newX = static_cast<int>(currentPosition.x / TILE_SIZE) + i * dx;
-                int newY = static_cast<int>(currentPosition.y / TILE_SIZE) + i * dy;
+                int newX = tileIndex(currentPosition.x) + i * dx;
+                int newY = tileIndex(currentPosition.y) + i * dy;
 
                 // Check if the new position is within the board bounds
                 if (newX >= 0 && newX < BOARD_SIZE && newY >= 0 && newY < BOARD_SIZE)
@@ -65,12 +66,12 @@ void Bishop::highlightValidMoves(std::vector<std::vector<Square>> &board, const
                         if (!isOpponentPiece(newPosition, pieces, currentPlayerColor))
                         {
                             // Highlight unoccupied squares yellow where Bishop can move
-                            board[newY][newX].setHighlight(true);
+                            highlights.moves |= Board::squareMask(newY, newX);
                         }
                         else if (isOpponentPiece(newPosition, pieces, currentPlayerColor))
                         {
                             // Highlight squares red where Bishop can move and capture opponent's piece
-                            board[newY][newX].setHighlight(true, sf::Color::Red);
+                            highlights.captures |= Board::squareMask(newY, newX);
                         }
 
                         // If the position is occupied by an opponent's piece, stop highlighting in this direction
@@ -93,4 +94,5 @@ void Bishop::highlightValidMoves(std::vector<std::vector<Square>> &board, const
             }
         }
     }
+    board.highlight(highlights);
 }
\ No newline at end of file
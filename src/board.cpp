@@ -0,0 +1,164 @@
+// Filename: board.cpp
+// Description: Implementation of the Board class, which holds the chessboard's square colours and highlights.
+
+// Main Classes:
+// - Board: The fill colour of every square and the highlighted squares as per-colour 64-bit masks.
+
+// Main Functions:
+// - void Board::highlight(SquareMask squares, const sf::Color &color): Highlights a set of squares in one colour.
+// - void Board::highlight(const Highlights &highlights): Applies the moves, captures and ability targets a piece collected.
+// - void Board::clearHighlights(SquareMask squares): Removes the highlights from a set of squares (all by default).
+// - void Board::setHighlight(int sq, bool highlight, const sf::Color &color): The single-square form the game uses for one-off changes.
+
+// Special Features or Notes:
+// - Highlights are kept as one layer per colour in use, at most MaxHighlightColors of them; a layer that loses its
+//   last square is dropped, so the few colours in play (move, capture, ability) stay at the front.
+// - A square is in at most one layer, so the union of the layers is the set of highlighted squares.
+// - Every change that alters a mask bumps the highlight version, which BoardLayer uses to rebuild its overlay.
+
+// Usage or Context:
+// - Created by Game::runChessGame and passed by reference to every piece's highlightValidMoves and to the game logic.
+
+#include "board.h"
+
+constexpr int Board::SquareCount;
+constexpr Board::SquareMask Board::AllSquares;
+constexpr int Board::MaxHighlightColors;
+
+static_assert(Board::SquareCount <= 64, "Board highlights are a 64-bit mask");
+
+Board::Board(const sf::Color &light, const sf::Color &dark)
+{
+    for (int sq = 0; sq < SquareCount; ++sq)
+    {
+        fills[sq] = (sq / BOARD_SIZE + sq % BOARD_SIZE) % 2 == 0 ? light : dark;
+    }
+}
+
+int Board::squareAt(const sf::Vector2f &position)
+{
+    int col = tileIndex(position.x);
+    int row = tileIndex(position.y);
+    if (position.x < 0 || position.y < 0 || col >= BOARD_SIZE || row >= BOARD_SIZE)
+    {
+        return -1;
+    }
+    return row * BOARD_SIZE + col;
+}
+
+Board::SquareMask Board::squareMask(const sf::Vector2f &position)
+{
+    int sq = squareAt(position);
+    return sq < 0 ? 0 : SquareMask(1) << sq;
+}
+
+Board::SquareMask Board::squareMask(int row, int col)
+{
+    if (row < 0 || col < 0 || row >= BOARD_SIZE || col >= BOARD_SIZE)
+    {
+        return 0;
+    }
+    return SquareMask(1) << (row * BOARD_SIZE + col);
+}
+
+sf::Vector2f Board::positionOf(int sq)
+{
+    return sf::Vector2f((sq % BOARD_SIZE) * TILE_SIZE, (sq / BOARD_SIZE) * TILE_SIZE);
+}
+
+Board::SquareMask Board::squaresFilled(const sf::Color &color) const
+{
+    SquareMask squares = 0;
+    for (int sq = 0; sq < SquareCount; ++sq)
+    {
+        if (fills[sq] == color)
+        {
+            squares |= SquareMask(1) << sq;
+        }
+    }
+    return squares;
+}
+
+void Board::setHighlight(int sq, bool highlight, const sf::Color &color)
+{
+    if (sq < 0 || sq >= SquareCount)
+    {
+        return;
+    }
+    if (highlight)
+    {
+        this->highlight(SquareMask(1) << sq, color);
+    }
+    else
+    {
+        clearHighlights(SquareMask(1) << sq);
+    }
+}
+
+// layerCount when no layer has the colour
+int Board::layerOf(const sf::Color &color) const
+{
+    int layer = 0;
+    while (layer < layerCount && layers[layer].color != color)
+    {
+        ++layer;
+    }
+    return layer;
+}
+
+void Board::highlight(SquareMask squares, const sf::Color &color)
+{
+    int target = layerOf(color);
+    if (!squares || (target < layerCount && (layers[target].squares & squares) == squares))
+    {
+        return;
+    }
+
+    // Out of their old colours first, so every square stays in one layer; that can drop emptied layers
+    clearHighlights(squares);
+    target = layerOf(color);
+    if (target == layerCount)
+    {
+        if (layerCount < MaxHighlightColors)
+        {
+            layers[layerCount++] = HighlightLayer{color, 0};
+        }
+        else
+        {
+            // Out of layers the squares join the last colour rather than being lost
+            target = layerCount - 1;
+        }
+    }
+
+    layers[target].squares |= squares;
+    highlightedSquares |= squares;
+    ++highlightVersion;
+}
+
+void Board::highlight(const Highlights &highlights)
+{
+    highlight(highlights.moves);
+    highlight(highlights.captures, sf::Color::Red);
+    highlight(highlights.abilities, sf::Color::Green);
+}
+
+void Board::clearHighlights(SquareMask squares)
+{
+    if (!(highlightedSquares & squares))
+    {
+        return;
+    }
+
+    int kept = 0;
+    for (int layer = 0; layer < layerCount; ++layer)
+    {
+        layers[layer].squares &= ~squares;
+        if (layers[layer].squares)
+        {
+            layers[kept++] = layers[layer];
+        }
+    }
+    layerCount = kept;
+    highlightedSquares &= ~squares;
+    ++highlightVersion;
+}
@@ -0,0 +1,115 @@
+// Filename: boardLayer.cpp
+// Description: Implementation of the BoardLayer class, which draws the chessboard from a cached texture and a highlight overlay.
+
+// Main Classes:
+// - BoardLayer: Keeps the squares pre-rendered and rebuilds the highlight outlines only when they change.
+
+// Main Functions:
+// - void BoardLayer::renderSquares(const Board &board): Renders every square's fill into the texture.
+// - void BoardLayer::draw(sf::RenderTarget &target, const Board &board):
+//   Draws the cached squares and the highlight overlay.
+
+// Special Features or Notes:
+// - The overlay remembers the board's highlight version it was built from, so a frame without highlight
+//   changes costs one comparison.
+// - Each highlight is an outline drawn inside its square as four quads, so neighbouring highlights never cover
+//   each other and the whole overlay is one vertex array.
+// - If no render texture can be created the squares are drawn one by one, the way the board was drawn before.
+
+// Usage or Context:
+// - Created by Game::runChessGame once the board is set up and drawn once per frame of the game loop.
+
+#include "boardLayer.h"
+#include <iostream>
+
+constexpr float BoardLayer::OutlineThickness;
+
+BoardLayer::BoardLayer(const Board &board)
+    : overlay(sf::Quads), overlayVersion(board.getHighlightVersion() - 1)
+{
+    renderSquares(board);
+}
+
+void BoardLayer::renderSquares(const Board &board)
+{
+    squareShapes.clear();
+    for (int sq = 0; sq < Board::SquareCount; ++sq)
+    {
+        sf::RectangleShape shape(sf::Vector2f(TILE_SIZE, TILE_SIZE));
+        shape.setPosition(Board::positionOf(sq));
+        shape.setFillColor(board.getFillColor(sq));
+        squareShapes.push_back(shape);
+    }
+
+    if (!rendered && !squaresTexture.create(BOARD_SIZE * TILE_SIZE, BOARD_SIZE * TILE_SIZE))
+    {
+        std::cerr << "Could not create the board texture, drawing squares directly" << std::endl;
+        return;
+    }
+    squaresTexture.clear(sf::Color::Transparent);
+    for (const auto &shape : squareShapes)
+    {
+        squaresTexture.draw(shape);
+    }
+    squaresTexture.display();
+    squaresSprite.setTexture(squaresTexture.getTexture(), true);
+    rendered = true;
+}
+
+void BoardLayer::updateOverlay(const Board &board)
+{
+    if (board.getHighlightVersion() == overlayVersion)
+    {
+        return;
+    }
+    overlayVersion = board.getHighlightVersion();
+
+    overlay.clear();
+    for (int layer = 0; layer < board.getHighlightLayerCount(); ++layer)
+    {
+        const Board::HighlightLayer &highlight = board.getHighlightLayer(layer);
+        for (Board::SquareMask rest = highlight.squares; rest; rest &= rest - 1)
+        {
+            sf::Vector2f corner = Board::positionOf(__builtin_ctzll(rest));
+            float left = corner.x;
+            float top = corner.y;
+            float right = left + TILE_SIZE;
+            float bottom = top + TILE_SIZE;
+            const float t = OutlineThickness;
+
+            // Top, bottom, left and right bands; the side bands fit between the top and bottom ones
+            const float bands[4][4] = {{left, top, right, top + t},
+                                       {left, bottom - t, right, bottom},
+                                       {left, top + t, left + t, bottom - t},
+                                       {right - t, top + t, right, bottom - t}};
+            for (const auto &band : bands)
+            {
+                overlay.append(sf::Vertex(sf::Vector2f(band[0], band[1]), highlight.color));
+                overlay.append(sf::Vertex(sf::Vector2f(band[2], band[1]), highlight.color));
+                overlay.append(sf::Vertex(sf::Vector2f(band[2], band[3]), highlight.color));
+                overlay.append(sf::Vertex(sf::Vector2f(band[0], band[3]), highlight.color));
+            }
+        }
+    }
+}
+
+void BoardLayer::draw(sf::RenderTarget &target, const Board &board)
+{
+    if (rendered)
+    {
+        target.draw(squaresSprite);
+    }
+    else
+    {
+        for (const auto &shape : squareShapes)
+        {
+            target.draw(shape);
+        }
+    }
+
+    updateOverlay(board);
+    if (overlay.getVertexCount() > 0)
+    {
+        target.draw(overlay);
+    }
+}
@@ -7,9 +7,9 @@
 // Main Functions:
 // - bool BoulderThrower::canMoveTo(const sf::Vector2f &target, const std::vector<std::unique_ptr<Piece>> &pieces) const:
 //   Checks if the BoulderThrower can legally move to the specified target position on the chessboard.
-// - void BoulderThrower::highlightValidMoves(std::vector<std::vector<Square>> &board, const std::vector<std::unique_ptr<Piece>> &pieces) const:
+// - void BoulderThrower::highlightValidMoves(Board &board, const std::vector<std::unique_ptr<Piece>> &pieces) const:
 //   Highlights all valid moves for the BoulderThrower on the provided chessboard, considering its current position and game rules.
-// - void BoulderThrower::highlightCaptureZones(std::vector<std::vector<Square>> &board, const std::vector<std::unique_ptr<Piece>> &pieces) const:
+// - void BoulderThrower::highlightCaptureZones(Board &board, const std::vector<std::unique_ptr<Piece>> &pieces) const:
 //   Highlights all valid capture options for the BoulderThrower on the provided chessboard, considering its current position and game rules.
 // - void BoulderThrower::capture(const sf::Vector2f &target, std::vector<std::unique_ptr<Piece>> &pieces):
 //   Captures an enemy piece. Overwrites the capture function from the Piece class.
@@ -28,7 +28,7 @@
 #include "boulderThrower.h"
 #include "utility.h"
 #include "globals.h"
-#include "square.h"
+#include "board.h"
 #include <vector>
 
 // Determine if the BoulderThrower can move to a specified target position
@@ -58,8 +58,9 @@ bool BoulderThrower::canMoveTo(const sf::Vector2f &target, const std::vector<std
 }
 
 // Highlight valid moves for the BoulderThrower on the provided board
-void BoulderThrower::highlightValidMoves(std::vector<std::vector<Square>> &board, const std::vector<std::unique_ptr<Piece>> &pieces) const
+void BoulderThrower::highlightValidMoves(Board &board, const std::vector<std::unique_ptr<Piece>> &pieces) const
 {
+    Board::Highlights highlights;
     sf::Vector2f currentPosition = getPosition();
 
     // Iterate through each column and row on the board
@@ -69,24 +70,26 @@ void BoulderThrower::highlightValidMoves(std::vector<std::vector<Square>> &board
         sf::Vector2f horizontalTarget(i * TILE_SIZE, currentPosition.y);
         if (canMoveTo(horizontalTarget, pieces))
         {
-            board[static_cast<int>(currentPosition.y / TILE_SIZE)][i].setHighlight(true);
+            highlights.moves |= Board::squareMask(tileIndex(currentPosition.y), i);
         }
 
         // Check and highlight vertical move to each row in the current column
         sf::Vector2f verticalTarget(currentPosition.x, i * TILE_SIZE);
         if (canMoveTo(verticalTarget, pieces))
         {
-            board[i][static_cast<int>(currentPosition.x / TILE_SIZE)].setHighlight(true);
+            highlights.moves |= Board::squareMask(i, tileIndex(currentPosition.x));
         }
     }
+    board.highlight(highlights);
 }
 
 // Highlight potential capture zones for the BoulderThrower on the provided board
-void BoulderThrower::highlightCaptureZones(std::vector<std::vector<Square>> &board, const std::vector<std::unique_ptr<Piece>> &pieces) const
+void BoulderThrower::highlightCaptureZones(Board &board, const std::vector<std::unique_ptr<Piece>> &pieces) const
 {
+    Board::Highlights highlights;
     sf::Vector2f currentPosition = getPosition();
-    int startX = currentPosition.x / TILE_SIZE;
-    int startY = currentPosition.y / TILE_SIZE;
+    int startX = tileIndex(currentPosition.x);
+    int startY = tileIndex(currentPosition.y);
 
     // Define the possible capture positions (dx, dy) where dx and dy are combinations that sum to 3
     std::vector<std::pair<int, int>> captureOffsets =
@@ -106,10 +109,11 @@ void BoulderThrower::highlightCaptureZones(std::vector<std::vector<Square>> &boa
             // Highlight squares where BoulderThrower can capture opponent's piece
             if (isOpponentPiece(target, pieces, getColor()))
             {
-                board[row][col].setHighlight(true, sf::Color::Red);
+                highlights.captures |= Board::squareMask(row, col);
             }
         }
     }
+    board.highlight(highlights);
 }
 
 // Execute the capture of an opponent piece located at the specified target position
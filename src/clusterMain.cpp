@@ -0,0 +1,145 @@
+// Filename: clusterMain.cpp
+// Description: Entry point of battlechess_cluster, which spreads perft and root-move searches over worker processes.
+
+// Main Functions:
+// - int main(int argc, char *argv[]): Coordinator or worker, depending on the arguments.
+
+// Special Features or Notes:
+// - battlechess_cluster perft <depth> [options]: divide per first move and total leaf count.
+// - battlechess_cluster search <depth> [options]: every root move searched to depth on some worker, best first.
+// - Options: --position "<notation>", --workers N, --threads N (per worker), --split N (perft plies cut into units),
+//   --timeout ms (per unit), --fail-after N (the first worker crashes on its n-th unit, to exercise reassignment).
+// - battlechess_cluster --worker <socket> [--threads N] [--fail-after N] is how the coordinator starts its workers.
+
+// Usage or Context:
+// - battlechess_cluster perft 6 --workers 8 --split 2
+
+#include "engineCluster.h"
+#include "engineMoveGen.h"
+#include "engineSearch.h"
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <map>
+#include <stdexcept>
+
+int main(int argc, char *argv[])
+{
+    std::vector<std::string> args(argv + 1, argv + argc);
+    engine::ClusterOptions options;
+    options.workerCommand = argv[0];
+    std::string mode;
+    int depth = 0;
+    int split = 1;
+    std::string workerSocket;
+    engine::Position position = engine::Position::startPosition();
+
+    try
+    {
+        std::size_t i = 0;
+        if (args.size() >= 2 && (args[0] == "perft" || args[0] == "search"))
+        {
+            mode = args[0];
+            depth = std::stoi(args[1]);
+            i = 2;
+        }
+        for (; i < args.size(); i += 2)
+        {
+            if (i + 1 >= args.size())
+                throw std::runtime_error("Missing value for " + args[i]);
+            const std::string &flag = args[i];
+            const std::string &value = args[i + 1];
+            if (flag == "--worker")
+                workerSocket = value;
+            else if (flag == "--position")
+                position = engine::Position::fromNotation(value);
+            else if (flag == "--workers")
+                options.workers = std::max(1, std::stoi(value));
+            else if (flag == "--threads")
+                options.workerThreads = std::max(1, std::stoi(value));
+            else if (flag == "--split")
+                split = std::max(1, std::stoi(value));
+            else if (flag == "--timeout")
+                options.unitTimeoutMs = std::stoi(value);
+            else if (flag == "--fail-after")
+                options.failAfter = std::stoi(value);
+            else
+                throw std::runtime_error("Unknown option " + flag);
+        }
+        if (workerSocket.empty() && (mode.empty() || depth < 1))
+            throw std::runtime_error("Expected perft <depth> or search <depth>");
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << "Error: " << e.what() << std::endl;
+        std::cerr << "Usage: battlechess_cluster perft|search <depth> [--position \"<notation>\"] [--workers N] [--threads N] [--split N] [--timeout ms] [--fail-after N]" << std::endl;
+        return 1;
+    }
+
+    if (!workerSocket.empty())
+    {
+        return engine::runClusterWorker(workerSocket, options.workerThreads, options.failAfter);
+    }
+
+    std::vector<engine::WorkUnit> units = mode == "perft" ? engine::splitPerft(position, depth, split)
+                                                           : engine::splitSearch(position, depth);
+    auto started = std::chrono::steady_clock::now();
+    std::vector<std::int64_t> results;
+    engine::ClusterCoordinator coordinator(options);
+    try
+    {
+        results = coordinator.run(units);
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+
+    if (mode == "perft")
+    {
+        // Divide by first move, in generation order like the engine's perft command
+        std::map<std::string, std::int64_t> byMove;
+        std::vector<std::string> order;
+        std::int64_t total = 0;
+        for (std::size_t i = 0; i < units.size(); ++i)
+        {
+            std::string first = units[i].label.substr(0, units[i].label.find(' '));
+            if (byMove.find(first) == byMove.end())
+            {
+                order.push_back(first);
+            }
+            byMove[first] += results[i];
+            total += results[i];
+        }
+        for (const std::string &move : order)
+        {
+            if (!move.empty())
+            {
+                std::cout << move << ": " << byMove[move] << std::endl;
+            }
+        }
+        std::cout << "nodes " << total << std::endl;
+    }
+    else
+    {
+        std::vector<std::size_t> ranking(units.size());
+        for (std::size_t i = 0; i < ranking.size(); ++i)
+        {
+            ranking[i] = i;
+        }
+        std::stable_sort(ranking.begin(), ranking.end(), [&](std::size_t a, std::size_t b)
+                         { return results[a] > results[b]; });
+        for (std::size_t index : ranking)
+        {
+            std::cout << units[index].move << " score " << engine::scoreToString(static_cast<int>(results[index])) << std::endl;
+        }
+        if (!ranking.empty())
+        {
+            std::cout << "bestmove " << units[ranking.front()].move << std::endl;
+        }
+    }
+    std::cerr << units.size() << " units, " << coordinator.reassignedUnits() << " reassigned, " << seconds << "s" << std::endl;
+    return 0;
+}
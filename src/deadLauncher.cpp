@@ -7,9 +7,9 @@
 // Main Functions:
 // - bool DeadLauncher::canMoveTo(const sf::Vector2f &target, const std::vector<std::unique_ptr<Piece>> &pieces) const:
 //   Checks if the DeadLauncher can legally move to the specified target position on the chessboard.
-// - void DeadLauncher::highlightValidMoves(std::vector<std::vector<Square>> &board, const std::vector<std::unique_ptr<Piece>> &pieces) const:
+// - void DeadLauncher::highlightValidMoves(Board &board, const std::vector<std::unique_ptr<Piece>> &pieces) const:
 //   Highlights all valid moves for the DeadLauncher on the provided chessboard, considering its current position and game rules.
-// - void DeadLauncher::highlightCaptureZones(std::vector<std::vector<Square>> &board, const std::vector<std::unique_ptr<Piece>> &pieces) const:
+// - void DeadLauncher::highlightCaptureZones(Board &board, const std::vector<std::unique_ptr<Piece>> &pieces) const:
 //   Highlights all valid capture options for the DeadLauncher on the provided chessboard, considering its current position and game rules.
 // - void DeadLauncher::capture(const sf::Vector2f &target, std::vector<std::unique_ptr<Piece>> &pieces):
 //   Captures an enemy piece. Overwrites the capture function from the Piece class.
@@ -30,7 +30,7 @@
 #include "necroPawn.h"
 #include "utility.h"
 #include "globals.h"
-#include "square.h"
+#include "board.h"
 #include <vector>
 #include <iostream>
 
@@ -71,8 +71,9 @@ bool DeadLauncher::canMoveTo(const sf::Vector2f &target, const std::vector<std::
         return true;
     }
 
-    // Allow capturing/loading of friendly pawns in the perimeter
-    if (targetPiece->getColor() == getColor() &&
+    // Allow capturing/loading of friendly pawns in the perimeter, one pawn at a time
+    bool adjacent = std::abs(target.x - currentPosition.x) <= TILE_SIZE && std::abs(target.y - currentPosition.y) <= TILE_SIZE;
+    if (targetPiece->getColor() == getColor() && adjacent && !pawnLoaded &&
         (targetPiece->getType() == "Pawn" || targetPiece->getType() == "NecroPawn"))
     {
         return true; // Allow loading of the friendly pawn
@@ -82,19 +83,20 @@ bool DeadLauncher::canMoveTo(const sf::Vector2f &target, const std::vector<std::
 }
 
 // Highlight valid moves for the DeadLauncher on the provided board
-void DeadLauncher::highlightValidMoves(std::vector<std::vector<Square>> &board, const std::vector<std::unique_ptr<Piece>> &pieces) const
+void DeadLauncher::highlightValidMoves(Board &board, const std::vector<std::unique_ptr<Piece>> &pieces) const
 {
+    Board::Highlights highlights;
     sf::Vector2f currentPosition = getPosition();
 
     // Convert the floating-point coordinates to integer indices
-    int row = static_cast<int>(currentPosition.y / TILE_SIZE);
-    int col = static_cast<int>(currentPosition.x / TILE_SIZE);
+    int row = tileIndex(currentPosition.y);
+    int col = tileIndex(currentPosition.x);
 
     // Ensure the indices are within the valid range of the board dimensions
     if (row >= 0 && row < BOARD_SIZE && col >= 0 && col < BOARD_SIZE)
     {
         // Highlight the current position in green
-        board[row][col].setHighlight(true, sf::Color::Green);
+        highlights.abilities |= Board::squareMask(row, col);
     }
 
     // Iterate through each column and row on the board
@@ -106,11 +108,11 @@ void DeadLauncher::highlightValidMoves(std::vector<std::vector<Square>> &board,
         {
             if (!isOpponentPiece(horizontalTarget, pieces, getColor()))
             {
-                board[static_cast<int>(currentPosition.y / TILE_SIZE)][i].setHighlight(true);
+                highlights.moves |= Board::squareMask(tileIndex(currentPosition.y), i);
             }
             else if (isOpponentPiece(horizontalTarget, pieces, getColor()))
             {
-                board[static_cast<int>(currentPosition.y / TILE_SIZE)][i].setHighlight(true, sf::Color::Red);
+                highlights.captures |= Board::squareMask(tileIndex(currentPosition.y), i);
             }
         }
 
@@ -120,22 +122,24 @@ void DeadLauncher::highlightValidMoves(std::vector<std::vector<Square>> &board,
         {
             if (!isOpponentPiece(verticalTarget, pieces, getColor()))
             {
-                board[i][static_cast<int>(currentPosition.x / TILE_SIZE)].setHighlight(true);
+                highlights.moves |= Board::squareMask(i, tileIndex(currentPosition.x));
             }
             else if (isOpponentPiece(verticalTarget, pieces, getColor()))
             {
-                board[i][static_cast<int>(currentPosition.x / TILE_SIZE)].setHighlight(true, sf::Color::Red);
+                highlights.captures |= Board::squareMask(i, tileIndex(currentPosition.x));
             }
         }
     }
+    board.highlight(highlights);
 }
 
 // Highlight potential capture zones for the DeadLauncher on the provided board
-void DeadLauncher::highlightDeadCaptureZones(std::vector<std::vector<Square>> &board, const std::vector<std::unique_ptr<Piece>> &pieces)
+void DeadLauncher::highlightCaptureZones(Board &board, const std::vector<std::unique_ptr<Piece>> &pieces) const
 {
+    Board::Highlights highlights;
     sf::Vector2f currentPosition = getPosition();
-    int startX = currentPosition.x / TILE_SIZE;
-    int startY = currentPosition.y / TILE_SIZE;
+    int startX = tileIndex(currentPosition.x);
+    int startY = tileIndex(currentPosition.y);
 
     // Define the possible capture positions (dx, dy) where dx and dy are combinations that sum to 3
     std::vector<std::pair<int, int>> captureOffsets = {
@@ -154,10 +158,11 @@ void DeadLauncher::highlightDeadCaptureZones(std::vector<std::vector<Square>> &b
             // Highlight squares where DeadLauncher can capture opponent's piece
             if (isOpponentPiece(target, pieces, getColor()) && pawnLoaded)
             {
-                board[row][col].setHighlight(true, sf::Color::Red);
+                highlights.captures |= Board::squareMask(row, col);
             }
         }
     }
+    board.highlight(highlights);
 }
 
 // Execute the capture of an opponent piece located at the specified target position
@@ -206,10 +211,11 @@ void DeadLauncher::capture(const sf::Vector2f &target, std::vector<std::unique_p
     }
 }
 
-void DeadLauncher::highlightAdjacentPawns(std::vector<std::unique_ptr<Piece>> &pieces, std::vector<std::vector<Square>> &board)
+void DeadLauncher::highlightAdjacentPawns(std::vector<std::unique_ptr<Piece>> &pieces, Board &board)
 {
-    int col = getPosition().x / TILE_SIZE;
-    int row = getPosition().y / TILE_SIZE;
+    Board::Highlights highlights;
+    int col = tileIndex(getPosition().x);
+    int row = tileIndex(getPosition().y);
 
     for (const auto &dir : directions)
     {
@@ -221,18 +227,19 @@ void DeadLauncher::highlightAdjacentPawns(std::vector<std::unique_ptr<Piece>> &p
             Piece *adjacentPiece = getPieceAtPosition(sf::Vector2f(newCol * TILE_SIZE, newRow * TILE_SIZE), pieces);
             if (adjacentPiece && (adjacentPiece->getType() == "Pawn" || adjacentPiece->getType() == "NecroPawn"))
             {
-                board[newRow][newCol].setHighlight(true, sf::Color::Red);
+                highlights.captures |= Board::squareMask(newRow, newCol);
             }
         }
     }
+    board.highlight(highlights);
 }
 
 // Helper method to check if the target is within the throwing range of the DeadLauncher
 bool DeadLauncher::isTargetWithinRange(const sf::Vector2f &target) const
 {
     sf::Vector2f currentPosition = getPosition();
-    int dx = std::abs(static_cast<int>(currentPosition.x / TILE_SIZE) - static_cast<int>(target.x / TILE_SIZE));
-    int dy = std::abs(static_cast<int>(currentPosition.y / TILE_SIZE) - static_cast<int>(target.y / TILE_SIZE));
+    int dx = std::abs(tileIndex(currentPosition.x) - tileIndex(target.x));
+    int dy = std::abs(tileIndex(currentPosition.y) - tileIndex(target.y));
 
     // Check if the target is within the throwing range (e.g., 3 squares away in any direction)
     return (dx + dy == 3);
@@ -0,0 +1,173 @@
+// Filename: effectScheduler.cpp
+// Description: Implementation of the EffectScheduler class, which expires the timed effects of piece abilities at the end of a turn.
+
+// Main Classes:
+// - EffectScheduler: Keeps a queue of effects per turn and applies or undoes them on the pieces they belong to.
+
+// Main Functions:
+// - void EffectScheduler::schedule(Effect effect, Piece &piece, int turns): Applies an effect and queues its expiry.
+// - void EffectScheduler::cancel(Effect effect, Piece &piece): Ends an effect before it expires.
+// - void EffectScheduler::endTurn(std::vector<std::unique_ptr<Piece>> &pieces, TextureManager &textureManager):
+//   Expires the effects of the turn that just ended.
+// - void EffectScheduler::adoptStuns(const std::vector<std::unique_ptr<Piece>> &pieces, Piece::Color side):
+//   Queues the expiry of stuns received from the opponent.
+
+// Special Features or Notes:
+// - GhostKnight stuns last until the stunned piece's owner has had its next turn. The opponent clears stuns on
+//   its own pieces and sends the result, so a stun this client put on an enemy is kept until the end of this
+//   client's next turn at the latest.
+// - A dominated piece stays a Queen for the owner's next turn and reverts at its end.
+// - Familiar stone has no expiry; selecting the Familiar wakes it through cancel().
+// - A HellPawn that infected a piece is removed at the end of the turn instead of being searched for every frame.
+// - Entries name pieces by id, so a copied scheduler together with a cloned piece list is an independent game
+//   state that can be explored and thrown away.
+
+// Usage or Context:
+// - Owned by the game loop in game.cpp, which calls endTurn() once when the player's turn is over.
+
+#include "effectScheduler.h"
+#include "queenOfDomination.h"
+#include <algorithm>
+#include <iostream>
+
+namespace
+{
+    std::vector<std::unique_ptr<Piece>>::iterator findPiece(std::vector<std::unique_ptr<Piece>> &pieces, int pieceId)
+    {
+        return std::find_if(pieces.begin(), pieces.end(), [pieceId](const std::unique_ptr<Piece> &piece)
+                            { return piece->getId() == pieceId; });
+    }
+
+    template <typename Entries>
+    void removeEntries(Entries &entries, EffectScheduler::Effect effect, int pieceId)
+    {
+        entries.erase(std::remove_if(entries.begin(), entries.end(), [&](const typename Entries::value_type &entry)
+                                     { return entry.effect == effect && entry.pieceId == pieceId; }),
+                      entries.end());
+    }
+}
+
+constexpr int EffectScheduler::UntilCancelled;
+
+// Apply the effect now and queue it under the turn it runs out
+void EffectScheduler::schedule(Effect effect, Piece &piece, int turnCount)
+{
+    // Scheduling again restarts the effect rather than stacking a second expiry
+    for (auto &entries : turns)
+    {
+        removeEntries(entries, effect, piece.getId());
+    }
+    removeEntries(untilCancelled, effect, piece.getId());
+
+    if (effect == Effect::Stun)
+    {
+        piece.setStunned(true);
+    }
+    else if (effect == Effect::Stone)
+    {
+        piece.setStone(true);
+    }
+
+    Entry entry{effect, piece.getId()};
+    if (turnCount == UntilCancelled)
+    {
+        untilCancelled.push_back(entry);
+        return;
+    }
+    if (turns.size() <= static_cast<size_t>(turnCount))
+    {
+        turns.resize(turnCount + 1);
+    }
+    turns[turnCount].push_back(entry);
+}
+
+// End the effect before its turn comes
+void EffectScheduler::cancel(Effect effect, Piece &piece)
+{
+    for (auto &entries : turns)
+    {
+        removeEntries(entries, effect, piece.getId());
+    }
+    removeEntries(untilCancelled, effect, piece.getId());
+
+    if (effect == Effect::Stun)
+    {
+        piece.setStunned(false);
+    }
+    else if (effect == Effect::Stone)
+    {
+        piece.setStone(false);
+    }
+}
+
+// Expire everything queued for the turn that just ended; pieces that left the board are skipped
+void EffectScheduler::endTurn(std::vector<std::unique_ptr<Piece>> &pieces, TextureManager &textureManager)
+{
+    if (turns.empty())
+    {
+        return;
+    }
+    std::vector<Entry> expiring = std::move(turns.front());
+    turns.pop_front();
+
+    for (const Entry &entry : expiring)
+    {
+        auto it = findPiece(pieces, entry.pieceId);
+        if (it == pieces.end())
+        {
+            continue;
+        }
+
+        switch (entry.effect)
+        {
+        case Effect::Stun:
+            (*it)->setStunned(false);
+            break;
+        case Effect::Stone:
+            (*it)->setStone(false);
+            break;
+        case Effect::Domination:
+            if (auto queen = dynamic_cast<QueenOfDomination *>(it->get()))
+            {
+                queen->returnOriginalSprite(pieces, textureManager);
+            }
+            break;
+        case Effect::Removal:
+            std::cout << "Removing " << (*it)->getType() << " at end of turn." << std::endl;
+            pieces.erase(it);
+            break;
+        }
+    }
+}
+
+// Stuns that came in a packet wear off at the end of the side's current turn
+void EffectScheduler::adoptStuns(const std::vector<std::unique_ptr<Piece>> &pieces, Piece::Color side)
+{
+    for (const auto &piece : pieces)
+    {
+        if (piece->getColor() == side && piece->isStunned() && !isPending(Effect::Stun, piece->getId()))
+        {
+            if (turns.empty())
+            {
+                turns.resize(1);
+            }
+            turns.front().push_back(Entry{Effect::Stun, piece->getId()});
+        }
+    }
+}
+
+bool EffectScheduler::isPending(Effect effect, int pieceId) const
+{
+    auto matches = [&](const Entry &entry)
+    {
+        return entry.effect == effect && entry.pieceId == pieceId;
+    };
+    for (const auto &entries : turns)
+    {
+        if (std::any_of(entries.begin(), entries.end(), matches))
+        {
+            return true;
+        }
+    }
+    return std::any_of(untilCancelled.begin(), untilCancelled.end(), matches);
+}
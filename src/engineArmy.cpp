@@ -0,0 +1,331 @@
+// Filename: engineArmy.cpp
+// Description: Army builds from the gemstone menus and the self-play optimizer that ranks them.
+
+// Main Classes:
+// - ArmyBuild: A race plus the set of upgraded slots, priced like the army menus.
+// - ArmyOptimizer: Genetic algorithm over builds, scored by self-play games run on a ThreadPool.
+
+// Main Functions:
+// - Position armyStartPosition(const ArmyBuild &white, const ArmyBuild &black): Board for a pairing.
+// - std::vector<ArmyScore> ArmyOptimizer::run(...): Evolves every race and returns all scored builds.
+
+// Special Features or Notes:
+// - Slot order and prices follow pieceNames/costsText in menu.cpp (R1 K1 B1 King Queen B2 K2 R2, then P1-P8).
+// - Illegal children of crossover or mutation are repaired by dropping random upgrades until they fit
+//   the 20 gemstone budget.
+
+// Usage or Context:
+// - Used by armyMain.cpp (battlechess_army) to guide balance changes.
+
+#include "engineArmy.h"
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <set>
+
+namespace engine
+{
+    namespace
+    {
+        const Base backRank[BOARD_DIM] = {RookBase, KnightBase, BishopBase, KingBase, QueenBase, BishopBase, KnightBase, RookBase};
+        const int backRankCosts[BOARD_DIM] = {4, 3, 3, 2, 5, 3, 3, 4};
+        const char *slotNames[ARMY_SLOTS] = {"R1", "K1", "B1", "King", "Queen", "B2", "K2", "R2",
+                                             "P1", "P2", "P3", "P4", "P5", "P6", "P7", "P8"};
+        const char *raceNames[RaceCount] = {"Standard", "Necro", "Wizard", "Beast", "Hell", "Custom"};
+
+        ArmyBuild repair(ArmyBuild build, std::mt19937 &rng)
+        {
+            while (!build.isLegal())
+            {
+                std::vector<int> selected;
+                for (int slot = 0; slot < ARMY_SLOTS; ++slot)
+                {
+                    if (build.upgrades & (1u << slot))
+                    {
+                        selected.push_back(slot);
+                    }
+                }
+                build.upgrades &= ~(1u << selected[rng() % selected.size()]);
+            }
+            return build;
+        }
+
+        ArmyBuild randomBuild(Race race, std::mt19937 &rng)
+        {
+            ArmyBuild build;
+            build.race = race;
+            std::vector<int> slots(ARMY_SLOTS);
+            for (int slot = 0; slot < ARMY_SLOTS; ++slot)
+            {
+                slots[slot] = slot;
+            }
+            std::shuffle(slots.begin(), slots.end(), rng);
+
+            // Spend a random share of the budget so cheap and expensive builds both appear
+            int budget = static_cast<int>(rng() % (ARMY_BUDGET + 1));
+            for (int slot : slots)
+            {
+                if (build.cost() + slotCost(slot) <= budget)
+                {
+                    build.upgrades |= 1u << slot;
+                }
+            }
+            return build;
+        }
+
+        const ArmyBuild &tournament(const std::vector<ArmyScore> &ranked, std::mt19937 &rng)
+        {
+            const ArmyScore *best = &ranked[rng() % ranked.size()];
+            for (int round = 0; round < 2; ++round)
+            {
+                const ArmyScore &other = ranked[rng() % ranked.size()];
+                if (other.winRate() > best->winRate())
+                {
+                    best = &other;
+                }
+            }
+            return best->build;
+        }
+
+        bool stronger(const ArmyScore &a, const ArmyScore &b)
+        {
+            return a.winRate() != b.winRate() ? a.winRate() > b.winRate() : a.games > b.games;
+        }
+    }
+
+    Base slotBase(int slot)
+    {
+        return slot < BOARD_DIM ? backRank[slot] : PawnBase;
+    }
+
+    int slotCost(int slot)
+    {
+        return slot < BOARD_DIM ? backRankCosts[slot] : 1;
+    }
+
+    int ArmyBuild::cost() const
+    {
+        int total = 0;
+        for (int slot = 0; slot < ARMY_SLOTS; ++slot)
+        {
+            if (upgrades & (1u << slot))
+            {
+                total += slotCost(slot);
+            }
+        }
+        return total;
+    }
+
+    Kind ArmyBuild::kindAt(int slot) const
+    {
+        bool upgraded = (upgrades & (1u << slot)) != 0;
+        return makeKind(upgraded ? race : Standard, slotBase(slot));
+    }
+
+    std::string ArmyBuild::describe() const
+    {
+        std::string text = std::string(raceNames[race]) + " [";
+        bool first = true;
+        for (int slot = 0; slot < ARMY_SLOTS; ++slot)
+        {
+            if (upgrades & (1u << slot))
+            {
+                text += (first ? "" : " ") + std::string(slotNames[slot]) + "=" + kindName(kindAt(slot));
+                first = false;
+            }
+        }
+        return text + "] cost " + std::to_string(cost());
+    }
+
+    Position armyStartPosition(const ArmyBuild &white, const ArmyBuild &black)
+    {
+        Position position;
+        for (int slot = 0; slot < ARMY_SLOTS; ++slot)
+        {
+            int col = slot % BOARD_DIM;
+            int whiteRow = slot < BOARD_DIM ? 0 : 1;
+            position.put(makeSquare(whiteRow, col), white.kindAt(slot), White);
+            position.put(makeSquare(BOARD_DIM - 1 - whiteRow, col), black.kindAt(slot), Black);
+        }
+        return position;
+    }
+
+    ArmyOptimizer::ArmyOptimizer(const OptimizerOptions &optimizerOptions, ThreadPool &threadPool)
+        : options(optimizerOptions), pool(threadPool)
+    {
+    }
+
+    std::vector<ArmyScore> ArmyOptimizer::run(const std::vector<Race> &races, const ProgressCallback &onGeneration,
+                                              const RecordCallback &onGame)
+    {
+        std::mt19937 rng(options.seed);
+        std::map<ArmyBuild, ArmyScore> scores;
+        std::map<Race, std::vector<ArmyBuild>> populations;
+        for (Race race : races)
+        {
+            std::set<ArmyBuild> unique;
+            for (int attempt = 0; attempt < options.population * 20 && static_cast<int>(unique.size()) < options.population; ++attempt)
+            {
+                unique.insert(randomBuild(race, rng));
+            }
+            populations[race].assign(unique.begin(), unique.end());
+        }
+
+        auto rankedFor = [&](Race race)
+        {
+            std::vector<ArmyScore> ranked;
+            for (const auto &entry : scores)
+            {
+                if (entry.first.race == race)
+                {
+                    ranked.push_back(entry.second);
+                }
+            }
+            std::sort(ranked.begin(), ranked.end(), stronger);
+            return ranked;
+        };
+
+        struct Game
+        {
+            ArmyBuild candidate;
+            ArmyBuild opponent;
+            bool candidateWhite;
+            std::uint32_t seed;
+            float result; // from the candidate's view
+        };
+
+        for (int generation = 1; generation <= options.generations; ++generation)
+        {
+            // Opponents: the standard army plus the best builds found so far for every race
+            std::vector<ArmyBuild> opponents(1);
+            for (Race race : races)
+            {
+                std::vector<ArmyScore> ranked = rankedFor(race);
+                for (int i = 0; i < options.elites && i < static_cast<int>(ranked.size()); ++i)
+                {
+                    opponents.push_back(ranked[i].build);
+                }
+            }
+
+            std::vector<Game> games;
+            for (Race race : races)
+            {
+                for (const ArmyBuild &candidate : populations[race])
+                {
+                    int offset = static_cast<int>(rng() % opponents.size());
+                    for (int g = 0; g < options.gamesPerCandidate; ++g)
+                    {
+                        const ArmyBuild &opponent = opponents[(offset + g / 2) % opponents.size()];
+                        games.push_back(Game{candidate, opponent, g % 2 == 0, static_cast<std::uint32_t>(rng()), 0.0f});
+                    }
+                }
+            }
+
+            // Players keep their transposition tables between games; tasks borrow one from the spares
+            std::vector<std::unique_ptr<SelfPlayer>> spares;
+            std::mutex mutex;
+            parallelFor(pool, games.size(), 1, [&](std::size_t first, std::size_t end)
+                        {
+                std::unique_ptr<SelfPlayer> player;
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    if (!spares.empty())
+                    {
+                        player = std::move(spares.back());
+                        spares.pop_back();
+                    }
+                }
+                if (!player)
+                {
+                    player.reset(new SelfPlayer());
+                }
+
+                std::vector<std::string> positions;
+                for (std::size_t index = first; index < end; ++index)
+                {
+                    Game &game = games[index];
+                    const ArmyBuild &white = game.candidateWhite ? game.candidate : game.opponent;
+                    const ArmyBuild &black = game.candidateWhite ? game.opponent : game.candidate;
+                    positions.clear();
+                    float whiteResult = player->play(armyStartPosition(white, black), options.play, game.seed,
+                                                     onGame ? &positions : nullptr);
+                    game.result = game.candidateWhite ? whiteResult : 1.0f - whiteResult;
+                    if (onGame)
+                    {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        onGame(positions, whiteResult);
+                    }
+                }
+
+                std::lock_guard<std::mutex> lock(mutex);
+                spares.push_back(std::move(player)); });
+
+            for (const Game &game : games)
+            {
+                ArmyScore &score = scores[game.candidate];
+                score.build = game.candidate;
+                score.points += game.result;
+                score.games += 1;
+            }
+
+            std::vector<ArmyScore> best;
+            for (Race race : races)
+            {
+                std::vector<ArmyScore> ranked = rankedFor(race);
+                if (!ranked.empty())
+                {
+                    best.push_back(ranked.front());
+                }
+            }
+            if (onGeneration)
+            {
+                onGeneration(generation, best);
+            }
+
+            // Next generation: elites survive, the rest are bred from tournament winners
+            for (Race race : races)
+            {
+                std::vector<ArmyScore> current;
+                for (const ArmyBuild &build : populations[race])
+                {
+                    current.push_back(scores[build]);
+                }
+                std::sort(current.begin(), current.end(), stronger);
+
+                std::set<ArmyBuild> nextPopulation;
+                for (int i = 0; i < options.elites && i < static_cast<int>(current.size()); ++i)
+                {
+                    nextPopulation.insert(current[i].build);
+                }
+                for (int attempt = 0; attempt < options.population * 20 && static_cast<int>(nextPopulation.size()) < options.population; ++attempt)
+                {
+                    const ArmyBuild &mother = tournament(current, rng);
+                    const ArmyBuild &father = tournament(current, rng);
+                    ArmyBuild child;
+                    child.race = race;
+                    std::uint16_t fromMother = static_cast<std::uint16_t>(rng());
+                    child.upgrades = (mother.upgrades & fromMother) | (father.upgrades & ~fromMother);
+                    for (int slot = 0; slot < ARMY_SLOTS; ++slot)
+                    {
+                        if (std::uniform_real_distribution<double>(0.0, 1.0)(rng) < options.mutationRate)
+                        {
+                            child.upgrades ^= 1u << slot;
+                        }
+                    }
+                    nextPopulation.insert(repair(child, rng));
+                }
+                populations[race].assign(nextPopulation.begin(), nextPopulation.end());
+            }
+        }
+
+        std::vector<ArmyScore> all;
+        for (const auto &entry : scores)
+        {
+            all.push_back(entry.second);
+        }
+        std::sort(all.begin(), all.end(), stronger);
+        return all;
+    }
+}
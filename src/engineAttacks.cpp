@@ -0,0 +1,148 @@
+// Filename: engineAttacks.cpp
+// Description: Precomputed per-square target tables and sliding helpers for the headless engine.
+
+// Main Functions:
+// - const BasicAttackTables<Geometry> &attackTablesFor(): Returns the lazily built neighbourhood tables.
+// - Mask slidingAttacks<Geometry>(int sq, Mask occupied, bool orthogonal, bool diagonal):
+//   Walks each ray until the first occupied square, the bitboard equivalent of isPathClear.
+// - Mask queenLineTargets<Geometry>(int sq, Mask occupied, int ignoreSquare):
+//   Queen rays that look through one square, used by QueenOfDestruction::massDestruction.
+
+// Special Features or Notes:
+// - Everything is instantiated for the 8x8, 10x10 and 12x12 geometries; the offsets do not change
+//   with the board size, only where they fall off the edge.
+// - Howler family sets are precomputed as unions (knight and king leaps, rook and queen slides),
+//   so a Howler that absorbed several families is generated like any single leaper.
+// - Offsets use dx for the column step and dy for the row step like the Piece classes. Piece
+//   movement is not here: it is compiled from the piece catalog in enginePieces.cpp.
+
+// Usage or Context:
+// - Shared by move generation, position updates and evaluation.
+
+#include "engineAttacks.h"
+#include "enginePieces.h"
+#include <utility>
+#include <vector>
+
+namespace engine
+{
+    namespace
+    {
+        const int orthogonalDirections[4][2] = {{1, 0}, {-1, 0}, {0, 1}, {0, -1}};
+        const int diagonalDirections[4][2] = {{1, 1}, {1, -1}, {-1, 1}, {-1, -1}};
+
+        template <typename Geometry>
+        typename Geometry::Mask fromOffsets(int sq, const std::vector<std::pair<int, int>> &offsets)
+        {
+            typename Geometry::Mask targets = 0;
+            for (const auto &offset : offsets)
+            {
+                int col = Geometry::colOf(sq) + offset.first;
+                int row = Geometry::rowOf(sq) + offset.second;
+                if (Geometry::onBoard(row, col))
+                {
+                    targets |= Geometry::squareBit(Geometry::makeSquare(row, col));
+                }
+            }
+            return targets;
+        }
+
+        // Fills tables in place: with the Howler unions the 12x12 tables are too large to pass by value
+        template <typename Geometry>
+        bool buildTables(BasicAttackTables<Geometry> &tables)
+        {
+            const std::vector<std::pair<int, int>> kingOffsets = {{1, 0}, {-1, 0}, {0, 1}, {0, -1}, {1, 1}, {1, -1}, {-1, 1}, {-1, -1}};
+            const std::vector<std::pair<int, int>> orthogonalOffsets = {{1, 0}, {-1, 0}, {0, 1}, {0, -1}};
+            const std::vector<std::pair<int, int>> knightOffsets = {{2, 1}, {2, -1}, {-2, 1}, {-2, -1}, {1, 2}, {1, -2}, {-1, 2}, {-1, -2}};
+
+            for (int sq = 0; sq < Geometry::squares; ++sq)
+            {
+                tables.king[sq] = fromOffsets<Geometry>(sq, kingOffsets);
+                tables.orthogonal[sq] = fromOffsets<Geometry>(sq, orthogonalOffsets);
+                tables.knight[sq] = fromOffsets<Geometry>(sq, knightOffsets);
+            }
+
+            using Mask = typename Geometry::Mask;
+            for (int families = 0; families < HowlerFamilySets; ++families)
+            {
+                std::uint16_t howlerFlags = static_cast<std::uint16_t>(families << HowlerFamilyShift);
+                for (int sq = 0; sq < Geometry::squares; ++sq)
+                {
+                    tables.howlLeaps[families][sq] = ((howlerFlags & FlagHowlerKnight) ? tables.knight[sq] : Mask(0)) |
+                                                     ((howlerFlags & FlagHowlerKing) ? tables.king[sq] : Mask(0));
+                }
+                std::uint8_t slides = (howlerFlags & FlagHowlerRook) ? SlideOrthogonal : 0;
+                slides |= (howlerFlags & FlagHowlerQueen) ? SlideOrthogonal | SlideDiagonal : 0;
+                tables.howlSlides[families] = slides;
+            }
+            return true;
+        }
+
+        template <typename Geometry>
+        typename Geometry::Mask walkRays(int sq, const typename Geometry::Mask &occupied, const int (*directions)[2], int count, int ignoreSquare)
+        {
+            typename Geometry::Mask targets = 0;
+            for (int d = 0; d < count; ++d)
+            {
+                int row = Geometry::rowOf(sq) + directions[d][1];
+                int col = Geometry::colOf(sq) + directions[d][0];
+                while (Geometry::onBoard(row, col))
+                {
+                    int target = Geometry::makeSquare(row, col);
+                    if (target != ignoreSquare)
+                    {
+                        targets |= Geometry::squareBit(target);
+                        if (occupied & Geometry::squareBit(target))
+                        {
+                            break;
+                        }
+                    }
+                    row += directions[d][1];
+                    col += directions[d][0];
+                }
+            }
+            return targets;
+        }
+    }
+
+    template <typename Geometry>
+    const BasicAttackTables<Geometry> &attackTablesFor()
+    {
+        static BasicAttackTables<Geometry> tables;
+        static const bool built = buildTables(tables);
+        (void)built;
+        return tables;
+    }
+
+    template <typename Geometry>
+    typename Geometry::Mask slidingAttacks(int sq, const typename Geometry::Mask &occupied, bool orthogonal, bool diagonal)
+    {
+        typename Geometry::Mask targets = 0;
+        if (orthogonal)
+        {
+            targets |= walkRays<Geometry>(sq, occupied, orthogonalDirections, 4, -1);
+        }
+        if (diagonal)
+        {
+            targets |= walkRays<Geometry>(sq, occupied, diagonalDirections, 4, -1);
+        }
+        return targets;
+    }
+
+    template <typename Geometry>
+    typename Geometry::Mask queenLineTargets(int sq, const typename Geometry::Mask &occupied, int ignoreSquare)
+    {
+        return walkRays<Geometry>(sq, occupied, orthogonalDirections, 4, ignoreSquare) |
+               walkRays<Geometry>(sq, occupied, diagonalDirections, 4, ignoreSquare);
+    }
+
+    template const BasicAttackTables<Board8> &attackTablesFor<Board8>();
+    template const BasicAttackTables<Board10> &attackTablesFor<Board10>();
+    template const BasicAttackTables<Board12> &attackTablesFor<Board12>();
+    template Board8::Mask slidingAttacks<Board8>(int sq, const Board8::Mask &occupied, bool orthogonal, bool diagonal);
+    template Board10::Mask slidingAttacks<Board10>(int sq, const Board10::Mask &occupied, bool orthogonal, bool diagonal);
+    template Board12::Mask slidingAttacks<Board12>(int sq, const Board12::Mask &occupied, bool orthogonal, bool diagonal);
+    template Board8::Mask queenLineTargets<Board8>(int sq, const Board8::Mask &occupied, int ignoreSquare);
+    template Board10::Mask queenLineTargets<Board10>(int sq, const Board10::Mask &occupied, int ignoreSquare);
+    template Board12::Mask queenLineTargets<Board12>(int sq, const Board12::Mask &occupied, int ignoreSquare);
+}
@@ -0,0 +1,249 @@
+// Filename: engineBatch.cpp
+// Description: Batch evaluation of packed positions for offline analysis jobs.
+
+// Main Classes:
+// - BatchEvaluator: Scores and counts moves for arrays of PackedPosition on a ThreadPool.
+
+// Main Functions:
+// - void BatchEvaluator::run(const PackedPosition *positions, std::size_t count, int *scores, int *moveCounts):
+//   Fills one score and one move count per position.
+
+// Special Features or Notes:
+// - Each block of EVAL_BLOCK positions is transposed into planes indexed [term][side][position], so a
+//   term is one tight loop of AND + popcount over contiguous bitboards. The loops have no branches and
+//   vectorize when the compiler may use a vector popcount (see BATTLECHESS_NATIVE in cmakelists.txt).
+// - Results are identical to evaluate(); the packed piece list is read directly, so positions are only
+//   rebuilt when move counts or the mobility term are needed. Reserve pieces add their material per position.
+// - Move counts rebuild each position with unpackBoard, which skips the Zobrist hash, and count with countMoves,
+//   which adds up target masks instead of listing moves; both cost most of the per-position loop otherwise.
+
+// Usage or Context:
+// - Used by batchBench.cpp (battlechess_batchbench) and by tools that score game records in bulk.
+
+#include "engineBatch.h"
+#include "engineAttacks.h"
+#include "engineMoveGen.h"
+#include "enginePieces.h"
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+
+namespace engine
+{
+    namespace
+    {
+        struct Planes
+        {
+            std::uint64_t kindsPresent; // material rows are only cleared and scanned for kinds in the block
+            Bitboard material[KindCount][2][EVAL_BLOCK];
+            Bitboard pawns[2][EVAL_BLOCK];
+            Bitboard officers[2][EVAL_BLOCK]; // neither pawn nor king, scored for centralization
+            Bitboard kings[2][EVAL_BLOCK];
+            Bitboard stunned[2][EVAL_BLOCK];
+            Bitboard loaded[2][EVAL_BLOCK];
+            Bitboard ready[2][EVAL_BLOCK]; // GhoulKing / QueenOfDomination ability unused
+        };
+
+        // Squares by distance from the four centre squares, and rows, as used by evaluate()
+        struct Masks
+        {
+            Bitboard centreRing[2 * BOARD_DIM];
+            Bitboard row[BOARD_DIM];
+
+            Masks()
+            {
+                std::memset(this, 0, sizeof(*this));
+                for (int sq = 0; sq < NUM_SQUARES; ++sq)
+                {
+                    int r = rowOf(sq);
+                    int c = colOf(sq);
+                    int dr = r < BOARD_DIM / 2 ? BOARD_DIM / 2 - 1 - r : r - BOARD_DIM / 2;
+                    int dc = c < BOARD_DIM / 2 ? BOARD_DIM / 2 - 1 - c : c - BOARD_DIM / 2;
+                    centreRing[dr + dc] |= squareBit(sq);
+                    row[r] |= squareBit(sq);
+                }
+            }
+        };
+
+        const Masks &masks()
+        {
+            static const Masks instance;
+            return instance;
+        }
+
+        void transpose(const PackedPosition *positions, int count, Planes &planes)
+        {
+            planes.kindsPresent = 0;
+            std::memset(&planes.pawns, 0, sizeof(planes) - offsetof(Planes, pawns));
+            for (int i = 0; i < count; ++i)
+            {
+                const PackedPosition &packed = positions[i];
+                Bitboard pieces = packed.occupied;
+                for (int index = 0; pieces; ++index)
+                {
+                    Bitboard bit = squareBit(popLsb(pieces));
+                    int side = (packed.kinds[index] & PACKED_BLACK) ? Black : White;
+                    std::uint16_t pieceFlags = packed.flags[index];
+                    Kind kind = (pieceFlags & FlagDominated) ? Queen : static_cast<Kind>(packed.kinds[index] & ~PACKED_BLACK);
+
+                    if (!(planes.kindsPresent & (1ull << kind)))
+                    {
+                        planes.kindsPresent |= 1ull << kind;
+                        std::memset(planes.material[kind], 0, sizeof(planes.material[kind]));
+                    }
+                    planes.material[kind][side][i] |= bit;
+                    Base base = baseOf(kind);
+                    if (base == PawnBase)
+                        planes.pawns[side][i] |= bit;
+                    else if (base == KingBase)
+                        planes.kings[side][i] |= bit;
+                    else
+                        planes.officers[side][i] |= bit;
+                    if (pieceFlags & FlagStunned)
+                        planes.stunned[side][i] |= bit;
+                    if (pieceFlags & FlagLoaded)
+                        planes.loaded[side][i] |= bit;
+                    if ((kindAbilities(kind) & (AbilityRaise | AbilityDominate)) && !(pieceFlags & FlagAbilityUsed))
+                        planes.ready[side][i] |= bit;
+                }
+            }
+        }
+
+        // total[i] += weight * (pieces of White in mask - pieces of Black in mask) for the whole block
+        void accumulate(int *total, const Bitboard *white, const Bitboard *black, Bitboard mask, int weight, int count)
+        {
+            if (weight == 0)
+            {
+                return;
+            }
+            for (int i = 0; i < count; ++i)
+            {
+                total[i] += weight * (popCount(white[i] & mask) - popCount(black[i] & mask));
+            }
+        }
+
+        int moveCount(const Position &position, Side side)
+        {
+            if (position.sideToMove() == side)
+            {
+                return countMoves(position);
+            }
+            Position flipped = position;
+            flipped.makeNullMove();
+            return countMoves(flipped);
+        }
+    }
+
+    BatchEvaluator::BatchEvaluator(const EvalParams &evalParams, ThreadPool &threadPool)
+        : params(evalParams), pool(threadPool)
+    {
+    }
+
+    void BatchEvaluator::runBlock(const PackedPosition *positions, int count, int *scores, int *moveCounts) const
+    {
+        Planes planes;
+        transpose(positions, count, planes);
+
+        const Masks &m = masks();
+        const Bitboard all = ~Bitboard(0);
+        int total[EVAL_BLOCK] = {};
+
+        for (std::uint64_t present = planes.kindsPresent; present; present &= present - 1)
+        {
+            int kind = lsb(present);
+            accumulate(total, planes.material[kind][White], planes.material[kind][Black], all, params.material(static_cast<Kind>(kind)), count);
+        }
+        for (int distance = 0; distance <= BOARD_DIM - 2; ++distance)
+        {
+            accumulate(total, planes.officers[White], planes.officers[Black], m.centreRing[distance],
+                       params.weights[TermCentralization] * (BOARD_DIM - 2 - distance), count);
+        }
+        int advance = params.weights[TermPawnAdvance];
+        for (int row = 0; row < BOARD_DIM; ++row)
+        {
+            int whiteRows = advance * (row - 1);
+            int blackRows = advance * (BOARD_DIM - 2 - row);
+            for (int i = 0; i < count; ++i)
+            {
+                total[i] += whiteRows * popCount(planes.pawns[White][i] & m.row[row]) -
+                            blackRows * popCount(planes.pawns[Black][i] & m.row[row]);
+            }
+        }
+        accumulate(total, planes.stunned[White], planes.stunned[Black], all, params.weights[TermStunned], count);
+        accumulate(total, planes.loaded[White], planes.loaded[Black], all, params.weights[TermLoaded], count);
+        accumulate(total, planes.ready[White], planes.ready[Black], all, params.weights[TermAbilityReady], count);
+        int extraKing = params.weights[TermKingCount];
+        for (int i = 0; i < count; ++i)
+        {
+            total[i] += extraKing * (std::max(0, popCount(planes.kings[White][i]) - 1) -
+                                     std::max(0, popCount(planes.kings[Black][i]) - 1));
+        }
+        for (int i = 0; i < count; ++i)
+        {
+            for (int side = White; side <= Black; ++side)
+            {
+                for (int slot = 0; slot < ReserveSlots; ++slot)
+                {
+                    Kind held = static_cast<Kind>(positions[i].reserveKinds[side][slot]);
+                    if (held != NoKind)
+                    {
+                        total[i] += (side == White ? 1 : -1) * params.material(held);
+                    }
+                }
+            }
+        }
+
+        int mobility = params.weights[TermMobility];
+        if (moveCounts || mobility != 0)
+        {
+            for (int i = 0; i < count; ++i)
+            {
+                Position position = Position::unpackBoard(positions[i]);
+                Side us = position.sideToMove();
+                int ours = moveCount(position, us);
+                if (moveCounts)
+                {
+                    moveCounts[i] = ours;
+                }
+                if (mobility != 0)
+                {
+                    int theirs = moveCount(position, us == White ? Black : White);
+                    total[i] += mobility * (us == White ? ours - theirs : theirs - ours);
+                }
+            }
+        }
+
+        if (scores)
+        {
+            for (int i = 0; i < count; ++i)
+            {
+                scores[i] = positions[i].sideToMove == White ? total[i] : -total[i];
+            }
+        }
+    }
+
+    void BatchEvaluator::run(const PackedPosition *positions, std::size_t count, int *scores, int *moveCounts) const
+    {
+        std::size_t blocks = (count + EVAL_BLOCK - 1) / EVAL_BLOCK;
+        parallelFor(pool, blocks, 4, [&](std::size_t firstBlock, std::size_t endBlock)
+                    {
+            for (std::size_t block = firstBlock; block < endBlock; ++block)
+            {
+                std::size_t first = block * EVAL_BLOCK;
+                int size = static_cast<int>(std::min<std::size_t>(EVAL_BLOCK, count - first));
+                runBlock(positions + first, size, scores ? scores + first : nullptr, moveCounts ? moveCounts + first : nullptr);
+            } });
+    }
+
+    BatchResults BatchEvaluator::run(const std::vector<PackedPosition> &positions, bool withMoveCounts) const
+    {
+        BatchResults results;
+        results.scores.resize(positions.size());
+        if (withMoveCounts)
+        {
+            results.moveCounts.resize(positions.size());
+        }
+        run(positions.data(), positions.size(), results.scores.data(), withMoveCounts ? results.moveCounts.data() : nullptr);
+        return results;
+    }
+}
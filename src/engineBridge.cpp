@@ -0,0 +1,114 @@
+// Filename: engineBridge.cpp
+// Description: Conversion from the GUI piece list to the headless engine's Position.
+
+// Main Functions:
+// - engine::Position positionFromPieces(const std::vector<std::unique_ptr<Piece>> &pieces, const PieceReserve &reserve, bool isWhiteTurn):
+//   Maps each piece's getType() to an engine Kind and its pixel position to a square, and each reserve slot to the
+//   engine's reserve slot of the same index.
+// - int squareFromPixels(const sf::Vector2f &position) / sf::Vector2f pixelsFromSquare(int sq):
+//   Square index conversions using TILE_SIZE.
+
+// Special Features or Notes:
+// - Stunned and stone state, the DeadLauncher's loaded pawn, the GhoulKing's raise, the QueenOfDomination ability
+//   and the Howler's captured families are carried over, so the engine offers the moves the pieces' own rules do.
+// - The piece inside a side's Portals is carried over from the PieceReserve, so the engine sees the same material
+//   and can plan to bring it back out.
+
+// Usage or Context:
+// - Used by game.cpp to hand the current board to the engine (pondering, hints, the legal move cache).
+
+#include "engineBridge.h"
+#include "queenOfDomination.h"
+#include "deadLauncher.h"
+#include "ghoulKing.h"
+#include "howler.h"
+#include "globals.h"
+
+static_assert(BOARD_SIZE == engine::BOARD_DIM, "the GUI board and the engine's Position must agree");
+static_assert(Howler::RookFamily << engine::HowlerFamilyShift == engine::FlagHowlerRook &&
+                  Howler::KnightFamily << engine::HowlerFamilyShift == engine::FlagHowlerKnight &&
+                  Howler::PawnFamily << engine::HowlerFamilyShift == engine::FlagHowlerPawn &&
+                  Howler::QueenFamily << engine::HowlerFamilyShift == engine::FlagHowlerQueen &&
+                  Howler::KingFamily << engine::HowlerFamilyShift == engine::FlagHowlerKing,
+              "Howler families must line up with the engine's flags");
+
+int squareFromPixels(const sf::Vector2f &position)
+{
+    int col = tileIndex(position.x);
+    int row = tileIndex(position.y);
+    if (!engine::onBoard(row, col))
+    {
+        return engine::NO_SQUARE;
+    }
+    return engine::makeSquare(row, col);
+}
+
+sf::Vector2f pixelsFromSquare(int sq)
+{
+    return sf::Vector2f(engine::colOf(sq) * TILE_SIZE, engine::rowOf(sq) * TILE_SIZE);
+}
+
+namespace
+{
+    std::uint16_t engineFlags(const Piece &piece, engine::Kind kind)
+    {
+        std::uint16_t pieceFlags = 0;
+        if (piece.isStunned())
+        {
+            pieceFlags |= engine::FlagStunned;
+        }
+        if (piece.isStone())
+        {
+            pieceFlags |= engine::FlagStone;
+        }
+        if (kind == engine::DeadLauncher && static_cast<const DeadLauncher &>(piece).pawnLoaded)
+        {
+            pieceFlags |= engine::FlagLoaded;
+        }
+        if ((kind == engine::GhoulKing && static_cast<const GhoulKing &>(piece).raisedDead) ||
+            (kind == engine::QueenOfDomination && static_cast<const QueenOfDomination &>(piece).hasUsedAbility()))
+        {
+            pieceFlags |= engine::FlagAbilityUsed;
+        }
+        if (kind == engine::Howler)
+        {
+            // Howler::Family orders the captured families like the engine's FlagHowler* bits
+            std::uint8_t families = static_cast<const Howler &>(piece).getFamilies() & ~Howler::BishopFamily;
+            pieceFlags |= static_cast<std::uint16_t>(families << engine::HowlerFamilyShift) & engine::FlagHowlerFamilies;
+        }
+        return pieceFlags;
+    }
+}
+
+engine::Position positionFromPieces(const std::vector<std::unique_ptr<Piece>> &pieces, const PieceReserve &reserve, bool isWhiteTurn)
+{
+    engine::Position position;
+    for (const auto &piece : pieces)
+    {
+        engine::Kind kind = engine::kindFromName(piece->getType());
+        int sq = squareFromPixels(piece->getPosition());
+        if (kind == engine::NoKind || sq == engine::NO_SQUARE)
+        {
+            continue;
+        }
+
+        engine::Side side = piece->getColor() == Piece::Color::White ? engine::White : engine::Black;
+        position.put(sq, kind, side, engineFlags(*piece, kind));
+    }
+
+    for (int slot = 0; slot < engine::ReserveSlots; ++slot)
+    {
+        for (Piece::Color color : {Piece::Color::White, Piece::Color::Black})
+        {
+            const Piece *held = reserve.get(PieceReserve::handleFor(static_cast<engine::ReserveSlot>(slot), color));
+            engine::Kind kind = held ? engine::kindFromName(held->getType()) : engine::NoKind;
+            if (kind != engine::NoKind)
+            {
+                engine::Side side = color == Piece::Color::White ? engine::White : engine::Black;
+                position.putReserve(side, static_cast<engine::ReserveSlot>(slot), kind, engineFlags(*held, kind));
+            }
+        }
+    }
+    position.setSideToMove(isWhiteTurn ? engine::White : engine::Black);
+    return position;
+}
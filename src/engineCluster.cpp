@@ -0,0 +1,473 @@
+// Filename: engineCluster.cpp
+// Description: Multi-process perft and root-split search over Unix-domain sockets.
+
+// Main Classes:
+// - ClusterCoordinator: Starts worker processes, hands out work units and collects their results.
+
+// Main Functions:
+// - std::vector<WorkUnit> splitPerft(...) / splitSearch(...): Cut a job into independent units.
+// - int runClusterWorker(const std::string &socketPath, int threads, int failAfter): Worker process loop.
+
+// Special Features or Notes:
+// - Line protocol, one message per line:
+//   worker -> coordinator: "hello <pid>", "result <unit> <value>"
+//   coordinator -> worker: "perft <unit> <depth> <notation>", "search <unit> <depth> <move> <notation>", "quit"
+// - A worker that disconnects (crash, kill) or exceeds unitTimeoutMs loses its unit to the next idle worker,
+//   and a replacement process is spawned while the restart budget lasts.
+// - POSIX only (fork/exec, poll, AF_UNIX); everything runs on one machine.
+
+// Usage or Context:
+// - Used by clusterMain.cpp (battlechess_cluster) for deep perft verification and long analyses.
+
+#include "engineCluster.h"
+#include "engineMoveGen.h"
+#include "engineSearch.h"
+#include "engineThreadPool.h"
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <csignal>
+#include <cstring>
+#include <deque>
+#include <fcntl.h>
+#include <poll.h>
+#include <sstream>
+#include <stdexcept>
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace engine
+{
+    namespace
+    {
+        using Clock = std::chrono::steady_clock;
+
+        sockaddr_un socketAddress(const std::string &path)
+        {
+            sockaddr_un address;
+            std::memset(&address, 0, sizeof(address));
+            address.sun_family = AF_UNIX;
+            if (path.size() >= sizeof(address.sun_path))
+            {
+                throw std::runtime_error("Socket path too long: " + path);
+            }
+            std::strncpy(address.sun_path, path.c_str(), sizeof(address.sun_path) - 1);
+            return address;
+        }
+
+        bool sendLine(int fd, const std::string &line)
+        {
+            std::string data = line + "\n";
+            std::size_t sent = 0;
+            while (sent < data.size())
+            {
+                ssize_t written = ::send(fd, data.data() + sent, data.size() - sent, 0);
+                if (written < 0 && errno == EINTR)
+                {
+                    continue;
+                }
+                if (written <= 0)
+                {
+                    return false;
+                }
+                sent += static_cast<std::size_t>(written);
+            }
+            return true;
+        }
+
+        // Appends available bytes to buffer; false on end of stream or error
+        bool receive(int fd, std::string &buffer)
+        {
+            char chunk[4096];
+            ssize_t count = ::recv(fd, chunk, sizeof(chunk), 0);
+            if (count < 0 && (errno == EINTR || errno == EAGAIN))
+            {
+                return true;
+            }
+            if (count <= 0)
+            {
+                return false;
+            }
+            buffer.append(chunk, static_cast<std::size_t>(count));
+            return true;
+        }
+
+        bool takeLine(std::string &buffer, std::string &line)
+        {
+            std::size_t end = buffer.find('\n');
+            if (end == std::string::npos)
+            {
+                return false;
+            }
+            line = buffer.substr(0, end);
+            buffer.erase(0, end + 1);
+            return true;
+        }
+
+        void splitPerft(const Position &position, int depth, int splitDepth, const std::string &label,
+                        std::vector<WorkUnit> &units)
+        {
+            if (splitDepth == 0 || depth <= 1 || isLost(position))
+            {
+                WorkUnit unit;
+                unit.type = WorkUnit::Perft;
+                unit.notation = position.toNotation();
+                unit.depth = depth;
+                unit.label = label;
+                units.push_back(unit);
+                return;
+            }
+
+            MoveList list;
+            generateMoves(position, list);
+            for (const Move &move : list)
+            {
+                Position child = position;
+                child.makeMove(move);
+                splitPerft(child, depth - 1, splitDepth - 1, label.empty() ? Position::moveToString(move) : label + " " + Position::moveToString(move), units);
+            }
+        }
+
+        struct WorkerConnection
+        {
+            int fd = -1;
+            pid_t pid = 0;
+            int unit = -1;
+            Clock::time_point assignedAt;
+            std::string buffer;
+        };
+    }
+
+    std::vector<WorkUnit> splitPerft(const Position &position, int depth, int splitDepth)
+    {
+        std::vector<WorkUnit> units;
+        splitPerft(position, depth, splitDepth, "", units);
+        return units;
+    }
+
+    std::vector<WorkUnit> splitSearch(const Position &position, int depth)
+    {
+        std::vector<WorkUnit> units;
+        MoveList list;
+        generateMoves(position, list);
+        for (const Move &move : list)
+        {
+            WorkUnit unit;
+            unit.type = WorkUnit::Search;
+            unit.notation = position.toNotation();
+            unit.depth = depth;
+            unit.move = Position::moveToString(move);
+            unit.label = unit.move;
+            units.push_back(unit);
+        }
+        return units;
+    }
+
+    ClusterCoordinator::ClusterCoordinator(const ClusterOptions &clusterOptions)
+        : options(clusterOptions)
+    {
+        if (options.socketPath.empty())
+        {
+            options.socketPath = "/tmp/battlechess-cluster-" + std::to_string(::getpid()) + ".sock";
+        }
+    }
+
+    std::vector<std::int64_t> ClusterCoordinator::run(const std::vector<WorkUnit> &units)
+    {
+        // A worker dying mid-write must not kill the coordinator
+        std::signal(SIGPIPE, SIG_IGN);
+
+        int listener = ::socket(AF_UNIX, SOCK_STREAM, 0);
+        if (listener < 0)
+        {
+            throw std::runtime_error("Unable to create socket");
+        }
+        sockaddr_un address = socketAddress(options.socketPath);
+        ::unlink(options.socketPath.c_str());
+        if (::bind(listener, reinterpret_cast<sockaddr *>(&address), sizeof(address)) != 0 || ::listen(listener, 64) != 0)
+        {
+            ::close(listener);
+            throw std::runtime_error("Unable to listen on " + options.socketPath);
+        }
+        ::fcntl(listener, F_SETFD, FD_CLOEXEC);
+
+        std::vector<pid_t> children;
+        int restarts = 0;
+        bool failureInjected = false;
+        auto spawn = [&]()
+        {
+            std::vector<std::string> args = {options.workerCommand, "--worker", options.socketPath,
+                                             "--threads", std::to_string(options.workerThreads)};
+            if (options.failAfter > 0 && !failureInjected)
+            {
+                args.push_back("--fail-after");
+                args.push_back(std::to_string(options.failAfter));
+                failureInjected = true;
+            }
+            pid_t pid = ::fork();
+            if (pid == 0)
+            {
+                std::vector<char *> argv;
+                for (std::string &arg : args)
+                {
+                    argv.push_back(&arg[0]);
+                }
+                argv.push_back(nullptr);
+                ::execvp(argv[0], argv.data());
+                ::_exit(127);
+            }
+            if (pid > 0)
+            {
+                children.push_back(pid);
+            }
+        };
+
+        for (int i = 0; i < options.workers; ++i)
+        {
+            spawn();
+        }
+
+        std::deque<int> pending;
+        for (int i = 0; i < static_cast<int>(units.size()); ++i)
+        {
+            pending.push_back(i);
+        }
+        std::vector<std::int64_t> results(units.size(), 0);
+        std::vector<bool> done(units.size(), false);
+        std::size_t remaining = units.size();
+        std::vector<WorkerConnection> connections;
+
+        auto dropConnection = [&](std::size_t index)
+        {
+            WorkerConnection &connection = connections[index];
+            if (connection.unit >= 0 && !done[connection.unit])
+            {
+                pending.push_front(connection.unit);
+                ++reassigned;
+            }
+            ::close(connection.fd);
+            connections.erase(connections.begin() + static_cast<std::ptrdiff_t>(index));
+        };
+
+        while (remaining > 0)
+        {
+            // Reap dead workers and start replacements while there is work left
+            int status = 0;
+            pid_t exited;
+            while ((exited = ::waitpid(-1, &status, WNOHANG)) > 0)
+            {
+                children.erase(std::remove(children.begin(), children.end(), exited), children.end());
+            }
+            while (static_cast<int>(children.size()) < options.workers && restarts < options.maxRestarts)
+            {
+                ++restarts;
+                spawn();
+            }
+            if (children.empty() && connections.empty())
+            {
+                ::close(listener);
+                ::unlink(options.socketPath.c_str());
+                throw std::runtime_error("Every cluster worker failed");
+            }
+
+            // Hand out units to idle workers
+            for (std::size_t i = 0; i < connections.size() && !pending.empty();)
+            {
+                WorkerConnection &connection = connections[i];
+                if (connection.unit >= 0 || connection.pid == 0)
+                {
+                    ++i;
+                    continue;
+                }
+                int unitIndex = pending.front();
+                pending.pop_front();
+                const WorkUnit &unit = units[unitIndex];
+                std::string message = unit.type == WorkUnit::Perft
+                                          ? "perft " + std::to_string(unitIndex) + " " + std::to_string(unit.depth) + " " + unit.notation
+                                          : "search " + std::to_string(unitIndex) + " " + std::to_string(unit.depth) + " " + unit.move + " " + unit.notation;
+                connection.unit = unitIndex;
+                connection.assignedAt = Clock::now();
+                if (!sendLine(connection.fd, message))
+                {
+                    dropConnection(i);
+                    continue;
+                }
+                ++i;
+            }
+
+            std::vector<pollfd> fds(1 + connections.size());
+            fds[0].fd = listener;
+            fds[0].events = POLLIN;
+            for (std::size_t i = 0; i < connections.size(); ++i)
+            {
+                fds[i + 1].fd = connections[i].fd;
+                fds[i + 1].events = POLLIN;
+            }
+            if (::poll(fds.data(), fds.size(), 100) < 0 && errno != EINTR)
+            {
+                break;
+            }
+
+            for (std::size_t i = connections.size(); i-- > 0;)
+            {
+                if (!(fds[i + 1].revents & (POLLIN | POLLHUP | POLLERR)))
+                {
+                    continue;
+                }
+                WorkerConnection &connection = connections[i];
+                bool open = receive(connection.fd, connection.buffer);
+                std::string line;
+                while (takeLine(connection.buffer, line))
+                {
+                    std::istringstream fields(line);
+                    std::string kind;
+                    fields >> kind;
+                    if (kind == "hello")
+                    {
+                        fields >> connection.pid;
+                    }
+                    else if (kind == "result")
+                    {
+                        int unitIndex = -1;
+                        std::int64_t value = 0;
+                        fields >> unitIndex >> value;
+                        if (unitIndex == connection.unit && !done[unitIndex])
+                        {
+                            results[unitIndex] = value;
+                            done[unitIndex] = true;
+                            --remaining;
+                        }
+                        connection.unit = -1;
+                    }
+                }
+                if (!open)
+                {
+                    dropConnection(i);
+                }
+            }
+
+            if (fds[0].revents & POLLIN)
+            {
+                int fd = ::accept(listener, nullptr, nullptr);
+                if (fd >= 0)
+                {
+                    ::fcntl(fd, F_SETFD, FD_CLOEXEC);
+                    WorkerConnection connection;
+                    connection.fd = fd;
+                    connections.push_back(connection);
+                }
+            }
+
+            if (options.unitTimeoutMs > 0)
+            {
+                for (WorkerConnection &connection : connections)
+                {
+                    if (connection.unit >= 0 && connection.pid > 0 &&
+                        Clock::now() - connection.assignedAt > std::chrono::milliseconds(options.unitTimeoutMs))
+                    {
+                        // The closed socket is noticed on the next poll and the unit requeued
+                        ::kill(connection.pid, SIGKILL);
+                    }
+                }
+            }
+        }
+
+        for (WorkerConnection &connection : connections)
+        {
+            sendLine(connection.fd, "quit");
+            ::close(connection.fd);
+        }
+        // Workers still starting find the listener gone and exit
+        ::close(listener);
+        ::unlink(options.socketPath.c_str());
+        for (pid_t child : children)
+        {
+            int status = 0;
+            ::waitpid(child, &status, 0);
+        }
+        return results;
+    }
+
+    int runClusterWorker(const std::string &socketPath, int threads, int failAfter)
+    {
+        int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+        sockaddr_un address = socketAddress(socketPath);
+        if (fd < 0 || ::connect(fd, reinterpret_cast<sockaddr *>(&address), sizeof(address)) != 0)
+        {
+            return 1;
+        }
+        if (!sendLine(fd, "hello " + std::to_string(::getpid())))
+        {
+            return 1;
+        }
+
+        ThreadPool pool(threads);
+        TranspositionTable tt(16);
+        Search search(tt);
+        int received = 0;
+        std::string buffer;
+        std::string line;
+        while (true)
+        {
+            while (!takeLine(buffer, line))
+            {
+                if (!receive(fd, buffer))
+                {
+                    return 0;
+                }
+            }
+
+            std::istringstream fields(line);
+            std::string kind;
+            int unit = 0;
+            int depth = 0;
+            fields >> kind >> unit >> depth;
+            if (kind == "quit")
+            {
+                return 0;
+            }
+            if (failAfter > 0 && ++received >= failAfter)
+            {
+                ::_exit(3);
+            }
+
+            std::int64_t value = 0;
+            if (kind == "perft")
+            {
+                std::string notation;
+                std::getline(fields >> std::ws, notation);
+                value = static_cast<std::int64_t>(perft(Position::fromNotation(notation), depth, pool));
+            }
+            else if (kind == "search")
+            {
+                std::string moveText, notation;
+                fields >> moveText;
+                std::getline(fields >> std::ws, notation);
+                Position position = Position::fromNotation(notation);
+                SearchLimits limits;
+                limits.depth = depth;
+                Move move;
+                if (!parseMove(position, moveText, move))
+                {
+                    return 2;
+                }
+                limits.searchMoves.push_back(move);
+                tt.clear();
+                search.resetStop();
+                value = search.run(position, limits).score;
+            }
+            else
+            {
+                continue;
+            }
+
+            if (!sendLine(fd, "result " + std::to_string(unit) + " " + std::to_string(value)))
+            {
+                return 1;
+            }
+        }
+    }
+}
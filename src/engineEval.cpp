@@ -0,0 +1,254 @@
+// Filename: engineEval.cpp
+// Description: Static evaluation for the headless engine.
+
+// Main Classes:
+// - EvalParams: Material and positional weights, kept in one array so they can be tuned and reloaded.
+
+// Main Functions:
+// - int evaluate(const Position &position, const EvalParams &params): Score from the side to move's view.
+// - void evalFeatures(const Position &position, std::vector<EvalFeature> &features):
+//   The same terms as sparse (term, count) pairs for the tuner.
+
+// Special Features or Notes:
+// - Material values start from the standard piece values and add roughly the gemstone price of each
+//   upgrade in the army menus, so stronger race pieces are valued above their base piece.
+// - Kings carry no material; losing every king is scored by the search as a loss.
+// - evaluate() and evalFeatures() share scanPosition(), so the evaluation is exactly linear in the weights.
+
+// Usage or Context:
+// - Called at the leaves of the engine search and by the parameter tuner.
+
+#include "engineEval.h"
+#include "engineAttacks.h"
+#include "engineMoveGen.h"
+#include "enginePieces.h"
+#include <fstream>
+#include <ostream>
+#include <sstream>
+#include <stdexcept>
+
+namespace engine
+{
+    EvalParams::EvalParams()
+    {
+        const int values[KindCount] = {
+            // Standard
+            100, 300, 320, 500, 900, 0,
+            // Necro: NecroPawn, GhostKnight, Necromancer, DeadLauncher, QueenOfBones, GhoulKing
+            110, 380, 420, 560, 980, 0,
+            // Wizard: YoungWiz, Familiar, Wizard, Portal, QueenOfIllusions, WizardKing
+            130, 360, 480, 540, 960, 0,
+            // Beast: PawnHopper, BeastKnight, BeastDruid, BoulderThrower, QueenOfDomination, FrogKing
+            120, 340, 400, 600, 960, 0,
+            // Hell: HellPawn, Prowler, Howler, Beholder, QueenOfDestruction, HellKing
+            120, 380, 420, 620, 1000, 0,
+            // Custom: priced as the standard slot until tuned with EvalFile
+            100, 300, 320, 500, 900, 0};
+        for (int kind = 0; kind < KindCount; ++kind)
+        {
+            weights[TermMaterial + kind] = values[kind];
+        }
+        weights[TermCentralization] = 4;
+        weights[TermPawnAdvance] = 6;
+        weights[TermStunned] = -30;
+        weights[TermLoaded] = 40;
+        weights[TermAbilityReady] = 25;
+        weights[TermKingCount] = 200;
+        weights[TermMobility] = 0;
+    }
+
+    std::string EvalParams::termName(int term)
+    {
+        if (term < TermMaterial + KindCount)
+        {
+            return "material." + kindName(static_cast<Kind>(term - TermMaterial));
+        }
+        switch (term)
+        {
+        case TermCentralization:
+            return "centralization";
+        case TermPawnAdvance:
+            return "pawnAdvance";
+        case TermStunned:
+            return "stunned";
+        case TermLoaded:
+            return "loaded";
+        case TermAbilityReady:
+            return "abilityReady";
+        case TermKingCount:
+            return "kingCount";
+        case TermMobility:
+            return "mobility";
+        default:
+            return "";
+        }
+    }
+
+    EvalParams EvalParams::load(const std::string &path)
+    {
+        std::ifstream file(path);
+        if (!file)
+        {
+            throw std::runtime_error("Failed to open eval parameters: " + path);
+        }
+
+        EvalParams params;
+        std::string line;
+        while (std::getline(file, line))
+        {
+            std::istringstream fields(line);
+            std::string name;
+            double value;
+            if (!(fields >> name) || name[0] == '#')
+            {
+                continue;
+            }
+            if (!(fields >> value))
+            {
+                throw std::runtime_error("Missing value for eval parameter: " + name);
+            }
+
+            int term = 0;
+            while (term < EvalTermCount && termName(term) != name)
+            {
+                ++term;
+            }
+            if (term == EvalTermCount)
+            {
+                throw std::runtime_error("Unknown eval parameter: " + name);
+            }
+            params.weights[term] = static_cast<int>(value < 0 ? value - 0.5 : value + 0.5);
+        }
+        return params;
+    }
+
+    void EvalParams::save(std::ostream &out) const
+    {
+        for (int term = 0; term < EvalTermCount; ++term)
+        {
+            out << termName(term) << ' ' << weights[term] << '\n';
+        }
+    }
+
+    const EvalParams &defaultEvalParams()
+    {
+        static const EvalParams params;
+        return params;
+    }
+
+    namespace
+    {
+        int centreDistance(int sq)
+        {
+            int row = rowOf(sq);
+            int col = colOf(sq);
+            int dr = row < BOARD_DIM / 2 ? BOARD_DIM / 2 - 1 - row : row - BOARD_DIM / 2;
+            int dc = col < BOARD_DIM / 2 ? BOARD_DIM / 2 - 1 - col : col - BOARD_DIM / 2;
+            return dr + dc;
+        }
+
+        int mobility(const Position &position, Side side)
+        {
+            if (position.sideToMove() == side)
+            {
+                return countMoves(position);
+            }
+            Position flipped = position;
+            flipped.makeNullMove();
+            return countMoves(flipped);
+        }
+
+        // Reports every evaluation term to sink(term, value) from White's point of view
+        template <typename Sink>
+        void scanPosition(const Position &position, bool withMobility, Sink &sink)
+        {
+            for (int s = 0; s < 2; ++s)
+            {
+                Side side = static_cast<Side>(s);
+                int sign = side == White ? 1 : -1;
+                Bitboard pieces = position.occupancy(side);
+                while (pieces)
+                {
+                    int sq = popLsb(pieces);
+                    Kind kind = position.kindAt(sq);
+                    std::uint16_t pieceFlags = position.flagsAt(sq);
+                    sink(TermMaterial + kind, sign);
+
+                    Base base = baseOf(kind);
+                    if (base == PawnBase)
+                    {
+                        int advanced = side == White ? rowOf(sq) - 1 : BOARD_DIM - 2 - rowOf(sq);
+                        sink(TermPawnAdvance, sign * advanced);
+                    }
+                    else if (base != KingBase)
+                    {
+                        sink(TermCentralization, sign * (BOARD_DIM - 2 - centreDistance(sq)));
+                    }
+
+                    if (pieceFlags & FlagStunned)
+                    {
+                        sink(TermStunned, sign);
+                    }
+                    if (pieceFlags & FlagLoaded)
+                    {
+                        sink(TermLoaded, sign);
+                    }
+                    if ((kindAbilities(kind) & (AbilityRaise | AbilityDominate)) && !(pieceFlags & FlagAbilityUsed))
+                    {
+                        sink(TermAbilityReady, sign);
+                    }
+                }
+
+                // A piece held off the board keeps its material and nothing that depends on a square
+                for (int slot = 0; slot < ReserveSlots; ++slot)
+                {
+                    Kind held = position.reserveKind(side, static_cast<ReserveSlot>(slot));
+                    if (held != NoKind)
+                    {
+                        sink(TermMaterial + held, sign);
+                    }
+                }
+
+                int kingCount = popCount(position.kings(side));
+                if (kingCount > 1)
+                {
+                    sink(TermKingCount, sign * (kingCount - 1));
+                }
+                if (withMobility)
+                {
+                    sink(TermMobility, sign * mobility(position, side));
+                }
+            }
+        }
+    }
+
+    int evaluate(const Position &position, const EvalParams &params)
+    {
+        int score = 0;
+        auto addTerm = [&](int term, int value)
+        {
+            score += params.weights[term] * value;
+        };
+        scanPosition(position, params.weights[TermMobility] != 0, addTerm);
+        return position.sideToMove() == White ? score : -score;
+    }
+
+    void evalFeatures(const Position &position, std::vector<EvalFeature> &features)
+    {
+        int counts[EvalTermCount] = {};
+        auto addTerm = [&](int term, int value)
+        {
+            counts[term] += value;
+        };
+        scanPosition(position, true, addTerm);
+
+        features.clear();
+        for (int term = 0; term < EvalTermCount; ++term)
+        {
+            if (counts[term] != 0)
+            {
+                features.push_back(EvalFeature{static_cast<std::uint16_t>(term), static_cast<std::int16_t>(counts[term])});
+            }
+        }
+    }
+}
@@ -0,0 +1,151 @@
+// Filename: engineHint.cpp
+// Description: Background best-move hints for the SFML client.
+
+// Main Classes:
+// - HintEngine: Runs hint searches on a worker thread and publishes results through a lock-free snapshot.
+
+// Main Functions:
+// - void HintEngine::request(const Position &position, int fromSquare, int timeMs): Queues a new hint search.
+// - HintSnapshot HintEngine::snapshot() const: Reads the latest hint with a single atomic load.
+
+// Special Features or Notes:
+// - A snapshot is packed as generation (16 bits), from, to, depth (8 bits each), score (16 bits) and a
+//   valid byte, so the render thread reads a consistent result without a mutex.
+// - request() only takes the job mutex, which the worker holds just long enough to pick up a job,
+//   and stops the running search instead of joining it.
+
+// Usage or Context:
+// - game.cpp requests a hint when a piece is selected in hint mode and draws snapshot() every frame.
+
+#include "engineHint.h"
+#include <algorithm>
+
+namespace engine
+{
+    namespace
+    {
+        std::uint64_t pack(std::uint32_t generation, const SearchInfo &info)
+        {
+            const Move &best = info.pv.front();
+            std::uint64_t score = static_cast<std::uint16_t>(static_cast<std::int16_t>(info.score));
+            return (static_cast<std::uint64_t>(generation & 0xFFFF) << 48) |
+                   (static_cast<std::uint64_t>(best.from) << 40) |
+                   (static_cast<std::uint64_t>(best.to) << 32) |
+                   (static_cast<std::uint64_t>(std::min(info.depth, 255)) << 24) |
+                   (score << 8) |
+                   1;
+        }
+    }
+
+    HintEngine::HintEngine(std::size_t hashMegabytes)
+        : tt(hashMegabytes), search(tt), generation(0), packed(0)
+    {
+        worker = std::thread(&HintEngine::workerLoop, this);
+    }
+
+    HintEngine::~HintEngine()
+    {
+        {
+            std::lock_guard<std::mutex> lock(jobMutex);
+            quitting = true;
+            search.stop();
+        }
+        jobReady.notify_all();
+        worker.join();
+    }
+
+    void HintEngine::request(const Position &position, int fromSquare, int timeMs)
+    {
+        SearchLimits limits;
+        limits.moveTime = timeMs;
+        if (fromSquare != NO_SQUARE)
+        {
+            MoveList list;
+            generateMoves(position, list);
+            for (const Move &move : list)
+            {
+                if (move.from == fromSquare)
+                {
+                    limits.searchMoves.push_back(move);
+                }
+            }
+            if (limits.searchMoves.empty())
+            {
+                cancel();
+                return;
+            }
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(jobMutex);
+            jobPosition = position;
+            jobLimits = limits;
+            jobGeneration = generation.fetch_add(1) + 1;
+            hasJob = true;
+            search.stop();
+        }
+        jobReady.notify_one();
+    }
+
+    void HintEngine::cancel()
+    {
+        std::lock_guard<std::mutex> lock(jobMutex);
+        generation.fetch_add(1);
+        hasJob = false;
+        search.stop();
+    }
+
+    HintSnapshot HintEngine::snapshot() const
+    {
+        HintSnapshot hint;
+        std::uint64_t value = packed.load(std::memory_order_acquire);
+        if (!(value & 1) || (value >> 48) != (generation.load(std::memory_order_acquire) & 0xFFFF))
+        {
+            return hint;
+        }
+
+        hint.valid = true;
+        hint.from = static_cast<int>((value >> 40) & 0xFF);
+        hint.to = static_cast<int>((value >> 32) & 0xFF);
+        hint.depth = static_cast<int>((value >> 24) & 0xFF);
+        hint.score = static_cast<std::int16_t>((value >> 8) & 0xFFFF);
+        return hint;
+    }
+
+    void HintEngine::publish(std::uint32_t jobGenerationId, const SearchInfo &info)
+    {
+        // Only the first line matters and an aborted iteration may report an empty one
+        if (info.multiPV == 1 && !info.pv.empty())
+        {
+            packed.store(pack(jobGenerationId, info), std::memory_order_release);
+        }
+    }
+
+    void HintEngine::workerLoop()
+    {
+        while (true)
+        {
+            Position position;
+            SearchLimits limits;
+            std::uint32_t jobGenerationId;
+            {
+                std::unique_lock<std::mutex> lock(jobMutex);
+                jobReady.wait(lock, [this]()
+                              { return hasJob || quitting; });
+                if (quitting)
+                {
+                    return;
+                }
+                position = jobPosition;
+                limits = jobLimits;
+                jobGenerationId = jobGeneration;
+                hasJob = false;
+                // Under the lock so a stop from a newer request cannot be cleared by mistake
+                search.resetStop();
+            }
+
+            search.run(position, limits, [this, jobGenerationId](const SearchInfo &info)
+                       { publish(jobGenerationId, info); });
+        }
+    }
+}
@@ -0,0 +1,21 @@
+// Filename: engineMain.cpp
+// Description: Entry point of the battlechess_engine binary.
+
+// Main Functions:
+// - int main(): Runs the engine protocol on stdin/stdout.
+
+// Special Features or Notes:
+// - Links no SFML and loads no textures or fonts, so the process is ready as soon as it starts.
+
+// Usage or Context:
+// - Launched by analysis and batch tools, e.g. `echo "position startpos\ngo depth 6" | battlechess_engine`.
+
+#include "engineProtocol.h"
+#include <iostream>
+
+int main()
+{
+    std::ios::sync_with_stdio(false);
+    engine::EngineProtocol protocol(std::cin, std::cout);
+    return protocol.run();
+}
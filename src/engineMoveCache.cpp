@@ -0,0 +1,170 @@
+// Filename: engineMoveCache.cpp
+// Description: Legal move lists generated once per position and shared by every lookup of that position.
+
+// Main Classes:
+// - LegalMoves: The moves of one position with per-square target masks and the hashes of the positions they lead to.
+// - LegalMoveCache: A small hash-keyed cache of LegalMoves filled by a worker thread.
+
+// Main Functions:
+// - void LegalMoveCache::prepare(const Position &position): Queues a position for background generation.
+// - std::shared_ptr<const LegalMoves> LegalMoveCache::lookup(const Position &position): Cached moves, generated on a miss.
+// - bool LegalMoves::leadsTo(std::uint64_t hash) const: Whether one legal move produces the position with that hash.
+
+// Special Features or Notes:
+// - Entries are compared by the full 64-bit Zobrist hash, so a lookup costs one probe per entry.
+// - Successor hashes come from playing every move on a copy of the position, which lets a whole-board packet
+//   be checked against the move list without knowing which move was played.
+// - The mutex is only held to probe or replace entries; generation runs outside it.
+
+// Usage or Context:
+// - game.cpp prepares the position whenever the turn changes hands, highlights selections from the cached
+//   target masks and checks incoming network positions with leadsTo().
+
+#include "engineMoveCache.h"
+#include <algorithm>
+
+namespace engine
+{
+    constexpr int LegalMoveCache::Entries;
+
+    LegalMoves::LegalMoves(const Position &position)
+        : key(position.hash())
+    {
+        quietTargets.fill(0);
+        captureTargets.fill(0);
+
+        generateMoves(position, list);
+        successors.reserve(list.size());
+        for (const Move &move : list)
+        {
+            if (move.type == MoveQuiet && move.extra == NO_SQUARE)
+            {
+                quietTargets[move.from] |= squareBit(move.to);
+            }
+            else if (move.isCapture() && move.extra == NO_SQUARE)
+            {
+                captureTargets[move.from] |= squareBit(move.to);
+            }
+            else
+            {
+                abilitySquares |= squareBit(move.from);
+            }
+
+            Position after = position;
+            after.makeMove(move);
+            successors.push_back(after.hash());
+        }
+        std::sort(successors.begin(), successors.end());
+    }
+
+    bool LegalMoves::leadsTo(std::uint64_t hash) const
+    {
+        return std::binary_search(successors.begin(), successors.end(), hash);
+    }
+
+    LegalMoveCache::LegalMoveCache()
+    {
+        worker = std::thread(&LegalMoveCache::workerLoop, this);
+    }
+
+    LegalMoveCache::~LegalMoveCache()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            quitting = true;
+        }
+        jobReady.notify_all();
+        worker.join();
+    }
+
+    void LegalMoveCache::prepare(const Position &position)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (findLocked(position.hash()))
+            {
+                return;
+            }
+            jobPosition = position;
+            hasJob = true;
+        }
+        jobReady.notify_one();
+    }
+
+    std::shared_ptr<const LegalMoves> LegalMoveCache::find(std::uint64_t hash) const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        std::shared_ptr<const LegalMoves> moves = findLocked(hash);
+        ++(moves ? hitCount : missCount);
+        return moves;
+    }
+
+    std::shared_ptr<const LegalMoves> LegalMoveCache::lookup(const Position &position)
+    {
+        if (std::shared_ptr<const LegalMoves> moves = find(position.hash()))
+        {
+            return moves;
+        }
+
+        // The worker may be generating the same position; doing it twice is cheaper than waiting for it
+        auto moves = std::make_shared<const LegalMoves>(position);
+        store(moves);
+        return moves;
+    }
+
+    std::uint64_t LegalMoveCache::hits() const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return hitCount;
+    }
+
+    std::uint64_t LegalMoveCache::misses() const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return missCount;
+    }
+
+    std::shared_ptr<const LegalMoves> LegalMoveCache::findLocked(std::uint64_t hash) const
+    {
+        for (const auto &entry : entries)
+        {
+            if (entry && entry->key == hash)
+            {
+                return entry;
+            }
+        }
+        return nullptr;
+    }
+
+    void LegalMoveCache::store(const std::shared_ptr<const LegalMoves> &moves)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (findLocked(moves->key))
+        {
+            return;
+        }
+        entries[nextEntry] = moves;
+        nextEntry = (nextEntry + 1) % Entries;
+    }
+
+    void LegalMoveCache::workerLoop()
+    {
+        while (true)
+        {
+            Position position;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                jobReady.wait(lock, [this]()
+                              { return hasJob || quitting; });
+                if (quitting)
+                {
+                    return;
+                }
+                position = jobPosition;
+                hasJob = false;
+            }
+
+            store(std::make_shared<const LegalMoves>(position));
+        }
+    }
+}
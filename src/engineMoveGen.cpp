@@ -0,0 +1,745 @@
+// Filename: engineMoveGen.cpp
+// Description: Move generation for the headless engine, covering the movement, capture and ability rules of every piece kind.
+
+// Main Functions:
+// - void generateMoves(const BasicPosition<Geometry> &position, MoveList &list): All moves for the side to move.
+// - int countMoves(const BasicPosition<Geometry> &position): How many moves generateMoves produces.
+// - void generateCaptures(const Position &position, MoveList &list): Capturing moves only.
+// - bool parseMove(const Position &position, const std::string &text, Move &move): Protocol text to Move.
+// - std::uint64_t perft(const Position &position, int depth): Leaf count used to validate the generator.
+// - std::uint64_t perft(const Position &position, int depth, ThreadPool &pool): The same count as a fork/join tree.
+
+// Special Features or Notes:
+// - The rules are written once against the board geometry and instantiated for 8x8, 10x10 and 12x12;
+//   the public functions below take any of those positions.
+// - Movement comes from the compiled piece tables (enginePieces.h): each kind's quiet, capture and
+//   ranged leaps and slides, so a Wizard or BoulderThrower captures without moving because its
+//   definition says so. Only the pawn families keep hand-written step rules (YoungWiz captures
+//   straight ahead from where it stands, a PawnHopper double step removes the enemy it jumps over).
+// - Abilities are bits of the definition; the stone scan and the stun check are skipped when no
+//   race the enemy has fielded has the stone or stun ability.
+// - One generator serves every army matchup; specializing it per matchup was tried twice and dropped. Templates
+//   on the pair of armies were no faster than this generator. Templates on the table-driven generator, keyed on
+//   what each side's army fields (pawn families, non-plain kinds, ability moves, infection, enemy stone and
+//   stun), were about 7% slower in battlechess_movegenbench --baseline over the 25 matchups: the per-position
+//   dispatch and the extra copies of generate cost more than the few well-predicted checks they remove.
+// - Stunned pieces generate nothing and stone pieces are never capture targets.
+// - countMoves adds up the popcount of each plain piece's targets and the steps of each pawn, and has generate
+//   list only the other pieces; battlechess_batchbench checks it against generateMoves.
+// - Ability moves that target the mover itself use from == to (NecroPawn sacrifice, Familiar stone,
+//   Prowler pass, GhoulKing raise with the NecroPawn square as extra, Portal exit with the exit square as extra).
+
+// Usage or Context:
+// - Used by the search, perft and the engine protocol.
+
+#include "engineMoveGen.h"
+#include "engineAttacks.h"
+#include "enginePieces.h"
+#include "engineThreadPool.h"
+#include <algorithm>
+#include <vector>
+
+namespace engine
+{
+    namespace
+    {
+        template <typename Geometry>
+        struct GenContext
+        {
+            using Mask = typename Geometry::Mask;
+
+            const BasicPosition<Geometry> &position;
+            const PieceTables<Geometry> &pieces;
+            const BasicAttackTables<Geometry> &tables; // looked up once, not per piece
+            MoveList &list;
+            Side us;
+            Mask own;
+            Mask empty;
+            Mask capturable; // enemy pieces that are not stone
+            bool capturesOnly;
+        };
+
+        template <typename Geometry>
+        void addTargets(GenContext<Geometry> &ctx, int from, typename Geometry::Mask targets)
+        {
+            using Mask = typename Geometry::Mask;
+
+            Mask quiet = targets & ctx.empty;
+            Mask captures = targets & ctx.capturable;
+            if (!ctx.capturesOnly)
+            {
+                while (quiet)
+                {
+                    ctx.list.add(Move(from, popLsb(quiet), MoveQuiet));
+                }
+            }
+            while (captures)
+            {
+                ctx.list.add(Move(from, popLsb(captures), MoveCapture));
+            }
+        }
+
+        int forwardStep(Side side) { return side == White ? 1 : -1; }
+        template <typename Geometry>
+        int startRow(Side side) { return side == White ? 1 : Geometry::dim - 2; }
+
+        // Pawn, NecroPawn, HellPawn and the Howler's pawn ability
+        template <typename Geometry>
+        void pawnMoves(GenContext<Geometry> &ctx, int from, bool infects)
+        {
+            int row = Geometry::rowOf(from);
+            int col = Geometry::colOf(from);
+            int dir = forwardStep(ctx.us);
+            int nextRow = row + dir;
+            if (nextRow < 0 || nextRow >= Geometry::dim)
+            {
+                return;
+            }
+
+            if (!ctx.capturesOnly)
+            {
+                int single = Geometry::makeSquare(nextRow, col);
+                if (ctx.empty & Geometry::squareBit(single))
+                {
+                    ctx.list.add(Move(from, single, MoveQuiet));
+                    int doubleRow = row + 2 * dir;
+                    if (row == startRow<Geometry>(ctx.us) && Geometry::onBoard(doubleRow, col) && (ctx.empty & Geometry::squareBit(Geometry::makeSquare(doubleRow, col))))
+                    {
+                        ctx.list.add(Move(from, Geometry::makeSquare(doubleRow, col), MoveQuiet));
+                    }
+                }
+            }
+
+            for (int dc = -1; dc <= 1; dc += 2)
+            {
+                if (!Geometry::onBoard(nextRow, col + dc))
+                {
+                    continue;
+                }
+                int target = Geometry::makeSquare(nextRow, col + dc);
+                if (ctx.capturable & Geometry::squareBit(target))
+                {
+                    bool infect = infects && ctx.position.kindAt(target) != Pawn;
+                    ctx.list.add(Move(from, target, infect ? MoveInfect : MoveCapture));
+                }
+            }
+        }
+
+        // How many moves pawnMoves lists, for countMoves; infecting only changes the move type
+        template <typename Geometry>
+        int pawnMoveCount(int from, Side us, const typename Geometry::Mask &empty, const typename Geometry::Mask &capturable)
+        {
+            int row = Geometry::rowOf(from);
+            int col = Geometry::colOf(from);
+            int dir = forwardStep(us);
+            int nextRow = row + dir;
+            if (nextRow < 0 || nextRow >= Geometry::dim)
+            {
+                return 0;
+            }
+
+            int count = 0;
+            if (empty & Geometry::squareBit(Geometry::makeSquare(nextRow, col)))
+            {
+                ++count;
+                int doubleRow = row + 2 * dir;
+                if (row == startRow<Geometry>(us) && Geometry::onBoard(doubleRow, col) && (empty & Geometry::squareBit(Geometry::makeSquare(doubleRow, col))))
+                {
+                    ++count;
+                }
+            }
+            for (int dc = -1; dc <= 1; dc += 2)
+            {
+                if (Geometry::onBoard(nextRow, col + dc) && (capturable & Geometry::squareBit(Geometry::makeSquare(nextRow, col + dc))))
+                {
+                    ++count;
+                }
+            }
+            return count;
+        }
+
+        template <typename Geometry>
+        void youngWizMoves(GenContext<Geometry> &ctx, int from)
+        {
+            int row = Geometry::rowOf(from);
+            int col = Geometry::colOf(from);
+            int dir = forwardStep(ctx.us);
+            int nextRow = row + dir;
+            if (nextRow < 0 || nextRow >= Geometry::dim)
+            {
+                return;
+            }
+
+            int single = Geometry::makeSquare(nextRow, col);
+            if (ctx.capturable & Geometry::squareBit(single))
+            {
+                // YoungWiz::capture removes the piece ahead without moving
+                ctx.list.add(Move(from, single, MoveRanged));
+            }
+            else if (!ctx.capturesOnly && (ctx.empty & Geometry::squareBit(single)))
+            {
+                ctx.list.add(Move(from, single, MoveQuiet));
+                int doubleRow = row + 2 * dir;
+                if (row == startRow<Geometry>(ctx.us) && Geometry::onBoard(doubleRow, col) && (ctx.empty & Geometry::squareBit(Geometry::makeSquare(doubleRow, col))))
+                {
+                    ctx.list.add(Move(from, Geometry::makeSquare(doubleRow, col), MoveQuiet));
+                }
+            }
+
+            for (int dc = -1; dc <= 1; dc += 2)
+            {
+                if (Geometry::onBoard(nextRow, col + dc) && (ctx.capturable & Geometry::squareBit(Geometry::makeSquare(nextRow, col + dc))))
+                {
+                    ctx.list.add(Move(from, Geometry::makeSquare(nextRow, col + dc), MoveCapture));
+                }
+            }
+        }
+
+        template <typename Geometry>
+        void pawnHopperMoves(GenContext<Geometry> &ctx, int from)
+        {
+            int row = Geometry::rowOf(from);
+            int col = Geometry::colOf(from);
+            int dir = forwardStep(ctx.us);
+            int nextRow = row + dir;
+            if (nextRow < 0 || nextRow >= Geometry::dim)
+            {
+                return;
+            }
+
+            int single = Geometry::makeSquare(nextRow, col);
+            if (!ctx.capturesOnly && (ctx.empty & Geometry::squareBit(single)))
+            {
+                ctx.list.add(Move(from, single, MoveQuiet));
+            }
+
+            // The double step is always available and jumps over whatever stands in between
+            int doubleRow = row + 2 * dir;
+            if (Geometry::onBoard(doubleRow, col) && (ctx.empty & Geometry::squareBit(Geometry::makeSquare(doubleRow, col))))
+            {
+                bool hops = (ctx.capturable & Geometry::squareBit(single)) != 0;
+                if (hops || !ctx.capturesOnly)
+                {
+                    ctx.list.add(Move(from, Geometry::makeSquare(doubleRow, col), hops ? MoveHop : MoveQuiet));
+                }
+            }
+
+            for (int dc = -1; dc <= 1; dc += 2)
+            {
+                if (Geometry::onBoard(nextRow, col + dc) && (ctx.capturable & Geometry::squareBit(Geometry::makeSquare(nextRow, col + dc))))
+                {
+                    ctx.list.add(Move(from, Geometry::makeSquare(nextRow, col + dc), MoveCapture));
+                }
+            }
+        }
+
+        // Necromancer::raiseDead lets the Necromancer place a Pawn beside the captured square
+        template <typename Geometry>
+        void raiseDeadCaptures(GenContext<Geometry> &ctx, int from, typename Geometry::Mask captures)
+        {
+            using Mask = typename Geometry::Mask;
+
+            while (captures)
+            {
+                int target = popLsb(captures);
+                Mask placements = ctx.tables.orthogonal[target] & (ctx.empty | Geometry::squareBit(from));
+                placements &= ~Geometry::squareBit(target);
+                if (!placements)
+                {
+                    ctx.list.add(Move(from, target, MoveCapture));
+                }
+                while (placements)
+                {
+                    ctx.list.add(Move(from, target, MoveCapture, popLsb(placements)));
+                }
+            }
+        }
+
+        // First piece straight up and down the column, the WizardKing's ranged capture
+        template <typename Geometry>
+        typename Geometry::Mask wizardKingRange(int from, const typename Geometry::Mask &occupied)
+        {
+            using Mask = typename Geometry::Mask;
+
+            Mask targets = 0;
+            for (int dir = -1; dir <= 1; dir += 2)
+            {
+                for (int row = Geometry::rowOf(from) + dir; row >= 0 && row < Geometry::dim; row += dir)
+                {
+                    int sq = Geometry::makeSquare(row, Geometry::colOf(from));
+                    if (occupied & Geometry::squareBit(sq))
+                    {
+                        if (row != Geometry::rowOf(from) + dir)
+                        {
+                            targets |= Geometry::squareBit(sq);
+                        }
+                        break;
+                    }
+                }
+            }
+            return targets;
+        }
+
+        // A pawn of the standard army or of owner's race: what a DeadLauncher loads and a
+        // QueenOfIllusions swaps with
+        bool isArmyPawn(Kind pawn, Kind owner)
+        {
+            return baseOf(pawn) == PawnBase && (raceOf(pawn) == Standard || raceOf(pawn) == raceOf(owner));
+        }
+
+        // Moves of a Betza-defined kind from its compiled tables, with the abilities that change
+        // which of those moves exist (howl, load, columnShot, raiseDead)
+        template <typename Geometry>
+        void definedMoves(GenContext<Geometry> &ctx, int from, Kind kind, const CompiledPiece<Geometry> &piece)
+        {
+            using Mask = typename Geometry::Mask;
+
+            const BasicPosition<Geometry> &pos = ctx.position;
+            std::uint16_t pieceFlags = pos.flagsAt(from);
+            Mask quiet = piece.quiet[from];
+            Mask capture = piece.capture[from];
+            Mask ranged = piece.ranged[from];
+            std::uint8_t quietSlides = piece.quietSlides;
+            std::uint8_t captureSlides = piece.captureSlides;
+
+            if (piece.abilities & AbilityHowl)
+            {
+                // Howler::gainAbilitiesFromCapturedPiece: captured families add their moves
+                int families = (pieceFlags & FlagHowlerFamilies) >> HowlerFamilyShift;
+                std::uint8_t gained = ctx.tables.howlSlides[families];
+                const Mask &leaps = ctx.tables.howlLeaps[families][from];
+                quietSlides |= gained;
+                captureSlides |= gained;
+                quiet |= leaps;
+                capture |= leaps;
+            }
+
+            std::uint8_t slides = quietSlides | captureSlides | piece.rangedSlides;
+            if (slides)
+            {
+                Mask occupied = pos.occupancy();
+                Mask orthogonal = (slides & SlideOrthogonal) ? slidingAttacks<Geometry>(from, occupied, true, false) : Mask(0);
+                Mask diagonal = (slides & SlideDiagonal) ? slidingAttacks<Geometry>(from, occupied, false, true) : Mask(0);
+                auto slid = [&](std::uint8_t flags)
+                {
+                    return ((flags & SlideOrthogonal) ? orthogonal : Mask(0)) | ((flags & SlideDiagonal) ? diagonal : Mask(0));
+                };
+                quiet |= slid(quietSlides);
+                capture |= slid(captureSlides);
+                ranged |= slid(piece.rangedSlides);
+            }
+
+            if ((piece.abilities & AbilityHowl) && (pieceFlags & FlagHowlerPawn))
+            {
+                // Pawn steps are generated in place, then those the other families already cover are dropped
+                Mask covered = quiet | capture;
+                int first = ctx.list.count;
+                pawnMoves(ctx, from, false);
+                int kept = first;
+                for (int i = first; i < ctx.list.count; ++i)
+                {
+                    if (!(covered & Geometry::squareBit(ctx.list.moves[i].to)))
+                    {
+                        ctx.list.moves[kept++] = ctx.list.moves[i];
+                    }
+                }
+                ctx.list.count = kept;
+            }
+            if (piece.abilities & AbilityColumnShot)
+            {
+                ranged |= wizardKingRange<Geometry>(from, pos.occupancy());
+            }
+            if ((piece.abilities & AbilityLoad) && !(pieceFlags & FlagLoaded))
+            {
+                // An empty DeadLauncher has nothing to launch but may load a pawn beside it
+                ranged = 0;
+                Mask loadable = ctx.capturesOnly ? Mask(0) : ctx.tables.king[from] & ctx.own;
+                while (loadable)
+                {
+                    int target = popLsb(loadable);
+                    if (isArmyPawn(pos.kindAt(target), kind))
+                    {
+                        ctx.list.add(Move(from, target, MoveLoad));
+                    }
+                }
+            }
+
+            // DeadLauncher::capture prefers launching when the target is in range
+            ranged &= ctx.capturable;
+            capture &= ctx.capturable & ~ranged;
+            if (!ctx.capturesOnly)
+            {
+                quiet &= ctx.empty;
+                while (quiet)
+                {
+                    ctx.list.add(Move(from, popLsb(quiet), MoveQuiet));
+                }
+            }
+            if (piece.abilities & AbilityRaiseDead)
+            {
+                raiseDeadCaptures(ctx, from, capture);
+            }
+            else
+            {
+                while (capture)
+                {
+                    ctx.list.add(Move(from, popLsb(capture), MoveCapture));
+                }
+            }
+            while (ranged)
+            {
+                ctx.list.add(Move(from, popLsb(ranged), MoveRanged));
+            }
+        }
+
+        // Ability moves that add to whatever the piece's movement allows
+        template <typename Geometry>
+        void abilityMoves(GenContext<Geometry> &ctx, int from, Kind kind, const CompiledPiece<Geometry> &piece)
+        {
+            using Mask = typename Geometry::Mask;
+
+            const BasicPosition<Geometry> &pos = ctx.position;
+            std::uint16_t pieceFlags = pos.flagsAt(from);
+            if (piece.abilities & AbilitySacrifice)
+            {
+                ctx.list.add(Move(from, from, MoveSacrifice));
+            }
+            if ((piece.abilities & AbilityStone) && !(pieceFlags & FlagStone))
+            {
+                ctx.list.add(Move(from, from, MoveStone));
+            }
+            if ((piece.abilities & AbilityRaise) && !(pieceFlags & FlagAbilityUsed))
+            {
+                Mask placements = ctx.tables.king[from] & ctx.empty;
+                while (placements)
+                {
+                    ctx.list.add(Move(from, from, MoveRaise, popLsb(placements)));
+                }
+            }
+            if (piece.abilities & AbilitySwap)
+            {
+                Mask swaps = ctx.own;
+                while (swaps)
+                {
+                    int target = popLsb(swaps);
+                    if (isArmyPawn(pos.kindAt(target), kind))
+                    {
+                        ctx.list.add(Move(from, target, MoveSwap));
+                    }
+                }
+            }
+            if ((piece.abilities & AbilityDominate) && !(pieceFlags & FlagAbilityUsed))
+            {
+                // Kings are excluded: a dominated king would leave its side without one
+                Mask targets = ctx.tables.king[from] & ctx.own & ~pos.kings(ctx.us);
+                while (targets)
+                {
+                    int target = popLsb(targets);
+                    if (!(pos.flagsAt(target) & FlagDominated))
+                    {
+                        ctx.list.add(Move(from, target, MoveDominate));
+                    }
+                }
+            }
+            if (piece.abilities & AbilityPortal)
+            {
+                // One reserve slot is shared by every Portal of the side: a piece goes in while it is
+                // empty and comes out beside any Portal once it is full. Kings stay on the board, and a
+                // dominated piece would lose its expiry inside
+                if (pos.reserveKind(ctx.us, PortalReserve) == NoKind)
+                {
+                    Mask entrants = ctx.tables.king[from] & ctx.own & ~pos.kings(ctx.us);
+                    while (entrants)
+                    {
+                        int target = popLsb(entrants);
+                        if (!(pos.flagsAt(target) & FlagDominated))
+                        {
+                            ctx.list.add(Move(from, target, MovePortalEnter));
+                        }
+                    }
+                }
+                else
+                {
+                    Mask exits = ctx.tables.king[from] & ctx.empty;
+                    while (exits)
+                    {
+                        ctx.list.add(Move(from, from, MovePortalExit, popLsb(exits)));
+                    }
+                }
+            }
+        }
+
+        template <typename Geometry>
+        void pieceMoves(GenContext<Geometry> &ctx, int from)
+        {
+            using Mask = typename Geometry::Mask;
+
+            Kind kind = ctx.position.kindAt(from);
+            const CompiledPiece<Geometry> &piece = ctx.pieces.kinds[kind];
+            switch (piece.family)
+            {
+            case FamilyPawn:
+                pawnMoves(ctx, from, (piece.abilities & AbilityInfect) != 0);
+                break;
+            case FamilyYoungWiz:
+                youngWizMoves(ctx, from);
+                break;
+            case FamilyHopper:
+                pawnHopperMoves(ctx, from);
+                break;
+            default:
+                if (piece.plain)
+                {
+                    Mask targets = piece.quiet[from];
+                    if (piece.quietSlides)
+                    {
+                        targets |= slidingAttacks<Geometry>(from, ctx.position.occupancy(), (piece.quietSlides & SlideOrthogonal) != 0, (piece.quietSlides & SlideDiagonal) != 0);
+                    }
+                    addTargets(ctx, from, targets);
+                }
+                else
+                {
+                    definedMoves(ctx, from, kind, piece);
+                }
+                break;
+            }
+
+            const std::uint16_t extraMoves = AbilitySacrifice | AbilityStone | AbilityRaise | AbilitySwap | AbilityDominate | AbilityPortal;
+            if ((piece.abilities & extraMoves) && !ctx.capturesOnly)
+            {
+                abilityMoves(ctx, from, kind, piece);
+            }
+        }
+
+        // Enemy pieces that can be captured. Only the stone ability sets FlagStone, so without it every enemy is capturable
+        template <typename Geometry>
+        typename Geometry::Mask capturableEnemies(const BasicPosition<Geometry> &position, Side them, std::uint16_t enemyAbilities)
+        {
+            using Mask = typename Geometry::Mask;
+
+            Mask capturable = position.occupancy(them);
+            if (enemyAbilities & AbilityStone)
+            {
+                Mask enemies = capturable;
+                while (enemies)
+                {
+                    int sq = popLsb(enemies);
+                    if (position.flagsAt(sq) & FlagStone)
+                    {
+                        capturable &= ~Geometry::squareBit(sq);
+                    }
+                }
+            }
+            return capturable;
+        }
+
+        // Moves of the side to move; movers limits them to those pieces (countMoves lists only the pieces it cannot count)
+        template <typename Geometry>
+        void generate(const BasicPosition<Geometry> &position, MoveList &list, bool capturesOnly, typename Geometry::Mask movers = ~typename Geometry::Mask(0))
+        {
+            using Mask = typename Geometry::Mask;
+
+            const PieceTables<Geometry> &pieces = pieceTablesFor<Geometry>();
+            Side us = position.sideToMove();
+            Side them = opponent(us);
+            std::uint16_t enemyAbilities = pieces.abilitiesOfRaces[position.races(them)];
+            Mask capturable = capturableEnemies(position, them, enemyAbilities);
+
+            GenContext<Geometry> ctx{position, pieces, attackTablesFor<Geometry>(), list, us, position.occupancy(us), ~position.occupancy(), capturable, capturesOnly};
+
+            // Only the Prowler that just captured may act, and it may decline. It goes through the
+            // same loop so that pieceMoves has a single call site and is inlined into it
+            int prowler = position.pendingProwler();
+            Mask own = prowler != NO_SQUARE ? Geometry::squareBit(prowler) : position.occupancy(us) & movers;
+            while (own)
+            {
+                int sq = popLsb(own);
+                // Only an enemy with the stun ability stuns, and the stun wears off at the end of our turn
+                if (!(enemyAbilities & AbilityStun) || !(position.flagsAt(sq) & FlagStunned))
+                {
+                    pieceMoves(ctx, sq);
+                }
+            }
+            if (prowler != NO_SQUARE && !capturesOnly)
+            {
+                list.add(Move(prowler, prowler, MovePass));
+            }
+        }
+    }
+
+    template <typename Geometry>
+    void generateMoves(const BasicPosition<Geometry> &position, MoveList &list)
+    {
+        generate(position, list, false);
+    }
+
+    template <typename Geometry>
+    void generateCaptures(const BasicPosition<Geometry> &position, MoveList &list)
+    {
+        generate(position, list, true);
+    }
+
+    template <typename Geometry>
+    int countMoves(const BasicPosition<Geometry> &position)
+    {
+        using Mask = typename Geometry::Mask;
+
+        // A pending Prowler has a handful of moves and a pass; not worth a second path
+        if (position.pendingProwler() != NO_SQUARE)
+        {
+            MoveList list;
+            generate(position, list, false);
+            return list.size();
+        }
+
+        const PieceTables<Geometry> &pieces = pieceTablesFor<Geometry>();
+        Side us = position.sideToMove();
+        Side them = opponent(us);
+        std::uint16_t enemyAbilities = pieces.abilitiesOfRaces[position.races(them)];
+        Mask capturable = capturableEnemies(position, them, enemyAbilities);
+        Mask empty = ~position.occupancy();
+        const std::uint16_t extraMoves = AbilitySacrifice | AbilityStone | AbilityRaise | AbilitySwap | AbilityDominate | AbilityPortal;
+
+        // Plain pieces and pawns are counted here; the rest are listed by generate, which keeps
+        // pieceMoves to its one call site
+        int count = 0;
+        Mask listed = 0;
+        Mask own = position.occupancy(us);
+        while (own)
+        {
+            int sq = popLsb(own);
+            if ((enemyAbilities & AbilityStun) && (position.flagsAt(sq) & FlagStunned))
+            {
+                continue;
+            }
+            const CompiledPiece<Geometry> &piece = pieces.kinds[position.kindAt(sq)];
+            if (piece.abilities & extraMoves)
+            {
+                listed |= Geometry::squareBit(sq);
+            }
+            else if (piece.family == FamilyBetza && piece.plain)
+            {
+                // addTargets lists exactly the empty and capturable targets
+                Mask targets = piece.quiet[sq];
+                if (piece.quietSlides)
+                {
+                    targets |= slidingAttacks<Geometry>(sq, position.occupancy(), (piece.quietSlides & SlideOrthogonal) != 0, (piece.quietSlides & SlideDiagonal) != 0);
+                }
+                count += popCount(targets & (empty | capturable));
+            }
+            else if (piece.family == FamilyPawn)
+            {
+                count += pawnMoveCount<Geometry>(sq, us, empty, capturable);
+            }
+            else
+            {
+                listed |= Geometry::squareBit(sq);
+            }
+        }
+        if (listed)
+        {
+            MoveList list;
+            generate(position, list, false, listed);
+            count += list.size();
+        }
+        // MoveList::add drops moves past MAX_MOVES
+        return std::min(count, MAX_MOVES);
+    }
+
+    template <typename Geometry>
+    bool parseMove(const BasicPosition<Geometry> &position, const std::string &text, Move &move)
+    {
+        MoveList list;
+        generateMoves(position, list);
+        for (const Move &candidate : list)
+        {
+            if (BasicPosition<Geometry>::moveToString(candidate) == text)
+            {
+                move = candidate;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    template <typename Geometry>
+    std::uint64_t perft(const BasicPosition<Geometry> &position, int depth)
+    {
+        if (depth == 0)
+        {
+            return 1;
+        }
+        if (isLost(position))
+        {
+            return 0;
+        }
+
+        MoveList list;
+        generateMoves(position, list);
+        if (depth == 1)
+        {
+            return list.size();
+        }
+
+        std::uint64_t nodes = 0;
+        for (const Move &move : list)
+        {
+            BasicPosition<Geometry> child = position;
+            child.makeMove(move);
+            nodes += perft(child, depth - 1);
+        }
+        return nodes;
+    }
+
+    template <typename Geometry>
+    std::uint64_t perft(const BasicPosition<Geometry> &position, int depth, ThreadPool &pool)
+    {
+        // Subtrees this small are cheaper to count than to schedule
+        if (depth <= 3 || isLost(position))
+        {
+            return perft(position, depth);
+        }
+
+        MoveList list;
+        generateMoves(position, list);
+        std::vector<std::uint64_t> counts(list.size());
+        TaskGroup group(pool);
+        for (int i = 0; i < list.size(); ++i)
+        {
+            group.run([&, i]()
+                      {
+                BasicPosition<Geometry> child = position;
+                child.makeMove(list.moves[i]);
+                counts[i] = perft(child, depth - 1, pool); });
+        }
+        group.wait();
+
+        std::uint64_t nodes = 0;
+        for (std::uint64_t count : counts)
+        {
+            nodes += count;
+        }
+        return nodes;
+    }
+
+    template void generateMoves(const BasicPosition<Board8> &position, MoveList &list);
+    template void generateCaptures(const BasicPosition<Board8> &position, MoveList &list);
+    template int countMoves(const BasicPosition<Board8> &position);
+    template bool parseMove(const BasicPosition<Board8> &position, const std::string &text, Move &move);
+    template std::uint64_t perft(const BasicPosition<Board8> &position, int depth);
+    template std::uint64_t perft(const BasicPosition<Board8> &position, int depth, ThreadPool &pool);
+
+    template void generateMoves(const BasicPosition<Board10> &position, MoveList &list);
+    template void generateCaptures(const BasicPosition<Board10> &position, MoveList &list);
+    template int countMoves(const BasicPosition<Board10> &position);
+    template bool parseMove(const BasicPosition<Board10> &position, const std::string &text, Move &move);
+    template std::uint64_t perft(const BasicPosition<Board10> &position, int depth);
+    template std::uint64_t perft(const BasicPosition<Board10> &position, int depth, ThreadPool &pool);
+
+    template void generateMoves(const BasicPosition<Board12> &position, MoveList &list);
+    template void generateCaptures(const BasicPosition<Board12> &position, MoveList &list);
+    template int countMoves(const BasicPosition<Board12> &position);
+    template bool parseMove(const BasicPosition<Board12> &position, const std::string &text, Move &move);
+    template std::uint64_t perft(const BasicPosition<Board12> &position, int depth);
+    template std::uint64_t perft(const BasicPosition<Board12> &position, int depth, ThreadPool &pool);
+}
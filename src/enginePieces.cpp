@@ -0,0 +1,448 @@
+// Filename: enginePieces.cpp
+// Description: Piece definitions for the headless engine: the Betza-style piece file format and its compilation into per-square movement tables.
+
+// Main Classes:
+// - PieceCatalog: Movement string and abilities of every kind, built in or read from a piece file.
+// - PieceTables<Geometry>: The active catalog compiled into leap tables and slide flags for one board size.
+
+// Main Functions:
+// - PieceCatalog PieceCatalog::load(const std::string &path): Applies a piece file on top of the built-in catalog.
+// - void setPieceCatalog(const PieceCatalog &catalog): Makes catalog the one move generation uses.
+
+// Special Features or Notes:
+// - The built-in catalog is written in the same format as piece files, so it documents the rules of
+//   all thirty GUI pieces in one place. Offsets follow the Piece classes: the BoulderThrower's launch
+//   offsets are NH, the Beholder's HDNF and the FrogKing's leaps WDFsN.
+// - Leap tables with identical offsets are stored once; a kind with no leap in some mode points at a
+//   shared all-empty table so the generator never branches on a missing table.
+// - Movement the pawn families need (forward steps, double steps, hop captures) is not expressible in
+//   symmetric Betza, so pawn-slot kinds may name the family instead.
+
+// Usage or Context:
+// - Compiled tables drive engineMoveGen; abilities are read by makeMove and the evaluation.
+// - Loaded by the engine protocol with "setoption name PieceFile value <path>".
+
+#include "enginePieces.h"
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+
+namespace engine
+{
+    namespace
+    {
+        // Same layout as a piece file; Custom kinds start out as the standard pieces of their slot
+        const char *const builtInText = R"(
+Pawn                pawn
+Knight              N
+Bishop              B
+Rook                R
+Queen               Q
+King                K
+NecroPawn           pawn         sacrifice
+GhostKnight         N            stun
+Necromancer         B            raiseDead
+DeadLauncher        RxNxH        load
+QueenOfBones        Q
+GhoulKing           K            raise
+YoungWiz            youngwiz
+Familiar            N            stone
+Wizard              mBxB
+Portal              R            portal
+QueenOfIllusions    Q            swap
+WizardKing          K            columnShot
+PawnHopper          hopper
+BeastKnight         C
+BeastDruid          BK
+BoulderThrower      mRxNxH
+QueenOfDomination   Q            dominate
+FrogKing            WDFsN
+HellPawn            pawn         infect
+Prowler             N            extraMove
+Howler              B            howl
+Beholder            mWxHxDxNxF
+QueenOfDestruction  Q            massDestruction
+HellKing            KxD
+CustomPawn          pawn
+CustomKnight        N
+CustomBishop        B
+CustomRook          R
+CustomQueen         Q
+CustomKing          K
+)";
+
+        struct AbilityName
+        {
+            Ability ability;
+            const char *name;
+        };
+
+        const AbilityName abilityNames[] = {
+            {AbilitySacrifice, "sacrifice"}, {AbilityStun, "stun"}, {AbilityRaiseDead, "raiseDead"}, {AbilityLoad, "load"}, {AbilityRaise, "raise"}, {AbilityStone, "stone"}, {AbilitySwap, "swap"}, {AbilityColumnShot, "columnShot"}, {AbilityDominate, "dominate"}, {AbilityInfect, "infect"}, {AbilityExtraMove, "extraMove"}, {AbilityHowl, "howl"}, {AbilityMassDestruction, "massDestruction"}, {AbilityPortal, "portal"}};
+
+        enum ModeFlag : std::uint8_t
+        {
+            ModeQuiet = 1 << 0,
+            ModeCapture = 1 << 1,
+            ModeRanged = 1 << 2
+        };
+
+        using Offset = std::pair<int, int>; // column step, row step
+
+        // A movement string parsed into board-independent pieces
+        struct Movement
+        {
+            PieceFamily family = FamilyBetza;
+            std::vector<Offset> leaps[3]; // by mode: quiet, capture, ranged
+            std::uint8_t slides[3] = {0, 0, 0};
+        };
+
+        bool isModifier(char c) { return c == 'm' || c == 'c' || c == 'x' || c == 's' || c == 'v'; }
+
+        // Leap (far, near) of a one-letter atom
+        bool atomLeap(char atom, int &far, int &near)
+        {
+            const char atoms[] = "WFDNAHCZG";
+            const int leaps[][2] = {{1, 0}, {1, 1}, {2, 0}, {2, 1}, {2, 2}, {3, 0}, {3, 1}, {3, 2}, {3, 3}};
+            for (int i = 0; atoms[i]; ++i)
+            {
+                if (atoms[i] == atom)
+                {
+                    far = leaps[i][0];
+                    near = leaps[i][1];
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        // Every orientation of a leap, narrowed to its sideways (s) or vertical (v) half
+        std::vector<Offset> orientations(int far, int near, char half)
+        {
+            std::vector<Offset> result;
+            for (int swap = 0; swap < 2; ++swap)
+            {
+                for (int sx = -1; sx <= 1; sx += 2)
+                {
+                    for (int sy = -1; sy <= 1; sy += 2)
+                    {
+                        Offset offset = swap ? Offset(near * sx, far * sy) : Offset(far * sx, near * sy);
+                        int dx = std::abs(offset.first);
+                        int dy = std::abs(offset.second);
+                        if ((half == 's' && dx <= dy) || (half == 'v' && dy <= dx))
+                        {
+                            continue;
+                        }
+                        if (std::find(result.begin(), result.end(), offset) == result.end())
+                        {
+                            result.push_back(offset);
+                        }
+                    }
+                }
+            }
+            return result;
+        }
+
+        Movement parseMovement(const std::string &text)
+        {
+            Movement movement;
+            if (text == "pawn" || text == "youngwiz" || text == "hopper")
+            {
+                movement.family = text == "pawn" ? FamilyPawn : text == "youngwiz" ? FamilyYoungWiz : FamilyHopper;
+                return movement;
+            }
+
+            std::size_t i = 0;
+            while (i < text.size())
+            {
+                std::uint8_t modes = 0;
+                char half = 0;
+                while (i < text.size() && isModifier(text[i]))
+                {
+                    char modifier = text[i++];
+                    if (modifier == 'm')
+                        modes |= ModeQuiet;
+                    else if (modifier == 'c')
+                        modes |= ModeCapture;
+                    else if (modifier == 'x')
+                        modes |= ModeRanged;
+                    else if (half && half != modifier)
+                        throw std::runtime_error("'s' and 'v' exclude each other in " + text);
+                    else
+                        half = modifier;
+                }
+                if (i == text.size())
+                {
+                    throw std::runtime_error("Modifiers without an atom at the end of " + text);
+                }
+                if (!modes)
+                {
+                    modes = ModeQuiet | ModeCapture;
+                }
+
+                char atom = text[i++];
+                bool rides = i < text.size() && text[i] == atom;
+                if (rides)
+                {
+                    ++i;
+                }
+
+                std::uint8_t slides = 0;
+                std::vector<Offset> leaps;
+                int far = 0, near = 0;
+                if (atom == 'R' || atom == 'B' || atom == 'Q' || rides)
+                {
+                    if (rides && atom != 'W' && atom != 'F')
+                    {
+                        throw std::runtime_error(std::string("Only W and F can ride, not ") + atom + " in " + text);
+                    }
+                    if (half)
+                    {
+                        throw std::runtime_error(std::string("'") + half + "' is not supported on riders in " + text);
+                    }
+                    slides = atom == 'W' || atom == 'R' ? SlideOrthogonal : atom == 'F' || atom == 'B' ? SlideDiagonal : SlideOrthogonal | SlideDiagonal;
+                }
+                else if (atom == 'K')
+                {
+                    leaps = orientations(1, 0, half);
+                    std::vector<Offset> diagonal = orientations(1, 1, half);
+                    leaps.insert(leaps.end(), diagonal.begin(), diagonal.end());
+                }
+                else if (atomLeap(atom, far, near))
+                {
+                    leaps = orientations(far, near, half);
+                }
+                else
+                {
+                    throw std::runtime_error(std::string("Unknown atom '") + atom + "' in " + text);
+                }
+                if (!slides && leaps.empty())
+                {
+                    throw std::runtime_error(std::string("'") + half + atom + "' leaves no directions in " + text);
+                }
+
+                for (int mode = 0; mode < 3; ++mode)
+                {
+                    if (modes & (1 << mode))
+                    {
+                        movement.slides[mode] |= slides;
+                        movement.leaps[mode].insert(movement.leaps[mode].end(), leaps.begin(), leaps.end());
+                    }
+                }
+            }
+            if (text.empty())
+            {
+                throw std::runtime_error("Empty movement");
+            }
+            return movement;
+        }
+
+        std::uint16_t parseAbility(const std::string &name)
+        {
+            for (const AbilityName &entry : abilityNames)
+            {
+                if (name == entry.name)
+                {
+                    return entry.ability;
+                }
+            }
+            throw std::runtime_error("Unknown ability " + name);
+        }
+
+        // Reads "<kind> <movement> [ability ...]" lines into catalog, leaving unlisted kinds alone
+        void applyLines(PieceCatalog &catalog, std::istream &in, const std::string &source)
+        {
+            std::string line;
+            int number = 0;
+            while (std::getline(in, line))
+            {
+                ++number;
+                std::istringstream fields(line);
+                std::string name;
+                if (!(fields >> name) || name[0] == '#')
+                {
+                    continue;
+                }
+                try
+                {
+                    Kind kind = kindFromName(name);
+                    if (kind == NoKind)
+                    {
+                        throw std::runtime_error("Unknown piece " + name);
+                    }
+                    PieceDefinition definition;
+                    if (!(fields >> definition.movement))
+                    {
+                        throw std::runtime_error("Missing movement for " + name);
+                    }
+                    Movement movement = parseMovement(definition.movement);
+                    if (movement.family != FamilyBetza && baseOf(kind) != PawnBase)
+                    {
+                        throw std::runtime_error(definition.movement + " movement is only for pawn slots");
+                    }
+
+                    std::string ability;
+                    while (fields >> ability && ability[0] != '#')
+                    {
+                        definition.abilities |= parseAbility(ability);
+                    }
+                    if ((definition.abilities & AbilityInfect) && movement.family == FamilyBetza)
+                    {
+                        throw std::runtime_error("infect needs a pawn family movement");
+                    }
+                    catalog.pieces[kind] = definition;
+                }
+                catch (const std::exception &error)
+                {
+                    throw std::runtime_error(source + ":" + std::to_string(number) + ": " + error.what());
+                }
+            }
+        }
+
+        template <typename Geometry>
+        std::vector<typename Geometry::Mask> leapTable(const std::vector<Offset> &offsets)
+        {
+            std::vector<typename Geometry::Mask> table(Geometry::squares, typename Geometry::Mask(0));
+            for (int sq = 0; sq < Geometry::squares; ++sq)
+            {
+                for (const Offset &offset : offsets)
+                {
+                    int col = Geometry::colOf(sq) + offset.first;
+                    int row = Geometry::rowOf(sq) + offset.second;
+                    if (Geometry::onBoard(row, col))
+                    {
+                        table[sq] |= Geometry::squareBit(Geometry::makeSquare(row, col));
+                    }
+                }
+            }
+            return table;
+        }
+
+        template <typename Geometry>
+        PieceTables<Geometry> compile(const PieceCatalog &catalog)
+        {
+            PieceTables<Geometry> tables;
+            std::map<std::vector<Offset>, std::size_t> tableIndex;
+            std::size_t indices[KindCount][3];
+
+            tableIndex[std::vector<Offset>()] = 0;
+            tables.leaps.push_back(leapTable<Geometry>(std::vector<Offset>()));
+            std::fill(tables.abilitiesOfRaces, tables.abilitiesOfRaces + (1 << RaceCount), 0);
+
+            for (int kind = 0; kind < KindCount; ++kind)
+            {
+                const PieceDefinition &definition = catalog.pieces[kind];
+                Movement movement = parseMovement(definition.movement);
+                CompiledPiece<Geometry> &piece = tables.kinds[kind];
+                piece.family = movement.family;
+                piece.abilities = definition.abilities;
+                piece.quietSlides = movement.slides[0];
+                piece.captureSlides = movement.slides[1];
+                piece.rangedSlides = movement.slides[2];
+                for (int races = 0; races < (1 << RaceCount); ++races)
+                {
+                    if (races & (1 << raceOf(static_cast<Kind>(kind))))
+                    {
+                        tables.abilitiesOfRaces[races] |= definition.abilities;
+                    }
+                }
+
+                for (int mode = 0; mode < 3; ++mode)
+                {
+                    std::vector<Offset> offsets = movement.leaps[mode];
+                    std::sort(offsets.begin(), offsets.end());
+                    offsets.erase(std::unique(offsets.begin(), offsets.end()), offsets.end());
+                    auto found = tableIndex.find(offsets);
+                    if (found == tableIndex.end())
+                    {
+                        found = tableIndex.emplace(offsets, tables.leaps.size()).first;
+                        tables.leaps.push_back(leapTable<Geometry>(offsets));
+                    }
+                    indices[kind][mode] = found->second;
+                }
+
+                const std::uint16_t reshaping = AbilityHowl | AbilityColumnShot | AbilityLoad | AbilityRaiseDead;
+                piece.plain = piece.family == FamilyBetza && indices[kind][0] == indices[kind][1] && indices[kind][2] == 0 &&
+                              piece.quietSlides == piece.captureSlides && !piece.rangedSlides && !(piece.abilities & reshaping);
+            }
+
+            // Point into the storage only once it has stopped growing
+            for (int kind = 0; kind < KindCount; ++kind)
+            {
+                tables.kinds[kind].quiet = tables.leaps[indices[kind][0]].data();
+                tables.kinds[kind].capture = tables.leaps[indices[kind][1]].data();
+                tables.kinds[kind].ranged = tables.leaps[indices[kind][2]].data();
+            }
+            return tables;
+        }
+
+        PieceCatalog &activeCatalog()
+        {
+            static PieceCatalog catalog = PieceCatalog::builtIn();
+            return catalog;
+        }
+
+        template <typename Geometry>
+        PieceTables<Geometry> &activeTables()
+        {
+            static PieceTables<Geometry> tables = compile<Geometry>(activeCatalog());
+            return tables;
+        }
+    }
+
+    const PieceCatalog &PieceCatalog::builtIn()
+    {
+        static const PieceCatalog catalog = []()
+        {
+            PieceCatalog result;
+            std::istringstream in(builtInText);
+            applyLines(result, in, "built-in pieces");
+            return result;
+        }();
+        return catalog;
+    }
+
+    PieceCatalog PieceCatalog::load(const std::string &path)
+    {
+        std::ifstream file(path);
+        if (!file)
+        {
+            throw std::runtime_error("Failed to open piece file: " + path);
+        }
+        return parse(file, path);
+    }
+
+    PieceCatalog PieceCatalog::parse(std::istream &in, const std::string &source)
+    {
+        PieceCatalog catalog = builtIn();
+        applyLines(catalog, in, source);
+        return catalog;
+    }
+
+    template <typename Geometry>
+    const PieceTables<Geometry> &pieceTablesFor()
+    {
+        return activeTables<Geometry>();
+    }
+
+    const PieceCatalog &pieceCatalog()
+    {
+        return activeCatalog();
+    }
+
+    void setPieceCatalog(const PieceCatalog &catalog)
+    {
+        activeCatalog() = catalog;
+        activeTables<Board8>() = compile<Board8>(catalog);
+        activeTables<Board10>() = compile<Board10>(catalog);
+        activeTables<Board12>() = compile<Board12>(catalog);
+    }
+
+    template const PieceTables<Board8> &pieceTablesFor<Board8>();
+    template const PieceTables<Board10> &pieceTablesFor<Board10>();
+    template const PieceTables<Board12> &pieceTablesFor<Board12>();
+}
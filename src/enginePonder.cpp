@@ -0,0 +1,199 @@
+// Filename: enginePonder.cpp
+// Description: Background search on the opponent's time with reuse on a correctly predicted reply.
+
+// Main Classes:
+// - Ponderer: Owns a Search and its transposition table and runs them on a worker thread.
+
+// Main Functions:
+// - void Ponderer::startPondering(const Position &afterOurMove, const SearchLimits &ourLimits):
+//   Starts the worker, which predicts the reply (transposition table move, else a shallow search) and
+//   ponders the resulting position.
+// - bool Ponderer::opponentMoved(const Position &actual):
+//   Turns the ponder search into the real search on a hit, otherwise cancels it and searches the actual position.
+
+// Special Features or Notes:
+// - A hit is detected by comparing Zobrist hashes, so it works from whole-board packets without move lists.
+// - Cancelling only sets the search's stop flag and joins; the worker checks it every node, including
+//   in the shallow search that predicts the reply, so nothing here blocks the game loop.
+// - A reply that arrives before the prediction is ready counts as a miss.
+// - Nothing is pondered while the same side is still to move (pending Prowler move) or the game is over.
+
+// Usage or Context:
+// - Used by the networked game loop so the local engine keeps thinking while receivePacket waits.
+
+#include "enginePonder.h"
+
+namespace engine
+{
+    Ponderer::Ponderer(std::size_t hashMegabytes)
+        : tt(hashMegabytes), search(tt), pondering(false)
+    {
+    }
+
+    Ponderer::~Ponderer()
+    {
+        cancel();
+    }
+
+    void Ponderer::cancel()
+    {
+        search.stop();
+        if (worker.joinable())
+        {
+            worker.join();
+        }
+        pondering.store(false);
+
+        std::lock_guard<std::mutex> lock(resultMutex);
+        predicted = Move();
+        resultReady = false;
+        hasInfo = false;
+    }
+
+    Move Ponderer::predictedMove() const
+    {
+        std::lock_guard<std::mutex> lock(resultMutex);
+        return predicted;
+    }
+
+    Move Ponderer::predictReply(const Position &afterOurMove)
+    {
+        TTEntry entry;
+        if (tt.probe(afterOurMove.hash(), entry) && !entry.move.isNull())
+        {
+            Move move;
+            // Guard against a hash collision handing back a move from another position
+            if (parseMove(afterOurMove, Position::moveToString(entry.move), move))
+            {
+                return move;
+            }
+        }
+
+        // Stopped by cancel() like the ponder search; the stop flag stays set for the search after it
+        SearchLimits quick;
+        quick.depth = 3;
+        return search.run(afterOurMove, quick).best;
+    }
+
+    void Ponderer::runSearch(const Position &root, const SearchLimits &limits)
+    {
+        SearchResult searchResult = search.run(root, limits, [this](const SearchInfo &latest)
+                                               {
+            std::lock_guard<std::mutex> lock(resultMutex);
+            info = latest;
+            hasInfo = true; });
+
+        std::lock_guard<std::mutex> lock(resultMutex);
+        result = searchResult;
+        resultReady = true;
+    }
+
+    void Ponderer::launch(const Position &root, const SearchLimits &limits)
+    {
+        search.resetStop();
+        worker = std::thread([this, root, limits]()
+                             { runSearch(root, limits); });
+    }
+
+    // Runs on the worker thread
+    void Ponderer::ponder(const Position &afterOurMove)
+    {
+        Move reply = predictReply(afterOurMove);
+        Position root = afterOurMove;
+        if (!reply.isNull())
+        {
+            root.makeMove(reply);
+        }
+        if (reply.isNull() || root.sideToMove() == afterOurMove.sideToMove() || isLost(root))
+        {
+            // No prediction, or the predicted reply keeps the turn (Prowler) or ends the game: nothing useful to ponder
+            pondering.store(false);
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(resultMutex);
+            predicted = reply;
+            ponderRoot = root;
+        }
+
+        SearchLimits ponderLimits = moveLimits;
+        ponderLimits.ponder = true;
+        runSearch(root, ponderLimits);
+    }
+
+    void Ponderer::startPondering(const Position &afterOurMove, const SearchLimits &ourLimits)
+    {
+        cancel();
+        moveLimits = ourLimits;
+        moveLimits.ponder = false;
+
+        if (isLost(afterOurMove) || afterOurMove.pendingProwler() != NO_SQUARE)
+        {
+            return;
+        }
+
+        pondering.store(true);
+        search.resetStop();
+        worker = std::thread([this, afterOurMove]()
+                             { ponder(afterOurMove); });
+    }
+
+    bool Ponderer::opponentMoved(const Position &actual)
+    {
+        bool hit;
+        {
+            std::lock_guard<std::mutex> lock(resultMutex);
+            hit = !predicted.isNull() && actual.hash() == ponderRoot.hash();
+        }
+        // A hit that lands before the ponder search has started is kept by the search until it does
+        if (pondering.load() && hit)
+        {
+            search.ponderHit();
+            pondering.store(false);
+            return true;
+        }
+
+        cancel();
+        if (!isLost(actual))
+        {
+            launch(actual, moveLimits);
+        }
+        return false;
+    }
+
+    bool Ponderer::poll(SearchResult &searchResult)
+    {
+        if (pondering.load())
+        {
+            return false;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(resultMutex);
+            if (!resultReady)
+            {
+                return false;
+            }
+            searchResult = result;
+            resultReady = false;
+        }
+
+        if (worker.joinable())
+        {
+            worker.join();
+        }
+        return true;
+    }
+
+    bool Ponderer::latestInfo(SearchInfo &latest) const
+    {
+        std::lock_guard<std::mutex> lock(resultMutex);
+        if (!hasInfo)
+        {
+            return false;
+        }
+        latest = info;
+        return true;
+    }
+}
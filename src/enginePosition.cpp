@@ -0,0 +1,994 @@
+// Filename: enginePosition.cpp
+// Description: Implementation of the headless engine Position: notation parsing, incremental hashing and move application.
+
+// Main Classes:
+// - BasicPosition<Geometry>: Mailbox plus bitboard board state with a Zobrist hash, instantiated for
+//   the 8x8 board (Position) and the 10x10 and 12x12 variants.
+
+// Main Functions:
+// - Position Position::fromNotation(const std::string &notation) / std::string Position::toNotation() const:
+//   Reads and writes the compact position notation used by the engine protocol.
+// - PackedPosition Position::pack() const / Position Position::unpack(const PackedPosition &packed):
+//   Fixed-size binary form used for bulk analysis; unpackBoard skips the hash for move-counting only.
+// - void Position::makeMove(const Move &move):
+//   Applies a move and every side effect the GUI performs for it (mass destruction, infection, stuns,
+//   Howler ability gains, Prowler extra moves, domination expiry).
+
+// Special Features or Notes:
+// - Rules mirror game.cpp: losing every king loses the game, stunned pieces skip their owner's next turn,
+//   stone Familiars cannot be captured and a Prowler that captures moves again.
+// - Side effects follow the mover's abilities in the piece catalog rather than its kind, so a piece
+//   file can hand a stun or an extra move to any piece.
+// - Each side holds off-board pieces in fixed reserve slots (the piece inside its Portals). A slot is hashed
+//   like a square and copied with the position, so entering and leaving a Portal undoes for free.
+// - The QueenOfBones revive prompt is GUI-only for now.
+
+// Usage or Context:
+// - Core state for the battlechess_engine binary and any tool that needs the rules without SFML.
+
+#include "enginePosition.h"
+#include "engineAttacks.h"
+#include "enginePieces.h"
+#include <cctype>
+#include <sstream>
+#include <stdexcept>
+
+namespace engine
+{
+    namespace
+    {
+        template <typename Geometry>
+        struct ZobristKeys
+        {
+            std::uint64_t pieces[KindCount][2][Geometry::squares];
+            std::uint64_t flags[16][Geometry::squares];
+            std::uint64_t original[KindCount][Geometry::squares];
+            std::uint64_t prowler[Geometry::squares];
+            std::uint64_t blackToMove;
+            std::uint64_t reserve[KindCount][2][ReserveSlots];
+            std::uint64_t reserveFlags[16][2][ReserveSlots];
+        };
+
+        std::uint64_t splitMix(std::uint64_t &state)
+        {
+            std::uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+            return z ^ (z >> 31);
+        }
+
+        template <typename Geometry>
+        const ZobristKeys<Geometry> &zobrist()
+        {
+            static const ZobristKeys<Geometry> keys = []()
+            {
+                ZobristKeys<Geometry> result;
+                std::uint64_t state = 0x42617474436865ULL; // fixed seed so hashes are stable across processes
+                for (auto &kind : result.pieces)
+                    for (auto &side : kind)
+                        for (auto &value : side)
+                            value = splitMix(state);
+                for (auto &bit : result.flags)
+                    for (auto &value : bit)
+                        value = splitMix(state);
+                for (auto &kind : result.original)
+                    for (auto &value : kind)
+                        value = splitMix(state);
+                for (auto &value : result.prowler)
+                    value = splitMix(state);
+                result.blackToMove = splitMix(state);
+                // Drawn after every older key so hashes of positions without a reserve do not change
+                for (auto &kind : result.reserve)
+                    for (auto &side : kind)
+                        for (auto &value : side)
+                            value = splitMix(state);
+                for (auto &bit : result.reserveFlags)
+                    for (auto &side : bit)
+                        for (auto &value : side)
+                            value = splitMix(state);
+                return result;
+            }();
+            return keys;
+        }
+
+        const char pieceLetters[BaseCount] = {'p', 'n', 'b', 'r', 'q', 'k'};
+        const char raceTags[RaceCount] = {0, 'd', 'w', 'f', 'h', 'c'};
+        const char reserveSlotLetters[ReserveSlots] = {'p'};
+
+        struct FlagLetter
+        {
+            std::uint16_t flag;
+            char letter;
+        };
+
+        const FlagLetter flagLetters[] = {
+            {FlagStunned, 's'}, {FlagStone, 'o'}, {FlagLoaded, 'l'}, {FlagAbilityUsed, 'u'}, {FlagDominated, 'm'}, {FlagDominationNew, 'n'}, {FlagHowlerRook, 'R'}, {FlagHowlerKnight, 'N'}, {FlagHowlerPawn, 'P'}, {FlagHowlerQueen, 'Q'}, {FlagHowlerKing, 'K'}};
+
+        struct PieceToken
+        {
+            Kind kind;
+            Side side;
+            std::uint16_t flags;
+        };
+
+        // Reads the piece letter, race tag and [flags] starting at text[i] and leaves i after them
+        PieceToken parsePiece(const std::string &text, std::size_t &i)
+        {
+            char c = text[i];
+            int base = -1;
+            for (int b = 0; b < BaseCount; ++b)
+            {
+                if (std::tolower(static_cast<unsigned char>(c)) == pieceLetters[b])
+                {
+                    base = b;
+                }
+            }
+            if (base < 0)
+            {
+                throw std::runtime_error(std::string("Unknown piece letter '") + c + "'");
+            }
+            Side side = std::isupper(static_cast<unsigned char>(c)) ? White : Black;
+            ++i;
+
+            int race = Standard;
+            if (i < text.size())
+            {
+                for (int r = 1; r < RaceCount; ++r)
+                {
+                    if (text[i] == raceTags[r])
+                    {
+                        race = r;
+                    }
+                }
+                if (race != Standard)
+                {
+                    ++i;
+                }
+            }
+
+            std::uint16_t pieceFlags = 0;
+            if (i < text.size() && text[i] == '[')
+            {
+                ++i;
+                while (i < text.size() && text[i] != ']')
+                {
+                    bool known = false;
+                    for (const auto &entry : flagLetters)
+                    {
+                        if (text[i] == entry.letter)
+                        {
+                            pieceFlags |= entry.flag;
+                            known = true;
+                        }
+                    }
+                    if (!known)
+                    {
+                        throw std::runtime_error(std::string("Unknown piece flag '") + text[i] + "'");
+                    }
+                    ++i;
+                }
+                if (i >= text.size())
+                {
+                    throw std::runtime_error("Unterminated piece flags");
+                }
+                ++i;
+            }
+            return PieceToken{makeKind(static_cast<Race>(race), static_cast<Base>(base)), side, pieceFlags};
+        }
+
+        void writePiece(std::string &text, Kind kind, Side side, std::uint16_t pieceFlags)
+        {
+            char letter = pieceLetters[baseOf(kind)];
+            text += side == White ? static_cast<char>(std::toupper(static_cast<unsigned char>(letter))) : letter;
+            if (raceOf(kind) != Standard)
+            {
+                text += raceTags[raceOf(kind)];
+            }
+            if (pieceFlags)
+            {
+                text += '[';
+                for (const auto &entry : flagLetters)
+                {
+                    if (pieceFlags & entry.flag)
+                    {
+                        text += entry.letter;
+                    }
+                }
+                text += ']';
+            }
+        }
+
+        // Howler::gainAbilitiesFromCapturedPiece grants the family of the captured piece's base slot
+        std::uint16_t howlerFamilyFor(Kind captured)
+        {
+            if (kindAbilities(captured) & AbilityHowl)
+            {
+                return 0;
+            }
+            switch (baseOf(captured))
+            {
+            case RookBase:
+                return FlagHowlerRook;
+            case KnightBase:
+                return FlagHowlerKnight;
+            case QueenBase:
+                return FlagHowlerQueen;
+            case KingBase:
+                return FlagHowlerKing;
+            case PawnBase:
+                return FlagHowlerPawn;
+            default:
+                return 0;
+            }
+        }
+
+        template <typename Geometry>
+        std::uint64_t squareKey(Kind kind, Side side, std::uint16_t pieceFlags, Kind original, int sq)
+        {
+            if (kind == NoKind)
+            {
+                return 0;
+            }
+            const ZobristKeys<Geometry> &keys = zobrist<Geometry>();
+            std::uint64_t value = keys.pieces[kind][side][sq];
+            for (int bit = 0; bit < 16; ++bit)
+            {
+                if (pieceFlags & (1u << bit))
+                {
+                    value ^= keys.flags[bit][sq];
+                }
+            }
+            if ((pieceFlags & FlagDominated) && original != NoKind)
+            {
+                value ^= keys.original[original][sq];
+            }
+            return value;
+        }
+
+        template <typename Geometry>
+        std::uint64_t reserveKey(Kind kind, Side side, std::uint16_t pieceFlags, ReserveSlot slot)
+        {
+            if (kind == NoKind)
+            {
+                return 0;
+            }
+            const ZobristKeys<Geometry> &keys = zobrist<Geometry>();
+            std::uint64_t value = keys.reserve[kind][side][slot];
+            for (int bit = 0; bit < 16; ++bit)
+            {
+                if (pieceFlags & (1u << bit))
+                {
+                    value ^= keys.reserveFlags[bit][side][slot];
+                }
+            }
+            return value;
+        }
+    }
+
+    template <typename Geometry>
+    BasicPosition<Geometry>::BasicPosition()
+        : toMove(White), prowlerSquare(NO_SQUARE), key(0)
+    {
+        kinds.fill(NoKind);
+        sides.fill(White);
+        flags.fill(0);
+        originalKinds.fill(NoKind);
+        occupied[White] = occupied[Black] = 0;
+        kingSquares[White] = kingSquares[Black] = 0;
+        raceMasks[White] = raceMasks[Black] = 0;
+        for (int side = White; side <= Black; ++side)
+        {
+            for (int slot = 0; slot < ReserveSlots; ++slot)
+            {
+                reserveKinds[side][slot] = NoKind;
+                reserveFlags[side][slot] = 0;
+            }
+        }
+    }
+
+    template <typename Geometry>
+    BasicPosition<Geometry> BasicPosition<Geometry>::startPosition()
+    {
+        // King on column 3 and queen on column 4 as laid out by the army menus; wider boards add
+        // knights between the rooks and the rest of the back rank
+        std::string extra((Geometry::dim - BOARD_DIM) / 2, 'n');
+        std::string backRank = "rn" + extra + "bkqb" + extra + "nr";
+        std::string whiteBackRank;
+        for (char c : backRank)
+        {
+            whiteBackRank += static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+        }
+
+        std::string notation = whiteBackRank + "/" + std::string(Geometry::dim, 'P');
+        for (int row = 2; row < Geometry::dim - 2; ++row)
+        {
+            notation += "/" + std::to_string(Geometry::dim);
+        }
+        return fromNotation(notation + "/" + std::string(Geometry::dim, 'p') + "/" + backRank + " w");
+    }
+
+    template <typename Geometry>
+    BasicPosition<Geometry> BasicPosition<Geometry>::fromNotation(const std::string &notation)
+    {
+        std::istringstream stream(notation);
+        std::string boardField, sideField, prowlerField, reserveField;
+        stream >> boardField >> sideField >> prowlerField >> reserveField;
+
+        if (boardField.empty())
+        {
+            throw std::runtime_error("Empty position notation");
+        }
+
+        BasicPosition position;
+        int row = 0;
+        int col = 0;
+        std::size_t i = 0;
+        while (i < boardField.size())
+        {
+            char c = boardField[i];
+            if (c == '/')
+            {
+                if (col != Geometry::dim)
+                {
+                    throw std::runtime_error("Row " + std::to_string(row + 1) + " does not have " + std::to_string(Geometry::dim) + " squares");
+                }
+                ++row;
+                col = 0;
+                ++i;
+                continue;
+            }
+            if (std::isdigit(static_cast<unsigned char>(c)))
+            {
+                int run = 0;
+                while (i < boardField.size() && std::isdigit(static_cast<unsigned char>(boardField[i])))
+                {
+                    run = run * 10 + (boardField[i] - '0');
+                    ++i;
+                }
+                col += run;
+                if (col > Geometry::dim)
+                {
+                    throw std::runtime_error("Too many squares in row " + std::to_string(row + 1));
+                }
+                continue;
+            }
+
+            if (row >= Geometry::dim || col >= Geometry::dim)
+            {
+                throw std::runtime_error("Piece placed outside the board");
+            }
+            PieceToken piece = parsePiece(boardField, i);
+            Kind kind = piece.kind;
+            std::uint16_t pieceFlags = piece.flags;
+            Side side = piece.side;
+            int sq = Geometry::makeSquare(row, col);
+            if (pieceFlags & FlagDominated)
+            {
+                // A dominated piece is written as its original kind and plays as a Queen
+                position.originalKinds[sq] = kind;
+                kind = Queen;
+            }
+            position.put(sq, kind, side, pieceFlags);
+            ++col;
+        }
+        if (row != Geometry::dim - 1 || col != Geometry::dim)
+        {
+            throw std::runtime_error("Board must have " + std::to_string(Geometry::dim) + " complete rows");
+        }
+
+        if (sideField == "b")
+        {
+            position.setSideToMove(Black);
+        }
+        else if (!sideField.empty() && sideField != "w")
+        {
+            throw std::runtime_error("Side to move must be 'w' or 'b'");
+        }
+
+        if (!prowlerField.empty() && prowlerField != "-")
+        {
+            std::size_t pos = 0;
+            int sq = squareFromString<Geometry>(prowlerField, pos);
+            if (sq < 0 || position.isEmpty(sq) || !(kindAbilities(position.kindAt(sq)) & AbilityExtraMove) || position.sideAt(sq) != position.toMove)
+            {
+                throw std::runtime_error("Pending Prowler square must hold a Prowler of the side to move");
+            }
+            position.prowlerSquare = static_cast<std::uint8_t>(sq);
+            position.key ^= zobrist<Geometry>().prowler[sq];
+        }
+
+        i = 0;
+        while (i < reserveField.size())
+        {
+            int slot = -1;
+            for (int index = 0; index < ReserveSlots; ++index)
+            {
+                if (reserveField[i] == reserveSlotLetters[index])
+                {
+                    slot = index;
+                }
+            }
+            if (slot < 0 || i + 2 >= reserveField.size() || reserveField[i + 1] != '=')
+            {
+                throw std::runtime_error("Reserve entries must be slot=piece");
+            }
+            i += 2;
+            PieceToken piece = parsePiece(reserveField, i);
+            if (piece.flags & FlagDominated)
+            {
+                throw std::runtime_error("A dominated piece cannot be in a reserve");
+            }
+            if (position.reserveKind(piece.side, static_cast<ReserveSlot>(slot)) != NoKind)
+            {
+                throw std::runtime_error("Reserve slot given twice");
+            }
+            position.putReserve(piece.side, static_cast<ReserveSlot>(slot), piece.kind, piece.flags);
+            if (i < reserveField.size())
+            {
+                if (reserveField[i] != ',')
+                {
+                    throw std::runtime_error("Reserve entries must be separated by ','");
+                }
+                ++i;
+            }
+        }
+        return position;
+    }
+
+    template <typename Geometry>
+    std::string BasicPosition<Geometry>::toNotation() const
+    {
+        std::string text;
+        for (int row = 0; row < Geometry::dim; ++row)
+        {
+            int empty = 0;
+            for (int col = 0; col < Geometry::dim; ++col)
+            {
+                int sq = Geometry::makeSquare(row, col);
+                if (isEmpty(sq))
+                {
+                    ++empty;
+                    continue;
+                }
+                if (empty)
+                {
+                    text += std::to_string(empty);
+                    empty = 0;
+                }
+                Kind written = (flags[sq] & FlagDominated) ? originalKindAt(sq) : kindAt(sq);
+                writePiece(text, written, sideAt(sq), flags[sq]);
+            }
+            if (empty)
+            {
+                text += std::to_string(empty);
+            }
+            if (row != Geometry::dim - 1)
+            {
+                text += '/';
+            }
+        }
+        text += toMove == White ? " w" : " b";
+
+        std::string reserve;
+        for (int side = White; side <= Black; ++side)
+        {
+            for (int slot = 0; slot < ReserveSlots; ++slot)
+            {
+                if (reserveKinds[side][slot] == NoKind)
+                {
+                    continue;
+                }
+                reserve += reserve.empty() ? "" : ",";
+                reserve += reserveSlotLetters[slot];
+                reserve += '=';
+                writePiece(reserve, static_cast<Kind>(reserveKinds[side][slot]), static_cast<Side>(side), reserveFlags[side][slot]);
+            }
+        }
+
+        if (prowlerSquare != NO_SQUARE)
+        {
+            text += " " + squareToString<Geometry>(prowlerSquare);
+        }
+        else if (!reserve.empty())
+        {
+            text += " -";
+        }
+        if (!reserve.empty())
+        {
+            text += " " + reserve;
+        }
+        return text;
+    }
+
+    template <typename Geometry>
+    typename BasicPosition<Geometry>::Packed BasicPosition<Geometry>::pack() const
+    {
+        Packed packed;
+        packed.occupied = occupancy();
+        packed.sideToMove = static_cast<std::uint8_t>(toMove);
+        packed.prowlerSquare = prowlerSquare;
+        for (int side = White; side <= Black; ++side)
+        {
+            for (int slot = 0; slot < ReserveSlots; ++slot)
+            {
+                packed.reserveKinds[side][slot] = reserveKinds[side][slot];
+                packed.reserveFlags[side][slot] = reserveFlags[side][slot];
+            }
+        }
+        if (popCount(packed.occupied) > Packed::maxPieces)
+        {
+            throw std::runtime_error("Too many pieces to pack a position");
+        }
+
+        int index = 0;
+        Mask pieces = packed.occupied;
+        while (pieces)
+        {
+            int sq = popLsb(pieces);
+            Kind kind = (flags[sq] & FlagDominated) ? originalKindAt(sq) : kindAt(sq);
+            packed.kinds[index] = static_cast<std::uint8_t>(kind | (sideAt(sq) == Black ? PACKED_BLACK : 0));
+            packed.flags[index] = flags[sq];
+            ++index;
+        }
+        return packed;
+    }
+
+    template <typename Geometry>
+    BasicPosition<Geometry> BasicPosition<Geometry>::unpack(const Packed &packed)
+    {
+        BasicPosition position;
+        int index = 0;
+        Mask pieces = packed.occupied;
+        while (pieces)
+        {
+            int sq = popLsb(pieces);
+            Kind kind = static_cast<Kind>(packed.kinds[index] & ~PACKED_BLACK);
+            Side side = (packed.kinds[index] & PACKED_BLACK) ? Black : White;
+            std::uint16_t pieceFlags = packed.flags[index];
+            if (pieceFlags & FlagDominated)
+            {
+                position.originalKinds[sq] = kind;
+                kind = Queen;
+            }
+            position.put(sq, kind, side, pieceFlags);
+            ++index;
+        }
+        position.setSideToMove(static_cast<Side>(packed.sideToMove));
+        if (packed.prowlerSquare != NO_SQUARE)
+        {
+            position.prowlerSquare = packed.prowlerSquare;
+            position.key ^= zobrist<Geometry>().prowler[packed.prowlerSquare];
+        }
+        for (int side = White; side <= Black; ++side)
+        {
+            for (int slot = 0; slot < ReserveSlots; ++slot)
+            {
+                position.putReserve(static_cast<Side>(side), static_cast<ReserveSlot>(slot),
+                                    static_cast<Kind>(packed.reserveKinds[side][slot]), packed.reserveFlags[side][slot]);
+            }
+        }
+        return position;
+    }
+
+    template <typename Geometry>
+    BasicPosition<Geometry> BasicPosition<Geometry>::unpackBoard(const Packed &packed)
+    {
+        // Writes the arrays and masks put() would, without the per-piece hash keys
+        BasicPosition position;
+        int index = 0;
+        Mask pieces = packed.occupied;
+        while (pieces)
+        {
+            int sq = popLsb(pieces);
+            Kind kind = static_cast<Kind>(packed.kinds[index] & ~PACKED_BLACK);
+            Side side = (packed.kinds[index] & PACKED_BLACK) ? Black : White;
+            std::uint16_t pieceFlags = packed.flags[index];
+            if (pieceFlags & FlagDominated)
+            {
+                position.originalKinds[sq] = kind;
+                kind = Queen;
+            }
+            position.kinds[sq] = kind;
+            position.sides[sq] = side;
+            position.flags[sq] = pieceFlags;
+            position.occupied[side] |= Geometry::squareBit(sq);
+            position.raceMasks[side] |= static_cast<std::uint8_t>(1 << raceOf(kind));
+            if (baseOf(kind) == KingBase)
+            {
+                position.kingSquares[side] |= Geometry::squareBit(sq);
+            }
+            ++index;
+        }
+        position.toMove = static_cast<Side>(packed.sideToMove);
+        position.prowlerSquare = packed.prowlerSquare;
+        for (int side = White; side <= Black; ++side)
+        {
+            for (int slot = 0; slot < ReserveSlots; ++slot)
+            {
+                Kind held = static_cast<Kind>(packed.reserveKinds[side][slot]);
+                if (held != NoKind)
+                {
+                    position.reserveKinds[side][slot] = held;
+                    position.reserveFlags[side][slot] = packed.reserveFlags[side][slot];
+                    position.raceMasks[side] |= static_cast<std::uint8_t>(1 << raceOf(held));
+                }
+            }
+        }
+        return position;
+    }
+
+    template <typename Geometry>
+    std::string BasicPosition<Geometry>::toDisplay() const
+    {
+        std::ostringstream out;
+        for (int row = 0; row < Geometry::dim; ++row)
+        {
+            out << (row + 1 < 10 ? " " : "") << row + 1 << " ";
+            for (int col = 0; col < Geometry::dim; ++col)
+            {
+                int sq = Geometry::makeSquare(row, col);
+                if (isEmpty(sq))
+                {
+                    out << " .  ";
+                    continue;
+                }
+                char letter = pieceLetters[baseOf(kindAt(sq))];
+                out << ' ' << (sideAt(sq) == White ? static_cast<char>(std::toupper(static_cast<unsigned char>(letter))) : letter);
+                out << (raceOf(kindAt(sq)) != Standard ? raceTags[raceOf(kindAt(sq))] : ' ');
+                out << (flags[sq] & FlagStunned ? '*' : ' ');
+            }
+            out << "\n";
+        }
+        out << "   ";
+        for (int col = 0; col < Geometry::dim; ++col)
+        {
+            out << ' ' << static_cast<char>('a' + col) << "  ";
+        }
+        out << "\n"
+            << toNotation() << "\nKey: " << std::hex << key << std::dec << "\n";
+        return out.str();
+    }
+
+    template <typename Geometry>
+    void BasicPosition<Geometry>::put(int sq, Kind kind, Side side, std::uint16_t pieceFlags)
+    {
+        if (!isEmpty(sq))
+        {
+            remove(sq);
+        }
+        kinds[sq] = kind;
+        sides[sq] = side;
+        flags[sq] = pieceFlags;
+        if (!(pieceFlags & FlagDominated))
+        {
+            originalKinds[sq] = NoKind;
+        }
+        occupied[side] |= Geometry::squareBit(sq);
+        raceMasks[side] |= static_cast<std::uint8_t>(1 << raceOf(kind));
+        if (baseOf(kind) == KingBase)
+        {
+            kingSquares[side] |= Geometry::squareBit(sq);
+        }
+        key ^= squareKey<Geometry>(kind, side, pieceFlags, originalKindAt(sq), sq);
+    }
+
+    template <typename Geometry>
+    void BasicPosition<Geometry>::remove(int sq)
+    {
+        if (isEmpty(sq))
+        {
+            return;
+        }
+        Side side = sideAt(sq);
+        key ^= squareKey<Geometry>(kindAt(sq), side, flags[sq], originalKindAt(sq), sq);
+        occupied[side] &= ~Geometry::squareBit(sq);
+        kingSquares[side] &= ~Geometry::squareBit(sq);
+        kinds[sq] = NoKind;
+        flags[sq] = 0;
+        originalKinds[sq] = NoKind;
+    }
+
+    template <typename Geometry>
+    void BasicPosition<Geometry>::relocate(int from, int to)
+    {
+        if (from == to)
+        {
+            return;
+        }
+        Kind kind = kindAt(from);
+        Side side = sideAt(from);
+        std::uint16_t pieceFlags = flags[from];
+        Kind original = originalKindAt(from);
+        remove(from);
+        remove(to);
+        originalKinds[to] = original;
+        put(to, kind, side, pieceFlags);
+    }
+
+    template <typename Geometry>
+    void BasicPosition<Geometry>::setFlags(int sq, std::uint16_t pieceFlags)
+    {
+        if (isEmpty(sq) || flags[sq] == pieceFlags)
+        {
+            return;
+        }
+        key ^= squareKey<Geometry>(kindAt(sq), sideAt(sq), flags[sq], originalKindAt(sq), sq);
+        flags[sq] = pieceFlags;
+        key ^= squareKey<Geometry>(kindAt(sq), sideAt(sq), flags[sq], originalKindAt(sq), sq);
+    }
+
+    template <typename Geometry>
+    void BasicPosition<Geometry>::setSideToMove(Side side)
+    {
+        if (side != toMove)
+        {
+            toMove = side;
+            key ^= zobrist<Geometry>().blackToMove;
+        }
+    }
+
+    template <typename Geometry>
+    void BasicPosition<Geometry>::putReserve(Side side, ReserveSlot slot, Kind kind, std::uint16_t pieceFlags)
+    {
+        clearReserve(side, slot);
+        if (kind == NoKind)
+        {
+            return;
+        }
+        reserveKinds[side][slot] = kind;
+        reserveFlags[side][slot] = pieceFlags;
+        raceMasks[side] |= static_cast<std::uint8_t>(1 << raceOf(kind));
+        key ^= reserveKey<Geometry>(kind, side, pieceFlags, slot);
+    }
+
+    template <typename Geometry>
+    void BasicPosition<Geometry>::clearReserve(Side side, ReserveSlot slot)
+    {
+        key ^= reserveKey<Geometry>(reserveKind(side, slot), side, reserveFlags[side][slot], slot);
+        reserveKinds[side][slot] = NoKind;
+        reserveFlags[side][slot] = 0;
+    }
+
+    template <typename Geometry>
+    void BasicPosition<Geometry>::makeNullMove()
+    {
+        if (prowlerSquare != NO_SQUARE)
+        {
+            key ^= zobrist<Geometry>().prowler[prowlerSquare];
+            prowlerSquare = NO_SQUARE;
+        }
+        setSideToMove(opponent(toMove));
+    }
+
+    // Removes the piece on target and triggers what capturing it causes
+    template <typename Geometry>
+    void BasicPosition<Geometry>::resolveCapture(int target, int capturer)
+    {
+        Kind victim = kindAt(target);
+        std::uint16_t attacker = kindAbilities(kindAt(capturer));
+        remove(target);
+
+        // Capturing a QueenOfDestruction destroys the capturer's pieces in her lines (HellPawns infect instead)
+        if ((kindAbilities(victim) & AbilityMassDestruction) && !(attacker & AbilityInfect))
+        {
+            massDestruction(target, capturer);
+        }
+
+        if (attacker & AbilityHowl)
+        {
+            setFlags(capturer, flags[capturer] | howlerFamilyFor(victim));
+        }
+    }
+
+    // Mirrors QueenOfDestruction::massDestruction: every capturer-side piece the fallen queen could
+    // reach, looking through the capturing piece, is removed
+    template <typename Geometry>
+    void BasicPosition<Geometry>::massDestruction(int queenSquare, int capturer)
+    {
+        Side destroyed = sideAt(capturer);
+        Mask targets = queenLineTargets<Geometry>(queenSquare, occupancy(), capturer) & occupied[destroyed];
+        targets &= ~Geometry::squareBit(capturer);
+        while (targets)
+        {
+            remove(popLsb(targets));
+        }
+    }
+
+    // GhostKnight::stunAdjacentEnemies
+    template <typename Geometry>
+    void BasicPosition<Geometry>::stunAdjacentEnemies(int sq, Side side)
+    {
+        Mask enemies = attackTablesFor<Geometry>().king[sq] & occupied[opponent(side)];
+        while (enemies)
+        {
+            int target = popLsb(enemies);
+            setFlags(target, flags[target] | FlagStunned);
+        }
+    }
+
+    // End-of-move bookkeeping game.cpp performs after every move
+    template <typename Geometry>
+    void BasicPosition<Geometry>::endTurn(Side mover)
+    {
+        Mask own = occupied[mover];
+        while (own)
+        {
+            int sq = popLsb(own);
+            std::uint16_t pieceFlags = flags[sq];
+
+            // A stun lasts for exactly one of its owner's turns
+            pieceFlags &= ~FlagStunned;
+
+            // Dominated pieces play one move as a Queen, then return to their original piece
+            if (pieceFlags & FlagDominated)
+            {
+                if (pieceFlags & FlagDominationNew)
+                {
+                    pieceFlags &= ~FlagDominationNew;
+                }
+                else
+                {
+                    Kind original = originalKindAt(sq);
+                    put(sq, original, mover, pieceFlags & ~FlagDominated);
+                    continue;
+                }
+            }
+            setFlags(sq, pieceFlags);
+        }
+    }
+
+    template <typename Geometry>
+    void BasicPosition<Geometry>::makeMove(const Move &move)
+    {
+        Side us = toMove;
+        int from = move.from;
+        int to = move.to;
+        Kind mover = kindAt(from);
+        std::uint16_t abilities = kindAbilities(mover);
+        bool extraMove = false;
+
+        if (prowlerSquare != NO_SQUARE)
+        {
+            key ^= zobrist<Geometry>().prowler[prowlerSquare];
+            prowlerSquare = NO_SQUARE;
+        }
+        else
+        {
+            // Only the first move of a turn may earn the Prowler its additional move
+            extraMove = (abilities & AbilityExtraMove) && move.type == MoveCapture;
+        }
+
+        // Any action wakes a stone Familiar
+        if (flags[from] & FlagStone && move.type != MoveStone)
+        {
+            setFlags(from, flags[from] & ~FlagStone);
+        }
+
+        switch (move.type)
+        {
+        case MoveQuiet:
+            relocate(from, to);
+            break;
+        case MoveCapture:
+            resolveCapture(to, from);
+            relocate(from, to);
+            if (move.extra != NO_SQUARE && isEmpty(move.extra))
+            {
+                put(move.extra, Pawn, us); // Necromancer::raiseDead
+            }
+            break;
+        case MoveRanged:
+            resolveCapture(to, from);
+            if (abilities & AbilityLoad)
+            {
+                setFlags(from, flags[from] & ~FlagLoaded);
+            }
+            break;
+        case MoveHop:
+        {
+            int hopped = (from + to) / 2;
+            if (!isEmpty(hopped) && sideAt(hopped) != us && !(flags[hopped] & FlagStone))
+            {
+                remove(hopped);
+            }
+            relocate(from, to);
+            break;
+        }
+        case MoveInfect:
+        {
+            // HellPawn::infect: the captured piece changes sides and the HellPawn is spent
+            Kind victim = kindAt(to);
+            remove(to);
+            put(to, victim, us);
+            remove(from);
+            break;
+        }
+        case MoveSacrifice:
+        {
+            Mask neighbours = attackTablesFor<Geometry>().king[from] & occupancy();
+            while (neighbours)
+            {
+                remove(popLsb(neighbours));
+            }
+            remove(from);
+            break;
+        }
+        case MoveStone:
+            setFlags(from, flags[from] | FlagStone);
+            break;
+        case MoveRaise:
+            put(move.extra, makeKind(raceOf(mover), PawnBase), us);
+            setFlags(from, flags[from] | FlagAbilityUsed);
+            break;
+        case MoveLoad:
+            remove(to);
+            setFlags(from, flags[from] | FlagLoaded);
+            break;
+        case MoveSwap:
+        {
+            Kind other = kindAt(to);
+            std::uint16_t otherFlags = flags[to];
+            remove(to);
+            relocate(from, to);
+            put(from, other, us, otherFlags);
+            break;
+        }
+        case MoveDominate:
+        {
+            Kind original = kindAt(to);
+            std::uint16_t targetFlags = flags[to];
+            remove(to);
+            originalKinds[to] = original;
+            put(to, Queen, us, targetFlags | FlagDominated | FlagDominationNew);
+            setFlags(from, flags[from] | FlagAbilityUsed);
+            break;
+        }
+        case MovePortalEnter:
+            // The piece rests inside the Portal, so a stun on it has nothing left to hold
+            putReserve(us, PortalReserve, kindAt(to), flags[to] & ~FlagStunned);
+            remove(to);
+            break;
+        case MovePortalExit:
+            put(move.extra, reserveKind(us, PortalReserve), us, reserveFlags[us][PortalReserve]);
+            clearReserve(us, PortalReserve);
+            break;
+        case MovePass:
+        default:
+            break;
+        }
+
+        if ((abilities & AbilityStun) && (move.type == MoveQuiet || move.type == MoveCapture))
+        {
+            stunAdjacentEnemies(to, us);
+        }
+
+        if (extraMove && kindAt(to) == mover && sideAt(to) == us)
+        {
+            prowlerSquare = static_cast<std::uint8_t>(to);
+            key ^= zobrist<Geometry>().prowler[to];
+            return;
+        }
+
+        endTurn(us);
+        setSideToMove(opponent(us));
+    }
+
+    template <typename Geometry>
+    std::string BasicPosition<Geometry>::moveToString(const Move &move)
+    {
+        if (move.isNull())
+        {
+            return "0000";
+        }
+        std::string text = squareToString<Geometry>(move.from) + squareToString<Geometry>(move.to);
+        if (move.extra != NO_SQUARE)
+        {
+            text += squareToString<Geometry>(move.extra);
+        }
+        return text;
+    }
+
+    template class BasicPosition<Board8>;
+    template class BasicPosition<Board10>;
+    template class BasicPosition<Board12>;
+}
@@ -0,0 +1,415 @@
+// Filename: engineProtocol.cpp
+// Description: Text command protocol for driving the headless engine from scripts and batch tools.
+
+// Main Classes:
+// - EngineProtocol: Parses commands, owns the current Position and runs searches on a worker thread.
+
+// Main Functions:
+// - int EngineProtocol::run(): Command loop over the input stream.
+// - bool EngineProtocol::handleCommand(const std::string &line): Dispatches a single command.
+
+// Special Features or Notes:
+// - Positions: "position startpos [moves ...]" or "position bcn <notation> [moves ...]", where the notation
+//   is the one written by Position::toNotation and moves use Position::moveToString.
+// - go accepts depth, nodes, movetime, wtime, btime, winc, binc, movestogo, searchmoves, infinite and ponder; every
+//   completed line is reported as "info depth .. multipv .. score .. pv ..", then "bestmove <move> [ponder <move>]".
+// - Output from the search thread and the command thread is serialized through one mutex.
+// - perft splits its tree over ThreadPool::shared(); results are printed in move order.
+// - "setoption name PieceFile value <path>" swaps the piece definitions (enginePieces.h) between searches.
+// - Search counters (SearchStats) of the last search are printed as JSON by "stats", after every search with
+//   "setoption name Stats value true", and appended to a file with "setoption name StatsFile value <path>".
+
+// Usage or Context:
+// - Used by engineMain.cpp; one process per analysis so tools can run many in parallel.
+
+#include "engineProtocol.h"
+#include "enginePieces.h"
+#include "engineThreadPool.h"
+#include <algorithm>
+#include <fstream>
+
+namespace engine
+{
+    EngineProtocol::EngineProtocol(std::istream &input, std::ostream &output)
+        : in(input), out(output), tt(16), search(tt), position(Position::startPosition())
+    {
+    }
+
+    EngineProtocol::~EngineProtocol()
+    {
+        stopSearch();
+    }
+
+    int EngineProtocol::run()
+    {
+        std::string line;
+        while (std::getline(in, line))
+        {
+            if (!handleCommand(line))
+            {
+                stopSearch();
+                return 0;
+            }
+        }
+
+        // Input closed by a piped batch job: let a bounded search finish and print its bestmove
+        bool held;
+        {
+            std::lock_guard<std::mutex> lock(holdMutex);
+            held = holdBestMove;
+        }
+        if (held)
+        {
+            stopSearch();
+        }
+        else if (worker.joinable())
+        {
+            worker.join();
+        }
+        return 0;
+    }
+
+    void EngineProtocol::send(const std::string &line)
+    {
+        std::lock_guard<std::mutex> lock(outputMutex);
+        out << line << std::endl;
+    }
+
+    void EngineProtocol::sendInfo(const SearchInfo &info)
+    {
+        std::ostringstream line;
+        // No rate until a millisecond has passed, rather than the node count as one
+        std::uint64_t nps = info.timeMs > 0 ? info.nodes * 1000 / info.timeMs : 0;
+        line << "info depth " << info.depth << " seldepth " << info.selDepth << " multipv " << info.multiPV
+             << " score " << scoreToString(info.score) << " nodes " << info.nodes << " nps " << nps
+             << " hashfull " << info.hashfull << " time " << info.timeMs << " pv";
+        for (const Move &move : info.pv)
+        {
+            line << ' ' << Position::moveToString(move);
+        }
+        send(line.str());
+    }
+
+    bool EngineProtocol::handleCommand(const std::string &line)
+    {
+        std::istringstream args(line);
+        std::string command;
+        if (!(args >> command))
+        {
+            return true;
+        }
+
+        if (command == "uci")
+        {
+            send("id name BattleChess Engine");
+            send("id author BattleChess");
+            send("option name Hash type spin default 16 min 1 max 4096");
+            send("option name MultiPV type spin default 1 min 1 max 64");
+            send("option name Ponder type check default false");
+            send("option name EvalFile type string default <empty>");
+            send("option name PieceFile type string default <empty>");
+            send("option name Stats type check default false");
+            send("option name StatsFile type string default <empty>");
+            send("uciok");
+        }
+        else if (command == "isready")
+        {
+            send("readyok");
+        }
+        else if (command == "ucinewgame")
+        {
+            stopSearch();
+            tt.clear();
+            position = Position::startPosition();
+        }
+        else if (command == "setoption")
+        {
+            cmdSetOption(args);
+        }
+        else if (command == "position")
+        {
+            cmdPosition(args);
+        }
+        else if (command == "go")
+        {
+            cmdGo(args);
+        }
+        else if (command == "stop")
+        {
+            stopSearch();
+        }
+        else if (command == "ponderhit")
+        {
+            search.ponderHit();
+            releaseBestMove();
+        }
+        else if (command == "quit")
+        {
+            return false;
+        }
+        else if (command == "d")
+        {
+            send(position.toDisplay());
+        }
+        else if (command == "eval")
+        {
+            send("info string eval " + std::to_string(evaluate(position, evalParams)));
+        }
+        else if (command == "perft")
+        {
+            cmdPerft(args);
+        }
+        else if (command == "stats")
+        {
+            std::lock_guard<std::mutex> lock(statsMutex);
+            send("info string stats " + lastStats.toJson());
+        }
+        else
+        {
+            send("info string unknown command: " + command);
+        }
+        return true;
+    }
+
+    void EngineProtocol::cmdSetOption(std::istringstream &args)
+    {
+        // setoption name <id> value <x>
+        std::string token, name, value;
+        args >> token;
+        while (args >> token && token != "value")
+        {
+            name += name.empty() ? token : " " + token;
+        }
+        std::getline(args >> std::ws, value);
+
+        stopSearch();
+        try
+        {
+            if (name == "Hash")
+            {
+                tt.resize(static_cast<std::size_t>(std::stoul(value)));
+            }
+            else if (name == "MultiPV")
+            {
+                multiPV = std::max(1, std::min(64, std::stoi(value)));
+            }
+            else if (name == "EvalFile")
+            {
+                evalParams = value.empty() || value == "<empty>" ? EvalParams() : EvalParams::load(value);
+                search.setEvalParams(evalParams);
+            }
+            else if (name == "PieceFile")
+            {
+                // Stored scores were searched under the old rules
+                setPieceCatalog(value.empty() || value == "<empty>" ? PieceCatalog::builtIn() : PieceCatalog::load(value));
+                tt.clear();
+            }
+            else if (name == "Stats")
+            {
+                statsAfterSearch = value == "true";
+            }
+            else if (name == "StatsFile")
+            {
+                statsFile = value == "<empty>" ? std::string() : value;
+            }
+            else if (name != "Ponder")
+            {
+                send("info string unknown option: " + name);
+            }
+        }
+        catch (const std::exception &error)
+        {
+            send("info string invalid value for " + name + ": " + value + " (" + error.what() + ")");
+        }
+    }
+
+    void EngineProtocol::cmdPosition(std::istringstream &args)
+    {
+        stopSearch();
+
+        std::string token;
+        args >> token;
+        Position next;
+        try
+        {
+            if (token == "startpos")
+            {
+                next = Position::startPosition();
+                args >> token;
+            }
+            else if (token == "bcn")
+            {
+                std::string notation;
+                while (args >> token && token != "moves")
+                {
+                    notation += notation.empty() ? token : " " + token;
+                }
+                next = Position::fromNotation(notation);
+            }
+            else
+            {
+                send("info string expected startpos or bcn");
+                return;
+            }
+        }
+        catch (const std::exception &error)
+        {
+            send(std::string("info string ") + error.what());
+            return;
+        }
+
+        if (token == "moves")
+        {
+            while (args >> token)
+            {
+                Move move;
+                if (!parseMove(next, token, move))
+                {
+                    send("info string illegal move: " + token);
+                    return;
+                }
+                next.makeMove(move);
+            }
+        }
+        position = next;
+    }
+
+    void EngineProtocol::cmdGo(std::istringstream &args)
+    {
+        stopSearch();
+
+        SearchLimits limits;
+        limits.multiPV = multiPV;
+        std::string token;
+        bool readingMoves = false;
+        while (args >> token)
+        {
+            Move move;
+            if (readingMoves && parseMove(position, token, move))
+            {
+                limits.searchMoves.push_back(move);
+                continue;
+            }
+            readingMoves = false;
+
+            if (token == "searchmoves")
+                readingMoves = true;
+            else if (token == "infinite")
+                limits.infinite = true;
+            else if (token == "ponder")
+                limits.ponder = true;
+            else if (token == "depth")
+                args >> limits.depth;
+            else if (token == "nodes")
+                args >> limits.nodes;
+            else if (token == "movetime")
+                args >> limits.moveTime;
+            else if (token == "wtime")
+                args >> limits.time[White];
+            else if (token == "btime")
+                args >> limits.time[Black];
+            else if (token == "winc")
+                args >> limits.increment[White];
+            else if (token == "binc")
+                args >> limits.increment[Black];
+            else if (token == "movestogo")
+                args >> limits.movesToGo;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(holdMutex);
+            holdBestMove = limits.infinite || limits.ponder;
+        }
+
+        Position root = position;
+        search.resetStop();
+        worker = std::thread([this, root, limits]()
+                             {
+            SearchResult result = search.run(root, limits, [this](const SearchInfo &info)
+                                             { sendInfo(info); });
+            reportStats(search.stats());
+
+            // bestmove must not be sent before stop/ponderhit in infinite or ponder mode
+            {
+                std::unique_lock<std::mutex> lock(holdMutex);
+                holdChanged.wait(lock, [this]()
+                                 { return !holdBestMove; });
+            }
+
+            std::string line = "bestmove " + (result.best.isNull() ? std::string("0000") : Position::moveToString(result.best));
+            if (!result.ponder.isNull())
+            {
+                line += " ponder " + Position::moveToString(result.ponder);
+            }
+            send(line); });
+    }
+
+    void EngineProtocol::cmdPerft(std::istringstream &args)
+    {
+        int depth = 1;
+        args >> depth;
+        if (depth < 1)
+        {
+            send("info string perft depth must be at least 1");
+            return;
+        }
+
+        MoveList list;
+        generateMoves(position, list);
+        std::vector<std::uint64_t> counts(list.size());
+        TaskGroup group(ThreadPool::shared());
+        for (int i = 0; i < list.size(); ++i)
+        {
+            group.run([&, i]()
+                      {
+                Position child = position;
+                child.makeMove(list.moves[i]);
+                counts[i] = perft(child, depth - 1, ThreadPool::shared()); });
+        }
+        group.wait();
+
+        std::uint64_t total = 0;
+        for (int i = 0; i < list.size(); ++i)
+        {
+            total += counts[i];
+            send(Position::moveToString(list.moves[i]) + ": " + std::to_string(counts[i]));
+        }
+        send("nodes " + std::to_string(total));
+    }
+
+    void EngineProtocol::reportStats(const SearchStats &stats)
+    {
+        {
+            std::lock_guard<std::mutex> lock(statsMutex);
+            lastStats = stats;
+        }
+        if (statsAfterSearch)
+        {
+            send("info string stats " + stats.toJson());
+        }
+        if (!statsFile.empty())
+        {
+            std::ofstream file(statsFile, std::ios::app);
+            file << stats.toJson() << '\n';
+        }
+    }
+
+    void EngineProtocol::releaseBestMove()
+    {
+        {
+            std::lock_guard<std::mutex> lock(holdMutex);
+            holdBestMove = false;
+        }
+        holdChanged.notify_all();
+    }
+
+    void EngineProtocol::stopSearch()
+    {
+        if (worker.joinable())
+        {
+            search.stop();
+            releaseBestMove();
+            worker.join();
+        }
+    }
+}
@@ -0,0 +1,571 @@
+// Filename: engineSearch.cpp
+// Description: Alpha-beta search and transposition table for the headless engine.
+
+// Main Classes:
+// - TranspositionTable: Fixed-size hash table of search results keyed by the Position hash.
+// - Search: Iterative deepening driver with multi-PV, node/time/depth limits and a thread-safe stop.
+
+// Main Functions:
+// - SearchResult Search::run(const Position &root, const SearchLimits &limits, const InfoCallback &onInfo):
+//   Searches until a limit is reached or stop() is called, reporting each completed line through onInfo.
+
+// Special Features or Notes:
+// - Battle Chess has no check or stalemate rule: a side with no kings has lost and a side with no moves
+//   (for instance every piece stunned) is scored as a draw.
+// - After a Prowler capture the same side moves again, so child scores are only negated when the turn passes.
+// - Multi-PV searches each additional line with the earlier best moves excluded at the root.
+// - SearchStats counters are plain members bumped on the searching thread, so they need no atomics.
+
+// Usage or Context:
+// - Driven by the engine protocol; the search runs on a worker thread while the protocol keeps reading stdin.
+
+#include "engineSearch.h"
+#include <algorithm>
+#include <cstring>
+
+namespace engine
+{
+    TranspositionTable::TranspositionTable(std::size_t megabytes)
+    {
+        resize(megabytes);
+    }
+
+    void TranspositionTable::resize(std::size_t megabytes)
+    {
+        std::size_t count = std::max<std::size_t>(1, megabytes) * 1024 * 1024 / sizeof(TTEntry);
+        entries.assign(count, TTEntry());
+    }
+
+    void TranspositionTable::clear()
+    {
+        std::fill(entries.begin(), entries.end(), TTEntry());
+    }
+
+    bool TranspositionTable::probe(std::uint64_t key, TTEntry &entry, bool *collision) const
+    {
+        const TTEntry &slot = entries[key % entries.size()];
+        if (slot.key != key || slot.bound == BoundNone)
+        {
+            if (collision)
+            {
+                *collision = slot.bound != BoundNone;
+            }
+            return false;
+        }
+        entry = slot;
+        return true;
+    }
+
+    void TranspositionTable::store(std::uint64_t key, const Move &move, int score, int depth, Bound bound)
+    {
+        TTEntry &slot = entries[key % entries.size()];
+        if (slot.key == key && depth < slot.depth && bound != BoundExact)
+        {
+            return;
+        }
+        // Keep the old best move when this result has none
+        if (!move.isNull() || slot.key != key)
+        {
+            slot.move = move;
+        }
+        slot.key = key;
+        slot.score = static_cast<std::int16_t>(score);
+        slot.depth = static_cast<std::int8_t>(std::min(depth, 127));
+        slot.bound = bound;
+    }
+
+    int TranspositionTable::hashfull() const
+    {
+        std::size_t sample = std::min<std::size_t>(1000, entries.size());
+        int used = 0;
+        for (std::size_t i = 0; i < sample; ++i)
+        {
+            if (entries[i].bound != BoundNone)
+            {
+                ++used;
+            }
+        }
+        return static_cast<int>(used * 1000 / sample);
+    }
+
+    namespace
+    {
+        // Mate scores are stored relative to the node so they stay valid at other plies
+        int scoreToTT(int score, int ply)
+        {
+            if (score > SCORE_MATE - MAX_PLY)
+                return score + ply;
+            if (score < -SCORE_MATE + MAX_PLY)
+                return score - ply;
+            return score;
+        }
+
+        int scoreFromTT(int score, int ply)
+        {
+            if (score > SCORE_MATE - MAX_PLY)
+                return score - ply;
+            if (score < -SCORE_MATE + MAX_PLY)
+                return score + ply;
+            return score;
+        }
+
+        // Square of the piece a capturing move removes
+        int victimSquare(const Move &move)
+        {
+            if (move.type == MoveHop)
+            {
+                return (move.from + move.to) / 2;
+            }
+            return move.to;
+        }
+    }
+
+    Search::Search(TranspositionTable &table)
+        : tt(table), stopRequested(false), pondering(false), ponderHitRequested(false), startTicks(0)
+    {
+        std::memset(history, 0, sizeof(history));
+        std::memset(pvLength, 0, sizeof(pvLength));
+    }
+
+    void Search::ponderHit()
+    {
+        // The opponent played the expected move: the clock for our move starts now
+        startTicks.store(std::chrono::steady_clock::now().time_since_epoch().count());
+        ponderHitRequested.store(true);
+        pondering.store(false);
+    }
+
+    int Search::elapsedMs() const
+    {
+        std::chrono::steady_clock::duration elapsed(std::chrono::steady_clock::now().time_since_epoch().count() - startTicks.load());
+        return static_cast<int>(std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count());
+    }
+
+    void Search::startClock(const Position &root)
+    {
+        startTicks.store(std::chrono::steady_clock::now().time_since_epoch().count());
+        timeBudgetMs = 0;
+        if (limits.moveTime > 0)
+        {
+            timeBudgetMs = limits.moveTime;
+            return;
+        }
+
+        Side us = root.sideToMove();
+        if (limits.time[us] > 0)
+        {
+            int movesLeft = limits.movesToGo > 0 ? limits.movesToGo : 30;
+            timeBudgetMs = limits.time[us] / movesLeft + limits.increment[us] * 3 / 4;
+            timeBudgetMs = std::max(1, std::min(timeBudgetMs, limits.time[us] - 50));
+        }
+    }
+
+    bool Search::shouldStop()
+    {
+        if (stopped())
+        {
+            return true;
+        }
+        if (limits.nodes && nodes >= limits.nodes)
+        {
+            limitReached = true;
+            return true;
+        }
+        if ((nodes & 1023) == 0 && timeBudgetMs > 0 && !limits.infinite && !pondering.load(std::memory_order_relaxed) &&
+            elapsedMs() >= timeBudgetMs)
+        {
+            limitReached = true;
+            return true;
+        }
+        return false;
+    }
+
+    void Search::orderMoves(const Position &position, MoveList &list, const Move &ttMove, int ply) const
+    {
+        int scores[MAX_MOVES];
+        for (int i = 0; i < list.count; ++i)
+        {
+            const Move &move = list.moves[i];
+            int score = history[move.from][move.to];
+            if (move == ttMove)
+            {
+                score = 1 << 30;
+            }
+            else if (move.isCapture())
+            {
+                // MVV-LVA: most valuable victim first, cheapest attacker breaks ties
+                int victim = evalParams.material(position.kindAt(victimSquare(move)));
+                int attacker = evalParams.material(position.kindAt(move.from));
+                score = (1 << 24) + victim * 16 - attacker / 16;
+            }
+            else if (move == killers[ply][0])
+            {
+                score = (1 << 22) + 1;
+            }
+            else if (move == killers[ply][1])
+            {
+                score = 1 << 22;
+            }
+            scores[i] = score;
+        }
+
+        for (int i = 1; i < list.count; ++i)
+        {
+            Move move = list.moves[i];
+            int score = scores[i];
+            int j = i - 1;
+            while (j >= 0 && scores[j] < score)
+            {
+                list.moves[j + 1] = list.moves[j];
+                scores[j + 1] = scores[j];
+                --j;
+            }
+            list.moves[j + 1] = move;
+            scores[j + 1] = score;
+        }
+    }
+
+    int Search::quiescence(const Position &position, int alpha, int beta, int ply)
+    {
+        // Ranged and area captures can keep the capture tree wide, so node and time limits apply here too
+        if (shouldStop())
+        {
+            return 0;
+        }
+        ++nodes;
+        ++counters.qnodes;
+        selDepth = std::max(selDepth, ply);
+        if (!position.hasKing(position.sideToMove()))
+        {
+            return -SCORE_MATE + ply;
+        }
+        if (ply >= MAX_PLY - 1)
+        {
+            return evaluate(position, evalParams);
+        }
+
+        int standPat = evaluate(position, evalParams);
+        if (standPat >= beta)
+        {
+            return standPat;
+        }
+        alpha = std::max(alpha, standPat);
+
+        MoveList list;
+        generateCaptures(position, list);
+        orderMoves(position, list, Move(), ply);
+
+        for (const Move &move : list)
+        {
+            Position child = position;
+            child.makeMove(move);
+            int score = child.sideToMove() == position.sideToMove()
+                            ? quiescence(child, alpha, beta, ply + 1)
+                            : -quiescence(child, -beta, -alpha, ply + 1);
+            if (stopped())
+            {
+                return 0;
+            }
+            if (score > alpha)
+            {
+                alpha = score;
+                if (score >= beta)
+                {
+                    return score;
+                }
+            }
+        }
+        return alpha;
+    }
+
+    int Search::searchNode(const Position &position, int depth, int alpha, int beta, int ply, bool allowNull)
+    {
+        pvLength[ply] = ply;
+        if (ply > 0 && shouldStop())
+        {
+            return 0;
+        }
+        if (!position.hasKing(position.sideToMove()))
+        {
+            return -SCORE_MATE + ply;
+        }
+        if (depth <= 0)
+        {
+            return quiescence(position, alpha, beta, ply);
+        }
+        ++nodes;
+        if (ply >= MAX_PLY - 1)
+        {
+            return evaluate(position, evalParams);
+        }
+
+        bool pvNode = beta - alpha > 1;
+        Move ttMove;
+        TTEntry entry;
+        bool collision = false;
+        ++counters.ttProbes;
+        if (tt.probe(position.hash(), entry, &collision))
+        {
+            ++counters.ttHits;
+            ttMove = entry.move;
+            int ttScore = scoreFromTT(entry.score, ply);
+            if (ply > 0 && !pvNode && entry.depth >= depth &&
+                (entry.bound == BoundExact ||
+                 (entry.bound == BoundLower && ttScore >= beta) ||
+                 (entry.bound == BoundUpper && ttScore <= alpha)))
+            {
+                return ttScore;
+            }
+        }
+        else if (collision)
+        {
+            ++counters.ttCollisions;
+        }
+
+        // Null move pruning, skipped while a Prowler extra move is pending since passing is already a move there
+        if (allowNull && !pvNode && depth >= 3 && position.pendingProwler() == NO_SQUARE &&
+            evaluate(position, evalParams) >= beta)
+        {
+            Position child = position;
+            child.makeNullMove();
+            int score = -searchNode(child, depth - 3, -beta, -beta + 1, ply + 1, false);
+            if (stopped())
+            {
+                return 0;
+            }
+            if (score >= beta && !isMateScore(score))
+            {
+                return score;
+            }
+        }
+
+        MoveList list;
+        generateMoves(position, list);
+        if (list.empty())
+        {
+            return 0;
+        }
+        orderMoves(position, list, ttMove, ply);
+
+        int originalAlpha = alpha;
+        int bestScore = -SCORE_INFINITE;
+        Move bestMove;
+        int searched = 0;
+
+        for (const Move &move : list)
+        {
+            if (ply == 0 && skipAtRoot(move))
+            {
+                continue;
+            }
+
+            ++counters.movesSearched;
+            if (isAbilityMove(move))
+            {
+                ++counters.abilityMoves;
+            }
+            Position child = position;
+            child.makeMove(move);
+            bool samePlayer = child.sideToMove() == position.sideToMove();
+            auto childScore = [&](int lower, int upper)
+            {
+                return samePlayer ? searchNode(child, depth - 1, lower, upper, ply + 1, false)
+                                  : -searchNode(child, depth - 1, -upper, -lower, ply + 1, true);
+            };
+
+            int score;
+            if (searched == 0)
+            {
+                score = childScore(alpha, beta);
+            }
+            else
+            {
+                score = childScore(alpha, alpha + 1);
+                if (score > alpha && score < beta)
+                {
+                    score = childScore(alpha, beta);
+                }
+            }
+            ++searched;
+
+            if (stopped())
+            {
+                return 0;
+            }
+
+            if (score > bestScore)
+            {
+                bestScore = score;
+                bestMove = move;
+                if (score > alpha)
+                {
+                    alpha = score;
+                    pvTable[ply][ply] = move;
+                    for (int next = ply + 1; next < pvLength[ply + 1]; ++next)
+                    {
+                        pvTable[ply][next] = pvTable[ply + 1][next];
+                    }
+                    pvLength[ply] = std::max(pvLength[ply + 1], ply + 1);
+
+                    if (score >= beta)
+                    {
+                        ++counters.betaCutoffs;
+                        if (searched == 1)
+                        {
+                            ++counters.firstMoveCutoffs;
+                        }
+                        if (!move.isCapture())
+                        {
+                            if (killers[ply][0] != move)
+                            {
+                                killers[ply][1] = killers[ply][0];
+                                killers[ply][0] = move;
+                            }
+                            history[move.from][move.to] += depth * depth;
+                        }
+                        break;
+                    }
+                }
+            }
+        }
+
+        if (searched == 0)
+        {
+            return 0;
+        }
+
+        Bound bound = bestScore >= beta ? BoundLower : (bestScore > originalAlpha ? BoundExact : BoundUpper);
+        if (ply > 0 || (excludedRootMoves.empty() && limits.searchMoves.empty()))
+        {
+            tt.store(position.hash(), bestMove, scoreToTT(bestScore, ply), depth, bound);
+        }
+        return bestScore;
+    }
+
+    bool Search::skipAtRoot(const Move &move) const
+    {
+        if (std::find(excludedRootMoves.begin(), excludedRootMoves.end(), move) != excludedRootMoves.end())
+        {
+            return true;
+        }
+        return !limits.searchMoves.empty() &&
+               std::find(limits.searchMoves.begin(), limits.searchMoves.end(), move) == limits.searchMoves.end();
+    }
+
+    SearchResult Search::run(const Position &root, const SearchLimits &searchLimits, const InfoCallback &onInfo)
+    {
+        limits = searchLimits;
+        limitReached = false;
+        // Set before the hit is checked, so a ponderHit() racing with this line is never lost
+        pondering.store(limits.ponder);
+        if (ponderHitRequested.load())
+        {
+            pondering.store(false);
+        }
+        nodes = 0;
+        counters.reset();
+        std::memset(killers, 0, sizeof(killers));
+        for (auto &row : history)
+        {
+            for (int &value : row)
+            {
+                value /= 8;
+            }
+        }
+        startClock(root);
+
+        SearchResult result;
+        MoveList generated;
+        generateMoves(root, generated);
+        excludedRootMoves.clear();
+        int rootMoves = 0;
+        for (const Move &move : generated)
+        {
+            if (!skipAtRoot(move))
+            {
+                if (rootMoves == 0)
+                {
+                    result.best = move;
+                }
+                ++rootMoves;
+            }
+        }
+        if (rootMoves == 0 || isLost(root))
+        {
+            return result;
+        }
+
+        int lines = std::max(1, std::min(limits.multiPV, rootMoves));
+        int maxDepth = limits.depth > 0 ? std::min(limits.depth, MAX_PLY - 1) : MAX_PLY - 1;
+
+        for (int depth = 1; depth <= maxDepth; ++depth)
+        {
+            std::uint64_t iterationStart = nodes;
+            excludedRootMoves.clear();
+            selDepth = 0;
+            for (int line = 0; line < lines; ++line)
+            {
+                int score = searchNode(root, depth, -SCORE_INFINITE, SCORE_INFINITE, 0, false);
+                if (stopped() && depth > 1)
+                {
+                    break;
+                }
+                if (pvLength[0] == 0)
+                {
+                    break;
+                }
+
+                SearchInfo info;
+                info.depth = depth;
+                info.selDepth = std::max(selDepth, depth);
+                info.multiPV = line + 1;
+                info.score = score;
+                info.nodes = nodes;
+                info.timeMs = elapsedMs();
+                info.hashfull = tt.hashfull();
+                info.pv.assign(pvTable[0], pvTable[0] + pvLength[0]);
+
+                if (line == 0)
+                {
+                    result.best = info.pv[0];
+                    result.ponder = info.pv.size() > 1 ? info.pv[1] : Move();
+                    result.score = score;
+                    result.depth = depth;
+                }
+                if (onInfo)
+                {
+                    onInfo(info);
+                }
+                excludedRootMoves.push_back(info.pv[0]);
+            }
+
+            if (stopped())
+            {
+                break;
+            }
+            counters.iterations.push_back(IterationStats{depth, nodes - iterationStart, elapsedMs()});
+            // Not worth starting another iteration that cannot finish in the remaining time
+            if (timeBudgetMs > 0 && !limits.infinite && !pondering.load() && elapsedMs() * 2 > timeBudgetMs)
+            {
+                break;
+            }
+        }
+
+        result.nodes = nodes;
+        counters.nodes = nodes;
+        return result;
+    }
+
+    std::string scoreToString(int score)
+    {
+        if (score > SCORE_MATE - MAX_PLY)
+        {
+            return "mate " + std::to_string((SCORE_MATE - score + 1) / 2);
+        }
+        if (score < -SCORE_MATE + MAX_PLY)
+        {
+            return "mate -" + std::to_string((SCORE_MATE + score) / 2);
+        }
+        return "cp " + std::to_string(score);
+    }
+}
@@ -0,0 +1,74 @@
+// Filename: engineSelfPlay.cpp
+// Description: Fast headless engine-vs-engine games.
+
+// Main Classes:
+// - SelfPlayer: Plays a game from a start position with a fixed node budget per move.
+
+// Special Features or Notes:
+// - A game ends when a side loses its last king, has no move (draw), repeats a position three times
+//   (draw) or reaches maxPlies (draw).
+
+// Usage or Context:
+// - Used by the army optimizer and to produce tuning records.
+
+#include "engineSelfPlay.h"
+#include <algorithm>
+#include <random>
+
+namespace engine
+{
+    SelfPlayer::SelfPlayer(std::size_t hashMegabytes)
+        : tt(hashMegabytes), search(tt)
+    {
+    }
+
+    float SelfPlayer::play(const Position &start, const SelfPlayOptions &options, std::uint32_t seed,
+                           std::vector<std::string> *positions)
+    {
+        std::mt19937 rng(seed);
+        Position position = start;
+        std::vector<std::uint64_t> history;
+        tt.clear();
+
+        for (int ply = 0; ply < options.maxPlies; ++ply)
+        {
+            if (isLost(position))
+            {
+                return position.sideToMove() == White ? 0.0f : 1.0f;
+            }
+
+            history.push_back(position.hash());
+            if (std::count(history.begin(), history.end(), position.hash()) >= 3)
+            {
+                return 0.5f;
+            }
+
+            if (positions && options.recordEvery > 0 && ply % options.recordEvery == 0)
+            {
+                positions->push_back(position.toNotation());
+            }
+
+            MoveList list;
+            generateMoves(position, list);
+            if (list.empty())
+            {
+                return 0.5f;
+            }
+
+            Move move;
+            if (ply < options.randomOpeningPlies)
+            {
+                move = list.moves[rng() % list.size()];
+            }
+            else
+            {
+                SearchLimits limits;
+                limits.nodes = options.nodesPerMove;
+                search.resetStop();
+                move = search.run(position, limits).best;
+            }
+            position.makeMove(move);
+        }
+        return 0.5f;
+    }
+}
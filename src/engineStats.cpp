@@ -0,0 +1,107 @@
+// Filename: engineStats.cpp
+// Description: Search counters: merging, derived rates and JSON output.
+
+// Main Classes:
+// - SearchStats: Per-search counters filled in by Search.
+
+// Special Features or Notes:
+// - merge() adds counters and lines iterations up by depth, so the stats of searches that ran on
+//   different threads can be summed once they are done instead of sharing atomics while searching.
+
+// Usage or Context:
+// - Reported by the engine protocol ("stats" command, Stats and StatsFile options).
+
+#include "engineStats.h"
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <sstream>
+
+namespace engine
+{
+    namespace
+    {
+        double ratio(std::uint64_t part, std::uint64_t whole)
+        {
+            return whole ? static_cast<double>(part) / static_cast<double>(whole) : 0.0;
+        }
+    }
+
+    void SearchStats::merge(const SearchStats &other)
+    {
+        nodes += other.nodes;
+        qnodes += other.qnodes;
+        ttProbes += other.ttProbes;
+        ttHits += other.ttHits;
+        ttCollisions += other.ttCollisions;
+        betaCutoffs += other.betaCutoffs;
+        firstMoveCutoffs += other.firstMoveCutoffs;
+        movesSearched += other.movesSearched;
+        abilityMoves += other.abilityMoves;
+
+        for (const IterationStats &theirs : other.iterations)
+        {
+            bool found = false;
+            for (IterationStats &ours : iterations)
+            {
+                if (ours.depth == theirs.depth)
+                {
+                    ours.nodes += theirs.nodes;
+                    ours.timeMs = std::max(ours.timeMs, theirs.timeMs);
+                    found = true;
+                }
+            }
+            if (!found)
+            {
+                iterations.push_back(theirs);
+            }
+        }
+    }
+
+    double SearchStats::ttHitRate() const
+    {
+        return ratio(ttHits, ttProbes);
+    }
+
+    double SearchStats::firstMoveCutoffRate() const
+    {
+        return ratio(firstMoveCutoffs, betaCutoffs);
+    }
+
+    double SearchStats::abilityMoveShare() const
+    {
+        return ratio(abilityMoves, movesSearched);
+    }
+
+    double SearchStats::branchingFactor() const
+    {
+        if (iterations.size() < 2 || iterations.front().nodes == 0 || iterations.back().depth <= iterations.front().depth)
+        {
+            return 0.0;
+        }
+        double growth = static_cast<double>(iterations.back().nodes) / static_cast<double>(iterations.front().nodes);
+        return std::pow(growth, 1.0 / (iterations.back().depth - iterations.front().depth));
+    }
+
+    std::string SearchStats::toJson() const
+    {
+        std::ostringstream out;
+        out << std::fixed << std::setprecision(4);
+        out << "{\"nodes\":" << nodes << ",\"qnodes\":" << qnodes
+            << ",\"ttProbes\":" << ttProbes << ",\"ttHits\":" << ttHits << ",\"ttCollisions\":" << ttCollisions
+            << ",\"ttHitRate\":" << ttHitRate()
+            << ",\"betaCutoffs\":" << betaCutoffs << ",\"firstMoveCutoffs\":" << firstMoveCutoffs
+            << ",\"firstMoveCutoffRate\":" << firstMoveCutoffRate()
+            << ",\"movesSearched\":" << movesSearched << ",\"abilityMoves\":" << abilityMoves
+            << ",\"abilityMoveShare\":" << abilityMoveShare()
+            << ",\"branchingFactor\":" << branchingFactor()
+            << ",\"iterations\":[";
+        for (std::size_t i = 0; i < iterations.size(); ++i)
+        {
+            out << (i ? "," : "") << "{\"depth\":" << iterations[i].depth << ",\"nodes\":" << iterations[i].nodes
+                << ",\"timeMs\":" << iterations[i].timeMs << "}";
+        }
+        out << "]}";
+        return out.str();
+    }
+}
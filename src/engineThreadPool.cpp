@@ -0,0 +1,246 @@
+// Filename: engineThreadPool.cpp
+// Description: Work-stealing task scheduler shared by the engine tools.
+
+// Main Classes:
+// - ThreadPool: Worker threads with one deque each plus a shared injection queue.
+// - TaskGroup: Fork/join handle with cancellation and exception forwarding.
+
+// Special Features or Notes:
+// - Each deque has its own mutex; the owner works on the back and thieves take from the front, so
+//   contention only happens when a worker runs out of work.
+// - Idle workers sleep on a condition variable counted by queued, so an idle pool costs no CPU. A thread waiting on a
+//   group sleeps on the same condition variable once a few steal attempts fail; the last task of a group wakes it.
+
+// Usage or Context:
+// - Used by batch evaluation, the army optimizer's self-play games, the tuner and parallel perft.
+
+#include "engineThreadPool.h"
+#include <algorithm>
+
+namespace engine
+{
+    namespace
+    {
+        thread_local ThreadPool *currentPool = nullptr;
+        thread_local int currentWorker = -1;
+    }
+
+    ThreadPool::ThreadPool(int concurrency)
+        : queued(0)
+    {
+        if (concurrency <= 0)
+        {
+            concurrency = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+        }
+        for (int i = 0; i < concurrency; ++i)
+        {
+            queues.emplace_back(new Queue());
+        }
+        for (int i = 0; i + 1 < concurrency; ++i)
+        {
+            workers.emplace_back(&ThreadPool::workerLoop, this, i);
+        }
+    }
+
+    ThreadPool::~ThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(sleepMutex);
+            stopping = true;
+        }
+        wake.notify_all();
+        for (std::thread &worker : workers)
+        {
+            worker.join();
+        }
+    }
+
+    ThreadPool &ThreadPool::shared()
+    {
+        static ThreadPool pool;
+        return pool;
+    }
+
+    void ThreadPool::push(Task task)
+    {
+        Queue &queue = currentPool == this ? *queues[currentWorker] : *queues.back();
+        {
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            queue.tasks.push_back(std::move(task));
+        }
+        {
+            std::lock_guard<std::mutex> lock(sleepMutex);
+            ++queued;
+        }
+        wake.notify_one();
+    }
+
+    bool ThreadPool::takeTask(Task &task)
+    {
+        if (queued.load(std::memory_order_acquire) == 0)
+        {
+            return false;
+        }
+
+        // Own deque newest first, keeping the subtree just spawned hot in cache
+        if (currentPool == this)
+        {
+            Queue &own = *queues[currentWorker];
+            std::lock_guard<std::mutex> lock(own.mutex);
+            if (!own.tasks.empty())
+            {
+                task = std::move(own.tasks.back());
+                own.tasks.pop_back();
+                --queued;
+                return true;
+            }
+        }
+
+        // Then the injection queue and the other deques, oldest (largest) task first
+        int count = static_cast<int>(queues.size());
+        int start = currentPool == this ? currentWorker + 1 : 0;
+        for (int offset = 0; offset < count; ++offset)
+        {
+            int index = (start + offset) % count;
+            if (currentPool == this && index == currentWorker)
+            {
+                continue;
+            }
+            Queue &victim = *queues[index];
+            std::lock_guard<std::mutex> lock(victim.mutex);
+            if (!victim.tasks.empty())
+            {
+                task = std::move(victim.tasks.front());
+                victim.tasks.pop_front();
+                --queued;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool ThreadPool::tryRunOne()
+    {
+        Task task;
+        if (!takeTask(task))
+        {
+            return false;
+        }
+        task.group->execute(task);
+        return true;
+    }
+
+    void ThreadPool::runUntilDone(const std::atomic<int> &outstanding)
+    {
+        // A few yields catch tasks that are about to finish; after that, sleep rather than spin on an empty pool
+        const int spinAttempts = 16;
+        int misses = 0;
+        while (outstanding.load(std::memory_order_acquire) > 0)
+        {
+            if (tryRunOne())
+            {
+                misses = 0;
+            }
+            else if (++misses < spinAttempts)
+            {
+                std::this_thread::yield();
+            }
+            else
+            {
+                std::unique_lock<std::mutex> lock(sleepMutex);
+                wake.wait(lock, [&]()
+                          { return outstanding.load(std::memory_order_acquire) == 0 || queued.load() > 0; });
+                misses = 0;
+            }
+        }
+    }
+
+    void ThreadPool::groupDone()
+    {
+        // Taking the lock orders the wake-up after a waiter's predicate check, so it cannot be missed
+        {
+            std::lock_guard<std::mutex> lock(sleepMutex);
+        }
+        wake.notify_all();
+    }
+
+    void ThreadPool::workerLoop(int index)
+    {
+        currentPool = this;
+        currentWorker = index;
+        while (true)
+        {
+            if (tryRunOne())
+            {
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(sleepMutex);
+            wake.wait(lock, [this]()
+                      { return stopping || queued.load() > 0; });
+            if (stopping && queued.load() == 0)
+            {
+                return;
+            }
+        }
+    }
+
+    TaskGroup::TaskGroup(ThreadPool &taskPool, CancellationToken token)
+        : pool(taskPool), cancellation(std::move(token)), outstanding(0)
+    {
+    }
+
+    TaskGroup::~TaskGroup()
+    {
+        // Queued tasks refer to this group, so they must finish even when unwinding
+        pool.runUntilDone(outstanding);
+    }
+
+    void TaskGroup::run(std::function<void()> work)
+    {
+        outstanding.fetch_add(1, std::memory_order_relaxed);
+        pool.push(ThreadPool::Task{std::move(work), this});
+    }
+
+    void TaskGroup::wait()
+    {
+        pool.runUntilDone(outstanding);
+
+        std::exception_ptr failure;
+        {
+            std::lock_guard<std::mutex> lock(errorMutex);
+            std::swap(failure, error);
+        }
+        if (failure)
+        {
+            std::rethrow_exception(failure);
+        }
+    }
+
+    void TaskGroup::execute(ThreadPool::Task &task)
+    {
+        if (!cancellation.cancelled())
+        {
+            try
+            {
+                task.work();
+            }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> lock(errorMutex);
+                if (!error)
+                {
+                    error = std::current_exception();
+                }
+                cancellation.cancel();
+            }
+        }
+        task.work = nullptr;
+
+        // The group can be destroyed as soon as outstanding reaches 0, so the pool is read first
+        ThreadPool &owner = pool;
+        if (outstanding.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            owner.groupDone();
+        }
+    }
+}
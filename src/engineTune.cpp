@@ -0,0 +1,330 @@
+// Filename: engineTune.cpp
+// Description: Evaluation weight tuning from recorded positions and game results.
+
+// Main Classes:
+// - TuningSet: Flat storage of sparse features and results.
+// - Tuner: Parallel full-batch gradient descent on the logistic loss.
+
+// Main Functions:
+// - TuningSet loadTuningSet(std::istream &input, std::size_t &skipped, ThreadPool &pool):
+//   Reads records in batches and converts them to features on the pool.
+// - EvalParams Tuner::run(const EvalParams &start, const ProgressCallback &onProgress): Fits the weights.
+// - std::vector<GemstoneSuggestion> suggestGemstoneCosts(const EvalParams &params):
+//   Converts tuned material into army menu prices.
+
+// Special Features or Notes:
+// - Work runs on a ThreadPool, ThreadPool::shared() unless the caller passes one, split into one range per thread
+//   of the pool so the per-range partial sums are added in a fixed order.
+// - Kings have no material weight (every live position has one), so their entries stay fixed.
+// - Gemstone prices are the material gain of each race piece over its standard piece, divided by the
+//   centipawns-per-gemstone rate that best fits the current menu prices.
+
+// Usage or Context:
+// - Used by tuneMain.cpp (battlechess_tune).
+
+#include "engineTune.h"
+#include <algorithm>
+#include <cmath>
+
+namespace engine
+{
+    void TuningSet::add(const std::vector<EvalFeature> &positionFeatures, float result)
+    {
+        features.insert(features.end(), positionFeatures.begin(), positionFeatures.end());
+        offsets.push_back(static_cast<std::uint32_t>(features.size()));
+        results.push_back(result);
+    }
+
+    void TuningSet::append(const TuningSet &other)
+    {
+        std::uint32_t base = offsets.back();
+        features.insert(features.end(), other.features.begin(), other.features.end());
+        for (std::size_t i = 1; i < other.offsets.size(); ++i)
+        {
+            offsets.push_back(base + other.offsets[i]);
+        }
+        results.insert(results.end(), other.results.begin(), other.results.end());
+    }
+
+    bool parseRecord(const std::string &line, Position &position, float &result)
+    {
+        std::size_t separator = line.rfind(';');
+        if (separator == std::string::npos)
+        {
+            return false;
+        }
+
+        std::string outcome = line.substr(separator + 1);
+        outcome.erase(0, outcome.find_first_not_of(" \t\r"));
+        outcome.erase(outcome.find_last_not_of(" \t\r") + 1);
+        if (outcome == "1-0")
+            result = 1.0f;
+        else if (outcome == "0-1")
+            result = 0.0f;
+        else if (outcome == "1/2-1/2")
+            result = 0.5f;
+        else
+        {
+            try
+            {
+                result = std::stof(outcome);
+            }
+            catch (const std::exception &)
+            {
+                return false;
+            }
+        }
+
+        try
+        {
+            position = Position::fromNotation(line.substr(0, separator));
+        }
+        catch (const std::exception &)
+        {
+            return false;
+        }
+        return result >= 0.0f && result <= 1.0f;
+    }
+
+    namespace
+    {
+        // Runs work(begin, end, index) over [0, count) split into pool.concurrency() contiguous ranges
+        template <typename Work>
+        void parallelRanges(ThreadPool &pool, std::size_t count, Work work)
+        {
+            int ranges = pool.concurrency();
+            std::size_t chunk = (count + ranges - 1) / ranges;
+            TaskGroup group(pool);
+            for (int r = 0; r < ranges; ++r)
+            {
+                std::size_t begin = std::min(count, r * chunk);
+                std::size_t end = std::min(count, begin + chunk);
+                group.run([&work, begin, end, r]()
+                          { work(begin, end, r); });
+            }
+            group.wait();
+        }
+
+        bool isFixedTerm(int term)
+        {
+            return term < TermMaterial + KindCount && baseOf(static_cast<Kind>(term - TermMaterial)) == KingBase;
+        }
+
+        double sigmoid(double x)
+        {
+            return 1.0 / (1.0 + std::exp(-x));
+        }
+    }
+
+    TuningSet loadTuningSet(std::istream &input, std::size_t &skipped, ThreadPool &pool)
+    {
+        const std::size_t batchSize = 1 << 16;
+        TuningSet set;
+        skipped = 0;
+
+        std::vector<std::string> lines;
+        lines.reserve(batchSize);
+        std::string line;
+        bool more = true;
+        while (more)
+        {
+            lines.clear();
+            while (lines.size() < batchSize && (more = static_cast<bool>(std::getline(input, line))))
+            {
+                if (!line.empty() && line[0] != '#')
+                {
+                    lines.push_back(line);
+                }
+            }
+
+            std::vector<TuningSet> parts(pool.concurrency());
+            std::vector<std::size_t> rejected(parts.size(), 0);
+            parallelRanges(pool, lines.size(), [&](std::size_t begin, std::size_t end, int index)
+                           {
+                Position position;
+                float result;
+                std::vector<EvalFeature> features;
+                for (std::size_t i = begin; i < end; ++i)
+                {
+                    if (!parseRecord(lines[i], position, result))
+                    {
+                        ++rejected[index];
+                        continue;
+                    }
+                    evalFeatures(position, features);
+                    parts[index].add(features, result);
+                } });
+
+            for (std::size_t i = 0; i < parts.size(); ++i)
+            {
+                set.append(parts[i]);
+                skipped += rejected[i];
+            }
+        }
+        return set;
+    }
+
+    Tuner::Tuner(const TuningSet &set, const TunerOptions &tunerOptions, ThreadPool &threadPool)
+        : data(set), options(tunerOptions), pool(threadPool), scale(tunerOptions.scaling > 0 ? tunerOptions.scaling : 1.0)
+    {
+    }
+
+    double Tuner::accumulate(const std::vector<double> &weights, std::vector<double> *gradient) const
+    {
+        int threads = pool.concurrency();
+        std::vector<double> partialLoss(threads, 0.0);
+        std::vector<std::vector<double>> partialGradient(gradient ? threads : 0, std::vector<double>(EvalTermCount, 0.0));
+        const double k = scale / 400.0;
+
+        parallelRanges(pool, data.size(), [&](std::size_t begin, std::size_t end, int index)
+                       {
+            double lossSum = 0.0;
+            for (std::size_t i = begin; i < end; ++i)
+            {
+                double eval = 0.0;
+                for (std::uint32_t f = data.offsets[i]; f < data.offsets[i + 1]; ++f)
+                {
+                    eval += weights[data.features[f].term] * data.features[f].value;
+                }
+                double predicted = sigmoid(k * eval);
+                double error = data.results[i] - predicted;
+                lossSum += error * error;
+
+                if (gradient)
+                {
+                    double factor = -2.0 * error * predicted * (1.0 - predicted) * k;
+                    std::vector<double> &local = partialGradient[index];
+                    for (std::uint32_t f = data.offsets[i]; f < data.offsets[i + 1]; ++f)
+                    {
+                        local[data.features[f].term] += factor * data.features[f].value;
+                    }
+                }
+            }
+            partialLoss[index] = lossSum; });
+
+        double total = 0.0;
+        for (double value : partialLoss)
+        {
+            total += value;
+        }
+        if (gradient)
+        {
+            gradient->assign(EvalTermCount, 0.0);
+            for (const std::vector<double> &local : partialGradient)
+            {
+                for (int term = 0; term < EvalTermCount; ++term)
+                {
+                    (*gradient)[term] += local[term] / data.size();
+                }
+            }
+        }
+        return data.size() ? total / data.size() : 0.0;
+    }
+
+    double Tuner::loss(const std::vector<double> &weights) const
+    {
+        return accumulate(weights, nullptr);
+    }
+
+    double Tuner::fitScaling(const EvalParams &params)
+    {
+        std::vector<double> weights(params.weights, params.weights + EvalTermCount);
+
+        // Golden-section search; the loss is unimodal in K for a fixed evaluation
+        double low = 0.05, high = 5.0;
+        const double ratio = (std::sqrt(5.0) - 1.0) / 2.0;
+        for (int step = 0; step < 30; ++step)
+        {
+            double a = high - ratio * (high - low);
+            double b = low + ratio * (high - low);
+            scale = a;
+            double lossA = loss(weights);
+            scale = b;
+            double lossB = loss(weights);
+            if (lossA < lossB)
+                high = b;
+            else
+                low = a;
+        }
+        scale = (low + high) / 2.0;
+        return scale;
+    }
+
+    EvalParams Tuner::run(const EvalParams &start, const ProgressCallback &onProgress)
+    {
+        if (options.scaling <= 0)
+        {
+            fitScaling(start);
+        }
+
+        std::vector<double> weights(start.weights, start.weights + EvalTermCount);
+        std::vector<double> gradient;
+        std::vector<double> firstMoment(EvalTermCount, 0.0), secondMoment(EvalTermCount, 0.0);
+        const double beta1 = 0.9, beta2 = 0.999, epsilon = 1e-12;
+
+        for (int epoch = 1; epoch <= options.epochs; ++epoch)
+        {
+            double currentLoss = accumulate(weights, &gradient);
+            for (int term = 0; term < EvalTermCount; ++term)
+            {
+                if (isFixedTerm(term))
+                {
+                    continue;
+                }
+                firstMoment[term] = beta1 * firstMoment[term] + (1 - beta1) * gradient[term];
+                secondMoment[term] = beta2 * secondMoment[term] + (1 - beta2) * gradient[term] * gradient[term];
+                double corrected1 = firstMoment[term] / (1 - std::pow(beta1, epoch));
+                double corrected2 = secondMoment[term] / (1 - std::pow(beta2, epoch));
+                weights[term] -= options.learningRate * corrected1 / (std::sqrt(corrected2) + epsilon);
+            }
+            if (onProgress)
+            {
+                onProgress(epoch, currentLoss);
+            }
+        }
+
+        EvalParams tuned = start;
+        for (int term = 0; term < EvalTermCount; ++term)
+        {
+            tuned.weights[term] = static_cast<int>(std::lround(weights[term]));
+        }
+        return tuned;
+    }
+
+    std::vector<GemstoneSuggestion> suggestGemstoneCosts(const EvalParams &params)
+    {
+        // Upgrade prices per slot from the army menus (costsText), indexed by Base
+        const int menuCosts[BaseCount] = {1, 3, 3, 4, 5, 2};
+
+        // Least-squares centipawns per gemstone over the measurable (non-king) upgrades
+        double numerator = 0.0, denominator = 0.0;
+        for (int race = Necro; race < RaceCount; ++race)
+        {
+            for (int base = PawnBase; base < KingBase; ++base)
+            {
+                Kind kind = makeKind(static_cast<Race>(race), static_cast<Base>(base));
+                double gain = params.material(kind) - params.material(makeKind(Standard, static_cast<Base>(base)));
+                numerator += gain * menuCosts[base];
+                denominator += menuCosts[base] * menuCosts[base];
+            }
+        }
+        double perGemstone = numerator > 0 ? numerator / denominator : 100.0 / 3.0;
+
+        std::vector<GemstoneSuggestion> suggestions;
+        for (int race = Necro; race < RaceCount; ++race)
+        {
+            for (int base = PawnBase; base < BaseCount; ++base)
+            {
+                Kind kind = makeKind(static_cast<Race>(race), static_cast<Base>(base));
+                int suggested = menuCosts[base]; // kings have no material to measure
+                if (base != KingBase)
+                {
+                    double gain = params.material(kind) - params.material(makeKind(Standard, static_cast<Base>(base)));
+                    suggested = std::max(1, static_cast<int>(std::lround(gain / perGemstone)));
+                }
+                suggestions.push_back(GemstoneSuggestion{kind, menuCosts[base], suggested});
+            }
+        }
+        return suggestions;
+    }
+}
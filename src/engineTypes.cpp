@@ -0,0 +1,91 @@
+// Filename: engineTypes.cpp
+// Description: Naming helpers shared by the headless engine (square and piece kind names).
+
+// Main Functions:
+// - std::string squareToString<Geometry>(int sq): Formats a square as file letter plus rank number ("a1" is White's back rank, left corner).
+// - int squareFromString<Geometry>(const std::string &text, std::size_t &pos): Parses a square starting at pos and advances pos.
+// - std::string kindName(Kind kind) / Kind kindFromName(const std::string &name):
+//   Converts between engine kinds and the type names used by getType() and pieceFactoryMap.
+
+// Usage or Context:
+// - Used by the engine protocol, the notation parser and tools that exchange positions with the GUI.
+
+#include "engineTypes.h"
+#include <cctype>
+
+namespace engine
+{
+    namespace
+    {
+        const char *const kindNames[KindCount] = {
+            "Pawn", "Knight", "Bishop", "Rook", "Queen", "King",
+            "NecroPawn", "GhostKnight", "Necromancer", "DeadLauncher", "QueenOfBones", "GhoulKing",
+            "YoungWiz", "Familiar", "Wizard", "Portal", "QueenOfIllusions", "WizardKing",
+            "PawnHopper", "BeastKnight", "BeastDruid", "BoulderThrower", "QueenOfDomination", "FrogKing",
+            "HellPawn", "Prowler", "Howler", "Beholder", "QueenOfDestruction", "HellKing",
+            "CustomPawn", "CustomKnight", "CustomBishop", "CustomRook", "CustomQueen", "CustomKing"};
+    }
+
+    template <typename Geometry>
+    std::string squareToString(int sq)
+    {
+        if (sq < 0 || sq >= Geometry::squares)
+        {
+            return "-";
+        }
+        std::string text(1, static_cast<char>('a' + Geometry::colOf(sq)));
+        return text + std::to_string(Geometry::rowOf(sq) + 1);
+    }
+
+    template <typename Geometry>
+    int squareFromString(const std::string &text, std::size_t &pos)
+    {
+        if (pos >= text.size() || text[pos] < 'a' || text[pos] >= 'a' + Geometry::dim)
+        {
+            return -1;
+        }
+        int col = text[pos] - 'a';
+        std::size_t cursor = pos + 1;
+        int rank = 0;
+        while (cursor < text.size() && std::isdigit(static_cast<unsigned char>(text[cursor])) && rank < Geometry::dim)
+        {
+            int next = rank * 10 + (text[cursor] - '0');
+            if (next > Geometry::dim)
+            {
+                break;
+            }
+            rank = next;
+            ++cursor;
+        }
+        if (rank < 1)
+        {
+            return -1;
+        }
+        pos = cursor;
+        return Geometry::makeSquare(rank - 1, col);
+    }
+
+    template std::string squareToString<Board8>(int sq);
+    template std::string squareToString<Board10>(int sq);
+    template std::string squareToString<Board12>(int sq);
+    template int squareFromString<Board8>(const std::string &text, std::size_t &pos);
+    template int squareFromString<Board10>(const std::string &text, std::size_t &pos);
+    template int squareFromString<Board12>(const std::string &text, std::size_t &pos);
+
+    std::string kindName(Kind kind)
+    {
+        return kind < KindCount ? kindNames[kind] : "None";
+    }
+
+    Kind kindFromName(const std::string &name)
+    {
+        for (int kind = 0; kind < KindCount; ++kind)
+        {
+            if (name == kindNames[kind])
+            {
+                return static_cast<Kind>(kind);
+            }
+        }
+        return NoKind;
+    }
+}
@@ -7,7 +7,7 @@
 // Main Functions:
 // - bool Familiar::canMoveTo(const sf::Vector2f &target, const std::vector<std::unique_ptr<Piece>> &pieces) const:
 //   Checks if the Familiar can legally move to the specified target position on the chessboard.
-// - void Familiar::highlightValidMoves(std::vector<std::vector<Square>> &board, const std::vector<std::unique_ptr<Piece>> &pieces) const:
+// - void Familiar::highlightValidMoves(Board &board, const std::vector<std::unique_ptr<Piece>> &pieces) const:
 //   Highlights all valid moves for the Familiar on the provided chessboard, considering its current position and game rules.
 
 // Special Features or Notes:
@@ -26,7 +26,7 @@
 #include "familiar.h"
 #include "utility.h"
 #include "globals.h"
-#include "square.h"
+#include "board.h"
 #include <vector>
 
 // Determine if the Familiar can move to a specified target position
@@ -45,14 +45,15 @@ bool Familiar::canMoveTo(const sf::Vector2f &target, const std::vector<std::uniq
 }
 
 // Highlight valid moves for the Familiar on the provided board
-void Familiar::highlightValidMoves(std::vector<std::vector<Square>> &board, const std::vector<std::unique_ptr<Piece>> &pieces) const
+void Familiar::highlightValidMoves(Board &board, const std::vector<std::unique_ptr<Piece>> &pieces) const
 {
+    Board::Highlights highlights;
     sf::Vector2f currentPosition = getPosition();
-    int currentRow = currentPosition.y / TILE_SIZE;
-    int currentCol = currentPosition.x / TILE_SIZE;
+    int currentRow = tileIndex(currentPosition.y);
+    int currentCol = tileIndex(currentPosition.x);
 
     // Highlight the current position in red
-    board[currentRow][currentCol].setHighlight(true, sf::Color::Red);
+    highlights.captures |= Board::squareMask(currentRow, currentCol);
 
     // Define all possible move positions for the Familiar
     std::vector<sf::Vector2f> moves = {
@@ -68,20 +69,21 @@ void Familiar::highlightValidMoves(std::vector<std::vector<Square>> &board, cons
     // Iterate through each possible move and highlight valid moves on the board
     for (const auto &move : moves)
     {
-        int col = move.x / TILE_SIZE;
-        int row = move.y / TILE_SIZE;
+        int col = tileIndex(move.x);
+        int row = tileIndex(move.y);
 
         // space is occupied by an opponent piece
         if (col >= 0 && col < BOARD_SIZE && row >= 0 && row < BOARD_SIZE && canMoveTo(move, pieces) && isOpponentPiece(move, pieces, getColor()))
         {
-            board[row][col].setHighlight(true, sf::Color::Red);
+            highlights.captures |= Board::squareMask(row, col);
         }
         // space is unoccupied
         else if (col >= 0 && col < BOARD_SIZE && row >= 0 && row < BOARD_SIZE && canMoveTo(move, pieces))
         {
-            board[row][col].setHighlight(true);
+            highlights.moves |= Board::squareMask(row, col);
         }
     }
+    board.highlight(highlights);
 };
 
 /*
@@ -7,7 +7,7 @@
 // Main Functions:
 // - bool FrogKing::canMoveTo(const sf::Vector2f &target, const std::vector<std::unique_ptr<Piece>> &pieces) const:
 //   Checks if the FrogKing can legally move to the specified target position on the chessboard.
-// - void FrogKing::highlightValidMoves(std::vector<std::vector<Square>> &board, const std::vector<std::unique_ptr<Piece>> &pieces) const:
+// - void FrogKing::highlightValidMoves(Board &board, const std::vector<std::unique_ptr<Piece>> &pieces) const:
 //   Highlights all valid moves for the FrogKing on the provided chessboard, considering its current position and game rules.
 
 // Special Features or Notes:
@@ -24,7 +24,7 @@
 #include "frogKing.h"
 #include "utility.h"
 #include "globals.h"
-#include "square.h"
+#include "board.h"
 #include <vector>
 
 // Determine if the FrogKing can move to a specified target position
@@ -42,8 +42,9 @@ bool FrogKing::canMoveTo(const sf::Vector2f &target, const std::vector<std::uniq
 }
 
 // Highlight valid moves for the FrogKing on the provided board
-void FrogKing::highlightValidMoves(std::vector<std::vector<Square>> &board, const std::vector<std::unique_ptr<Piece>> &pieces) const
+void FrogKing::highlightValidMoves(Board &board, const std::vector<std::unique_ptr<Piece>> &pieces) const
 {
+    Board::Highlights highlights;
     sf::Vector2f currentPosition = getPosition();
     std::vector<sf::Vector2f> moves = {
         {currentPosition.x, currentPosition.y + TILE_SIZE},
@@ -57,26 +58,28 @@ void FrogKing::highlightValidMoves(std::vector<std::vector<Square>> &board, cons
         {currentPosition.x, currentPosition.y + TILE_SIZE * 2},
         {currentPosition.x, currentPosition.y - TILE_SIZE * 2},
         {currentPosition.x - TILE_SIZE * 2, currentPosition.y},
-        {currentPosition.x - TILE_SIZE * 2, currentPosition.y - TILE_SIZE * 2},
-        {currentPosition.x - TILE_SIZE * 2, currentPosition.y + TILE_SIZE * 2},
         {currentPosition.x + TILE_SIZE * 2, currentPosition.y},
-        {currentPosition.x + TILE_SIZE * 2, currentPosition.y + TILE_SIZE * 2},
-        {currentPosition.x + TILE_SIZE * 2, currentPosition.y - TILE_SIZE * 2}};
+        // Sideways hops: two squares across and one up or down, the leaps canMoveTo accepts
+        {currentPosition.x - TILE_SIZE * 2, currentPosition.y - TILE_SIZE},
+        {currentPosition.x - TILE_SIZE * 2, currentPosition.y + TILE_SIZE},
+        {currentPosition.x + TILE_SIZE * 2, currentPosition.y + TILE_SIZE},
+        {currentPosition.x + TILE_SIZE * 2, currentPosition.y - TILE_SIZE}};
 
     for (const auto &move : moves)
     {
-        int col = move.x / TILE_SIZE;
-        int row = move.y / TILE_SIZE;
+        int col = tileIndex(move.x);
+        int row = tileIndex(move.y);
 
         // space is occupied by an opponent piece
         if (col >= 0 && col < BOARD_SIZE && row >= 0 && row < BOARD_SIZE && canMoveTo(move, pieces) && isOpponentPiece(move, pieces, getColor()))
         {
-            board[row][col].setHighlight(true, sf::Color::Red);
+            highlights.captures |= Board::squareMask(row, col);
         }
         // space is unoccupied
         else if (col >= 0 && col < BOARD_SIZE && row >= 0 && row < BOARD_SIZE && canMoveTo(move, pieces))
         {
-            board[row][col].setHighlight(true);
+            highlights.moves |= Board::squareMask(row, col);
         }
     }
+    board.highlight(highlights);
 };
\ No newline at end of file
@@ -11,93 +11,150 @@
 #include "ghoulKing.h"
 #include "necroPawn.h"
 #include "hellPawn.h"
-#include "hellKing.h"
 #include "queenOfIllusions.h"
 #include "queenOfBones.h"
-#include "boulderThrower.h"
-#include "beholder.h"
 #include "deadLauncher.h"
 #include "howler.h"
 #include "prowler.h"
 #include "portal.h"
 #include "familiar.h"
 #include "ghostKnight.h"
-#include "wizardKing.h"
 #include "utility.h"
 #include "globals.h"
 #include "piece.h"
 #include "network.h"
+#include "engineBridge.h"
+#include "enginePonder.h"
+#include "engineHint.h"
+#include "engineMoveCache.h"
+#include "effectScheduler.h"
+#include "areaEffect.h"
+#include "pieceReserve.h"
+#include "piecePool.h"
+#include "pieceTable.h"
+#include "gameContext.h"
+#include "boardLayer.h"
+#include "pendingAction.h"
 #include <iostream>
 #include <sstream>
 #include <SFML/Graphics.hpp>
 #include <vector>
 #include <memory>
 #include <algorithm>
+#include <deque>
 
-void clearSelection(std::vector<std::vector<Square>> &board)
+// Highlights a piece of the side to move from the position's cached legal moves. Pieces of the other side,
+// and pieces with abilities the target masks cannot show, still highlight through their own rules, ranged
+// captures included. battlechess_highlighttest checks that both give the same squares for every piece class.
+void highlightSelection(Board &board, engine::LegalMoveCache &legalMoves, const Piece &piece, const std::vector<std::unique_ptr<Piece>> &pieces, const PieceReserve &reserve, bool isWhiteTurn)
 {
-    for (auto &row : board)
+    int from = squareFromPixels(piece.getPosition());
+    if (from != engine::NO_SQUARE && piece.getColor() == (isWhiteTurn ? Piece::Color::White : Piece::Color::Black))
     {
-        for (auto &square : row)
+        std::shared_ptr<const engine::LegalMoves> moves = legalMoves.lookup(positionFromPieces(pieces, reserve, isWhiteTurn));
+        if (!moves->hasAbilities(from))
         {
-            square.setHighlight(false);
+            board.highlight(moves->quietTargets[from]);
+            board.highlight(moves->captureTargets[from], sf::Color::Red);
+            return;
         }
     }
+    piece.highlightValidMoves(board, pieces);
+    piece.highlightCaptureZones(board, pieces);
 }
 
-Piece *playerSelectPawn(sf::RenderWindow &window, const std::vector<Piece *> &sacrificablePawns, std::vector<std::vector<Square>> &board, const std::vector<std::unique_ptr<Piece>> &pieces, QueenOfBones &queen)
+// Outlines the hinted move and shows the evaluation (in pawns, for the side to move) with the search depth
+void drawHint(sf::RenderWindow &window, const engine::HintSnapshot &hint, const sf::Font &font)
 {
-    while (window.isOpen())
+    sf::RectangleShape fromSquare(sf::Vector2f(TILE_SIZE - 6, TILE_SIZE - 6));
+    fromSquare.setFillColor(sf::Color(0, 170, 255, 50));
+    fromSquare.setOutlineColor(sf::Color(0, 170, 255));
+    fromSquare.setOutlineThickness(3);
+    fromSquare.setPosition(pixelsFromSquare(hint.from) + sf::Vector2f(3, 3));
+    window.draw(fromSquare);
+
+    sf::RectangleShape toSquare = fromSquare;
+    toSquare.setFillColor(sf::Color(0, 170, 255, 110));
+    toSquare.setPosition(pixelsFromSquare(hint.to) + sf::Vector2f(3, 3));
+    window.draw(toSquare);
+
+    std::ostringstream label;
+    label.setf(std::ios::fixed);
+    label.precision(2);
+    label << (hint.score >= 0 ? "+" : "") << hint.score / 100.0 << " d" << hint.depth;
+
+    sf::Text evalText(label.str(), font, 16);
+    evalText.setFillColor(sf::Color::White);
+    evalText.setOutlineColor(sf::Color::Black);
+    evalText.setOutlineThickness(1);
+    evalText.setPosition(pixelsFromSquare(hint.to) + sf::Vector2f(4, TILE_SIZE - 22));
+    window.draw(evalText);
+}
+
+// Offers the revival of the first fallen QueenOfBones whose side still has two pawns to sacrifice; the others
+// are dropped. Returns false when no queen is left to offer.
+bool offerNextQueenOfBonesRevival(std::deque<std::unique_ptr<Piece>> &fallenQueens, Board &board, std::vector<std::unique_ptr<Piece>> &pieces)
+{
+    while (!fallenQueens.empty())
     {
-        sf::Event event;
-        while (window.pollEvent(event))
+        auto &queen = static_cast<QueenOfBones &>(*fallenQueens.front());
+        std::vector<Piece *> sacrificablePawns = queen.revive(pieces);
+
+        // If there are not enough pawns to sacrifice, the revive cannot occur
+        if (sacrificablePawns.size() >= 2)
         {
-            if (event.type == sf::Event::Closed)
-                window.close();
+            std::cout << "REVIVE QUEENOFBONES?: Select two pawns to sacrifice. ELSE: Select QueenOfBones." << std::endl;
 
-            if (event.type == sf::Event::MouseButtonPressed)
+            board.clearHighlights();
+            for (Piece *pawn : sacrificablePawns)
             {
-                if (event.mouseButton.button == sf::Mouse::Left)
-                {
-                    sf::Vector2i mousePosition = sf::Mouse::getPosition(window);
-                    sf::Vector2f worldPosition = window.mapPixelToCoords(mousePosition);
+                board.setHighlight(Board::squareAt(pawn->getPosition()), true, sf::Color::Red);
+            }
+            return true;
+        }
 
-                    // Check if the mouse click is on a sacrificable pawn
-                    for (auto pawn : sacrificablePawns)
-                    {
-                        if (pawn->getSprite().getGlobalBounds().contains(worldPosition))
-                        {
-                            // Get the position of the pawn
-                            sf::Vector2f piecePosition = pawn->getPosition();
-                            int x = static_cast<int>(piecePosition.x / TILE_SIZE);
-                            int y = static_cast<int>(piecePosition.y / TILE_SIZE);
+        std::cout << "Not enough pawns to sacrifice. Revive failed." << std::endl;
+        fallenQueens.pop_front();
+    }
+    return false;
+}
 
-                            // Highlight the corresponding square on the board
-                            board[y][x].setHighlight(true, sf::Color::Red);
+// One click of the revival offered for the first fallen QueenOfBones: a sacrificable pawn is sacrificed and the
+// queen respawns with the second, a click on the queen's square declines. Returns true once the revival is decided.
+bool handleQueenOfBonesRevivalClick(std::deque<std::unique_ptr<Piece>> &fallenQueens, const sf::Vector2f &clickPosition, Board &board, std::vector<std::unique_ptr<Piece>> &pieces, TextureManager &textureManager)
+{
+    auto &queen = static_cast<QueenOfBones &>(*fallenQueens.front());
+    std::vector<Piece *> sacrificablePawns = queen.revive(pieces);
+    Piece *clickedPiece = getPieceAtPosition(clickPosition, pieces);
 
-                            window.clear();
-                            drawChessboard(window, board);
+    if (clickedPiece && std::find(sacrificablePawns.begin(), sacrificablePawns.end(), clickedPiece) != sacrificablePawns.end())
+    {
+        board.setHighlight(Board::squareAt(clickPosition), false);
+        queen.handlePawnSacrifice(clickedPiece, pieces);
+        if (queen.pawnsToSacrifice > 0)
+        {
+            return false;
+        }
 
-                            for (const auto &piece : pieces)
-                            {
-                                window.draw(piece->getSprite());
-                            }
+        // Attempt to respawn the QueenOfBones
+        queen.respawnAtOriginalPosition(pieces, textureManager);
+    }
+    else if (clickPosition != queen.getPosition())
+    {
+        return false;
+    }
 
-                            window.display();
+    board.clearHighlights();
+    fallenQueens.pop_front();
+    return true;
+}
 
-                            return pawn; // Return the selected pawn
-                        }
-                        else if (queen.getSprite().getGlobalBounds().contains(worldPosition))
-                        {
-                            queen.pawnsToSacrifice = -1;
-                            return nullptr;
-                        }
-                    }
-                }
-            }
-        }
-    }
-    return nullptr;
+// Prints what the session's asset cache keeps resident, once per game
+void reportAssetMemory(const AssetLoader::MemoryUsage &usage)
+{
+    std::cout << "Assets: " << usage.textureCount << " textures, " << usage.textureBytes / 1024 << " KiB; archive "
+              << usage.archiveBytes / 1024 << " KiB mapped; textures in use by " << usage.textureUsers << " game(s)"
+              << std::endl;
 }
 
 /**
@@ -108,21 +165,43 @@ Piece *playerSelectPawn(sf::RenderWindow &window, const std::vector<Piece *> &sa
  * It also operates capture positions and some specific logic for the unique game pieces.
  *
  * @param window Reference to the SFML window where the game is rendered.
+ * @param playerColor The side this player plays, as agreed in initialConnect.
+ * @param assets The textures and font, loaded once per process.
  */
-void Game::runChessGame(sf::RenderWindow &window, std::unique_ptr<sf::TcpSocket> &socket)
+void Game::runChessGame(sf::RenderWindow &window, std::unique_ptr<sf::TcpSocket> &socket, Piece::Color playerColor, AssetLoader &assets)
 {
-    TextureManager textureManager;
-    std::vector<std::unique_ptr<Piece>> pieces;
+    // Uploaded by the first game, waiting for the image worker if the menu was left before it finished; a rematch
+    // gets the same textures back at once. Held until the game returns, after every piece drawn with them is gone.
+    std::shared_ptr<TextureManager> textures;
     try
     {
-        loadTextures(textureManager);         // Load textures for all pieces
-        createPieces(textureManager, pieces); // Create and add pieces
+        textures = assets.acquireTextures();
     }
     catch (const std::runtime_error &e)
     {
         std::cerr << "Error loading textures: " << e.what() << std::endl;
         return;
     }
+    TextureManager &textureManager = *textures;
+    reportAssetMemory(assets.getMemoryUsage());
+    GameContext context(textureManager, playerColor);
+    const bool isPlayerWhite = context.isPlayerWhite();
+
+    // The loop never waits on input, so the window paces it; packets are polled once per frame
+    window.setFramerateLimit(context.getSettings().frameRateLimit);
+
+    // Every piece of this game lives in the pool; declared before the pieces so they are destroyed before it
+    PiecePool piecePool(context.getSettings().piecePoolCapacity);
+    PiecePool::Scope piecePoolScope(piecePool);
+
+    // The piece list as columns for the area effects and revivals, kept up to date as pieces move, are captured
+    // and spawn; declared before the pieces so it outlives them
+    PieceTable pieceTable;
+    PieceTable::Scope pieceTableScope(pieceTable);
+
+    std::vector<std::unique_ptr<Piece>> pieces;
+    createPieces(context, pieces); // Create and add pieces
+    pieceTable.sync(pieces);
 
     // set flags
     bool isWhiteTurn = true; // Initialize to white's turn
@@ -133,29 +212,29 @@ void Game::runChessGame(sf::RenderWindow &window, std::unique_ptr<sf::TcpSocket>
     std::cout << "isWhiteTurn: " << isWhiteTurn << std::endl;
     std::cout << "currentTurn: " << currentTurn << std::endl;
 
-    std::vector<std::vector<Square>> board(BOARD_SIZE, std::vector<Square>(BOARD_SIZE, Square(sf::Vector2f(), sf::Color::White)));
-
     sf::Color darkGreen(0, 100, 0);
     sf::Color lightGreen(144, 238, 144);
 
-    // Initialize the chessboard squares
-    for (int row = 0; row < BOARD_SIZE; ++row)
+    // Initialize the chessboard squares; highlights live in the board's per-colour masks
+    Board board(lightGreen, darkGreen);
+
+    // The squares are rendered once here; each frame draws them as one texture plus the highlight overlay
+    BoardLayer boardLayer(board);
+
+    // Multi-click abilities in progress; each click of one is handled by the loop like any other
+    PendingAction pending;
+
+    // Captures and area effects hand a fallen QueenOfBones here. A copy waits until her revival is offered,
+    // after the capture and anything else pending is done, and the loop then takes the clicks that decide it.
+    std::deque<std::unique_ptr<Piece>> fallenQueens;
+    AreaEffect::QueenOfBonesFallen offerRevival = [&](QueenOfBones &queen)
     {
-        for (int col = 0; col < BOARD_SIZE; ++col)
-        {
-            sf::Vector2f position(col * TILE_SIZE, row * TILE_SIZE);
-            sf::Color color = (row + col) % 2 == 0 ? lightGreen : darkGreen;
-            board[row][col] = Square(position, color);
-        }
-    }
+        fallenQueens.push_back(queen.clone());
+    };
 
     bool pieceSelected = false;
     Piece *selectedPiece = nullptr;
 
-    // Necromancer specific variables
-    bool awaitingPawnPlacement = false;
-    Necromancer *necromancer = nullptr;
-
     // Initialize ghostKnight variable
     GhostKnight *ghostKnight = nullptr;
 
@@ -168,32 +247,18 @@ void Game::runChessGame(sf::RenderWindow &window, std::unique_ptr<sf::TcpSocket>
     // Initialize QueenOfDomination variable
     QueenOfDomination *queenOfDomination = nullptr;
 
-    // Initialize GhoulKing variable
-    bool awaitingNecroPawnPlacement = false;
-    GhoulKing *ghoulKing = nullptr;
+    // Pieces held off the board, shared by every Portal of a side
+    PieceReserve reserve;
 
-    // Initialize portal/portals variables
-    Portal *portal = nullptr;
-    std::vector<Portal *> portals;
-    for (const auto &piece : pieces)
-    {
-        if (piece->getType() == "Portal")
-        {
-            portals.push_back(static_cast<Portal *>(piece.get()));
-        }
-    }
+    // Stuns, domination, stone and HellPawn removal expire here when a turn is handed over
+    EffectScheduler effects;
 
     // Prowler specific variables
     bool prowlerNeedsAdditionalMove = false;
     Piece *prowlerForAdditionalMove = nullptr;
 
-    // Load font for turn indicator
-    sf::Font font;
-    if (!font.loadFromFile("../resources/JmhcthulhumbusarcadeugRegular-JleB.ttf"))
-    {
-        std::cerr << "Error loading font" << std::endl;
-        return;
-    }
+    // Font for turn indicator
+    const sf::Font &font = assets.getFont();
 
     // Turn indicator text
     sf::Text turnIndicator;
@@ -211,6 +276,46 @@ void Game::runChessGame(sf::RenderWindow &window, std::unique_ptr<sf::TcpSocket>
     bool showTurnIndicator = true;
     sf::Clock fadeClock;
 
+    // Engine thinks on the opponent's time and suggests our reply once it arrives. In hint mode the
+    // overlay shows the suggestion while no piece hint is showing, until our move is sent.
+    engine::Ponderer ponderer;
+    engine::SearchLimits engineLimits;
+    engineLimits.moveTime = context.getSettings().engineMoveTimeMs;
+    engine::HintSnapshot engineSuggestion;
+
+    // Hint mode (toggled with H): the engine searches the selected piece's moves in the background
+    engine::HintEngine hintEngine;
+    bool hintMode = false;
+    // A handle rather than a pointer: a captured piece's slot is soon reused by the next piece created
+    PiecePool::Handle hintedPiece;
+    const int hintTimeMs = context.getSettings().hintTimeMs;
+
+    // Moves of the side to move, generated in the background once per position and shared by every selection.
+    // awaitedPosition is the position handed to the opponent, which their packet must follow from.
+    engine::LegalMoveCache legalMoves;
+    legalMoves.prepare(positionFromPieces(pieces, reserve, isWhiteTurn));
+    std::uint64_t awaitedPosition = 0;
+
+    // Checks a position received from the opponent against the moves of the one we handed over
+    // and starts generating our moves in it. The GUI pieces' rules and the engine's can still differ (see
+    // battlechess_highlighttest), so a mismatch is reported, not refused. The ponderer only hears of a completed
+    // turn: after a Prowler's first move the opponent is still on turn, and comparing that position with the
+    // prediction would count as a miss and restart the ponder search.
+    auto opponentPositionArrived = [&](const engine::Position &actual, bool turnComplete)
+    {
+        std::shared_ptr<const engine::LegalMoves> expected = legalMoves.find(awaitedPosition);
+        if (expected && !expected->leadsTo(actual.hash()))
+        {
+            std::cerr << "Warning: the received position does not follow from a legal move" << std::endl;
+        }
+        legalMoves.prepare(actual);
+        if (turnComplete)
+        {
+            // A correctly predicted reply keeps the ponder search, anything else restarts it
+            ponderer.opponentMoved(actual);
+        }
+    };
+
     // game states
     bool update = false; // update boolean helps with testing netork connections on a single cpu
     bool mouseButtonPressed = false;
@@ -233,24 +338,60 @@ void Game::runChessGame(sf::RenderWindow &window, std::unique_ptr<sf::TcpSocket>
             {
                 update = false;
             }
+            else if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::H)
+            {
+                hintMode = !hintMode;
+                hintedPiece = PiecePool::Handle();
+                hintEngine.cancel();
+            }
         }
 
         // Check for incoming packets even if it's not this player's turn
         Piece::Color color = isPlayerWhite ? Piece::Color::Black : Piece::Color::White;
-        receivePacket(socket, pieces, textureManager, color);
+        bool opponentTurnComplete = false;
+        if (receivePacket(socket, pieces, context, color, opponentTurnComplete))
+        {
+            effects.adoptStuns(pieces, isPlayerWhite ? Piece::Color::White : Piece::Color::Black);
+            opponentPositionArrived(positionFromPieces(pieces, reserve, isPlayerWhite), opponentTurnComplete);
+        }
+
+        // A fallen QueenOfBones is offered her revival once nothing else is pending; the turn waits for it
+        if (!pending.isActive() && offerNextQueenOfBonesRevival(fallenQueens, board, pieces))
+        {
+            pending.start(PendingAction::Kind::QueenOfBonesRevival);
+        }
+
+        engine::SearchResult suggestion;
+        if (ponderer.poll(suggestion) && !suggestion.best.isNull())
+        {
+            engineSuggestion.valid = true;
+            engineSuggestion.from = suggestion.best.from;
+            engineSuggestion.to = suggestion.best.to;
+            engineSuggestion.score = suggestion.score;
+            engineSuggestion.depth = suggestion.depth;
+        }
 
         if (update)
         {
             if (isPlayerWhite == isWhiteTurn)
             {
                 // This player should make a move and send the packet
-                if (playerMadeMove && !prowlerNeedsAdditionalMove)
+                if (playerMadeMove && !prowlerNeedsAdditionalMove && !pending.isActive())
                 {
-                    sendPacket(socket, pieces);
+                    effects.endTurn(pieces, textureManager);
+                    sendPacket(socket, pieces, true);
                     isWhiteTurn = !isWhiteTurn; // Toggle turn after sending
                     currentTurn = isWhiteTurn;  // Update currentTurn to reflect the new turn
                     playerMadeMove = false;
 
+                    engine::Position handedOver = positionFromPieces(pieces, reserve, isWhiteTurn);
+                    awaitedPosition = handedOver.hash();
+                    engineSuggestion = engine::HintSnapshot();
+                    legalMoves.prepare(handedOver);
+
+                    // Start thinking about our next move while the opponent plays theirs
+                    ponderer.startPondering(handedOver, engineLimits);
+
                     turnIndicator.setString(isWhiteTurn ? "White's Turn" : "Black's Turn");
                     turnIndicator.setFillColor(sf::Color::White);
                     showTurnIndicator = true;
@@ -262,9 +403,10 @@ void Game::runChessGame(sf::RenderWindow &window, std::unique_ptr<sf::TcpSocket>
                     turnIndicator.setOrigin(textRect.left + textRect.width / 2.0f, textRect.top + textRect.height / 2.0f);
                     turnIndicator.setPosition(sf::Vector2f(window.getSize().x / 2.0f, window.getSize().y / 2.0f));
                 }
-                else if (playerMadeMove)
+                else if (playerMadeMove && !pending.isActive())
                 {
-                    sendPacket(socket, pieces);
+                    // The Prowler moves again, so the opponent is not on turn yet
+                    sendPacket(socket, pieces, false);
                     playerMadeMove = false;
 
                     turnIndicator.setString(prowlerNeedsAdditionalMove ? "Prowler can move again" : (isWhiteTurn ? "White's Turn" : "Black's Turn"));
@@ -285,7 +427,12 @@ void Game::runChessGame(sf::RenderWindow &window, std::unique_ptr<sf::TcpSocket>
 
                 // This player should receive the packet and update its state
                 std::cout << "About to receivePacket" << std::endl;
-                receivePacket(socket, pieces, textureManager, color);
+                bool opponentTurnComplete = false;
+                if (receivePacket(socket, pieces, context, color, opponentTurnComplete))
+                {
+                    effects.adoptStuns(pieces, isPlayerWhite ? Piece::Color::White : Piece::Color::Black);
+                    opponentPositionArrived(positionFromPieces(pieces, reserve, isPlayerWhite), opponentTurnComplete);
+                }
                 isWhiteTurn = !isWhiteTurn;
                 std::cout << "receivePacket: Success!" << std::endl;
 
@@ -313,49 +460,109 @@ void Game::runChessGame(sf::RenderWindow &window, std::unique_ptr<sf::TcpSocket>
                     int col = mousePos.x / TILE_SIZE;
                     int row = mousePos.y / TILE_SIZE;
                     sf::Vector2f selectedPiecePosition = sf::Vector2f(col * TILE_SIZE, row * TILE_SIZE);
-                    if (awaitingPawnPlacement)
+                    Piece *clickedPiece = getPieceAtPosition(selectedPiecePosition, pieces);
+
+                    // A pending ability takes the click before anything can be selected
+                    if (pending.isActive())
                     {
-                        if (board[row][col].getHighlight())
+                        Piece *actor = piecePool.resolve(pending.actor);
+                        bool highlighted = board[row][col].getHighlight();
+
+                        switch (pending.kind)
                         {
-                            pushPawn(pieces, necromancer->getPawnTexture(textureManager), selectedPiecePosition, necromancer->getColor());
-                            awaitingPawnPlacement = false;
-                            necromancer = nullptr;
+                        case PendingAction::Kind::NecromancerPawn:
+                            // The raised pawn has to be placed before the turn can end
+                            if (!actor || highlighted)
+                            {
+                                if (actor)
+                                {
+                                    auto necromancer = static_cast<Necromancer *>(actor);
+                                    pushPawn(context, pieces, necromancer->getPawnTexture(textureManager), selectedPiecePosition, necromancer->getColor());
+                                }
+                                board.clearHighlights();
+                                pending.clear();
+                            }
+                            playerMadeMove = true;
+                            break;
+
+                        case PendingAction::Kind::GhoulKingNecroPawn:
+                            if (actor)
+                            {
+                                auto ghoulKing = static_cast<GhoulKing *>(actor);
+                                if (highlighted)
+                                {
+                                    pushNecroPawn(context, pieces, ghoulKing->getNecroPawnTexture(textureManager), selectedPiecePosition, ghoulKing->getColor());
+                                }
+                                // A click anywhere else calls the raise off
+                                ghoulKing->raisedDead = highlighted;
+                            }
+                            board.clearHighlights();
+                            pending.clear();
+                            pieceSelected = false;
+                            selectedPiece = nullptr;
+                            break;
+
+                        case PendingAction::Kind::PortalUnload:
+                            pending.clear();
+                            if (actor)
+                            {
+                                auto portal = static_cast<Portal *>(actor);
+                                portal->teleport(selectedPiecePosition, board, pieces, reserve);
+
+                                // The Portal stays selected with its moves shown
+                                portal->highlightValidMoves(board, pieces);
+                            }
+                            else
+                            {
+                                board.clearHighlights();
+                            }
+                            break;
 
-                            // Only clear highlights related to the pawn placement, not all highlights
-                            for (int r = 0; r < BOARD_SIZE; ++r)
+                        case PendingAction::Kind::DominationTarget:
+                            pending.clear();
+                            if (actor)
                             {
-                                for (int c = 0; c < BOARD_SIZE; ++c)
+                                auto queen = static_cast<QueenOfDomination *>(actor);
+                                if (highlighted && clickedPiece && clickedPiece != actor && !queen->hasUsedAbility() &&
+                                    queen->getColor() == (isWhiteTurn ? Piece::Color::White : Piece::Color::Black))
                                 {
-                                    if (board[r][c].getHighlight())
+                                    // The dominated piece keeps the Queen's powers through the next turn
+                                    Piece *dominated = queen->applyDominationAbility(clickedPiece, pieces, textureManager);
+                                    if (dominated)
                                     {
-                                        board[r][c].setHighlight(false);
+                                        effects.schedule(EffectScheduler::Effect::Domination, *dominated, 1);
                                     }
+                                    playerMadeMove = true;
+                                }
+                                queen->clearHighlights(board);
+
+                                // Clicking the queen again only hides her targets
+                                if (clickedPiece == actor)
+                                {
+                                    break;
                                 }
                             }
-                        }
-                        playerMadeMove = true;
-                        continue;
-                    }
+                            else
+                            {
+                                board.clearHighlights();
+                            }
+                            pieceSelected = false;
+                            selectedPiece = nullptr;
+                            break;
 
-                    if (awaitingNecroPawnPlacement)
-                    {
-                        if (board[row][col].getHighlight())
-                        {
-                            pushNecroPawn(pieces, ghoulKing->getNecroPawnTexture(textureManager), selectedPiecePosition, ghoulKing->getColor());
-                            awaitingNecroPawnPlacement = false;
-                            ghoulKing = nullptr;
-                            clearSelection(board);
-                            static_cast<GhoulKing *>(selectedPiece)->raisedDead = true;
-                            continue;
-                        }
-                        else
-                        {
-                            static_cast<GhoulKing *>(selectedPiece)->raisedDead = false;
+                        case PendingAction::Kind::QueenOfBonesRevival:
+                            if (handleQueenOfBonesRevivalClick(fallenQueens, selectedPiecePosition, board, pieces, textureManager))
+                            {
+                                pending.clear();
+                            }
+                            break;
+
+                        case PendingAction::Kind::None:
+                            break;
                         }
+                        continue;
                     }
 
-                    Piece *clickedPiece = getPieceAtPosition(selectedPiecePosition, pieces);
-
                     if (prowlerNeedsAdditionalMove)
                     {
                         if (clickedPiece == prowlerForAdditionalMove)
@@ -380,38 +587,7 @@ void Game::runChessGame(sf::RenderWindow &window, std::unique_ptr<sf::TcpSocket>
                                 // Check if the piece is a QueenOfBones
                                 if (targetPiece->getType() == "QueenOfBones")
                                 {
-                                    auto queen = static_cast<QueenOfBones *>(targetPiece);
-                                    // Call the revive method if the piece is a QueenOfBones
-                                    std::vector<Piece *> sacrificablePawns = queen->revive(pieces);
-
-                                    // If there are not enough pawns to sacrifice, the revive cannot occur
-                                    if (sacrificablePawns.size() < 2)
-                                    {
-                                        std::cout << "Not enough pawns to sacrifice. Revive failed." << std::endl;
-                                    }
-                                    else
-                                    {
-                                        std::cout << "REVIVE QUEENOFBONES?: Select two pawns to sacrifice. ELSE: Select QueenOfBones." << std::endl;
-
-                                        while (queen->pawnsToSacrifice > 0)
-                                        {
-                                            // Implement a mechanism to allow player to select a pawn from the sacrificablePawns vector
-                                            Piece *selectedPawn = playerSelectPawn(window, sacrificablePawns, board, pieces, *queen);
-
-                                            if (selectedPawn != nullptr)
-                                            {
-                                                queen->handlePawnSacrifice(selectedPawn, pieces); // Pass the selected pawn for sacrifice
-                                            }
-                                        }
-                                        if (queen->pawnsToSacrifice == 0)
-                                        {
-                                            // Attempt to respawn the QueenOfBones
-                                            queen->respawnAtOriginalPosition(pieces, textureManager);
-                                        }
-
-                                        // Reset pawnsToSacrifice
-                                        queen->pawnsToSacrifice = 2;
-                                    }
+                                    offerRevival(*static_cast<QueenOfBones *>(targetPiece));
                                 }
                                 // Capture the clicked piece
                                 selectedPiece->capture(targetPosition, pieces);
@@ -422,7 +598,7 @@ void Game::runChessGame(sf::RenderWindow &window, std::unique_ptr<sf::TcpSocket>
                             else if (targetPiece->getType() == "QueenOfDestruction")
                             {
                                 auto queen = static_cast<QueenOfDestruction *>(targetPiece);
-                                queen->massDestruction(selectedPiece, pieces, board);
+                                queen->massDestruction(selectedPiece, pieces, offerRevival);
                                 playerMadeMove = true;
                             }
 
@@ -438,35 +614,10 @@ void Game::runChessGame(sf::RenderWindow &window, std::unique_ptr<sf::TcpSocket>
                             selectedPiece = nullptr;
 
                             // Clear all highlights
-                            for (int r = 0; r < BOARD_SIZE; ++r)
-                            {
-                                for (int c = 0; c < BOARD_SIZE; ++c)
-                                {
-                                    board[r][c].setHighlight(false);
-                                }
-                            }
+                            board.clearHighlights();
 
                             // isWhiteTurn = !isWhiteTurn; // Switch turn after Prowler's additional move
 
-                            // Reset the stunned state of all pieces of the current player
-                            for (auto &piece : pieces)
-                            {
-                                if ((isWhiteTurn && piece->getColor() == Piece::Color::Black) ||
-                                    (!isWhiteTurn && piece->getColor() == Piece::Color::White))
-                                {
-                                    piece->setStunned(false);
-                                }
-                            }
-
-                            for (auto &piece : pieces)
-                            {
-                                auto queenOfDomination = dynamic_cast<QueenOfDomination *>(piece.get());
-                                if (queenOfDomination && queenOfDomination->originalType != "QueenOfDomination")
-                                {
-                                    queenOfDomination->returnOriginalSprite(pieces, textureManager);
-                                    playerMadeMove = true;
-                                }
-                            }
                             /*
                                                         turnIndicator.setString(isWhiteTurn ? "White's Turn" : "Black's Turn");
                                                         turnIndicator.setFillColor(sf::Color::White);
@@ -508,52 +659,18 @@ void Game::runChessGame(sf::RenderWindow &window, std::unique_ptr<sf::TcpSocket>
                                 // Familiar wakes up
                                 if (selectedPiece->getType() == "Familiar")
                                 {
-                                    auto &familiar = static_cast<Familiar &>(*selectedPiece);
-                                    familiar.setStone(false);
+                                    effects.cancel(EffectScheduler::Effect::Stone, *selectedPiece);
                                 }
 
                                 // Highlighting moves for all pieces happens here
-                                selectedPiece->highlightValidMoves(board, pieces);
-                            }
-
-                            // Highlight capture zones for BoulderThrower
-                            if (selectedPiece->getType() == "BoulderThrower")
-                            {
-                                auto &boulderThrower = static_cast<BoulderThrower &>(*selectedPiece);
-                                boulderThrower.highlightCaptureZones(board, pieces);
+                                highlightSelection(board, legalMoves, *selectedPiece, pieces, reserve, isWhiteTurn);
                             }
 
-                            // Highlight capture zones for Beholder
-                            if (selectedPiece->getType() == "Beholder")
-                            {
-                                auto &beholder = static_cast<Beholder &>(*selectedPiece);
-                                beholder.highlightCaptureZones(board, pieces);
-                            }
-
-                            // Highlight capture zones for HellKing
-                            if (selectedPiece->getType() == "HellKing")
-                            {
-                                auto &hellKing = static_cast<HellKing &>(*selectedPiece);
-                                hellKing.highlightCaptureZones(board, pieces);
-                            }
-
-                            // Highlight capture zones for deadLauncher
+                            // Highlight adjacent Pawns/NecroPawns the DeadLauncher can load
                             if (selectedPiece->getType() == "DeadLauncher")
                             {
                                 DeadLauncher *deadLauncher = static_cast<DeadLauncher *>(selectedPiece);
-                                // Highlight adjacent Pawns/NecroPawns
                                 deadLauncher->highlightAdjacentPawns(pieces, board);
-                                if (deadLauncher->pawnLoaded == true)
-                                {
-                                    deadLauncher->highlightDeadCaptureZones(board, pieces);
-                                }
-                            }
-
-                            // Highlight capture zones for WizardKing
-                            if (selectedPiece->getType() == "WizardKing")
-                            {
-                                WizardKing *wizardKing = static_cast<WizardKing *>(selectedPiece);
-                                wizardKing->highlightCaptureZones(board, pieces);
                             }
 
                             // Highlight pieces able to load
@@ -574,116 +691,17 @@ void Game::runChessGame(sf::RenderWindow &window, std::unique_ptr<sf::TcpSocket>
                                 {
                                     auto &necroPawn = static_cast<NecroPawn &>(*selectedPiece);
 
-                                    sf::Vector2f currentPosition = necroPawn.getPosition();
-                                    std::vector<sf::Vector2f> capturePositions = necroPawn.getCapturePositions();
-
-                                    // Iterate over all adjacent positions and capture any pieces found
-                                    for (const auto &pos : capturePositions)
-                                    {
-                                        for (auto it = pieces.begin(); it != pieces.end();)
-                                        {
-                                            Piece *piece = it->get(); // Access the raw pointer from std::unique_ptr
-                                            if (piece && piece->getPosition() == pos)
-                                            {
-                                                // Check if the piece is a QueenOfBones
-                                                if (piece->getType() == "QueenOfBones")
-                                                {
-                                                    auto queen = static_cast<QueenOfBones *>(piece);
-                                                    // Call the revive method if the piece is a QueenOfBones
-                                                    std::vector<Piece *> sacrificablePawns = queen->revive(pieces);
-
-                                                    // If there are not enough pawns to sacrifice, the revive cannot occur
-                                                    if (sacrificablePawns.size() < 2)
-                                                    {
-                                                        std::cout << "Not enough pawns to sacrifice. Revive failed." << std::endl;
-                                                    }
-                                                    else
-                                                    {
-                                                        std::cout << "REVIVE QUEENOFBONES?: Select two pawns to sacrifice. ELSE: Select QueenOfBones." << std::endl;
-
-                                                        while (queen->pawnsToSacrifice > 0)
-                                                        {
-                                                            // Implement a mechanism to allow player to select a pawn from the sacrificablePawns vector
-                                                            Piece *selectedPawn = playerSelectPawn(window, sacrificablePawns, board, pieces, *queen);
-
-                                                            if (selectedPawn != nullptr)
-                                                            {
-                                                                queen->handlePawnSacrifice(selectedPawn, pieces); // Pass the selected pawn for sacrifice
-                                                            }
-                                                        }
-
-                                                        if (queen->pawnsToSacrifice == 0)
-                                                        {
-                                                            // Attempt to respawn the QueenOfBones
-                                                            queen->respawnAtOriginalPosition(pieces, textureManager);
-                                                        }
-
-                                                        // Reset pawnsToSacrifice
-                                                        queen->pawnsToSacrifice = 2;
-                                                    }
-                                                    playerMadeMove = true;
-                                                    break;
-                                                }
-
-                                                // Check it killed piece if QueenOfDestruction (activate massDestruction)
-                                                else if (piece->getType() == "QueenOfDestruction")
-                                                {
-                                                    auto queen = static_cast<QueenOfDestruction *>(piece);
-                                                    queen->massDestruction(selectedPiece, pieces, board);
-                                                    playerMadeMove = true;
-                                                }
-
-                                                // Erase the captured piece
-                                                if (Piece *piece = it->get())
-                                                {
-                                                    it = pieces.erase(it); // Properly erase and reassign iterator
-                                                }
-                                                // playerMadeMove = true;
-                                            }
-                                            else
-                                            {
-                                                ++it; // Increment iterator only when not erasing
-                                            }
-                                        }
-                                    }
-
-                                    necroPawn.sacrifice(pieces);
+                                    necroPawn.sacrifice(pieces, offerRevival);
                                     playerMadeMove = true;
                                     pieceSelected = false;
                                     selectedPiece = nullptr;
 
                                     // Clear all highlights after sacrifice
-                                    for (int r = 0; r < BOARD_SIZE; ++r)
-                                    {
-                                        for (int c = 0; c < BOARD_SIZE; ++c)
-                                        {
-                                            board[r][c].setHighlight(false);
-                                        }
-                                    }
+                                    board.clearHighlights();
 
                                     // Switch turn after the sacrifice
                                     // isWhiteTurn = !isWhiteTurn;
 
-                                    // Reset the stunned state of all pieces of the current player
-                                    for (auto &piece : pieces)
-                                    {
-                                        if ((isWhiteTurn && piece->getColor() == Piece::Color::Black) ||
-                                            (!isWhiteTurn && piece->getColor() == Piece::Color::White))
-                                        {
-                                            piece->setStunned(false);
-                                        }
-                                    }
-
-                                    for (auto &piece : pieces)
-                                    {
-                                        auto queenOfDomination = dynamic_cast<QueenOfDomination *>(piece.get());
-                                        if (queenOfDomination && queenOfDomination->originalType != "QueenOfDomination")
-                                        {
-                                            queenOfDomination->returnOriginalSprite(pieces, textureManager);
-                                            playerMadeMove = true;
-                                        }
-                                    }
-
                                     /*
                                                         turnIndicator.setString(isWhiteTurn ? "White's Turn" : "Black's Turn");
                                                         turnIndicator.setFillColor(sf::Color::White);
@@ -700,13 +718,7 @@ void Game::runChessGame(sf::RenderWindow &window, std::unique_ptr<sf::TcpSocket>
                                 else
                                 {
                                     // Clear all highlights
-                                    for (int r = 0; r < BOARD_SIZE; ++r)
-                                    {
-                                        for (int c = 0; c < BOARD_SIZE; ++c)
-                                        {
-                                            board[r][c].setHighlight(false);
-                                        }
-                                    }
+                                    board.clearHighlights();
                                     // Reset selected state
                                     pieceSelected = false;
                                     selectedPiece = nullptr;
@@ -717,27 +729,9 @@ void Game::runChessGame(sf::RenderWindow &window, std::unique_ptr<sf::TcpSocket>
                                 auto queen = dynamic_cast<QueenOfDomination *>(selectedPiece);
 
                                 // First, check if any non-highlighted friendly unit is clicked
-                                bool clickedNonHighlighted = false;
-
-                                for (auto &row : board)
-                                {
-                                    for (auto &square : row)
-                                    {
-                                        // Simplified comparison by directly converting Piece::Color to sf::Color
-                                        sf::Color pieceColor = (selectedPiece->getColor() == Piece::Color::White) ? sf::Color::White : sf::Color::Black;
-
-                                        if (!square.getHighlight() && pieceColor == square.getShape().getFillColor())
-                                        {
-                                            clickedNonHighlighted = true;
-                                            break; // Exit the loop if a non-highlighted square is found
-                                        }
-                                    }
-
-                                    if (clickedNonHighlighted)
-                                    {
-                                        break; // Exit the outer loop if condition is met
-                                    }
-                                }
+                                // Simplified comparison by directly converting Piece::Color to sf::Color
+                                sf::Color pieceColor = (selectedPiece->getColor() == Piece::Color::White) ? sf::Color::White : sf::Color::Black;
+                                bool clickedNonHighlighted = (board.squaresFilled(pieceColor) & ~board.highlighted()) != 0;
 
                                 if (clickedNonHighlighted)
                                 {
@@ -750,8 +744,12 @@ void Game::runChessGame(sf::RenderWindow &window, std::unique_ptr<sf::TcpSocket>
                                 }
                                 else
                                 {
-                                    // Toggle highlights when clicking the QueenOfDomination again
+                                    // Toggle highlights when clicking the QueenOfDomination again; while they show, the next click picks the target
                                     queen->toggleAdjacentFriendlyHighlights(board, pieces);
+                                    if (board.highlighted())
+                                    {
+                                        pending.start(PendingAction::Kind::DominationTarget, piecePool.handleOf(queen));
+                                    }
                                 }
                             }
 
@@ -762,16 +760,10 @@ void Game::runChessGame(sf::RenderWindow &window, std::unique_ptr<sf::TcpSocket>
                                          (!isWhiteTurn && selectedPiece->getColor() == Piece::Color::Black))
                             {
                                 auto &familiar = static_cast<Familiar &>(*selectedPiece);
-                                familiar.setStone(true);
+                                effects.schedule(EffectScheduler::Effect::Stone, familiar, EffectScheduler::UntilCancelled);
 
                                 // Clear all highlights after turned to stone
-                                for (int r = 0; r < BOARD_SIZE; ++r)
-                                {
-                                    for (int c = 0; c < BOARD_SIZE; ++c)
-                                    {
-                                        board[r][c].setHighlight(false);
-                                    }
-                                }
+                                board.clearHighlights();
 
                                 std::cout << "Familiar isStone: (" << familiar.isStone() << ")\n";
                                 // Switch turn after the sacrifice
@@ -780,26 +772,6 @@ void Game::runChessGame(sf::RenderWindow &window, std::unique_ptr<sf::TcpSocket>
                                 selectedPiece = nullptr;
                                 playerMadeMove = true;
 
-                                // Reset the stunned state of all pieces of the current player
-                                for (auto &piece : pieces)
-                                {
-                                    if ((isWhiteTurn && piece->getColor() == Piece::Color::Black) ||
-                                        (!isWhiteTurn && piece->getColor() == Piece::Color::White))
-                                    {
-                                        piece->setStunned(false);
-                                    }
-                                }
-
-                                for (auto &piece : pieces)
-                                {
-                                    auto queenOfDomination = dynamic_cast<QueenOfDomination *>(piece.get());
-                                    if (queenOfDomination && queenOfDomination->originalType != "QueenOfDomination")
-                                    {
-                                        queenOfDomination->returnOriginalSprite(pieces, textureManager);
-                                        playerMadeMove = true;
-                                    }
-                                }
-
                                 /*
                                                         turnIndicator.setString(isWhiteTurn ? "White's Turn" : "Black's Turn");
                                                         turnIndicator.setFillColor(sf::Color::White);
@@ -816,26 +788,23 @@ void Game::runChessGame(sf::RenderWindow &window, std::unique_ptr<sf::TcpSocket>
 
                             // Portal actions (unload)
                             else if (selectedPiece->getType() == "Portal" && selectedPiece->getColor() == (isWhiteTurn ? Piece::Color::White : Piece::Color::Black) &&
-                                     static_cast<Portal *>(selectedPiece)->pieceLoaded)
+                                     static_cast<Portal *>(selectedPiece)->isLoaded(reserve))
                             {
                                 Portal *portal = static_cast<Portal *>(selectedPiece);
-                                sf::Vector2f portalPosition = portal->getPosition();
 
-                                if (portal->pieceLoaded)
-                                {
-                                    // Set unload highlights
-                                    portal->teleport(window, board, pieces, isWhiteTurn, portals);
-                                    // playerMadeMove = true;
-                                    portal->highlightValidMoves(board, pieces);
-                                }
+                                // Set unload highlights; the next click picks the square
+                                portal->highlightValidUnloadPos(portal->getPosition(), board, pieces);
+                                pending.start(PendingAction::Kind::PortalUnload, piecePool.handleOf(portal));
                             }
 
                             else if (selectedPiece->getType() == "GhoulKing" && selectedPiece->getColor() == (isWhiteTurn ? Piece::Color::White : Piece::Color::Black) &&
-                                     static_cast<GhoulKing *>(selectedPiece)->raisedDead == false && awaitingNecroPawnPlacement == false)
+                                     static_cast<GhoulKing *>(selectedPiece)->raisedDead == false)
                             {
-                                ghoulKing = static_cast<GhoulKing *>(selectedPiece);
-                                sf::Vector2f ghoulPos = selectedPiece->getPosition();
-                                awaitingNecroPawnPlacement = dynamic_cast<GhoulKing *>(selectedPiece)->raiseNecroPawn(ghoulPos, board, pieces, textureManager);
+                                auto ghoulKing = static_cast<GhoulKing *>(selectedPiece);
+                                if (ghoulKing->raiseNecroPawn(ghoulKing->getPosition(), board, pieces, textureManager))
+                                {
+                                    pending.start(PendingAction::Kind::GhoulKingNecroPawn, piecePool.handleOf(ghoulKing));
+                                }
                             }
                             else
                             {
@@ -843,13 +812,7 @@ void Game::runChessGame(sf::RenderWindow &window, std::unique_ptr<sf::TcpSocket>
                                 selectedPiece = nullptr;
 
                                 // Clear all highlights
-                                for (int r = 0; r < BOARD_SIZE; ++r)
-                                {
-                                    for (int c = 0; c < BOARD_SIZE; ++c)
-                                    {
-                                        board[r][c].setHighlight(false);
-                                    }
-                                }
+                                board.clearHighlights();
                             }
                         }
                         else
@@ -865,8 +828,8 @@ void Game::runChessGame(sf::RenderWindow &window, std::unique_ptr<sf::TcpSocket>
                                         sf::Vector2f deadLauncherPosition = deadLauncher->getPosition();
 
                                         // Check if the clicked piece is adjacent to the DeadLauncher
-                                        int col = deadLauncherPosition.x / TILE_SIZE;
-                                        int row = deadLauncherPosition.y / TILE_SIZE;
+                                        int col = tileIndex(deadLauncherPosition.x);
+                                        int row = tileIndex(deadLauncherPosition.y);
 
                                         for (const auto &dir : deadLauncher->directions)
                                         {
@@ -883,13 +846,7 @@ void Game::runChessGame(sf::RenderWindow &window, std::unique_ptr<sf::TcpSocket>
                                                     deadLauncher->pawnLoaded = true;
 
                                                     // Clear all highlights after turned to stone
-                                                    for (int r = 0; r < BOARD_SIZE; ++r)
-                                                    {
-                                                        for (int c = 0; c < BOARD_SIZE; ++c)
-                                                        {
-                                                            board[r][c].setHighlight(false);
-                                                        }
-                                                    }
+                                                    board.clearHighlights();
 
                                                     deadLauncher->highlightValidMoves(board, pieces);
                                                 }
@@ -903,52 +860,24 @@ void Game::runChessGame(sf::RenderWindow &window, std::unique_ptr<sf::TcpSocket>
                                 }
                                 else if (selectedPiece->getType() == "QueenOfDomination" && selectedPiece->getColor() == (isWhiteTurn ? Piece::Color::White : Piece::Color::Black))
                                 {
-                                    // Check if the clicked position corresponds to a highlighted square
-                                    bool isHighlighted = false;
-                                    const sf::Vector2f clickedPosition = clickedPiece->getPosition();
+                                    // Domination targets are picked through the pending action, so a friendly piece clicked
+                                    // here is not one of them and only drops the selection
                                     auto queen = dynamic_cast<QueenOfDomination *>(selectedPiece);
-
-                                    for (const auto &row : board)
-                                    {
-                                        for (const auto &square : row)
-                                        {
-                                            if (square.getPosition() == clickedPosition)
-                                            {
-                                                if (square.getHighlight())
-                                                {
-                                                    isHighlighted = true;
-                                                    break; // Breaks out of the inner loop
-                                                }
-                                                else
-                                                {
-                                                    queen->clearHighlights(board);
-                                                }
-                                            }
-                                        }
-                                    }
-
-                                    if (isHighlighted && !queen->hasUsedAbility())
-                                    {
-                                        queen->applyDominationAbility(clickedPiece, pieces, textureManager);
-                                        playerMadeMove = true;
-
-                                        // Clear highlights
-                                        clearSelection(board);
-                                    }
+                                    queen->clearHighlights(board);
 
                                     pieceSelected = false;
                                 }
 
                                 else if (selectedPiece->getType() == "Portal" && selectedPiece->getColor() == (isWhiteTurn ? Piece::Color::White : Piece::Color::Black) &&
-                                         static_cast<Portal *>(selectedPiece)->pieceLoaded == false)
+                                         !static_cast<Portal *>(selectedPiece)->isLoaded(reserve))
                                 {
                                     Portal *portal = static_cast<Portal *>(selectedPiece);
                                     sf::Vector2f clickedPiecePosition = clickedPiece->getPosition();
                                     sf::Vector2f portalPosition = portal->getPosition();
 
                                     // Check if the clicked piece is adjacent to the Portal
-                                    int col = portalPosition.x / TILE_SIZE;
-                                    int row = portalPosition.y / TILE_SIZE;
+                                    int col = tileIndex(portalPosition.x);
+                                    int row = tileIndex(portalPosition.y);
 
                                     for (const auto &dir : portal->directions)
                                     {
@@ -958,24 +887,25 @@ void Game::runChessGame(sf::RenderWindow &window, std::unique_ptr<sf::TcpSocket>
                                         // Check if the clicked piece's position matches any adjacent position
                                         if (clickedPiecePosition == sf::Vector2f(newCol * TILE_SIZE, newRow * TILE_SIZE))
                                         {
-                                            if (!portal->pieceLoaded)
+                                            if (effects.isPending(EffectScheduler::Effect::Domination, clickedPiece->getId()))
                                             {
-                                                portal->captureWithPortals(clickedPiecePosition, pieces, portals, board);
-                                                // playerMadeMove = true;
-                                                std::cout << "Piece is loaded into the portal!" << std::endl;
-
-                                                for (int r = 0; r < BOARD_SIZE; ++r)
-                                                {
-                                                    for (int c = 0; c < BOARD_SIZE; ++c)
-                                                    {
-                                                        board[r][c].setHighlight(false);
-                                                    }
-                                                }
+                                                // The piece would miss its reversion inside the portal
+                                                std::cout << "A dominated piece cannot enter a portal." << std::endl;
                                             }
-                                            else
+                                            else if (portal->isLoaded(reserve))
                                             {
                                                 std::cout << "Piece is already loaded." << std::endl;
                                             }
+                                            else if (clickedPiece->getColor() == portal->getColor() && Portal::canEnter(*clickedPiece))
+                                            {
+                                                // A stun has nothing to hold inside the portal
+                                                effects.cancel(EffectScheduler::Effect::Stun, *clickedPiece);
+                                                portal->captureWithPortals(clickedPiecePosition, pieces, reserve, board);
+                                                // playerMadeMove = true;
+                                                std::cout << "Piece is loaded into the portal!" << std::endl;
+
+                                                board.clearHighlights();
+                                            }
                                             portal->highlightValidMoves(board, pieces);
                                             break;
                                         }
@@ -998,16 +928,6 @@ void Game::runChessGame(sf::RenderWindow &window, std::unique_ptr<sf::TcpSocket>
                                         // Switch turn after swapping
                                         // isWhiteTurn = !isWhiteTurn;
 
-                                        for (auto &piece : pieces)
-                                        {
-                                            auto queenOfDomination = dynamic_cast<QueenOfDomination *>(piece.get());
-                                            if (queenOfDomination && queenOfDomination->originalType != "QueenOfDomination")
-                                            {
-                                                queenOfDomination->returnOriginalSprite(pieces, textureManager);
-                                                playerMadeMove = true;
-                                            }
-                                        }
-
                                         /*
                                                         turnIndicator.setString(isWhiteTurn ? "White's Turn" : "Black's Turn");
                                                         turnIndicator.setFillColor(sf::Color::White);
@@ -1026,14 +946,8 @@ void Game::runChessGame(sf::RenderWindow &window, std::unique_ptr<sf::TcpSocket>
                                 {
                                     pieceSelected = true;
                                     selectedPiece = clickedPiece;
-                                    for (int r = 0; r < BOARD_SIZE; ++r)
-                                    {
-                                        for (int c = 0; c < BOARD_SIZE; ++c)
-                                        {
-                                            board[r][c].setHighlight(false);
-                                        }
-                                    }
-                                    selectedPiece->highlightValidMoves(board, pieces);
+                                    board.clearHighlights();
+                                    highlightSelection(board, legalMoves, *selectedPiece, pieces, reserve, isWhiteTurn);
                                 }
                             }
                             else
@@ -1063,38 +977,7 @@ void Game::runChessGame(sf::RenderWindow &window, std::unique_ptr<sf::TcpSocket>
                                             // Check if the piece is a QueenOfBones
                                             if (targetPiece->getType() == "QueenOfBones")
                                             {
-                                                auto queen = static_cast<QueenOfBones *>(targetPiece);
-                                                // Call the revive method if the piece is a QueenOfBones
-                                                std::vector<Piece *> sacrificablePawns = queen->revive(pieces);
-
-                                                // If there are not enough pawns to sacrifice, the revive cannot occur
-                                                if (sacrificablePawns.size() < 2)
-                                                {
-                                                    std::cout << "Not enough pawns to sacrifice. Revive failed." << std::endl;
-                                                }
-                                                else
-                                                {
-                                                    std::cout << "REVIVE QUEENOFBONES?: Select two pawns to sacrifice. ELSE: Select QueenOfBones." << std::endl;
-
-                                                    while (queen->pawnsToSacrifice > 0)
-                                                    {
-                                                        // Implement a mechanism to allow player to select a pawn from the sacrificablePawns vector
-                                                        Piece *selectedPawn = playerSelectPawn(window, sacrificablePawns, board, pieces, *queen);
-
-                                                        if (selectedPawn != nullptr)
-                                                        {
-                                                            queen->handlePawnSacrifice(selectedPawn, pieces); // Pass the selected pawn for sacrifice
-                                                        }
-                                                    }
-                                                    if (queen->pawnsToSacrifice == 0)
-                                                    {
-                                                        // Attempt to respawn the QueenOfBones
-                                                        queen->respawnAtOriginalPosition(pieces, textureManager);
-                                                    }
-
-                                                    // Reset pawnsToSacrifice
-                                                    queen->pawnsToSacrifice = 2;
-                                                }
+                                                offerRevival(*static_cast<QueenOfBones *>(targetPiece));
                                                 playerMadeMove = true;
                                             }
 
@@ -1102,14 +985,18 @@ void Game::runChessGame(sf::RenderWindow &window, std::unique_ptr<sf::TcpSocket>
                                             else if (targetPiece->getType() == "QueenOfDestruction" && selectedPiece->getType() != "HellPawn")
                                             {
                                                 auto queen = static_cast<QueenOfDestruction *>(targetPiece);
-                                                queen->massDestruction(selectedPiece, pieces, board);
+                                                queen->massDestruction(selectedPiece, pieces, offerRevival);
                                                 playerMadeMove = true;
                                             }
 
                                             else if (selectedPiece->getType() == "HellPawn")
                                             {
                                                 auto hellPawn = static_cast<HellPawn *>(selectedPiece);
-                                                hellPawn->infect(targetPiece, pieces, board, textureManager);
+                                                hellPawn->infect(targetPiece, pieces, board, context);
+                                                if (hellPawn->toBeRemoved)
+                                                {
+                                                    effects.schedule(EffectScheduler::Effect::Removal, *hellPawn, 0);
+                                                }
                                                 playerMadeMove = true;
                                             }
 
@@ -1124,16 +1011,13 @@ void Game::runChessGame(sf::RenderWindow &window, std::unique_ptr<sf::TcpSocket>
                                         if (selectedPiece->getType() == "Necromancer")
                                         {
                                             // Clear highlights before entering raiseDead
-                                            for (int r = 0; r < BOARD_SIZE; ++r)
+                                            board.clearHighlights();
+                                            // Necromancer raises dead
+                                            auto necromancer = static_cast<Necromancer *>(selectedPiece);
+                                            if (necromancer->raiseDead(targetPosition, board, pieces, textureManager))
                                             {
-                                                for (int c = 0; c < BOARD_SIZE; ++c)
-                                                {
-                                                    board[r][c].setHighlight(false);
-                                                }
+                                                pending.start(PendingAction::Kind::NecromancerPawn, piecePool.handleOf(necromancer));
                                             }
-                                            // Necromancer raises dead
-                                            necromancer = static_cast<Necromancer *>(selectedPiece);
-                                            awaitingPawnPlacement = necromancer->raiseDead(targetPosition, board, pieces, textureManager);
                                         }
                                         else if (selectedPiece->getType() == "Prowler")
                                         {
@@ -1146,15 +1030,9 @@ void Game::runChessGame(sf::RenderWindow &window, std::unique_ptr<sf::TcpSocket>
                                     selectedPiece = nullptr;
 
                                     // Clear all highlights except those related to awaiting pawn placement
-                                    if (!awaitingPawnPlacement)
+                                    if (!pending.isActive())
                                     {
-                                        for (int r = 0; r < BOARD_SIZE; ++r)
-                                        {
-                                            for (int c = 0; c < BOARD_SIZE; ++c)
-                                            {
-                                                board[r][c].setHighlight(false);
-                                            }
-                                        }
+                                        board.clearHighlights();
                                     }
                                     if (canCapture)
                                     {
@@ -1164,26 +1042,6 @@ void Game::runChessGame(sf::RenderWindow &window, std::unique_ptr<sf::TcpSocket>
                                             // isWhiteTurn = !isWhiteTurn;
                                         }
 
-                                        // Reset the stunned state of all pieces of the current player
-                                        for (auto &piece : pieces)
-                                        {
-                                            if ((isWhiteTurn && piece->getColor() == Piece::Color::Black) ||
-                                                (!isWhiteTurn && piece->getColor() == Piece::Color::White))
-                                            {
-                                                piece->setStunned(false);
-                                            }
-                                        }
-
-                                        for (auto &piece : pieces)
-                                        {
-                                            auto queenOfDomination = dynamic_cast<QueenOfDomination *>(piece.get());
-                                            if (queenOfDomination && queenOfDomination->originalType != "QueenOfDomination")
-                                            {
-                                                queenOfDomination->returnOriginalSprite(pieces, textureManager);
-                                                playerMadeMove = true;
-                                            }
-                                        }
-
                                         /*
                                                         turnIndicator.setString(isWhiteTurn ? "White's Turn" : "Black's Turn");
                                                         turnIndicator.setFillColor(sf::Color::White);
@@ -1201,7 +1059,7 @@ void Game::runChessGame(sf::RenderWindow &window, std::unique_ptr<sf::TcpSocket>
                             }
                         }
                     }
-                    else if (pieceSelected && awaitingNecroPawnPlacement == false)
+                    else if (pieceSelected)
                     {
                         sf::Vector2f targetPosition = sf::Vector2f(col * TILE_SIZE, row * TILE_SIZE);
 
@@ -1227,38 +1085,7 @@ void Game::runChessGame(sf::RenderWindow &window, std::unique_ptr<sf::TcpSocket>
                                     // Check if the piece is a QueenOfBones
                                     if (targetPiece->getType() == "QueenOfBones")
                                     {
-                                        auto queen = static_cast<QueenOfBones *>(targetPiece);
-                                        // Call the revive method if the piece is a QueenOfBones
-                                        std::vector<Piece *> sacrificablePawns = queen->revive(pieces);
-
-                                        // If there are not enough pawns to sacrifice, the revive cannot occur
-                                        if (sacrificablePawns.size() < 2)
-                                        {
-                                            std::cout << "Not enough pawns to sacrifice. Revive failed." << std::endl;
-                                        }
-                                        else
-                                        {
-                                            std::cout << "REVIVE QUEENOFBONES?: Select two pawns to sacrifice. ELSE: Select QueenOfBones." << std::endl;
-
-                                            while (queen->pawnsToSacrifice > 0)
-                                            {
-                                                // Implement a mechanism to allow player to select a pawn from the sacrificablePawns vector
-                                                Piece *selectedPawn = playerSelectPawn(window, sacrificablePawns, board, pieces, *queen);
-
-                                                if (selectedPawn != nullptr)
-                                                {
-                                                    queen->handlePawnSacrifice(selectedPawn, pieces); // Pass the selected pawn for sacrifice
-                                                }
-                                            }
-                                            if (queen->pawnsToSacrifice == 0)
-                                            {
-                                                // Attempt to respawn the QueenOfBones
-                                                queen->respawnAtOriginalPosition(pieces, textureManager);
-                                            }
-
-                                            // Reset pawnsToSacrifice
-                                            queen->pawnsToSacrifice = 2;
-                                        }
+                                        offerRevival(*static_cast<QueenOfBones *>(targetPiece));
                                         playerMadeMove = true;
                                     }
 
@@ -1266,7 +1093,7 @@ void Game::runChessGame(sf::RenderWindow &window, std::unique_ptr<sf::TcpSocket>
                                     else if (targetPiece->getType() == "QueenOfDestruction")
                                     {
                                         auto queen = static_cast<QueenOfDestruction *>(targetPiece);
-                                        queen->massDestruction(selectedPiece, pieces, board);
+                                        queen->massDestruction(selectedPiece, pieces, offerRevival);
                                         playerMadeMove = true;
                                     }
 
@@ -1277,16 +1104,13 @@ void Game::runChessGame(sf::RenderWindow &window, std::unique_ptr<sf::TcpSocket>
                                 if (selectedPiece->getType() == "Necromancer")
                                 {
                                     // Clear highlights before entering raiseDead
-                                    for (int r = 0; r < BOARD_SIZE; ++r)
+                                    board.clearHighlights();
+                                    // Necromancer raises dead
+                                    auto necromancer = static_cast<Necromancer *>(selectedPiece);
+                                    if (necromancer->raiseDead(targetPosition, board, pieces, textureManager))
                                     {
-                                        for (int c = 0; c < BOARD_SIZE; ++c)
-                                        {
-                                            board[r][c].setHighlight(false);
-                                        }
+                                        pending.start(PendingAction::Kind::NecromancerPawn, piecePool.handleOf(necromancer));
                                     }
-                                    // Necromancer raises dead
-                                    necromancer = static_cast<Necromancer *>(selectedPiece);
-                                    awaitingPawnPlacement = necromancer->raiseDead(targetPosition, board, pieces, textureManager);
                                 }
                                 else if (selectedPiece->getType() == "Prowler")
                                 {
@@ -1300,7 +1124,7 @@ void Game::runChessGame(sf::RenderWindow &window, std::unique_ptr<sf::TcpSocket>
                                         if (canCapture)
                                         {
                                             ghostKnight = static_cast<GhostKnight *>(selectedPiece);
-                                            ghostKnight->stunAdjacentEnemies(targetPosition, pieces, board);
+                                            ghostKnight->stunAdjacentEnemies(targetPosition, pieces, effects);
                                         }
                                     }
                                 }
@@ -1318,58 +1142,22 @@ void Game::runChessGame(sf::RenderWindow &window, std::unique_ptr<sf::TcpSocket>
                                     if (targetPosition.x == currentPosition.x && std::abs(targetPosition.y - currentPosition.y) == 2 * TILE_SIZE)
                                     {
                                         sf::Vector2f hoppedPosition = sf::Vector2f(currentPosition.x, currentPosition.y + direction * TILE_SIZE);
-                                        for (const auto &piecePtr : pieces)
+                                        Piece *piece = getPieceAtPosition(hoppedPosition, pieces);
+                                        if (piece && piece->getColor() != pawnHopper->getColor())
                                         {
-                                            Piece *piece = piecePtr.get(); // Access the raw pointer from std::unique_ptr
-
-                                            if (piece->getPosition() == hoppedPosition && piece->getColor() != pawnHopper->getColor())
+                                            // Check if the piece is a QueenOfBones
+                                            if (piece->getType() == "QueenOfBones")
                                             {
-                                                // Check if the piece is a QueenOfBones
-                                                if (piece->getType() == "QueenOfBones")
-                                                {
-                                                    auto queen = static_cast<QueenOfBones *>(piece);
-                                                    // Call the revive method if the piece is a QueenOfBones
-                                                    std::vector<Piece *> sacrificablePawns = queen->revive(pieces);
-
-                                                    // If there are not enough pawns to sacrifice, the revive cannot occur
-                                                    if (sacrificablePawns.size() < 2)
-                                                    {
-                                                        std::cout << "Not enough pawns to sacrifice. Revive failed." << std::endl;
-                                                    }
-                                                    else
-                                                    {
-                                                        std::cout << "REVIVE QUEENOFBONES?: Select two pawns to sacrifice. ELSE: Select QueenOfBones." << std::endl;
-
-                                                        while (queen->pawnsToSacrifice > 0)
-                                                        {
-                                                            // Implement a mechanism to allow player to select a pawn from the sacrificablePawns vector
-                                                            Piece *selectedPawn = playerSelectPawn(window, sacrificablePawns, board, pieces, *queen);
-
-                                                            if (selectedPawn != nullptr)
-                                                            {
-                                                                queen->handlePawnSacrifice(selectedPawn, pieces); // Pass the selected pawn for sacrifice
-                                                            }
-                                                        }
-                                                        if (queen->pawnsToSacrifice == 0)
-                                                        {
-                                                            // Attempt to respawn the QueenOfBones
-                                                            queen->respawnAtOriginalPosition(pieces, textureManager);
-                                                        }
-
-                                                        // Reset pawnsToSacrifice
-                                                        queen->pawnsToSacrifice = 2;
-                                                        break;
-                                                    }
-                                                    playerMadeMove = true;
-                                                }
+                                                offerRevival(*static_cast<QueenOfBones *>(piece));
+                                                playerMadeMove = true;
+                                            }
 
-                                                // Check it killed piece if QueenOfDestruction (activate massDestruction)
-                                                else if (piece->getType() == "QueenOfDestruction")
-                                                {
-                                                    auto queen = static_cast<QueenOfDestruction *>(piece);
-                                                    queen->massDestruction(selectedPiece, pieces, board);
-                                                    playerMadeMove = true;
-                                                }
+                                            // Check it killed piece if QueenOfDestruction (activate massDestruction)
+                                            else if (piece->getType() == "QueenOfDestruction")
+                                            {
+                                                auto queen = static_cast<QueenOfDestruction *>(piece);
+                                                queen->massDestruction(selectedPiece, pieces, offerRevival);
+                                                playerMadeMove = true;
                                             }
                                         }
                                         // Capture the hopped piece
@@ -1388,22 +1176,16 @@ void Game::runChessGame(sf::RenderWindow &window, std::unique_ptr<sf::TcpSocket>
                                 if (selectedPiece->getType() == "GhostKnight")
                                 {
                                     ghostKnight = static_cast<GhostKnight *>(selectedPiece);
-                                    ghostKnight->stunAdjacentEnemies(targetPosition, pieces, board);
+                                    ghostKnight->stunAdjacentEnemies(targetPosition, pieces, effects);
                                 }
                             }
                             pieceSelected = false;
                             selectedPiece = nullptr;
 
                             // Clear all highlights except those related to awaiting pawn placement
-                            if (!awaitingPawnPlacement)
+                            if (!pending.isActive())
                             {
-                                for (int r = 0; r < BOARD_SIZE; ++r)
-                                {
-                                    for (int c = 0; c < BOARD_SIZE; ++c)
-                                    {
-                                        board[r][c].setHighlight(false);
-                                    }
-                                }
+                                board.clearHighlights();
                             }
                             if (canCapture)
                             {
@@ -1413,24 +1195,6 @@ void Game::runChessGame(sf::RenderWindow &window, std::unique_ptr<sf::TcpSocket>
                                     // isWhiteTurn = !isWhiteTurn;
                                 }
 
-                                // Reset the stunned state of all pieces of the current player
-                                for (auto &piece : pieces)
-                                {
-                                    if ((isWhiteTurn && piece->getColor() == Piece::Color::Black) ||
-                                        (!isWhiteTurn && piece->getColor() == Piece::Color::White))
-                                    {
-                                        piece->setStunned(false);
-                                    }
-                                }
-                                for (auto &piece : pieces)
-                                {
-                                    auto queenOfDomination = dynamic_cast<QueenOfDomination *>(piece.get());
-                                    if (queenOfDomination && queenOfDomination->originalType != "QueenOfDomination")
-                                    {
-                                        queenOfDomination->returnOriginalSprite(pieces, textureManager);
-                                        playerMadeMove = true;
-                                    }
-                                }
                                 /*
                                                                 turnIndicator.setString(prowlerNeedsAdditionalMove ? "Prowler can move again" : (isWhiteTurn ? "White's Turn" : "Black's Turn"));
                                                                 turnIndicator.setFillColor(sf::Color::White);
@@ -1455,15 +1219,6 @@ void Game::runChessGame(sf::RenderWindow &window, std::unique_ptr<sf::TcpSocket>
             }
         }
 
-        // Code to remove pieces marked for removal
-        pieces.erase(std::remove_if(pieces.begin(), pieces.end(),
-                                    [](const std::unique_ptr<Piece> &piece)
-                                    {
-                                        auto hellPawn = dynamic_cast<HellPawn *>(piece.get());
-                                        return hellPawn && hellPawn->toBeRemoved;
-                                    }),
-                     pieces.end());
-
         // Fade out the turn indicator
         if (showTurnIndicator && turnIndicatorClock.getElapsedTime() > turnIndicatorDisplayTime)
         {
@@ -1476,13 +1231,38 @@ void Game::runChessGame(sf::RenderWindow &window, std::unique_ptr<sf::TcpSocket>
             }
         }
 
+        // Start a new hint search whenever the selection changes; the search never blocks this loop
+        Piece *hintTarget = (hintMode && pieceSelected) ? selectedPiece : nullptr;
+        if (piecePool.handleOf(hintTarget) != hintedPiece)
+        {
+            hintedPiece = piecePool.handleOf(hintTarget);
+            if (hintTarget && hintTarget->getColor() == (isWhiteTurn ? Piece::Color::White : Piece::Color::Black))
+            {
+                hintEngine.request(positionFromPieces(pieces, reserve, isWhiteTurn), squareFromPixels(hintTarget->getPosition()), hintTimeMs);
+            }
+            else
+            {
+                hintEngine.cancel();
+            }
+        }
+
         window.clear();
-        drawChessboard(window, board);
+        boardLayer.draw(window, board);
         for (const auto &piece : pieces)
         {
             window.draw(piece->getSprite());
         }
 
+        engine::HintSnapshot hint = hintEngine.snapshot();
+        if (!hint.valid)
+        {
+            hint = engineSuggestion;
+        }
+        if (hintMode && hint.valid)
+        {
+            drawHint(window, hint, font);
+        }
+
         if (showTurnIndicator)
         {
             // Center the turn indicator
@@ -1494,4 +1274,8 @@ void Game::runChessGame(sf::RenderWindow &window, std::unique_ptr<sf::TcpSocket>
 
         window.display();
     }
+
+    const PiecePool::Counters &poolCounters = piecePool.getCounters();
+    std::cout << "Piece pool: " << poolCounters.allocations << " allocations, " << poolCounters.releases << " releases, peak "
+              << poolCounters.peak << " in " << poolCounters.blocks << (poolCounters.blocks == 1 ? " block" : " blocks") << std::endl;
 }
\ No newline at end of file
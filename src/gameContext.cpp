@@ -0,0 +1,28 @@
+// Filename: gameContext.cpp
+// Description: Implementation of the GameContext class, which holds the state of one game that used to be global.
+
+// Main Classes:
+// - GameContext: The local player's side, the piece ID counter, the texture set and the settings of one game.
+
+// Main Functions:
+// - GameContext::GameContext(TextureManager &textures, Piece::Color playerColor, const GameSettings &settings):
+//   Starts a game's IDs at 0 for the given side.
+// - int GameContext::nextId(): Hands out the next piece ID of this game.
+// - void GameContext::observeId(int id): Skips the counter past an ID received from the opponent.
+
+// Special Features or Notes:
+// - Nothing in a context is shared with another game except the TextureManager, which games only read from.
+// - Piece IDs are what network packets match pieces by, so they must come out in the same order on both players'
+//   machines; a per-game counter keeps that true however many games a process has played before.
+// - A piece the opponent spawns arrives with their ID, which the local counter has not handed out; receivePacket
+//   passes every received ID to observeId so the next local spawn does not get it a second time.
+
+// Usage or Context:
+// - Created by Game::runChessGame and passed to createPieces, pushPawn, pushNecroPawn and HellPawn::infect.
+
+#include "gameContext.h"
+
+GameContext::GameContext(TextureManager &textures, Piece::Color playerColor, const GameSettings &settings)
+    : textures(textures), playerColor(playerColor), settings(settings)
+{
+}
@@ -7,10 +7,10 @@
 // Main Functions:
 // - bool GhostKnight::canMoveTo(const sf::Vector2f &target, const std::vector<std::unique_ptr<Piece>> &pieces) const:
 //   Checks if the GhostKnight can legally move to the specified target position on the chessboard.
-// - void GhostKnight::highlightValidMoves(std::vector<std::vector<Square>> &board, const std::vector<std::unique_ptr<Piece>> &pieces) const:
+// - void GhostKnight::highlightValidMoves(Board &board, const std::vector<std::unique_ptr<Piece>> &pieces) const:
 //   Highlights all valid moves for the GhostKnight on the provided chessboard, considering its current position and game rules.
-// - void GhostKnight::stunAdjacentEnemies(const sf::Vector2f &position, std::vector<std::unique_ptr<Piece>> &pieces, std::vector<std::vector<Square>> &board)
-//   logic stun enemu units in the perimeter of the target position.
+// - void GhostKnight::stunAdjacentEnemies(const sf::Vector2f &position, std::vector<std::unique_ptr<Piece>> &pieces, EffectScheduler &effects)
+//   logic stun enemu units in the perimeter of the target position through AreaEffect; the scheduler lifts the stun again.
 
 // Special Features or Notes:
 // - The GhostKnight is a level 2 Knight piece that belongs to the Necromancer Guild.
@@ -29,7 +29,8 @@
 #include "ghostKnight.h"
 #include "utility.h"
 #include "globals.h"
-#include "square.h"
+#include "board.h"
+#include "areaEffect.h"
 #include <vector>
 #include <iostream>
 
@@ -49,8 +50,9 @@ bool GhostKnight::canMoveTo(const sf::Vector2f &target, const std::vector<std::u
 }
 
 // Highlight valid moves for the GhostKnight on the provided board
-void GhostKnight::highlightValidMoves(std::vector<std::vector<Square>> &board, const std::vector<std::unique_ptr<Piece>> &pieces) const
+void GhostKnight::highlightValidMoves(Board &board, const std::vector<std::unique_ptr<Piece>> &pieces) const
 {
+    Board::Highlights highlights;
     sf::Vector2f currentPosition = getPosition();
 
     // Define all possible move positions for the GhostKnight
@@ -67,44 +69,30 @@ void GhostKnight::highlightValidMoves(std::vector<std::vector<Square>> &board, c
     // Iterate through each possible move and highlight valid moves on the board
     for (const auto &move : moves)
     {
-        int col = move.x / TILE_SIZE;
-        int row = move.y / TILE_SIZE;
+        int col = tileIndex(move.x);
+        int row = tileIndex(move.y);
 
         // space is occupied by an opponent piece
         if (col >= 0 && col < BOARD_SIZE && row >= 0 && row < BOARD_SIZE && canMoveTo(move, pieces) && isOpponentPiece(move, pieces, getColor()))
         {
-            board[row][col].setHighlight(true, sf::Color::Red);
+            highlights.captures |= Board::squareMask(row, col);
         }
         // space is unoccupied
         else if (col >= 0 && col < BOARD_SIZE && row >= 0 && row < BOARD_SIZE && canMoveTo(move, pieces))
         {
-            board[row][col].setHighlight(true);
+            highlights.moves |= Board::squareMask(row, col);
         }
     }
+    board.highlight(highlights);
 }
 
 // Stuns all enemies in the perimeter of the new target position
-void GhostKnight::stunAdjacentEnemies(const sf::Vector2f &position, std::vector<std::unique_ptr<Piece>> &pieces, std::vector<std::vector<Square>> &board)
+void GhostKnight::stunAdjacentEnemies(const sf::Vector2f &position, std::vector<std::unique_ptr<Piece>> &pieces, EffectScheduler &effects)
 {
-    static const int directions[8][2] = {{-1, -1}, {-1, 0}, {-1, 1}, {0, -1}, {0, 1}, {1, -1}, {1, 0}, {1, 1}};
+    Piece::Color enemy = getColor() == Piece::Color::White ? Piece::Color::Black : Piece::Color::White;
 
-    int col = position.x / TILE_SIZE;
-    int row = position.y / TILE_SIZE;
-
-    for (const auto &dir : directions)
-    {
-        int newRow = row + dir[0];
-        int newCol = col + dir[1];
-
-        if (newRow >= 0 && newRow < BOARD_SIZE && newCol >= 0 && newCol < BOARD_SIZE)
-        {
-            Piece *adjacentPiece = getPieceAtPosition(sf::Vector2f(newCol * TILE_SIZE, newRow * TILE_SIZE), pieces);
-            if (adjacentPiece && adjacentPiece->getColor() != getColor())
-            {
-                std::cout << "Adjacent piece is stunned: (" << adjacentPiece->isStunned() << ")\n";
-                adjacentPiece->setStunned(true);
-                std::cout << "Adjacent piece is stunned: (" << adjacentPiece->isStunned() << ")\n";
-            }
-        }
-    }
-};
\ No newline at end of file
+    AreaEffect area(pieces);
+    AreaEffect::SquareMask stunned = AreaEffect::adjacentSquares(position) & area.occupiedBy(enemy);
+    area.stun(stunned, effects);
+    std::cout << "Adjacent pieces stunned: " << __builtin_popcountll(stunned) << "\n";
+}
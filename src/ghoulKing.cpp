@@ -7,7 +7,7 @@
 // Main Functions:
 // - bool GhoulKing::canMoveTo(const sf::Vector2f &target, const std::vector<std::unique_ptr<Piece>> &pieces) const:
 //   Checks if the GhoulKing can legally move to the specified target position on the chessboard.
-// - void GhoulKing::highlightValidMoves(std::vector<std::vector<Square>> &board, const std::vector<std::unique_ptr<Piece>> &pieces) const:
+// - void GhoulKing::highlightValidMoves(Board &board, const std::vector<std::unique_ptr<Piece>> &pieces) const:
 //   Highlights all valid moves for the GhoulKing on the provided chessboard, considering its current position and game rules.
 // - void GhoulKing::RaiseNecroPawn()
 
@@ -27,7 +27,7 @@
 #include "ghoulKing.h"
 #include "utility.h"
 #include "globals.h"
-#include "square.h"
+#include "board.h"
 #include <vector>
 
 // Determine if the GhoulKing can move to a specified target position
@@ -45,8 +45,9 @@ bool GhoulKing::canMoveTo(const sf::Vector2f &target, const std::vector<std::uni
 }
 
 // Highlight valid moves for the GhoulKing on the provided board
-void GhoulKing::highlightValidMoves(std::vector<std::vector<Square>> &board, const std::vector<std::unique_ptr<Piece>> &pieces) const
+void GhoulKing::highlightValidMoves(Board &board, const std::vector<std::unique_ptr<Piece>> &pieces) const
 {
+    Board::Highlights highlights;
     sf::Vector2f currentPosition = getPosition();
     std::vector<sf::Vector2f> moves = {
         {currentPosition.x, currentPosition.y + TILE_SIZE},
@@ -60,25 +61,27 @@ void GhoulKing::highlightValidMoves(std::vector<std::vector<Square>> &board, con
 
     for (const auto &move : moves)
     {
-        int col = move.x / TILE_SIZE;
-        int row = move.y / TILE_SIZE;
+        int col = tileIndex(move.x);
+        int row = tileIndex(move.y);
 
         // space is occupied by an opponent piece
         if (col >= 0 && col < BOARD_SIZE && row >= 0 && row < BOARD_SIZE && canMoveTo(move, pieces) && isOpponentPiece(move, pieces, getColor()))
         {
-            board[row][col].setHighlight(true, sf::Color::Red);
+            highlights.captures |= Board::squareMask(row, col);
         }
         // space is unoccupied
         else if (col >= 0 && col < BOARD_SIZE && row >= 0 && row < BOARD_SIZE && canMoveTo(move, pieces))
         {
-            board[row][col].setHighlight(true);
+            highlights.moves |= Board::squareMask(row, col);
         }
     }
+    board.highlight(highlights);
 }
 
 // Place a pawn piece in a selected adjacent square
-bool GhoulKing::raiseNecroPawn(const sf::Vector2f &targetPosition, std::vector<std::vector<Square>> &board, std::vector<std::unique_ptr<Piece>> &pieces, TextureManager &textureManager)
+bool GhoulKing::raiseNecroPawn(const sf::Vector2f &targetPosition, Board &board, std::vector<std::unique_ptr<Piece>> &pieces, TextureManager &textureManager)
 {
+    Board::Highlights highlights;
     // raisedDead = true;
     bool awaitingNecroPawnPlacement = false;
     const sf::Texture &pawnTexture = getNecroPawnTexture(textureManager);
@@ -96,13 +99,14 @@ bool GhoulKing::raiseNecroPawn(const sf::Vector2f &targetPosition, std::vector<s
             {
                 awaitingNecroPawnPlacement = true;
                 std::cout << "Made it to after awaitingNecroPawnPlacement: " << awaitingNecroPawnPlacement << std::endl;
-                int col = pos.x / TILE_SIZE;
-                int row = pos.y / TILE_SIZE;
+                int col = tileIndex(pos.x);
+                int row = tileIndex(pos.y);
                 // Highlight the square for pawn placement
-                board[row][col].setHighlight(true, sf::Color::Green);
+                highlights.abilities |= Board::squareMask(row, col);
             }
         }
     }
+    board.highlight(highlights);
     return awaitingNecroPawnPlacement;
 }
 
@@ -7,7 +7,7 @@
 // Main Functions:
 // - bool HellKing::canMoveTo(const sf::Vector2f &target, const std::vector<std::unique_ptr<Piece>> &pieces) const:
 //   Checks if the HellKing can legally move to the specified target position on the chessboard.
-// - void HellKing::highlightValidMoves(std::vector<std::vector<Square>> &board, const std::vector<std::unique_ptr<Piece>> &pieces) const:
+// - void HellKing::highlightValidMoves(Board &board, const std::vector<std::unique_ptr<Piece>> &pieces) const:
 //   Highlights all valid moves for the HellKing on the provided chessboard, considering its current position and game rules.
 
 // Special Features or Notes:
@@ -23,7 +23,7 @@
 #include "hellKing.h"
 #include "utility.h"
 #include "globals.h"
-#include "square.h"
+#include "board.h"
 #include <vector>
 
 // Determine if the HellKing can move to a specified target position
@@ -41,8 +41,9 @@ bool HellKing::canMoveTo(const sf::Vector2f &target, const std::vector<std::uniq
 }
 
 // Highlight valid moves for the HellKing on the provided board
-void HellKing::highlightValidMoves(std::vector<std::vector<Square>> &board, const std::vector<std::unique_ptr<Piece>> &pieces) const
+void HellKing::highlightValidMoves(Board &board, const std::vector<std::unique_ptr<Piece>> &pieces) const
 {
+    Board::Highlights highlights;
     sf::Vector2f currentPosition = getPosition();
     std::vector<sf::Vector2f> moves = {
         {currentPosition.x, currentPosition.y + TILE_SIZE},
@@ -56,28 +57,30 @@ void HellKing::highlightValidMoves(std::vector<std::vector<Square>> &board, cons
 
     for (const auto &move : moves)
     {
-        int col = move.x / TILE_SIZE;
-        int row = move.y / TILE_SIZE;
+        int col = tileIndex(move.x);
+        int row = tileIndex(move.y);
 
         // space is occupied by an opponent piece
         if (col >= 0 && col < BOARD_SIZE && row >= 0 && row < BOARD_SIZE && canMoveTo(move, pieces) && isOpponentPiece(move, pieces, getColor()))
         {
-            board[row][col].setHighlight(true, sf::Color::Red);
+            highlights.captures |= Board::squareMask(row, col);
         }
         // space is unoccupied
         else if (col >= 0 && col < BOARD_SIZE && row >= 0 && row < BOARD_SIZE && canMoveTo(move, pieces))
         {
-            board[row][col].setHighlight(true);
+            highlights.moves |= Board::squareMask(row, col);
         }
     }
+    board.highlight(highlights);
 }
 
 // Highlight potential capture zones for the Beholder on the provided board
-void HellKing::highlightCaptureZones(std::vector<std::vector<Square>> &board, const std::vector<std::unique_ptr<Piece>> &pieces) const
+void HellKing::highlightCaptureZones(Board &board, const std::vector<std::unique_ptr<Piece>> &pieces) const
 {
+    Board::Highlights highlights;
     sf::Vector2f currentPosition = getPosition();
-    int startX = currentPosition.x / TILE_SIZE;
-    int startY = currentPosition.y / TILE_SIZE;
+    int startX = tileIndex(currentPosition.x);
+    int startY = tileIndex(currentPosition.y);
 
     // Define the possible capture positions (dx, dy) where dx and dy are combinations that sum to 3
     std::vector<std::pair<int, int>> captureOffsets =
@@ -97,10 +100,11 @@ void HellKing::highlightCaptureZones(std::vector<std::vector<Square>> &board, co
             // Highlight squares where BoulderThrower can capture opponent's piece
             if (isOpponentPiece(target, pieces, getColor()))
             {
-                board[row][col].setHighlight(true, sf::Color::Red);
+                highlights.captures |= Board::squareMask(row, col);
             }
         }
     }
+    board.highlight(highlights);
 }
 
 // Execute the capture of an opponent piece located at the specified target position
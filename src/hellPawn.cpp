@@ -8,10 +8,10 @@
 // Main Functions:
 // - bool HellPawn::canMoveTo(const sf::Vector2f &target, const std::vector<std::unique_ptr<Piece>> &pieces) const:
 //   Checks if the HellPawn can legally move to the specified target position on the chessboard.
-// - void HellPawn::highlightValidMoves(std::vector<std::vector<Square>> &board, const std::vector<std::unique_ptr<Piece>> &pieces) const:
+// - void HellPawn::highlightValidMoves(Board &board, const std::vector<std::unique_ptr<Piece>> &pieces) const:
 //   Highlights all valid moves for the HellPawn on the provided chessboard, considering its current position and game rules.
-// - void HellPawn::infect(const Piece *capturedPiece, std::vector<std::unique_ptr<Piece>> &pieces, std::vector<std::vector<Square>> &board, TextureManager &textureManager)
-//   Infects the minds of enemy pieces and merges with them to take control.
+// - void HellPawn::infect(const Piece *capturedPiece, std::vector<std::unique_ptr<Piece>> &pieces, Board &board, GameContext &context)
+//   Infects the minds of enemy pieces and merges with them to take control; the new piece gets the next ID of the game.
 
 // Special Features or Notes:
 // - The HellPawn is a Level 2 Pawn piece belonging to the Hellspawn race.
@@ -60,7 +60,7 @@
 #include "pieceFactory.h"
 #include "textureManager.h"
 #include "globals.h"
-#include "square.h"
+#include "board.h"
 #include <vector>
 #include <iostream>
 
@@ -104,8 +104,9 @@ bool HellPawn::canMoveTo(const sf::Vector2f &target, const std::vector<std::uniq
 }
 
 // Highlight valid moves for the HellPawn on the provided board
-void HellPawn::highlightValidMoves(std::vector<std::vector<Square>> &board, const std::vector<std::unique_ptr<Piece>> &pieces) const
+void HellPawn::highlightValidMoves(Board &board, const std::vector<std::unique_ptr<Piece>> &pieces) const
 {
+    Board::Highlights highlights;
     sf::Vector2f currentPosition = getPosition();
     float direction = (getColor() == Piece::Color::White) ? 1.0f : -1.0f; // White moves down, Black moves up
 
@@ -113,7 +114,7 @@ void HellPawn::highlightValidMoves(std::vector<std::vector<Square>> &board, cons
     sf::Vector2f singleStep = sf::Vector2f(currentPosition.x, currentPosition.y + direction * TILE_SIZE);
     if (singleStep.y >= 0 && singleStep.y < BOARD_SIZE * TILE_SIZE && canMoveTo(singleStep, pieces))
     {
-        board[static_cast<int>(singleStep.y / TILE_SIZE)][static_cast<int>(singleStep.x / TILE_SIZE)].setHighlight(true);
+        highlights.moves |= Board::squareMask(tileIndex(singleStep.y), tileIndex(singleStep.x));
     }
 
     // Highlight double step forward on first move
@@ -123,7 +124,7 @@ void HellPawn::highlightValidMoves(std::vector<std::vector<Square>> &board, cons
          (getColor() == Piece::Color::Black && currentPosition.y == 6 * TILE_SIZE)) &&
         canMoveTo(doubleStep, pieces))
     {
-        board[static_cast<int>(doubleStep.y / TILE_SIZE)][static_cast<int>(doubleStep.x / TILE_SIZE)].setHighlight(true);
+        highlights.moves |= Board::squareMask(tileIndex(doubleStep.y), tileIndex(doubleStep.x));
     }
 
     // Highlight diagonal captures
@@ -131,18 +132,21 @@ void HellPawn::highlightValidMoves(std::vector<std::vector<Square>> &board, cons
     if (diagonalLeft.x >= 0 && diagonalLeft.x < BOARD_SIZE * TILE_SIZE && diagonalLeft.y >= 0 && diagonalLeft.y < BOARD_SIZE * TILE_SIZE &&
         canMoveTo(diagonalLeft, pieces))
     {
-        board[static_cast<int>(diagonalLeft.y / TILE_SIZE)][static_cast<int>(diagonalLeft.x / TILE_SIZE)].setHighlight(true, sf::Color::Red);
+        highlights.captures |= Board::squareMask(tileIndex(diagonalLeft.y), tileIndex(diagonalLeft.x));
     }
 
     sf::Vector2f diagonalRight = sf::Vector2f(currentPosition.x + TILE_SIZE, currentPosition.y + direction * TILE_SIZE);
     if (diagonalRight.x >= 0 && diagonalRight.x < BOARD_SIZE * TILE_SIZE && diagonalRight.y >= 0 && diagonalRight.y < BOARD_SIZE * TILE_SIZE &&
         canMoveTo(diagonalRight, pieces))
     {
-        board[static_cast<int>(diagonalRight.y / TILE_SIZE)][static_cast<int>(diagonalRight.x / TILE_SIZE)].setHighlight(true, sf::Color::Red);
+        highlights.captures |= Board::squareMask(tileIndex(diagonalRight.y), tileIndex(diagonalRight.x));
     }
+    board.highlight(highlights);
 }
-void HellPawn::infect(const Piece *capturedPiece, std::vector<std::unique_ptr<Piece>> &pieces, std::vector<std::vector<Square>> &board, TextureManager &textureManager)
+void HellPawn::infect(const Piece *capturedPiece, std::vector<std::unique_ptr<Piece>> &pieces, Board &board, GameContext &context)
 {
+    TextureManager &textureManager = context.getTextures();
+
     // Check if the captured piece is not a 'pawn' type
     if (dynamic_cast<const Pawn *>(capturedPiece) == nullptr)
     {
@@ -171,7 +175,7 @@ void HellPawn::infect(const Piece *capturedPiece, std::vector<std::unique_ptr<Pi
             Piece::Color color = this->getColor();
 
             // Create a new piece of the same type as the captured piece
-            int id = getNextID();
+            int id = context.nextId();
             std::unique_ptr<Piece> newPiece = createPiece(id, pieceType, textureManager, position, color);
 
             if (newPiece)
@@ -0,0 +1,273 @@
+// Filename: highlightTest.cpp
+// Description: Entry point of battlechess_highlighttest, which checks every GUI piece's highlighted moves against the engine's legal moves.
+
+// Main Functions:
+// - int main(int argc, char *argv[]): Plays random games for every army matchup and compares, for each piece of the side
+//   to move, the squares highlightValidMoves marks with the engine's quiet and capture targets; exits 1 on a difference.
+
+// Special Features or Notes:
+// - Options: --games N per matchup (default 4), --plies N per game (default 40), --seed N (default 1).
+// - The GUI pieces are made through pieceFactoryMap from the engine position, and the engine position compared against
+//   is read back from them with positionFromPieces, so both sides look at the same board.
+// - Squares are compared per colour: yellow with the engine's quiet targets and red with its capture targets. Green
+//   squares mark abilities, which the target masks do not hold, and are only printed.
+// - Pieces the LegalMoves cache marks as having abilities are skipped, as game.cpp leaves them to their own rules; so are
+//   stunned and stone pieces, which cannot be selected. The DeadLauncher's load, the used GhoulKing and QueenOfDomination
+//   abilities and the Howler's captured families are set on the GUI pieces from the engine flags, so the bridge's
+//   handling of them is checked as well. Howlers holding captured families are tallied on their own line.
+// - Every difference is printed with the position, so a failure can be replayed in battlechess_engine.
+
+// Usage or Context:
+// - Registered with CTest; battlechess_highlighttest --games 20 --plies 80 for a longer run.
+
+#include "engineArmy.h"
+#include "engineBridge.h"
+#include "engineMoveCache.h"
+#include "pieceFactory.h"
+#include "deadLauncher.h"
+#include "ghoulKing.h"
+#include "howler.h"
+#include "queenOfDomination.h"
+#include "piecePool.h"
+#include "pieceTable.h"
+#include "board.h"
+#include "globals.h"
+#include <iostream>
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <string>
+
+namespace
+{
+    using Pieces = std::vector<std::unique_ptr<Piece>>;
+
+    struct Tally
+    {
+        int checked = 0;
+        int differing = 0;
+        int withAbilities = 0; // left to the piece's own rules by game.cpp, so not compared
+    };
+
+    // Upgrades the slots in the given order until the gemstone budget runs out. Two orders, back rank first and pawns
+    // and knights first, put every race piece on the board between them.
+    engine::ArmyBuild fullBuild(engine::Race race, bool backRankFirst)
+    {
+        static const int backRank[] = {3, 4, 0, 7, 2, 5, 1, 6, 8, 9, 10, 11, 12, 13, 14, 15};
+        static const int pawnsFirst[] = {8, 9, 10, 11, 12, 13, 14, 15, 1, 6, 2, 5, 0, 7, 4, 3};
+        engine::ArmyBuild build;
+        build.race = race;
+        if (race == engine::Standard)
+        {
+            return build;
+        }
+        for (int slot : backRankFirst ? backRank : pawnsFirst)
+        {
+            engine::ArmyBuild upgraded = build;
+            upgraded.upgrades |= static_cast<std::uint16_t>(1 << slot);
+            if (upgraded.isLegal())
+            {
+                build = upgraded;
+            }
+        }
+        return build;
+    }
+
+    // The GUI pieces of an engine position, with the flags the bridge carries: stun, stone, the DeadLauncher's load,
+    // the used GhoulKing and QueenOfDomination abilities and the Howler's captured families. The position compared
+    // against is read back from the pieces, so a flag the bridge drops shows up as a difference.
+    void piecesFromPosition(const engine::Position &position, sf::Texture &texture, Pieces &pieces)
+    {
+        int id = 0;
+        for (int sq = 0; sq < engine::NUM_SQUARES; ++sq)
+        {
+            if (position.isEmpty(sq))
+            {
+                continue;
+            }
+            engine::Kind kind = position.kindAt(sq);
+            std::uint16_t flags = position.flagsAt(sq);
+            Piece::Color color = position.sideAt(sq) == engine::White ? Piece::Color::White : Piece::Color::Black;
+            pieces.push_back(pieceFactoryMap.at(engine::kindName(kind))(id, texture, pixelsFromSquare(sq), color));
+            Piece &piece = *pieces.back();
+            piece.setStunned((flags & engine::FlagStunned) != 0);
+            piece.setStone((flags & engine::FlagStone) != 0);
+            if (kind == engine::DeadLauncher)
+            {
+                static_cast<DeadLauncher &>(piece).pawnLoaded = (flags & engine::FlagLoaded) != 0;
+            }
+            if (kind == engine::GhoulKing)
+            {
+                static_cast<GhoulKing &>(piece).raisedDead = (flags & engine::FlagAbilityUsed) != 0;
+            }
+            if (kind == engine::QueenOfDomination)
+            {
+                static_cast<QueenOfDomination &>(piece).setAbilityUsed((flags & engine::FlagAbilityUsed) != 0);
+            }
+            if (kind == engine::Howler)
+            {
+                static_cast<Howler &>(piece).setFamilies(static_cast<std::uint8_t>((flags & engine::FlagHowlerFamilies) >> engine::HowlerFamilyShift));
+            }
+            ++id;
+        }
+    }
+
+    std::string squareList(Board::SquareMask squares)
+    {
+        std::string list;
+        for (int sq = 0; sq < Board::SquareCount; ++sq)
+        {
+            if (squares >> sq & 1)
+            {
+                list += (list.empty() ? "" : " ") + engine::squareToString(sq);
+            }
+        }
+        return list.empty() ? "-" : list;
+    }
+
+    Board::SquareMask squaresIn(const Board &board, const sf::Color &color)
+    {
+        for (int layer = 0; layer < board.getHighlightLayerCount(); ++layer)
+        {
+            if (board.getHighlightLayer(layer).color == color)
+            {
+                return board.getHighlightLayer(layer).squares;
+            }
+        }
+        return 0;
+    }
+
+    // Compares every selectable piece of the side to move; returns the number of pieces that differ
+    int comparePosition(const engine::Position &start, std::map<std::string, Tally> &tallies)
+    {
+        sf::Texture texture;
+        Pieces pieces;
+        piecesFromPosition(start, texture, pieces);
+        bool isWhiteTurn = start.sideToMove() == engine::White;
+        engine::Position position = positionFromPieces(pieces, PieceReserve(), isWhiteTurn);
+        engine::LegalMoves moves(position);
+
+        int differing = 0;
+        for (const auto &piece : pieces)
+        {
+            int from = squareFromPixels(piece->getPosition());
+            if (piece->getColor() != (isWhiteTurn ? Piece::Color::White : Piece::Color::Black) || piece->isStunned() || piece->isStone())
+            {
+                continue;
+            }
+            std::string name = piece->getType();
+            if (name == "Howler" && static_cast<const Howler &>(*piece).getFamilies() != Howler::BishopFamily)
+            {
+                name += " with captured families";
+            }
+            Tally &tally = tallies[name];
+            if (moves.hasAbilities(from))
+            {
+                ++tally.withAbilities;
+                continue;
+            }
+
+            // What game.cpp shows when the cache is not used: the piece's moves and its ranged captures
+            Board board(sf::Color::White, sf::Color::Black);
+            piece->highlightValidMoves(board, pieces);
+            piece->highlightCaptureZones(board, pieces);
+            Board::SquareMask quiet = squaresIn(board, sf::Color::Yellow);
+            Board::SquareMask captures = squaresIn(board, sf::Color::Red);
+
+            ++tally.checked;
+            if (quiet != moves.quietTargets[from] || captures != moves.captureTargets[from])
+            {
+                ++tally.differing;
+                ++differing;
+                std::cout << piece->getType() << " on " << engine::squareToString(from) << " in " << position.toNotation() << "\n"
+                          << "  highlighted: moves " << squareList(quiet) << ", captures " << squareList(captures)
+                          << ", other " << squareList(board.highlighted() & ~(quiet | captures)) << "\n"
+                          << "  engine:      moves " << squareList(moves.quietTargets[from]) << ", captures "
+                          << squareList(moves.captureTargets[from]) << std::endl;
+            }
+        }
+        return differing;
+    }
+
+    int parseCount(const std::string &option, const char *value)
+    {
+        int count = std::stoi(value);
+        if (count < 1)
+        {
+            throw std::runtime_error(option + " must be at least 1");
+        }
+        return count;
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    int games = 4;
+    int plies = 40;
+    int seed = 1;
+
+    try
+    {
+        for (int i = 1; i < argc; ++i)
+        {
+            std::string option = argv[i];
+            if ((option == "--games" || option == "--plies" || option == "--seed") && i + 1 < argc)
+            {
+                (option == "--games" ? games : option == "--plies" ? plies : seed) = parseCount(option, argv[++i]);
+            }
+            else
+            {
+                throw std::runtime_error("Unknown option " + option);
+            }
+        }
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << e.what() << "\nUsage: battlechess_highlighttest [--games N] [--plies N] [--seed N]" << std::endl;
+        return 1;
+    }
+
+    // Pieces are allocated from a pool and report to a table as they would in a game
+    PiecePool pool;
+    PiecePool::Scope poolScope(pool);
+    PieceTable table;
+    PieceTable::Scope tableScope(table);
+
+    const engine::Race races[] = {engine::Standard, engine::Necro, engine::WizardRace, engine::Beast, engine::Hell};
+    std::mt19937 random(static_cast<std::mt19937::result_type>(seed));
+    std::map<std::string, Tally> tallies;
+    int differing = 0;
+
+    for (engine::Race white : races)
+    {
+        for (engine::Race black : races)
+        {
+            for (int game = 0; game < games; ++game)
+            {
+                bool backRankFirst = game % 2 == 0;
+                engine::Position position = engine::armyStartPosition(fullBuild(white, backRankFirst), fullBuild(black, backRankFirst));
+                for (int ply = 0; ply < plies && !engine::isLost(position); ++ply)
+                {
+                    if (position.pendingProwler() == engine::NO_SQUARE)
+                    {
+                        differing += comparePosition(position, tallies);
+                    }
+                    engine::MoveList list;
+                    engine::generateMoves(position, list);
+                    if (list.empty())
+                    {
+                        break;
+                    }
+                    position.makeMove(list.moves[std::uniform_int_distribution<int>(0, list.size() - 1)(random)]);
+                }
+            }
+        }
+    }
+
+    for (const auto &entry : tallies)
+    {
+        std::cout << entry.first << ": " << entry.second.differing << " of " << entry.second.checked << " differ, "
+                  << entry.second.withAbilities << " with abilities not compared" << std::endl;
+    }
+    return differing == 0 ? 0 : 1;
+}
@@ -7,12 +7,10 @@
 // Main Functions:
 // - void Howler::gainInitialAbilities(): Sets the initial abilities of the Howler piece to those of a Bishop.
 // - bool Howler::canMoveTo(const sf::Vector2f &target, const std::vector<std::unique_ptr<Piece>> &pieces) const: Determines if the Howler can move to a given target position based on its current abilities.
-// - void Howler::highlightValidMoves(std::vector<std::vector<Square>> &board, const std::vector<std::unique_ptr<Piece>> &pieces) const: Highlights all valid moves for the Howler on the provided chessboard, considering its current abilities.
+// - void Howler::highlightValidMoves(Board &board, const std::vector<std::unique_ptr<Piece>> &pieces) const: Highlights all valid moves for the Howler on the provided chessboard, considering its current abilities.
 // - void Howler::capture(const sf::Vector2f &target, std::vector<std::unique_ptr<Piece>> &pieces): Executes the capture of an opponent piece located at the specified target position and gains the movment abilities of the captured piece.
-// - void Howler::gainBishopAbilities(): Grants the Howler the movement and highlighting abilities of a Bishop.
-// - void Howler::gainRookAbilities(): Grants the Howler the movement and highlighting abilities of a Rook.
-// - void Howler::gainKnightAbilities(): Grants the Howler the movement and highlighting abilities of a Knight.
-// - etc.
+// - std::uint64_t Howler::moveTargets(const std::vector<std::unique_ptr<Piece>> &pieces, std::uint64_t &enemy) const: Bitboard of every square the Howler can move to or capture on.
+// - void Howler::gainFamily(Family family): Adds a movement family to the Howler's ability bits.
 // - void Howler::gainAbilitiesFromCapturedPiece(const Piece &capturedPiece): Grants the Howler new abilities based on the type of the captured piece.
 
 // Special Features or Notes:
@@ -20,8 +18,10 @@
 // - The Howler's abilities are dynamic and can change throughout the game based on the pieces it captures.
 // - The Howler will only ever acquire the movement from the Level 1 piece type. Ex. If a Necromancer is captured,
 //   the Howler will aquire the movement and capture abilities of the Bishop.
-// - Current Howler logic has the code to implement full movement and capture of higher level Pieces in case we choose to use this
-//   flexibility at a later stage in development.
+// - Abilities are a bitmask of movement families. Knight and king leaps are precomputed per set of families and
+//   per square, and the rays of the sliding families are precomputed per set as well, so a Howler holding five
+//   families costs one table lookup and one pass over its rays, the same as a Howler holding one.
+// - The tables index squares as row * BOARD_SIZE + col, the layout engineBridge.cpp uses.
 
 // Usage or Context:
 // - This file implements the dynamic behavior of the Howler piece in a our Battle Chess game.
@@ -29,500 +29,251 @@
 #include "howler.h"
 #include "utility.h"
 #include "globals.h"
-#include "square.h"
-#include "bishop.h"
-#include "rook.h"
-#include "pawn.h"
-#include "knight.h"
-#include "queen.h"
-#include "king.h"
-#include "necromancer.h"
-#include "necroPawn.h"
-#include "beastKnight.h"
-#include "boulderThrower.h"
-#include "wizard.h"
+#include "board.h"
 #include <iostream>
+#include <string>
+#include <unordered_map>
 
-// Initialize abilities, Howler starts with Bishop abilities
-void Howler::gainInitialAbilities()
+namespace
 {
-    gainBishopAbilities();
-}
+    constexpr int SquareCount = BOARD_SIZE * BOARD_SIZE;
+    constexpr int FamilySets = 1 << 6;
+    constexpr int RayCount = 8;
 
-// Check if Howler can move to the target position based on current abilities
-bool Howler::canMoveTo(const sf::Vector2f &target, const std::vector<std::unique_ptr<Piece>> &pieces) const
-{
-    for (const auto &ability : movementAbilities)
-    {
-        if (ability(target, pieces))
-        {
-            return true;
-        }
-    }
-    return false;
-}
+    static_assert(SquareCount <= 64, "Howler targets are a 64-bit mask");
 
-// Highlight all valid moves for Howler on the board based on current abilities
-void Howler::highlightValidMoves(std::vector<std::vector<Square>> &board, const std::vector<std::unique_ptr<Piece>> &pieces) const
-{
-    for (const auto &highlight : highlightAbilities)
-    {
-        highlight(board, pieces);
-    }
-}
-
-// Capture an opponent piece at the target position and gain its abilities
-void Howler::capture(const sf::Vector2f &target, std::vector<std::unique_ptr<Piece>> &pieces)
-{
-    std::cout << "Howler attempting to capture at: (" << target.x / TILE_SIZE << ", " << target.y / TILE_SIZE << ")" << std::endl;
+    // dx, dy of each ray; the first four step to higher square indices, the last four to lower ones
+    const int rayDirections[RayCount][2] = {{1, 0}, {0, 1}, {1, 1}, {-1, 1}, {-1, 0}, {0, -1}, {-1, -1}, {1, -1}};
+    constexpr std::uint8_t OrthogonalRays = 0x33;
+    constexpr std::uint8_t DiagonalRays = 0xCC;
 
-    for (auto it = pieces.begin(); it != pieces.end(); ++it)
+    struct HowlerTables
     {
-        if ((*it)->getPosition() == target && isOpponentPiece(target, pieces, getColor()))
+        std::uint64_t leaps[FamilySets][SquareCount]; // knight and king squares of each family set
+        std::uint8_t rays[FamilySets];                // rayDirections a family set slides along
+        std::uint64_t rayMasks[RayCount][SquareCount]; // whole ray up to the edge
+        std::uint64_t pawnSteps[2][SquareCount];       // by color, White first
+        std::uint64_t pawnDoubleSteps[2][SquareCount]; // only from the starting row
+        std::uint64_t pawnCaptures[2][SquareCount];
+    };
+
+    std::uint64_t squareBit(int col, int row)
+    {
+        if (col < 0 || col >= BOARD_SIZE || row < 0 || row >= BOARD_SIZE)
         {
-            std::cout << "Howler captured piece: " << (*it)->getType() << std::endl;
-            gainAbilitiesFromCapturedPiece(**it);
-            pieces.erase(it);
-            break;
+            return 0;
         }
+        return std::uint64_t(1) << (row * BOARD_SIZE + col);
     }
-    setPosition(target);
-}
-
-// Grant Howler the movement and highlighting abilities of a Bishop
-void Howler::gainBishopAbilities()
-{
-    if (bishopAbilities)
-        return; // Prevent adding the same ability multiple times
-    bishopAbilities = true;
 
-    movementAbilities.push_back([this](const sf::Vector2f &target, const std::vector<std::unique_ptr<Piece>> &pieces) -> bool
-                                {
-        sf::Vector2f currentPosition = getPosition();
+    void buildTables(HowlerTables &tables)
+    {
+        const int knightOffsets[8][2] = {{2, 1}, {2, -1}, {-2, 1}, {-2, -1}, {1, 2}, {1, -2}, {-1, 2}, {-1, -2}};
 
-        // Bishop can only move diagonally
-        if (std::abs(target.x - currentPosition.x) != std::abs(target.y - currentPosition.y))
+        for (int sq = 0; sq < SquareCount; ++sq)
         {
-            return false;
-        }
-
-        // Check if the path is clear
-        return isPathClear(currentPosition, target, pieces); });
-
-    highlightAbilities.push_back([this](std::vector<std::vector<Square>> &board, const std::vector<std::unique_ptr<Piece>> &pieces) -> void
-                                 {
-        sf::Vector2f currentPosition = getPosition();
-        Piece::Color currentPlayerColor = getColor();
+            int col = sq % BOARD_SIZE;
+            int row = sq / BOARD_SIZE;
 
-        // Iterate over all diagonal directions
-        for (int dx = -1; dx <= 1; dx += 2)
-        {
-            for (int dy = -1; dy <= 1; dy += 2)
+            std::uint64_t knight = 0;
+            std::uint64_t king = 0;
+            for (const auto &offset : knightOffsets)
             {
-                // Check valid moves in each diagonal direction
-                for (float i = 1; i < BOARD_SIZE; ++i)
-                {
-                    int newX = static_cast<int>(currentPosition.x / TILE_SIZE) + i * dx;
-                    int newY = static_cast<int>(currentPosition.y / TILE_SIZE) + i * dy;
-
-                    // Check if the new position is within the board bounds
-                    if (newX >= 0 && newX < BOARD_SIZE && newY >= 0 && newY < BOARD_SIZE)
-                    {
-                        sf::Vector2f newPosition(newX * TILE_SIZE, newY * TILE_SIZE);
-
-                        // Check if the path is clear and if the position is empty or occupied by an opponent's piece
-                        if (isPathClear(currentPosition, newPosition, pieces) && (!getPieceAtPosition(newPosition, pieces) || isOpponentPiece(newPosition, pieces, currentPlayerColor)))
-                        {
-                            if (!isOpponentPiece(newPosition, pieces, currentPlayerColor))
-                            {
-                                board[newY][newX].setHighlight(true);
-                            }
-                            else if (isOpponentPiece(newPosition, pieces, currentPlayerColor))
-                            {
-                                board[newY][newX].setHighlight(true, sf::Color::Red);
-                            }
-
-                            // If the position is occupied by an opponent's piece, stop highlighting in this direction
-                            if (getPieceAtPosition(newPosition, pieces))
-                            {
-                                break;
-                            }
-                        }
-                        else
-                        {
-                            // If the path is not clear or the position is occupied by a friendly piece, stop highlighting in this direction
-                            break;
-                        }
-                    }
-                    else
-                    {
-                        // If the new position is out of bounds, stop highlighting in this direction
-                        break;
-                    }
-                }
+                knight |= squareBit(col + offset[0], row + offset[1]);
             }
-        } });
-}
-
-// Grant Howler the movement and highlighting abilities of a Rook
-void Howler::gainRookAbilities()
-{
-    if (rookAbilities)
-        return; // Prevent adding the same ability multiple times
-    rookAbilities = true;
-
-    std::cout << "Howler gained Rook abilities." << std::endl;
-    movementAbilities.push_back([this](const sf::Vector2f &target, const std::vector<std::unique_ptr<Piece>> &pieces) -> bool
-                                {
-        sf::Vector2f currentPosition = getPosition();
-
-        // Rook can only move in straight lines
-        if (target.x != getPosition().x && target.y != getPosition().y)
-        {
-            return false;
-        }
-
-        // Check if the path is clear
-        if (!isPathClear(currentPosition, target, pieces))
-        {
-            return false;
-        }
-
-        // Check if the target position is occupied by an opponent's piece
-        return !getPieceAtPosition(target, pieces) || isOpponentPiece(target, pieces, getColor()); });
-
-    highlightAbilities.push_back([this](std::vector<std::vector<Square>> &board, const std::vector<std::unique_ptr<Piece>> &pieces) -> void
-                                 {
-        sf::Vector2f currentPosition = getPosition();
-
-        for (int i = 0; i < BOARD_SIZE; ++i)
-        {
-            sf::Vector2f horizontalTarget(i * TILE_SIZE, currentPosition.y);
-            if (canMoveTo(horizontalTarget, pieces))
+            for (int ray = 0; ray < RayCount; ++ray)
             {
-                if (!isOpponentPiece(horizontalTarget, pieces, getColor()))
-                {
-                    board[static_cast<int>(currentPosition.y / TILE_SIZE)][i].setHighlight(true);
-                }
-                else if (isOpponentPiece(horizontalTarget, pieces, getColor()))
-                {
-                    board[static_cast<int>(currentPosition.y / TILE_SIZE)][i].setHighlight(true, sf::Color::Red);
-                }
-            }
+                int dx = rayDirections[ray][0];
+                int dy = rayDirections[ray][1];
+                king |= squareBit(col + dx, row + dy);
 
-            sf::Vector2f verticalTarget(currentPosition.x, i * TILE_SIZE);
-            if (canMoveTo(verticalTarget, pieces))
-            {
-                if (!isOpponentPiece(verticalTarget, pieces, getColor()))
+                std::uint64_t mask = 0;
+                for (int step = 1; squareBit(col + step * dx, row + step * dy); ++step)
                 {
-                    board[i][static_cast<int>(currentPosition.x / TILE_SIZE)].setHighlight(true);
-                }
-                else if (isOpponentPiece(verticalTarget, pieces, getColor()))
-                {
-                    board[i][static_cast<int>(currentPosition.x / TILE_SIZE)].setHighlight(true, sf::Color::Red);
+                    mask |= squareBit(col + step * dx, row + step * dy);
                 }
+                tables.rayMasks[ray][sq] = mask;
             }
-        } });
-}
 
-// Grant Howler the movement and highlighting abilities of a Knight
-void Howler::gainKnightAbilities()
-{
-    if (knightAbilities)
-        return; // Prevent adding the same ability multiple times
-    knightAbilities = true;
-
-    std::cout << "Howler gained Knight abilities." << std::endl;
-    movementAbilities.push_back([this](const sf::Vector2f &target, const std::vector<std::unique_ptr<Piece>> &pieces) -> bool
-                                {
-        sf::Vector2f currentPosition = getPosition();
-        int dx = std::abs(target.x - currentPosition.x) / TILE_SIZE;
-        int dy = std::abs(target.y - currentPosition.y) / TILE_SIZE;
-
-        if ((dx == 2 && dy == 1) || (dx == 1 && dy == 2))
-        {
-            return !getPieceAtPosition(target, pieces) || isOpponentPiece(target, pieces, getColor());
-        }
-        return false; });
-
-    highlightAbilities.push_back([this](std::vector<std::vector<Square>> &board, const std::vector<std::unique_ptr<Piece>> &pieces) -> void
-                                 {
-        sf::Vector2f currentPosition = getPosition();
-        std::vector<sf::Vector2f> moves = {
-            {currentPosition.x + 2 * TILE_SIZE, currentPosition.y + TILE_SIZE},
-            {currentPosition.x + 2 * TILE_SIZE, currentPosition.y - TILE_SIZE},
-            {currentPosition.x - 2 * TILE_SIZE, currentPosition.y + TILE_SIZE},
-            {currentPosition.x - 2 * TILE_SIZE, currentPosition.y - TILE_SIZE},
-            {currentPosition.x + TILE_SIZE, currentPosition.y + 2 * TILE_SIZE},
-            {currentPosition.x + TILE_SIZE, currentPosition.y - 2 * TILE_SIZE},
-            {currentPosition.x - TILE_SIZE, currentPosition.y + 2 * TILE_SIZE},
-            {currentPosition.x - TILE_SIZE, currentPosition.y - 2 * TILE_SIZE}};
-
-        for (const auto &move : moves)
-        {
-            int col = move.x / TILE_SIZE;
-            int row = move.y / TILE_SIZE;
-
-            // space is occupied by an opponent piece
-            if (col >= 0 && col < BOARD_SIZE && row >= 0 && row < BOARD_SIZE && canMoveTo(move, pieces) && isOpponentPiece(move, pieces, getColor()))
+            for (int families = 0; families < FamilySets; ++families)
             {
-                board[row][col].setHighlight(true, sf::Color::Red);
+                tables.leaps[families][sq] = ((families & Howler::KnightFamily) ? knight : 0) |
+                                             ((families & Howler::KingFamily) ? king : 0);
             }
-            // space is unoccupied
-            else if (col >= 0 && col < BOARD_SIZE && row >= 0 && row < BOARD_SIZE && canMoveTo(move, pieces))
-            {
-                board[row][col].setHighlight(true);
-            }
-        } });
-}
-
-// Grant Howler the movement and highlighting abilities of a Pawn
-void Howler::gainPawnAbilities()
-{
-    if (pawnAbilities)
-        return; // Prevent adding the same ability multiple times
-    pawnAbilities = true;
-
-    std::cout << "Howler gained Pawn abilities." << std::endl;
-    movementAbilities.push_back([this](const sf::Vector2f &target, const std::vector<std::unique_ptr<Piece>> &pieces) -> bool
-                                {
-        sf::Vector2f currentPosition = getPosition();
-        float direction = (getColor() == Piece::Color::White) ? 1.0f : -1.0f; // White moves down, Black moves up
-
-        // Ensure target is within the board bounds
-        if (target.x < 0 || target.x >= BOARD_SIZE * TILE_SIZE || target.y < 0 || target.y >= BOARD_SIZE * TILE_SIZE)
-        {
-            std::cout << "Target out of bounds: (" << target.x << ", " << target.y << ")\n";
-            return false;
-        }
 
-        // Check for forward movement
-        if (target.x == currentPosition.x)
-        {
-            // Single step forward
-            if (target.y == currentPosition.y + direction * TILE_SIZE)
-            {
-                return !getPieceAtPosition(target, pieces);
-            }
-            // Double step forward on first move
-            else if (target.y == currentPosition.y + 2 * direction * TILE_SIZE &&
-                    ((getColor() == Piece::Color::White && currentPosition.y == 1 * TILE_SIZE) ||
-                    (getColor() == Piece::Color::Black && currentPosition.y == 6 * TILE_SIZE)))
+            // White moves down the board (increasing row), Black moves up
+            for (int side = 0; side < 2; ++side)
             {
-                sf::Vector2f intermediatePosition = sf::Vector2f(currentPosition.x, currentPosition.y + direction * TILE_SIZE);
-                return !getPieceAtPosition(target, pieces) && !getPieceAtPosition(intermediatePosition, pieces);
+                int direction = side == 0 ? 1 : -1;
+                int startRow = side == 0 ? 1 : 6;
+                tables.pawnSteps[side][sq] = squareBit(col, row + direction);
+                tables.pawnDoubleSteps[side][sq] = row == startRow ? squareBit(col, row + 2 * direction) : 0;
+                tables.pawnCaptures[side][sq] = squareBit(col - 1, row + direction) | squareBit(col + 1, row + direction);
             }
         }
 
-        // Check for diagonal capture
-        if (std::abs(target.x - currentPosition.x) == TILE_SIZE && target.y == currentPosition.y + direction * TILE_SIZE)
+        for (int families = 0; families < FamilySets; ++families)
         {
-            return isOpponentPiece(target, pieces, getColor());
+            std::uint8_t rays = 0;
+            rays |= (families & (Howler::RookFamily | Howler::QueenFamily)) ? OrthogonalRays : 0;
+            rays |= (families & (Howler::BishopFamily | Howler::QueenFamily)) ? DiagonalRays : 0;
+            tables.rays[families] = rays;
         }
-        return false; });
-
-    highlightAbilities.push_back([this](std::vector<std::vector<Square>> &board, const std::vector<std::unique_ptr<Piece>> &pieces) -> void
-                                 {
+    }
 
-        sf::Vector2f currentPosition = getPosition();
-        float direction = (getColor() == Piece::Color::White) ? 1.0f : -1.0f; // White moves down, Black moves up
+    const HowlerTables &howlerTables()
+    {
+        static HowlerTables tables;
+        static const bool built = (buildTables(tables), true);
+        (void)built;
+        return tables;
+    }
 
-        // Highlight single step forward
-        sf::Vector2f singleStep = sf::Vector2f(currentPosition.x, currentPosition.y + direction * TILE_SIZE);
-        if (singleStep.y >= 0 && singleStep.y < BOARD_SIZE * TILE_SIZE && canMoveTo(singleStep, pieces))
+    const char *familyName(Howler::Family family)
+    {
+        switch (family)
         {
-            board[static_cast<int>(singleStep.y / TILE_SIZE)][static_cast<int>(singleStep.x / TILE_SIZE)].setHighlight(true);
+        case Howler::RookFamily:
+            return "Rook";
+        case Howler::KnightFamily:
+            return "Knight";
+        case Howler::PawnFamily:
+            return "Pawn";
+        case Howler::QueenFamily:
+            return "Queen";
+        case Howler::KingFamily:
+            return "King";
+        default:
+            return "Bishop";
         }
+    }
 
-        // Highlight double step forward on first move
-        sf::Vector2f doubleStep = sf::Vector2f(currentPosition.x, currentPosition.y + 2 * direction * TILE_SIZE);
-        if (doubleStep.y >= 0 && doubleStep.y < BOARD_SIZE * TILE_SIZE &&
-            ((getColor() == Piece::Color::White && currentPosition.y == 1 * TILE_SIZE) ||
-            (getColor() == Piece::Color::Black && currentPosition.y == 6 * TILE_SIZE)) &&
-            canMoveTo(doubleStep, pieces))
+    int squareOf(const sf::Vector2f &position)
+    {
+        if (position.x < 0 || position.y < 0)
         {
-            board[static_cast<int>(doubleStep.y / TILE_SIZE)][static_cast<int>(doubleStep.x / TILE_SIZE)].setHighlight(true);
+            return -1;
         }
-
-        // Highlight diagonal captures
-        sf::Vector2f diagonalLeft = sf::Vector2f(currentPosition.x - TILE_SIZE, currentPosition.y + direction * TILE_SIZE);
-        if (diagonalLeft.x >= 0 && diagonalLeft.x < BOARD_SIZE * TILE_SIZE && diagonalLeft.y >= 0 && diagonalLeft.y < BOARD_SIZE * TILE_SIZE &&
-            canMoveTo(diagonalLeft, pieces))
+        int col = tileIndex(position.x);
+        int row = tileIndex(position.y);
+        if (col >= BOARD_SIZE || row >= BOARD_SIZE)
         {
-            board[static_cast<int>(diagonalLeft.y / TILE_SIZE)][static_cast<int>(diagonalLeft.x / TILE_SIZE)].setHighlight(true, sf::Color::Red);
+            return -1;
         }
+        return row * BOARD_SIZE + col;
+    }
+}
 
-        sf::Vector2f diagonalRight = sf::Vector2f(currentPosition.x + TILE_SIZE, currentPosition.y + direction * TILE_SIZE);
-        if (diagonalRight.x >= 0 && diagonalRight.x < BOARD_SIZE * TILE_SIZE && diagonalRight.y >= 0 && diagonalRight.y < BOARD_SIZE * TILE_SIZE &&
-            canMoveTo(diagonalRight, pieces))
-        {
-            board[static_cast<int>(diagonalRight.y / TILE_SIZE)][static_cast<int>(diagonalRight.x / TILE_SIZE)].setHighlight(true, sf::Color::Red);
-        } });
+// Initialize abilities, Howler starts with Bishop abilities
+void Howler::gainInitialAbilities()
+{
+    families = BishopFamily;
 }
 
-// Grant Howler the movement and highlighting abilities of a Queen
-void Howler::gainQueenAbilities()
+// Every square reachable with the current families: empty squares and enemy pieces, never a friendly piece
+std::uint64_t Howler::moveTargets(const std::vector<std::unique_ptr<Piece>> &pieces, std::uint64_t &enemy) const
 {
-    if (queenAbilities)
-        return; // Prevent adding the same ability multiple times
-    queenAbilities = true;
+    const HowlerTables &tables = howlerTables();
 
-    std::cout << "Howler gained Queen abilities." << std::endl;
-    movementAbilities.push_back([this](const sf::Vector2f &target, const std::vector<std::unique_ptr<Piece>> &pieces) -> bool
-                                {
+    std::uint64_t own = 0;
+    enemy = 0;
+    for (const auto &piece : pieces)
+    {
+        int sq = squareOf(piece->getPosition());
+        if (sq < 0)
+        {
+            continue;
+        }
+        // A piece turned to stone cannot be captured, so it blocks like one of the Howler's own
+        (piece->getColor() == getColor() || piece->isStone() ? own : enemy) |= std::uint64_t(1) << sq;
+    }
 
-        sf::Vector2f currentPosition = getPosition();
+    int from = squareOf(getPosition());
+    if (from < 0)
+    {
+        return 0;
+    }
+    std::uint64_t occupied = own | enemy;
 
-        // Queen can only move in straight lines and diagnal lines
-        if ((target.x != getPosition().x && target.y != getPosition().y) && (std::abs(target.x - currentPosition.x) != std::abs(target.y - currentPosition.y)))
+    std::uint64_t targets = tables.leaps[families][from];
+    for (std::uint8_t rays = tables.rays[families]; rays; rays &= rays - 1)
+    {
+        // A ray stops on its first piece: drop everything the blocker's own ray would reach
+        int ray = __builtin_ctz(rays);
+        std::uint64_t reach = tables.rayMasks[ray][from];
+        std::uint64_t blockers = reach & occupied;
+        if (blockers)
         {
-            return false;
+            int blocker = ray < 4 ? __builtin_ctzll(blockers) : 63 - __builtin_clzll(blockers);
+            reach ^= tables.rayMasks[ray][blocker];
         }
+        targets |= reach;
+    }
+    targets &= ~own;
 
-        // Check if the path is clear
-        if (!isPathClear(currentPosition, target, pieces))
+    if (families & PawnFamily)
+    {
+        int side = getColor() == Piece::Color::White ? 0 : 1;
+        std::uint64_t step = tables.pawnSteps[side][from] & ~occupied;
+        targets |= step;
+        if (step)
         {
-            return false;
+            targets |= tables.pawnDoubleSteps[side][from] & ~occupied;
         }
+        targets |= tables.pawnCaptures[side][from] & enemy;
+    }
+    return targets;
+}
 
-        // Check if the target position is occupied by an opponent's piece
-        return !getPieceAtPosition(target, pieces) || isOpponentPiece(target, pieces, getColor()); });
+// Check if Howler can move to the target position based on current abilities
+bool Howler::canMoveTo(const sf::Vector2f &target, const std::vector<std::unique_ptr<Piece>> &pieces) const
+{
+    int sq = squareOf(target);
+    if (sq < 0)
+    {
+        return false;
+    }
+    std::uint64_t enemy = 0;
+    return (moveTargets(pieces, enemy) >> sq) & 1;
+}
 
-    highlightAbilities.push_back([this](std::vector<std::vector<Square>> &board, const std::vector<std::unique_ptr<Piece>> &pieces) -> void
-                                 {
+// Highlight all valid moves for Howler on the board based on current abilities
+void Howler::highlightValidMoves(Board &board, const std::vector<std::unique_ptr<Piece>> &pieces) const
+{
+    // The targets are already a mask in the board's square layout
+    std::uint64_t enemy = 0;
+    std::uint64_t targets = moveTargets(pieces, enemy);
+    Board::Highlights highlights;
+    highlights.moves = targets & ~enemy;
+    highlights.captures = targets & enemy;
+    board.highlight(highlights);
+}
 
-        sf::Vector2f currentPosition = getPosition();
-        Piece::Color currentPlayerColor = getColor();
+// Capture an opponent piece at the target position and gain its abilities
+void Howler::capture(const sf::Vector2f &target, std::vector<std::unique_ptr<Piece>> &pieces)
+{
+    std::cout << "Howler attempting to capture at: (" << target.x / TILE_SIZE << ", " << target.y / TILE_SIZE << ")" << std::endl;
 
-        for (int i = 0; i < BOARD_SIZE; ++i)
+    for (auto it = pieces.begin(); it != pieces.end(); ++it)
+    {
+        if ((*it)->getPosition() == target && isOpponentPiece(target, pieces, getColor()))
         {
-            sf::Vector2f horizontalTarget(i * TILE_SIZE, currentPosition.y);
-            if (canMoveTo(horizontalTarget, pieces))
-            {
-                if (!isOpponentPiece(horizontalTarget, pieces, currentPlayerColor))
-                {
-                    board[static_cast<int>(currentPosition.y / TILE_SIZE)][i].setHighlight(true);
-                }
-                else if (isOpponentPiece(horizontalTarget, pieces, currentPlayerColor))
-                {
-                    board[static_cast<int>(currentPosition.y / TILE_SIZE)][i].setHighlight(true, sf::Color::Red);
-                }
-            }
-
-            sf::Vector2f verticalTarget(currentPosition.x, i * TILE_SIZE);
-            if (canMoveTo(verticalTarget, pieces))
-            {
-                if (!isOpponentPiece(verticalTarget, pieces, currentPlayerColor))
-                {
-                    board[i][static_cast<int>(currentPosition.x / TILE_SIZE)].setHighlight(true);
-                }
-                else if (isOpponentPiece(verticalTarget, pieces, currentPlayerColor))
-                {
-                    board[i][static_cast<int>(currentPosition.x / TILE_SIZE)].setHighlight(true, sf::Color::Red);
-                }
-            }
+            std::cout << "Howler captured piece: " << (*it)->getType() << std::endl;
+            gainAbilitiesFromCapturedPiece(**it);
+            pieces.erase(it);
+            break;
         }
-
-        // Iterate over all diagonal directions
-        for (int dx = -1; dx <= 1; dx += 2)
-        {
-            for (int dy = -1; dy <= 1; dy += 2)
-            {
-                // Check valid moves in each diagonal direction
-                for (float i = 1; i < BOARD_SIZE; ++i)
-                {
-                    int newX = static_cast<int>(currentPosition.x / TILE_SIZE) + i * dx;
-                    int newY = static_cast<int>(currentPosition.y / TILE_SIZE) + i * dy;
-
-                    // Check if the new position is within the board bounds
-                    if (newX >= 0 && newX < BOARD_SIZE && newY >= 0 && newY < BOARD_SIZE)
-                    {
-                        sf::Vector2f newPosition(newX * TILE_SIZE, newY * TILE_SIZE);
-
-                        // Check if the path is clear and if the position is empty or occupied by an opponent's piece
-                        if (isPathClear(currentPosition, newPosition, pieces) && (!getPieceAtPosition(newPosition, pieces) || isOpponentPiece(newPosition, pieces, currentPlayerColor)))
-                        {
-                            if (!isOpponentPiece(newPosition, pieces, currentPlayerColor))
-                            {
-                                board[newY][newX].setHighlight(true);
-                            }
-                            else if (isOpponentPiece(newPosition, pieces, currentPlayerColor))
-                            {
-                                board[newY][newX].setHighlight(true, sf::Color::Red);
-                            }
-
-                            // If the position is occupied by an opponent's piece, stop highlighting in this direction
-                            if (getPieceAtPosition(newPosition, pieces))
-                            {
-                                break;
-                            }
-                        }
-                        else
-                        {
-                            // If the path is not clear or the position is occupied by a friendly piece, stop highlighting in this direction
-                            break;
-                        }
-                    }
-                    else
-                    {
-                        // If the new position is out of bounds, stop highlighting in this direction
-                        break;
-                    }
-                }
-            }
-        } });
+    }
+    setPosition(target);
 }
 
-// Grant Howler the movement and highlighting abilities of a King
-void Howler::gainKingAbilities()
+// Add a movement family; the tables already hold every combination, so this only sets a bit
+void Howler::gainFamily(Family family)
 {
-    if (kingAbilities)
-        return; // Prevent adding the same ability multiple times
-    kingAbilities = true;
-
-    std::cout << "Howler gained King abilities." << std::endl;
-    movementAbilities.push_back([this](const sf::Vector2f &target, const std::vector<std::unique_ptr<Piece>> &pieces) -> bool
-                                {
-        sf::Vector2f currentPosition = getPosition();
-        int dx = std::abs(target.x - currentPosition.x) / TILE_SIZE;
-        int dy = std::abs(target.y - currentPosition.y) / TILE_SIZE;
-
-        if ((dx == 0 && dy == 1) || (dx == 0 && dy == -1) || (dx == 1 && dy == 0) || (dx == 1 && dy == -1) || (dx == 1 && dy == 1) || (dx == -1 && dy == 0) || (dx == -1 && dy == 1) || (dx == -1 && dy == -1))
-        {
-            return !getPieceAtPosition(target, pieces) || isOpponentPiece(target, pieces, getColor());
-        }
-        return false; });
-
-    highlightAbilities.push_back([this](std::vector<std::vector<Square>> &board, const std::vector<std::unique_ptr<Piece>> &pieces) -> void
-                                 {
-        
-        sf::Vector2f currentPosition = getPosition();
-        std::vector<sf::Vector2f> moves = {
-            {currentPosition.x, currentPosition.y + TILE_SIZE},
-            {currentPosition.x, currentPosition.y - TILE_SIZE},
-            {currentPosition.x - TILE_SIZE, currentPosition.y},
-            {currentPosition.x - TILE_SIZE, currentPosition.y - TILE_SIZE},
-            {currentPosition.x - TILE_SIZE, currentPosition.y + TILE_SIZE},
-            {currentPosition.x + TILE_SIZE, currentPosition.y},
-            {currentPosition.x + TILE_SIZE, currentPosition.y + TILE_SIZE},
-            {currentPosition.x + TILE_SIZE, currentPosition.y - TILE_SIZE}};
-
-        for (const auto &move : moves)
-        {
-            int col = move.x / TILE_SIZE;
-            int row = move.y / TILE_SIZE;
-
-            // space is occupied by an opponent piece
-            if (col >= 0 && col < BOARD_SIZE && row >= 0 && row < BOARD_SIZE && canMoveTo(move, pieces) && isOpponentPiece(move, pieces, getColor()))
-            {
-                board[row][col].setHighlight(true, sf::Color::Red);
-            }
-            // space is unoccupied
-            else if (col >= 0 && col < BOARD_SIZE && row >= 0 && row < BOARD_SIZE && canMoveTo(move, pieces))
-            {
-                board[row][col].setHighlight(true);
-            }
-        } });
+    if (families & family)
+        return; // Already held
+    families |= family;
+    std::cout << "Howler gained " << familyName(family) << " abilities." << std::endl;
 }
 
 // Grant Howler abilities based on the captured piece type
@@ -530,40 +281,18 @@ void Howler::gainAbilitiesFromCapturedPiece(const Piece &capturedPiece)
 {
     std::cout << "Howler is gaining abilities from captured piece: " << capturedPiece.getType() << std::endl;
 
-    std::string capturedType = capturedPiece.getType();
-
-    // Define sets of types for each category
-    const std::unordered_set<std::string> rookTypes = {"Rook", "BoulderThrower", "DeadLauncher", "Portal", "Beholder"};
-    const std::unordered_set<std::string> knightTypes = {"Knight", "BeastKnight", "Prowler", "Familiar", "GhostKnight"};
-    const std::unordered_set<std::string> queenTypes = {"Queen", "QueenOfIllusions", "QueenOfDomination", "QueenOfDestruction", "QueenOfBones"};
-    const std::unordered_set<std::string> kingTypes = {"King", "WizardKing", "GhoulKing", "HellKing", "FrogKing"};
-    const std::unordered_set<std::string> pawnTypes = {"Pawn", "NecroPawn", "YoungWiz", "PawnHopper", "HellPawn"};
-    const std::unordered_set<std::string> bishopTypes = {"Bishop", "Wizard", "Beholder", "BeastDruid", "Necromancer"};
-
-    // Check the captured piece type and gain corresponding abilities
-    if (rookTypes.find(capturedType) != rookTypes.end())
-    {
-        gainRookAbilities();
-    }
-    else if (knightTypes.find(capturedType) != knightTypes.end())
-    {
-        gainKnightAbilities();
-    }
-    else if (queenTypes.find(capturedType) != queenTypes.end())
-    {
-        gainQueenAbilities();
-    }
-    else if (kingTypes.find(capturedType) != kingTypes.end())
+    // Every race piece grants the family of the level 1 piece it upgrades; the Beholder counts as a rook
+    static const std::unordered_map<std::string, Family> familyOfType = {
+        {"Rook", RookFamily}, {"BoulderThrower", RookFamily}, {"DeadLauncher", RookFamily}, {"Portal", RookFamily}, {"Beholder", RookFamily},
+        {"Knight", KnightFamily}, {"BeastKnight", KnightFamily}, {"Prowler", KnightFamily}, {"Familiar", KnightFamily}, {"GhostKnight", KnightFamily},
+        {"Queen", QueenFamily}, {"QueenOfIllusions", QueenFamily}, {"QueenOfDomination", QueenFamily}, {"QueenOfDestruction", QueenFamily}, {"QueenOfBones", QueenFamily},
+        {"King", KingFamily}, {"WizardKing", KingFamily}, {"GhoulKing", KingFamily}, {"HellKing", KingFamily}, {"FrogKing", KingFamily},
+        {"Pawn", PawnFamily}, {"NecroPawn", PawnFamily}, {"YoungWiz", PawnFamily}, {"PawnHopper", PawnFamily}, {"HellPawn", PawnFamily},
+        {"Bishop", BishopFamily}, {"Wizard", BishopFamily}, {"BeastDruid", BishopFamily}, {"Necromancer", BishopFamily}};
+
+    auto found = familyOfType.find(capturedPiece.getType());
+    if (found != familyOfType.end())
     {
-        gainKingAbilities();
+        gainFamily(found->second);
     }
-    else if (pawnTypes.find(capturedType) != pawnTypes.end())
-    {
-        std::cout << "Howler gains: " << capturedPiece.getType() << " abilities." << std::endl;
-        gainPawnAbilities();
-    }
-    else if (bishopTypes.find(capturedType) != bishopTypes.end())
-    {
-        gainBishopAbilities();
-    }
-};
+}
@@ -7,7 +7,7 @@
 // Main Functions:
 // - bool Knight::canMoveTo(const sf::Vector2f &target, const std::vector<std::unique_ptr<Piece>> &pieces) const:
 //   Checks if the Knight can legally move to the specified target position on the chessboard.
-// - void Knight::highlightValidMoves(std::vector<std::vector<Square>> &board, const std::vector<std::unique_ptr<Piece>> &pieces) const:
+// - void Knight::highlightValidMoves(Board &board, const std::vector<std::unique_ptr<Piece>> &pieces) const:
 //   Highlights all valid moves for the Knight on the provided chessboard, considering its current position and game rules.
 
 // Special Features or Notes:
@@ -23,7 +23,7 @@
 #include "knight.h"
 #include "utility.h"
 #include "globals.h"
-#include "square.h"
+#include "board.h"
 #include <vector>
 
 // Determine if the Knight can move to a specified target position
@@ -42,8 +42,9 @@ bool Knight::canMoveTo(const sf::Vector2f &target, const std::vector<std::unique
 }
 
 // Highlight valid moves for the Knight on the provided board
-void Knight::highlightValidMoves(std::vector<std::vector<Square>> &board, const std::vector<std::unique_ptr<Piece>> &pieces) const
+void Knight::highlightValidMoves(Board &board, const std::vector<std::unique_ptr<Piece>> &pieces) const
 {
+    Board::Highlights highlights;
     sf::Vector2f currentPosition = getPosition();
 
     // Define all possible move positions for the Knight
@@ -60,18 +61,19 @@ void Knight::highlightValidMoves(std::vector<std::vector<Square>> &board, const
     // Iterate through each possible move and highlight valid moves on the board
     for (const auto &move : moves)
     {
-        int col = move.x / TILE_SIZE;
-        int row = move.y / TILE_SIZE;
+        int col = tileIndex(move.x);
+        int row = tileIndex(move.y);
 
         // space is occupied by an opponent piece
         if (col >= 0 && col < BOARD_SIZE && row >= 0 && row < BOARD_SIZE && canMoveTo(move, pieces) && isOpponentPiece(move, pieces, getColor()))
         {
-            board[row][col].setHighlight(true, sf::Color::Red);
+            highlights.captures |= Board::squareMask(row, col);
         }
         // space is unoccupied
         else if (col >= 0 && col < BOARD_SIZE && row >= 0 && row < BOARD_SIZE && canMoveTo(move, pieces))
         {
-            board[row][col].setHighlight(true);
+            highlights.moves |= Board::squareMask(row, col);
         }
     }
+    board.highlight(highlights);
 };
\ No newline at end of file
@@ -3,6 +3,7 @@
 #include "menu.h"
 #include "game.h"
 #include "network.h"
+#include "assetLoader.h"
 #include <iostream>
 #include <vector>
 
@@ -10,15 +11,22 @@ int main()
 { // Make a menu window
     sf::RenderWindow window(sf::VideoMode(640, 640), "Battle Chess");
 
-    sf::Font font;
-    if (!font.loadFromFile("../resources/JmhcthulhumbusarcadeugRegular-JleB.ttf"))
+    // Font and menu background are ready at once; the piece images finish on a worker while we connect and the menu is up
+    std::unique_ptr<AssetLoader> assets;
+    try
     {
-        std::cerr << "Error loading font" << std::endl;
+        assets = std::make_unique<AssetLoader>();
+    }
+    catch (const std::runtime_error &e)
+    {
+        std::cerr << "Error loading resources: " << e.what() << std::endl;
         return -1;
     }
+    sf::Font &font = assets->getFont();
 
     // network operations
-    std::unique_ptr<sf::TcpSocket> socket = initialConnect();
+    Piece::Color playerColor = Piece::Color::White;
+    std::unique_ptr<sf::TcpSocket> socket = initialConnect(playerColor);
 
     std::cout << "Finished initialConnect" << std::endl;
 
@@ -28,12 +36,12 @@ int main()
     {
         if (inMainMenu)
         {
-            showMainMenu(window, font, inMainMenu);
+            showMainMenu(window, font, assets->getMenuBackground(), inMainMenu);
         }
         else
         {
             Game game;
-            game.runChessGame(window, socket);
+            game.runChessGame(window, socket, playerColor, *assets);
         }
     }
 
@@ -687,7 +687,7 @@ void chooseRaceMenu(sf::RenderWindow &window, sf::Font &font, bool &inRaceMenu)
     }
 }
 
-void showMainMenu(sf::RenderWindow &window, sf::Font &font, bool &inMainMenu)
+void showMainMenu(sf::RenderWindow &window, sf::Font &font, const sf::Texture &backgroundTexture, bool &inMainMenu)
 {
     sf::Text title("Battle Chess", font, 50);
     title.setFillColor(sf::Color::White);
@@ -700,9 +700,7 @@ void showMainMenu(sf::RenderWindow &window, sf::Font &font, bool &inMainMenu)
     // set a background
     sf::RectangleShape background;
     background.setSize(sf::Vector2f(640, 640));
-    sf::Texture MainTexture;
-    MainTexture.loadFromFile("../resources/BustedMenu.png");
-    background.setTexture(&MainTexture);
+    background.setTexture(&backgroundTexture);
 
     Button playButton(sf::Vector2f(200, 50), sf::Vector2f(220, 200), "Pick a Race", font);
     Button optionsButton(sf::Vector2f(200, 50), sf::Vector2f(220, 300), "Options", font);
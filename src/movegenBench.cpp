@@ -0,0 +1,290 @@
+// Filename: movegenBench.cpp
+// Description: Entry point of battlechess_movegenbench, which times move generation for every army matchup.
+
+// Main Functions:
+// - int main(int argc, char *argv[]): Times generation and perft for every army matchup and prints their rates.
+
+// Special Features or Notes:
+// - Options: --depth N (default 4), --races necro,hell (default: all five built-in races, custom can be
+//   added), --repeat N (default 5), --pieces <file>, --save <file>, --baseline <file>.
+// - Two rates per matchup: generateMoves alone over every position of the tree above the leaves, and
+//   perft, which adds makeMove. The median of the runs is reported so that one disturbed run cannot
+//   decide it.
+// - --save writes the rates of a build and --baseline reads them back in another build and prints the
+//   ratio per matchup, so a change to the generator is measured matchup by matchup. Leaf counts must
+//   match the baseline, otherwise the rules differ and the tool exits with an error.
+// - With --pieces every matchup is also run with that piece file loaded, so the cost of a prototype
+//   piece shows up next to the built-in rate; leaf counts differ when the file changes the rules.
+// - Each army upgrades its slots king first, then queen, rooks, bishops, knights and pawns until the
+//   gemstone budget runs out, so every race piece the generator has to handle is on the board.
+
+// Usage or Context:
+// - battlechess_movegenbench --depth 5 --races hell,custom --pieces pieces.txt
+// - battlechess_movegenbench --save before.txt, then after the change battlechess_movegenbench --baseline before.txt
+
+#include "engineArmy.h"
+#include "engineMoveGen.h"
+#include "enginePieces.h"
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    const char *raceNames[engine::RaceCount] = {"standard", "necro", "wizard", "beast", "hell", "custom"};
+
+    struct Rates
+    {
+        std::uint64_t nodes = 0;
+        double generated = 0.0; // moves per second from generateMoves alone
+        double perft = 0.0;     // perft leaves per second
+    };
+
+    using Matchup = std::pair<std::string, std::string>;
+
+    engine::ArmyBuild fullBuild(engine::Race race)
+    {
+        static const int order[] = {3, 4, 0, 7, 2, 5, 1, 6, 8, 9, 10, 11, 12, 13, 14, 15};
+        engine::ArmyBuild build;
+        build.race = race;
+        if (race == engine::Standard)
+        {
+            return build;
+        }
+        for (int slot : order)
+        {
+            engine::ArmyBuild upgraded = build;
+            upgraded.upgrades |= static_cast<std::uint16_t>(1 << slot);
+            if (upgraded.isLegal())
+            {
+                build = upgraded;
+            }
+        }
+        return build;
+    }
+
+    engine::Race parseRace(const std::string &name)
+    {
+        for (int race = 0; race < engine::RaceCount; ++race)
+        {
+            if (name == raceNames[race])
+            {
+                return static_cast<engine::Race>(race);
+            }
+        }
+        throw std::runtime_error("Unknown race " + name);
+    }
+
+    // Every position of the tree above the leaves, the ones perft generates moves for
+    void collectPositions(const engine::Position &position, int depth, std::vector<engine::Position> &out)
+    {
+        if (depth == 0 || engine::isLost(position))
+        {
+            return;
+        }
+        out.push_back(position);
+        engine::MoveList list;
+        engine::generateMoves(position, list);
+        for (const engine::Move &move : list)
+        {
+            engine::Position child = position;
+            child.makeMove(move);
+            collectPositions(child, depth - 1, out);
+        }
+    }
+
+    template <typename Run>
+    double seconds(Run run)
+    {
+        auto started = std::chrono::steady_clock::now();
+        run();
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+    }
+
+    double median(std::vector<double> values)
+    {
+        std::sort(values.begin(), values.end());
+        return values[values.size() / 2];
+    }
+
+    Rates measure(const engine::Position &position, int depth, int repeat)
+    {
+        std::vector<engine::Position> positions;
+        collectPositions(position, depth, positions);
+
+        Rates rates;
+        std::uint64_t generated = 0;
+        std::vector<double> generateTimes;
+        std::vector<double> perftTimes;
+        engine::MoveList list;
+        for (int run = 0; run < repeat; ++run)
+        {
+            generateTimes.push_back(seconds([&]
+                                            {
+                generated = 0;
+                for (const engine::Position &each : positions)
+                {
+                    list.count = 0;
+                    engine::generateMoves(each, list);
+                    generated += list.size();
+                } }));
+            perftTimes.push_back(seconds([&] { rates.nodes = engine::perft(position, depth); }));
+        }
+        rates.generated = generated / std::max(median(generateTimes), 1e-9);
+        rates.perft = rates.nodes / std::max(median(perftTimes), 1e-9);
+        return rates;
+    }
+
+    std::map<Matchup, Rates> loadBaseline(const std::string &path)
+    {
+        std::ifstream in(path);
+        if (!in)
+        {
+            throw std::runtime_error("Cannot open " + path);
+        }
+        std::map<Matchup, Rates> baseline;
+        std::string white;
+        std::string black;
+        Rates rates;
+        while (in >> white >> black >> rates.nodes >> rates.generated >> rates.perft)
+        {
+            baseline[Matchup(white, black)] = rates;
+        }
+        return baseline;
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    int depth = 4;
+    int repeat = 5;
+    std::vector<engine::Race> races = {engine::Standard, engine::Necro, engine::WizardRace, engine::Beast, engine::Hell};
+    std::string piecesPath;
+    std::string savePath;
+    engine::PieceCatalog pieces;
+    std::map<Matchup, Rates> baseline;
+
+    try
+    {
+        for (int i = 1; i + 1 < argc; i += 2)
+        {
+            std::string flag = argv[i];
+            std::string value = argv[i + 1];
+            if (flag == "--depth")
+                depth = std::stoi(value);
+            else if (flag == "--repeat")
+                repeat = std::max(1, std::stoi(value));
+            else if (flag == "--races")
+            {
+                races.clear();
+                std::stringstream list(value);
+                std::string name;
+                while (std::getline(list, name, ','))
+                {
+                    races.push_back(parseRace(name));
+                }
+            }
+            else if (flag == "--pieces")
+            {
+                piecesPath = value;
+                pieces = engine::PieceCatalog::load(value);
+            }
+            else if (flag == "--save")
+                savePath = value;
+            else if (flag == "--baseline")
+                baseline = loadBaseline(value);
+            else
+                throw std::runtime_error("Unknown option " + flag);
+        }
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << "Error: " << e.what() << std::endl;
+        std::cerr << "Usage: battlechess_movegenbench [--depth N] [--races necro,hell] [--repeat N] [--pieces file] "
+                     "[--save file] [--baseline file]"
+                  << std::endl;
+        return 1;
+    }
+
+    std::ofstream save;
+    if (!savePath.empty())
+    {
+        save.open(savePath);
+        if (!save)
+        {
+            std::cerr << "Error: cannot write " << savePath << std::endl;
+            return 1;
+        }
+    }
+
+    for (engine::Race race : races)
+    {
+        std::cout << fullBuild(race).describe() << std::endl;
+    }
+    std::cout << std::setw(12) << "white" << std::setw(12) << "black" << std::setw(14) << "nodes" << std::setw(14) << "generated/s"
+              << std::setw(14) << "perft/s";
+    if (!baseline.empty())
+    {
+        std::cout << std::setw(12) << "gen ratio" << std::setw(12) << "perft ratio";
+    }
+    if (!piecesPath.empty())
+    {
+        std::cout << std::setw(14) << "file nodes" << std::setw(14) << "file perft/s";
+    }
+    std::cout << std::endl;
+
+    for (engine::Race white : races)
+    {
+        for (engine::Race black : races)
+        {
+            engine::Position position = engine::armyStartPosition(fullBuild(white), fullBuild(black));
+            Matchup matchup(raceNames[white], raceNames[black]);
+            engine::setPieceCatalog(engine::PieceCatalog::builtIn());
+            Rates rates = measure(position, depth, repeat);
+
+            std::cout << std::setw(12) << matchup.first << std::setw(12) << matchup.second << std::setw(14) << rates.nodes
+                      << std::fixed << std::setprecision(0) << std::setw(14) << rates.generated << std::setw(14) << rates.perft;
+            if (!baseline.empty())
+            {
+                auto found = baseline.find(matchup);
+                if (found == baseline.end())
+                {
+                    std::cout << std::setw(12) << "-" << std::setw(12) << "-";
+                }
+                else if (found->second.nodes != rates.nodes)
+                {
+                    std::cout << std::endl;
+                    std::cerr << "Error: " << rates.nodes << " leaves, the baseline has " << found->second.nodes << std::endl;
+                    return 1;
+                }
+                else
+                {
+                    // Above 1 this build is faster than the baseline
+                    std::cout << std::setprecision(3) << std::setw(12) << rates.generated / found->second.generated
+                              << std::setw(12) << rates.perft / found->second.perft << std::setprecision(0);
+                }
+            }
+            if (!piecesPath.empty())
+            {
+                engine::setPieceCatalog(pieces);
+                Rates fileRates = measure(position, depth, repeat);
+                std::cout << std::setw(14) << fileRates.nodes << std::setw(14) << fileRates.perft;
+            }
+            std::cout << std::endl;
+
+            if (save.is_open())
+            {
+                save << matchup.first << ' ' << matchup.second << ' ' << rates.nodes << ' ' << std::fixed << std::setprecision(0)
+                     << rates.generated << ' ' << rates.perft << std::endl;
+            }
+        }
+    }
+    return 0;
+}
@@ -7,16 +7,17 @@
 // Main Functions:
 // - bool NecroPawn::canMoveTo(const sf::Vector2f &target, const std::vector<std::unique_ptr<Piece>> &pieces) const:
 //   Determines if the NecroPawn can move to a given target position based on its movement rules.
-// - void NecroPawn::highlightValidMoves(std::vector<std::vector<Square>> &board, const std::vector<std::unique_ptr<Piece>> &pieces) const:
+// - void NecroPawn::highlightValidMoves(Board &board, const std::vector<std::unique_ptr<Piece>> &pieces) const:
 //   Highlights all valid moves for the NecroPawn on the provided chessboard.
-// - void NecroPawn::sacrifice(std::vector<std::unique_ptr<Piece>> &pieces):
+// - void NecroPawn::sacrifice(std::vector<std::unique_ptr<Piece>> &pieces, const AreaEffect::QueenOfBonesFallen &onQueenOfBonesFallen):
 //   Sacrifices the NecroPawn to capture adjacent/diagnal (both friendly and opponent) pieces and remove itself from the board.
-// - std::vector<sf::Vector2f> NecroPawn::getCapturePositions() const: Returns all adjacent/diagnal positions for potential captures.
 
 // Special Features or Notes:
 // - NecroPawn moves like a regular pawn. It is a Level 2 Pawn piece belonging to the Necromancer race.
 // - NecroPawn can either capture diagnally like a regular pawn or,
 //   It has a unique ability to sacrifice itself to capture all adjacent and diagnal pieces.
+//   The sacrifice is resolved by AreaEffect, so a QueenOfDestruction caught in it sets off her mass destruction
+//   and a QueenOfBones caught in it is offered her revival.
 // - It inherits from the Piece class.
 
 // Usage or Context:
@@ -25,7 +26,7 @@
 #include "necroPawn.h"
 #include "utility.h"
 #include "globals.h"
-#include "square.h"
+#include "board.h"
 #include <vector>
 #include <iostream> // Include for debug output
 
@@ -65,21 +66,22 @@ bool NecroPawn::canMoveTo(const sf::Vector2f &target, const std::vector<std::uni
 }
 
 // Highlight valid moves for the Pawn on the provided board
-void NecroPawn::highlightValidMoves(std::vector<std::vector<Square>> &board, const std::vector<std::unique_ptr<Piece>> &pieces) const
+void NecroPawn::highlightValidMoves(Board &board, const std::vector<std::unique_ptr<Piece>> &pieces) const
 {
+    Board::Highlights highlights;
     sf::Vector2f currentPosition = getPosition();
-    int currentRow = currentPosition.y / TILE_SIZE;
-    int currentCol = currentPosition.x / TILE_SIZE;
+    int currentRow = tileIndex(currentPosition.y);
+    int currentCol = tileIndex(currentPosition.x);
     float direction = (getColor() == Piece::Color::White) ? 1.0f : -1.0f; // White moves down, Black moves up
 
     // Highlight the current position in red
-    board[currentRow][currentCol].setHighlight(true, sf::Color::Red);
+    highlights.captures |= Board::squareMask(currentRow, currentCol);
 
     // Highlight single step forward
     sf::Vector2f singleStep = sf::Vector2f(currentPosition.x, currentPosition.y + direction * TILE_SIZE);
     if (canMoveTo(singleStep, pieces))
     {
-        board[static_cast<int>(singleStep.y / TILE_SIZE)][static_cast<int>(singleStep.x / TILE_SIZE)].setHighlight(true);
+        highlights.moves |= Board::squareMask(tileIndex(singleStep.y), tileIndex(singleStep.x));
     }
 
     // Highlight double step forward on first move
@@ -88,72 +90,31 @@ void NecroPawn::highlightValidMoves(std::vector<std::vector<Square>> &board, con
          (getColor() == Piece::Color::Black && currentPosition.y == 6 * TILE_SIZE)) &&
         canMoveTo(doubleStep, pieces))
     {
-        board[static_cast<int>(doubleStep.y / TILE_SIZE)][static_cast<int>(doubleStep.x / TILE_SIZE)].setHighlight(true);
+        highlights.moves |= Board::squareMask(tileIndex(doubleStep.y), tileIndex(doubleStep.x));
     }
 
     // Highlight diagonal captures in red
     sf::Vector2f diagonalLeft = sf::Vector2f(currentPosition.x - TILE_SIZE, currentPosition.y + direction * TILE_SIZE);
     if (canMoveTo(diagonalLeft, pieces))
     {
-        board[static_cast<int>(diagonalLeft.y / TILE_SIZE)][static_cast<int>(diagonalLeft.x / TILE_SIZE)].setHighlight(true, sf::Color::Red);
+        highlights.captures |= Board::squareMask(tileIndex(diagonalLeft.y), tileIndex(diagonalLeft.x));
     }
 
     sf::Vector2f diagonalRight = sf::Vector2f(currentPosition.x + TILE_SIZE, currentPosition.y + direction * TILE_SIZE);
     if (canMoveTo(diagonalRight, pieces))
     {
-        board[static_cast<int>(diagonalRight.y / TILE_SIZE)][static_cast<int>(diagonalRight.x / TILE_SIZE)].setHighlight(true, sf::Color::Red);
+        highlights.captures |= Board::squareMask(tileIndex(diagonalRight.y), tileIndex(diagonalRight.x));
     }
+    board.highlight(highlights);
 }
 
 // The sacrifice ability captures itself and all adjacent and vertical pieces.
-void NecroPawn::sacrifice(std::vector<std::unique_ptr<Piece>> &pieces)
+void NecroPawn::sacrifice(std::vector<std::unique_ptr<Piece>> &pieces, const AreaEffect::QueenOfBonesFallen &onQueenOfBonesFallen)
 {
     sf::Vector2f currentPosition = getPosition();
-    std::vector<sf::Vector2f> capturePositions = getCapturePositions();
+    std::cout << "NecroPawn at (" << currentPosition.x / TILE_SIZE << ", " << currentPosition.y / TILE_SIZE << ") has been sacrificed.\n";
 
-    // Iterate over all adjacent positions and capture any pieces found
-    for (const auto &pos : capturePositions)
-    {
-        for (auto it = pieces.begin(); it != pieces.end();)
-        {
-            if ((*it)->getPosition() == pos)
-            {
-                std::cout << "Capturing piece at position: (" << pos.x / TILE_SIZE << ", " << pos.y / TILE_SIZE << ")\n";
-                it = pieces.erase(it); // Remove the piece and update iterator
-            }
-            else
-            {
-                ++it;
-            }
-        }
-    }
-
-    // Sacrifice this NecroPawn by removing it from the pieces
-    for (auto it = pieces.begin(); it != pieces.end();)
-    {
-        if ((*it)->getPosition() == currentPosition)
-        {
-            std::cout << "NecroPawn at (" << currentPosition.x / TILE_SIZE << ", " << currentPosition.y / TILE_SIZE << ") has been sacrificed.\n";
-            it = pieces.erase(it); // Remove the NecroPawn and update iterator
-        }
-        else
-        {
-            ++it;
-        }
-    }
+    // This NecroPawn is among the captured pieces, so nothing may touch it after the capture
+    AreaEffect area(pieces);
+    area.capture(AreaEffect::adjacentSquares(currentPosition) | AreaEffect::squareMask(currentPosition), this, onQueenOfBonesFallen);
 }
-
-// Returns all adjacent and vertical squares to the current selected position
-std::vector<sf::Vector2f> NecroPawn::getCapturePositions() const
-{
-    sf::Vector2f currentPosition = getPosition();
-    return {
-        {currentPosition.x + TILE_SIZE, currentPosition.y},
-        {currentPosition.x - TILE_SIZE, currentPosition.y},
-        {currentPosition.x, currentPosition.y + TILE_SIZE},
-        {currentPosition.x, currentPosition.y - TILE_SIZE},
-        {currentPosition.x + TILE_SIZE, currentPosition.y + TILE_SIZE},
-        {currentPosition.x + TILE_SIZE, currentPosition.y - TILE_SIZE},
-        {currentPosition.x - TILE_SIZE, currentPosition.y + TILE_SIZE},
-        {currentPosition.x - TILE_SIZE, currentPosition.y - TILE_SIZE}};
-}
\ No newline at end of file
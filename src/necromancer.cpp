@@ -7,9 +7,9 @@
 // Main Functions:
 // - bool Necromancer::canMoveTo(const sf::Vector2f &target, const std::vector<std::unique_ptr<Piece>> &pieces) const:
 //   Determines if the Necromancer can move to a given target position based on its movement rules.
-// - void Necromancer::highlightValidMoves(std::vector<std::vector<Square>> &board, const std::vector<std::unique_ptr<Piece>> &pieces) const:
+// - void Necromancer::highlightValidMoves(Board &board, const std::vector<std::unique_ptr<Piece>> &pieces) const:
 //   Highlights all valid moves for the Necromancer on the provided chessboard.
-// - bool Necromancer::raiseDead(const sf::Vector2f &targetPosition, std::vector<std::vector<Square>> &board, std::vector<std::unique_ptr<Piece>> &pieces):
+// - bool Necromancer::raiseDead(const sf::Vector2f &targetPosition, Board &board, std::vector<std::unique_ptr<Piece>> &pieces):
 //   Attempts to raise a pawn at adjacent positions to the target position.
 // - sf::Texture &Necromancer::getPawnTexture(): Retrieves the appropriate pawn texture based on the Necromancer's color.
 // - std::vector<sf::Vector2f> Necromancer::getAdjacentPositions(const sf::Vector2f &position) const:
@@ -46,8 +46,9 @@ bool Necromancer::canMoveTo(const sf::Vector2f &target, const std::vector<std::u
 }
 
 // Highlight valid moves for the Pawn on the provided board
-void Necromancer::highlightValidMoves(std::vector<std::vector<Square>> &board, const std::vector<std::unique_ptr<Piece>> &pieces) const
+void Necromancer::highlightValidMoves(Board &board, const std::vector<std::unique_ptr<Piece>> &pieces) const
 {
+    Board::Highlights highlights;
     sf::Vector2f currentPosition = getPosition();
     Piece::Color currentPlayerColor = getColor();
 
@@ -59,8 +60,8 @@ void Necromancer::highlightValidMoves(std::vector<std::vector<Square>> &board, c
             // Check valid moves in each diagonal direction
             for (float i = 1; i < BOARD_SIZE; ++i)
             {
-                int newX = static_cast<int>(currentPosition.x / TILE_SIZE) + i * dx;
-                int newY = static_cast<int>(currentPosition.y / TILE_SIZE) + i * dy;
+                int newX = tileIndex(currentPosition.x) + i * dx;
+                int newY = tileIndex(currentPosition.y) + i * dy;
 
                 // Check if the new position is within the board bounds
                 if (newX >= 0 && newX < BOARD_SIZE && newY >= 0 && newY < BOARD_SIZE)
@@ -72,11 +73,11 @@ void Necromancer::highlightValidMoves(std::vector<std::vector<Square>> &board, c
                     {
                         if (!isOpponentPiece(newPosition, pieces, currentPlayerColor))
                         {
-                            board[newY][newX].setHighlight(true);
+                            highlights.moves |= Board::squareMask(newY, newX);
                         }
                         else if (isOpponentPiece(newPosition, pieces, currentPlayerColor))
                         {
-                            board[newY][newX].setHighlight(true, sf::Color::Red);
+                            highlights.captures |= Board::squareMask(newY, newX);
                         }
 
                         // If the position is occupied by an opponent's piece, stop highlighting in this direction
@@ -99,11 +100,13 @@ void Necromancer::highlightValidMoves(std::vector<std::vector<Square>> &board, c
             }
         }
     }
+    board.highlight(highlights);
 }
 
 // Place a pawn piece in a selected adjacent square
-bool Necromancer::raiseDead(const sf::Vector2f &targetPosition, std::vector<std::vector<Square>> &board, std::vector<std::unique_ptr<Piece>> &pieces, TextureManager &textureManager)
+bool Necromancer::raiseDead(const sf::Vector2f &targetPosition, Board &board, std::vector<std::unique_ptr<Piece>> &pieces, TextureManager &textureManager)
 {
+    Board::Highlights highlights;
     bool awaitingPawnPlacement = false;
     const sf::Texture &pawnTexture = getPawnTexture(textureManager);
 
@@ -119,14 +122,15 @@ bool Necromancer::raiseDead(const sf::Vector2f &targetPosition, std::vector<std:
             if (!getPieceAtPosition(pos, pieces))
             {
                 awaitingPawnPlacement = true;
-                int col = pos.x / TILE_SIZE;
-                int row = pos.y / TILE_SIZE;
+                int col = tileIndex(pos.x);
+                int row = tileIndex(pos.y);
                 // Highlight the square for pawn placement
-                board[row][col].setHighlight(true, sf::Color::Green);
+                highlights.abilities |= Board::squareMask(row, col);
                 std::cout << "hightlighting for pawn placement: (" << col << ", " << row << ")" << std::endl; // Debug
             }
         }
     }
+    board.highlight(highlights);
     return awaitingPawnPlacement;
 }
 
@@ -8,7 +8,7 @@
 #include "globals.h"
 #include "textureManager.h"
 #include "utility.h"
-#include "square.h"
+#include "board.h"
 #include "network.h"
 #include "piece.h"
 #include "pieceFactory.h"
@@ -26,7 +26,7 @@ sf::Packet &operator>>(sf::Packet &packet, PieceData &data)
     return packet >> data.id >> data.position.x >> data.position.y;
 }
 
-std::unique_ptr<sf::TcpSocket> initialConnect()
+std::unique_ptr<sf::TcpSocket> initialConnect(Piece::Color &playerColor)
 {
     sf::IpAddress ip = sf::IpAddress::getLocalAddress();
     sf::TcpListener listener;
@@ -41,7 +41,7 @@ std::unique_ptr<sf::TcpSocket> initialConnect()
 
     if (connectionType == 's')
     {
-        isPlayerWhite = true;
+        playerColor = Piece::Color::White;
 
         if (listener.listen(2000) != sf::Socket::Done)
         {
@@ -60,7 +60,7 @@ std::unique_ptr<sf::TcpSocket> initialConnect()
     }
     else if (connectionType == 'c')
     {
-        isPlayerWhite = false;
+        playerColor = Piece::Color::Black;
 
         if (socket->connect(ip, 2000) != sf::Socket::Done)
         {
@@ -95,10 +95,13 @@ std::unique_ptr<sf::TcpSocket> initialConnect()
     return socket; // Return the unique_ptr to manage the socket's lifetime.
 }
 
-void sendPacket(std::unique_ptr<sf::TcpSocket> &socket, const std::vector<std::unique_ptr<Piece>> &currentPack)
+void sendPacket(std::unique_ptr<sf::TcpSocket> &socket, const std::vector<std::unique_ptr<Piece>> &currentPack, bool turnComplete)
 {
     sf::Packet packet;
 
+    // Whether the opponent is on turn after this packet
+    packet << turnComplete;
+
     // Serialize the number of pieces
     packet << static_cast<sf::Uint32>(currentPack.size());
 
@@ -122,7 +125,7 @@ void sendPacket(std::unique_ptr<sf::TcpSocket> &socket, const std::vector<std::u
     }
 }
 
-void receivePacket(std::unique_ptr<sf::TcpSocket> &socket, std::vector<std::unique_ptr<Piece>> &currentPack, TextureManager &textureManager, Piece::Color color)
+bool receivePacket(std::unique_ptr<sf::TcpSocket> &socket, std::vector<std::unique_ptr<Piece>> &currentPack, GameContext &context, Piece::Color color, bool &turnComplete)
 {
     sf::Packet packet;
     socket->setBlocking(false);
@@ -131,22 +134,22 @@ void receivePacket(std::unique_ptr<sf::TcpSocket> &socket, std::vector<std::uniq
     if (status == sf::Socket::Disconnected)
     {
         std::cerr << "Disconnected from the server" << std::endl;
-        return;
+        return false;
     }
     else if (status == sf::Socket::NotReady)
     {
         // std::cout << "Socket not ready for receiving data" << std::endl;
-        return;
+        return false;
     }
     else if (status != sf::Socket::Done)
     {
         std::cerr << "Error: Unable to receive the packet" << std::endl;
-        return;
+        return false;
     }
 
-    // Deserialize the number of pieces
+    // Deserialize the turn flag and the number of pieces
     sf::Uint32 numPieces;
-    packet >> numPieces;
+    packet >> turnComplete >> numPieces;
 
     // A set to track the IDs of pieces received in the packet
     std::set<int> receivedPieceIDs;
@@ -165,6 +168,7 @@ void receivePacket(std::unique_ptr<sf::TcpSocket> &socket, std::vector<std::uniq
 
         // Add the ID to the set of received IDs
         receivedPieceIDs.insert(id);
+        context.observeId(id);
 
         // Find the piece by its ID and update its position
         bool found = false;
@@ -183,7 +187,7 @@ void receivePacket(std::unique_ptr<sf::TcpSocket> &socket, std::vector<std::uniq
         // If the piece was not found in currentPack, create and add it
         if (!found)
         {
-            auto newPiece = createPiece(id, type, textureManager, position, color);
+            auto newPiece = createPiece(id, type, context.getTextures(), position, color);
             newPiece->setStunned(isStunned);
             newPiece->setStone(isStone);
             currentPack.push_back(std::move(newPiece));
@@ -199,4 +203,5 @@ void receivePacket(std::unique_ptr<sf::TcpSocket> &socket, std::vector<std::uniq
                       currentPack.end());
 
     std::cout << "Packet received and currentPack positions updated successfully!" << std::endl;
+    return true;
 }
@@ -0,0 +1,86 @@
+// Filename: packMain.cpp
+// Description: Entry point of the battlechess_pack build step, which packs the game's resources into one archive.
+
+// Main Functions:
+// - int main(int argc, char *argv[]): Decodes every image given and writes them with the font into the archive.
+
+// Special Features or Notes:
+// - Arguments: <archive> <resource file>... Each entry is named after its file without the extension.
+// - PNG files are decoded here, at build time, and stored as RGBA pixels; .ttf files are stored as they are.
+//   Anything else is stored raw.
+
+// Usage or Context:
+// - Run by the build (cmakelists.txt) whenever a file in resources/ changes; the game maps the result at startup.
+
+#include "resourceArchive.h"
+#include <SFML/Graphics.hpp>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+
+namespace
+{
+    std::string extensionOf(const std::string &path)
+    {
+        std::size_t dot = path.find_last_of('.');
+        return dot == std::string::npos ? "" : path.substr(dot + 1);
+    }
+
+    std::string stemOf(const std::string &path)
+    {
+        std::size_t slash = path.find_last_of("/\\");
+        std::string file = slash == std::string::npos ? path : path.substr(slash + 1);
+        return file.substr(0, file.find_last_of('.'));
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc < 3)
+    {
+        std::cerr << "Usage: battlechess_pack <archive> <resource file>..." << std::endl;
+        return 1;
+    }
+
+    std::vector<ResourceArchive::Item> items;
+    for (int i = 2; i < argc; ++i)
+    {
+        std::string path = argv[i];
+        ResourceArchive::Item item;
+        item.name = stemOf(path);
+
+        if (extensionOf(path) == "png")
+        {
+            sf::Image image;
+            if (!image.loadFromFile(path))
+            {
+                std::cerr << "Failed to decode " << path << std::endl;
+                return 1;
+            }
+            const sf::Uint8 *pixels = image.getPixelsPtr();
+            item.type = ResourceArchive::Type::Image;
+            item.width = image.getSize().x;
+            item.height = image.getSize().y;
+            item.bytes.assign(pixels, pixels + std::size_t(item.width) * item.height * 4);
+        }
+        else
+        {
+            std::ifstream file(path, std::ios::binary);
+            if (!file)
+            {
+                std::cerr << "Failed to read " << path << std::endl;
+                return 1;
+            }
+            item.type = extensionOf(path) == "ttf" ? ResourceArchive::Type::Font : ResourceArchive::Type::Raw;
+            item.bytes.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        }
+        items.push_back(std::move(item));
+    }
+
+    if (!ResourceArchive::write(argv[1], std::move(items)))
+    {
+        std::cerr << "Failed to write " << argv[1] << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -7,7 +7,7 @@
 // Main Functions:
 // - bool Pawn::canMoveTo(const sf::Vector2f &target, const std::vector<std::unique_ptr<Piece>> &pieces) const:
 //   Checks if the Pawn can legally move to the specified target position on the chessboard.
-// - void Pawn::highlightValidMoves(std::vector<std::vector<Square>> &board, const std::vector<std::unique_ptr<Piece>> &pieces) const:
+// - void Pawn::highlightValidMoves(Board &board, const std::vector<std::unique_ptr<Piece>> &pieces) const:
 //   Highlights all valid moves for the Pawn on the provided chessboard, considering its current position and game rules.
 
 // Special Features or Notes:
@@ -22,7 +22,7 @@
 #include "pawn.h"
 #include "utility.h"
 #include "globals.h"
-#include "square.h"
+#include "board.h"
 #include <vector>
 
 // Determine if the Pawn can move to a specified target position
@@ -65,8 +65,9 @@ bool Pawn::canMoveTo(const sf::Vector2f &target, const std::vector<std::unique_p
 }
 
 // Highlight valid moves for the Pawn on the provided board
-void Pawn::highlightValidMoves(std::vector<std::vector<Square>> &board, const std::vector<std::unique_ptr<Piece>> &pieces) const
+void Pawn::highlightValidMoves(Board &board, const std::vector<std::unique_ptr<Piece>> &pieces) const
 {
+    Board::Highlights highlights;
     sf::Vector2f currentPosition = getPosition();
     float direction = (getColor() == Piece::Color::White) ? 1.0f : -1.0f; // White moves down, Black moves up
 
@@ -74,7 +75,7 @@ void Pawn::highlightValidMoves(std::vector<std::vector<Square>> &board, const st
     sf::Vector2f singleStep = sf::Vector2f(currentPosition.x, currentPosition.y + direction * TILE_SIZE);
     if (singleStep.y >= 0 && singleStep.y < BOARD_SIZE * TILE_SIZE && canMoveTo(singleStep, pieces))
     {
-        board[static_cast<int>(singleStep.y / TILE_SIZE)][static_cast<int>(singleStep.x / TILE_SIZE)].setHighlight(true);
+        highlights.moves |= Board::squareMask(tileIndex(singleStep.y), tileIndex(singleStep.x));
     }
 
     // Highlight double step forward on first move
@@ -84,7 +85,7 @@ void Pawn::highlightValidMoves(std::vector<std::vector<Square>> &board, const st
          (getColor() == Piece::Color::Black && currentPosition.y == 6 * TILE_SIZE)) &&
         canMoveTo(doubleStep, pieces))
     {
-        board[static_cast<int>(doubleStep.y / TILE_SIZE)][static_cast<int>(doubleStep.x / TILE_SIZE)].setHighlight(true);
+        highlights.moves |= Board::squareMask(tileIndex(doubleStep.y), tileIndex(doubleStep.x));
     }
 
     // Highlight diagonal captures
@@ -92,13 +93,14 @@ void Pawn::highlightValidMoves(std::vector<std::vector<Square>> &board, const st
     if (diagonalLeft.x >= 0 && diagonalLeft.x < BOARD_SIZE * TILE_SIZE && diagonalLeft.y >= 0 && diagonalLeft.y < BOARD_SIZE * TILE_SIZE &&
         canMoveTo(diagonalLeft, pieces))
     {
-        board[static_cast<int>(diagonalLeft.y / TILE_SIZE)][static_cast<int>(diagonalLeft.x / TILE_SIZE)].setHighlight(true, sf::Color::Red);
+        highlights.captures |= Board::squareMask(tileIndex(diagonalLeft.y), tileIndex(diagonalLeft.x));
     }
 
     sf::Vector2f diagonalRight = sf::Vector2f(currentPosition.x + TILE_SIZE, currentPosition.y + direction * TILE_SIZE);
     if (diagonalRight.x >= 0 && diagonalRight.x < BOARD_SIZE * TILE_SIZE && diagonalRight.y >= 0 && diagonalRight.y < BOARD_SIZE * TILE_SIZE &&
         canMoveTo(diagonalRight, pieces))
     {
-        board[static_cast<int>(diagonalRight.y / TILE_SIZE)][static_cast<int>(diagonalRight.x / TILE_SIZE)].setHighlight(true, sf::Color::Red);
+        highlights.captures |= Board::squareMask(tileIndex(diagonalRight.y), tileIndex(diagonalRight.x));
     }
+    board.highlight(highlights);
 }
\ No newline at end of file
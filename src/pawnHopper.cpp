@@ -7,7 +7,7 @@
 // Main Functions:
 // - bool PawnHopper::canMoveTo(const sf::Vector2f &target, const std::vector<std::unique_ptr<Piece>> &pieces) const:
 //   Checks if the PawnHopper can legally move to the specified target position on the chessboard.
-// - void PawnHopper::highlightValidMoves(std::vector<std::vector<Square>> &board, const std::vector<std::unique_ptr<Piece>> &pieces) const:
+// - void PawnHopper::highlightValidMoves(Board &board, const std::vector<std::unique_ptr<Piece>> &pieces) const:
 //   Highlights all valid moves for the PawnHopper on the provided chessboard, considering its current position and game rules.
 // - void PawnHopper::captureHoppedPiece(const sf::Vector2f &target, std::vector<std::unique_ptr<Piece>> &pieces) const:
 //   logic for capturing when hopping over an enemy unit
@@ -26,7 +26,7 @@
 #include "pawnHopper.h"
 #include "utility.h"
 #include "globals.h"
-#include "square.h"
+#include "board.h"
 #include <vector>
 
 // Determine if the PawnHopper can move to a specified target position
@@ -62,8 +62,9 @@ bool PawnHopper::canMoveTo(const sf::Vector2f &target, const std::vector<std::un
 }
 
 // Highlight valid moves for the PawnHopper on the provided board
-void PawnHopper::highlightValidMoves(std::vector<std::vector<Square>> &board, const std::vector<std::unique_ptr<Piece>> &pieces) const
+void PawnHopper::highlightValidMoves(Board &board, const std::vector<std::unique_ptr<Piece>> &pieces) const
 {
+    Board::Highlights highlights;
     sf::Vector2f currentPosition = getPosition();
     float direction = (getColor() == Piece::Color::White) ? 1.0f : -1.0f; // White moves down, Black moves up
 
@@ -71,7 +72,7 @@ void PawnHopper::highlightValidMoves(std::vector<std::vector<Square>> &board, co
     sf::Vector2f singleStep = sf::Vector2f(currentPosition.x, currentPosition.y + direction * TILE_SIZE);
     if (singleStep.y >= 0 && singleStep.y < BOARD_SIZE * TILE_SIZE && canMoveTo(singleStep, pieces))
     {
-        board[static_cast<int>(singleStep.y / TILE_SIZE)][static_cast<int>(singleStep.x / TILE_SIZE)].setHighlight(true);
+        highlights.moves |= Board::squareMask(tileIndex(singleStep.y), tileIndex(singleStep.x));
     }
 
     // Highlight double step forward
@@ -79,14 +80,15 @@ void PawnHopper::highlightValidMoves(std::vector<std::vector<Square>> &board, co
     if (doubleStep.y >= 0 && doubleStep.y < BOARD_SIZE * TILE_SIZE &&
         canMoveTo(doubleStep, pieces))
     {
+        // Only hopping an opponent captures it; hopping a friendly piece is a plain move
         sf::Vector2f intermediatePosition = sf::Vector2f(currentPosition.x, currentPosition.y + direction * TILE_SIZE);
-        if (!getPieceAtPosition(intermediatePosition, pieces))
+        if (!isOpponentPiece(intermediatePosition, pieces, getColor()))
         {
-            board[static_cast<int>(doubleStep.y / TILE_SIZE)][static_cast<int>(doubleStep.x / TILE_SIZE)].setHighlight(true);
+            highlights.moves |= Board::squareMask(tileIndex(doubleStep.y), tileIndex(doubleStep.x));
         }
         else
         {
-            board[static_cast<int>(doubleStep.y / TILE_SIZE)][static_cast<int>(doubleStep.x / TILE_SIZE)].setHighlight(true, sf::Color::Red);
+            highlights.captures |= Board::squareMask(tileIndex(doubleStep.y), tileIndex(doubleStep.x));
         }
     }
 
@@ -95,15 +97,16 @@ void PawnHopper::highlightValidMoves(std::vector<std::vector<Square>> &board, co
     if (diagonalLeft.x >= 0 && diagonalLeft.x < BOARD_SIZE * TILE_SIZE && diagonalLeft.y >= 0 && diagonalLeft.y < BOARD_SIZE * TILE_SIZE &&
         canMoveTo(diagonalLeft, pieces))
     {
-        board[static_cast<int>(diagonalLeft.y / TILE_SIZE)][static_cast<int>(diagonalLeft.x / TILE_SIZE)].setHighlight(true, sf::Color::Red);
+        highlights.captures |= Board::squareMask(tileIndex(diagonalLeft.y), tileIndex(diagonalLeft.x));
     }
 
     sf::Vector2f diagonalRight = sf::Vector2f(currentPosition.x + TILE_SIZE, currentPosition.y + direction * TILE_SIZE);
     if (diagonalRight.x >= 0 && diagonalRight.x < BOARD_SIZE * TILE_SIZE && diagonalRight.y >= 0 && diagonalRight.y < BOARD_SIZE * TILE_SIZE &&
         canMoveTo(diagonalRight, pieces))
     {
-        board[static_cast<int>(diagonalRight.y / TILE_SIZE)][static_cast<int>(diagonalRight.x / TILE_SIZE)].setHighlight(true, sf::Color::Red);
+        highlights.captures |= Board::squareMask(tileIndex(diagonalRight.y), tileIndex(diagonalRight.x));
     }
+    board.highlight(highlights);
 }
 
 // If moving two spaces forward, passing over an enemy unit, capture the enemy unit
@@ -117,7 +120,7 @@ void PawnHopper::captureHoppedPiece(const sf::Vector2f &target, std::vector<std:
         sf::Vector2f hoppedPosition = sf::Vector2f(currentPosition.x, currentPosition.y + direction * TILE_SIZE);
         for (auto &piece : pieces)
         {
-            if (piece->getPosition() == hoppedPosition && piece->getColor() != getColor())
+            if (piece->getPosition() == hoppedPosition && isOpponentPiece(hoppedPosition, pieces, getColor()))
             {
                 // Find the piece at the hopped position and remove it
                 auto it = std::remove_if(pieces.begin(), pieces.end(),
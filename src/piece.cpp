@@ -1,4 +1,21 @@
 #include "piece.h"
+#include "pieceTable.h"
+
+Piece::~Piece()
+{
+    if (tableRow.table)
+    {
+        tableRow.table->forget(this);
+    }
+}
+
+void Piece::reportChange() const
+{
+    if (tableRow.table)
+    {
+        tableRow.table->update(*this);
+    }
+}
 
 std::ostream &operator<<(std::ostream &os, const Piece &piece)
 {
@@ -0,0 +1,246 @@
+// Filename: piecePool.cpp
+// Description: Implementation of the PiecePool class and of Piece::operator new/delete, which place pieces in pooled slots.
+
+// Main Classes:
+// - PiecePool: A free list of equally sized slots in blocks, each large enough for any piece class, with a generation per slot.
+
+// Main Functions:
+// - void *PiecePool::allocate(std::size_t size) / bool PiecePool::release(void *memory): Takes and returns a slot.
+// - PiecePool::Handle PiecePool::handleOf(const Piece *piece) const / Piece *PiecePool::resolve(Handle handle) const:
+//   Generation-checked references to pooled pieces.
+// - void *Piece::operator new(std::size_t size) / void Piece::operator delete(void *memory):
+//   Route every piece allocation through the installed pool and every release to the pool that holds the piece.
+
+// Special Features or Notes:
+// - The slot size is the largest piece class, so the pool never needs to know which piece it is holding.
+// - Allocation and release are O(1): a slot index is popped from or pushed onto the free list. When it is empty
+//   a new block of slots is added; blocks are never moved or freed before the pool, so pieces keep their address.
+// - A slot's generation is odd while it is in use and is bumped on allocation and release, so a stale handle
+//   fails to resolve even after the slot has been handed to a new piece.
+// - Every piece is preceded by a SlotHeader naming its pool and slot, or no pool for a piece on the heap.
+//   operator delete and handleOf read it, so a piece is freed to its own pool whichever pool is installed, or
+//   none, when it is destroyed. The pool must outlive its pieces.
+// - Without an installed pool pieces are allocated on the heap as before.
+// - The installed pool is per thread and a pool is not locked; its pieces are created and destroyed on one thread.
+
+// Usage or Context:
+// - Game::runChessGame installs a pool for the length of a game; PiecePool::current() reports its counters.
+
+#include "piecePool.h"
+#include "piece.h"
+#include "rook.h"
+#include "bishop.h"
+#include "knight.h"
+#include "pawn.h"
+#include "queen.h"
+#include "king.h"
+#include "necroPawn.h"
+#include "necromancer.h"
+#include "ghostKnight.h"
+#include "deadLauncher.h"
+#include "hellPawn.h"
+#include "howler.h"
+#include "prowler.h"
+#include "beholder.h"
+#include "youngWiz.h"
+#include "wizard.h"
+#include "familiar.h"
+#include "portal.h"
+#include "pawnHopper.h"
+#include "beastKnight.h"
+#include "beastDruid.h"
+#include "boulderThrower.h"
+#include "queenOfIllusions.h"
+#include "queenOfBones.h"
+#include "queenOfDomination.h"
+#include "queenOfDestruction.h"
+#include "ghoulKing.h"
+#include "frogKing.h"
+#include "wizardKing.h"
+#include "hellKing.h"
+#include <new>
+
+namespace
+{
+    template <typename... Types>
+    struct LargestOf;
+
+    template <typename Type>
+    struct LargestOf<Type>
+    {
+        static constexpr std::size_t size = sizeof(Type);
+    };
+
+    template <typename Type, typename... Rest>
+    struct LargestOf<Type, Rest...>
+    {
+        static constexpr std::size_t size = sizeof(Type) > LargestOf<Rest...>::size ? sizeof(Type) : LargestOf<Rest...>::size;
+    };
+
+    constexpr std::size_t LargestPiece = LargestOf<Rook, Bishop, Knight, Pawn, Queen, King, NecroPawn, Necromancer, GhostKnight,
+                                                   DeadLauncher, HellPawn, Howler, Prowler, Beholder, YoungWiz, Wizard, Familiar,
+                                                   Portal, PawnHopper, BeastKnight, BeastDruid, BoulderThrower, QueenOfIllusions,
+                                                   QueenOfBones, QueenOfDomination, QueenOfDestruction, GhoulKing, FrogKing,
+                                                   WizardKing, HellKing>::size;
+
+    // Written in front of every piece, pooled or not
+    struct SlotHeader
+    {
+        PiecePool *pool; // nullptr for a piece on the heap
+        std::uint32_t slot;
+    };
+
+    constexpr std::size_t unitsFor(std::size_t bytes)
+    {
+        return (bytes + sizeof(std::max_align_t) - 1) / sizeof(std::max_align_t);
+    }
+
+    // Headers and slots are whole max_align_t units so every piece is aligned for any piece class
+    constexpr std::size_t HeaderSize = unitsFor(sizeof(SlotHeader)) * sizeof(std::max_align_t);
+    constexpr std::size_t PieceSize = unitsFor(LargestPiece) * sizeof(std::max_align_t);
+    constexpr std::size_t SlotUnits = unitsFor(HeaderSize + PieceSize);
+
+    SlotHeader *headerOf(const void *piece)
+    {
+        return reinterpret_cast<SlotHeader *>(static_cast<unsigned char *>(const_cast<void *>(piece)) - HeaderSize);
+    }
+
+    // Per thread, so games running on different threads each allocate from their own pool
+    thread_local PiecePool *installedPool = nullptr;
+}
+
+constexpr std::uint32_t PiecePool::NoSlot;
+constexpr std::size_t PiecePool::DefaultCapacity;
+
+PiecePool::PiecePool(std::size_t capacity)
+    : blockSlots(capacity > 0 ? capacity : 1)
+{
+    grow();
+}
+
+// Another block of slots, lowest slot first on the free list
+void PiecePool::grow()
+{
+    std::uint32_t first = static_cast<std::uint32_t>(generations.size());
+    blocks.emplace_back(new std::max_align_t[blockSlots * SlotUnits]);
+    generations.resize(generations.size() + blockSlots, 0);
+    freeSlots.reserve(freeSlots.size() + blockSlots);
+    for (std::size_t slot = blockSlots; slot > 0; --slot)
+    {
+        freeSlots.push_back(first + static_cast<std::uint32_t>(slot - 1));
+    }
+    ++counters.blocks;
+}
+
+unsigned char *PiecePool::slotAddress(std::uint32_t slot) const
+{
+    return reinterpret_cast<unsigned char *>(blocks[slot / blockSlots].get() + slot % blockSlots * SlotUnits);
+}
+
+void *PiecePool::allocate(std::size_t size)
+{
+    if (size > PieceSize)
+    {
+        return nullptr;
+    }
+    if (freeSlots.empty())
+    {
+        grow();
+    }
+    std::uint32_t slot = freeSlots.back();
+    freeSlots.pop_back();
+    ++generations[slot];
+
+    ++counters.allocations;
+    ++counters.live;
+    if (counters.live > counters.peak)
+    {
+        counters.peak = counters.live;
+    }
+    unsigned char *address = slotAddress(slot);
+    new (address) SlotHeader{this, slot};
+    return address + HeaderSize;
+}
+
+bool PiecePool::release(void *memory)
+{
+    const SlotHeader *header = headerOf(memory);
+    if (header->pool != this)
+    {
+        return false;
+    }
+    ++generations[header->slot];
+    freeSlots.push_back(header->slot);
+
+    ++counters.releases;
+    --counters.live;
+    return true;
+}
+
+PiecePool::Handle PiecePool::handleOf(const Piece *piece) const
+{
+    Handle handle;
+    const SlotHeader *header = piece ? headerOf(piece) : nullptr;
+    if (header && header->pool == this && (generations[header->slot] & 1))
+    {
+        handle.slot = header->slot;
+        handle.generation = generations[header->slot];
+    }
+    return handle;
+}
+
+Piece *PiecePool::resolve(Handle handle) const
+{
+    if (handle.slot >= generations.size() || generations[handle.slot] != handle.generation || !(handle.generation & 1))
+    {
+        return nullptr;
+    }
+    return reinterpret_cast<Piece *>(slotAddress(handle.slot) + HeaderSize);
+}
+
+PiecePool *PiecePool::current()
+{
+    return installedPool;
+}
+
+PiecePool::Scope::Scope(PiecePool &pool)
+    : previous(installedPool)
+{
+    installedPool = &pool;
+}
+
+PiecePool::Scope::~Scope()
+{
+    installedPool = previous;
+}
+
+void *Piece::operator new(std::size_t size)
+{
+    if (PiecePool *pool = PiecePool::current())
+    {
+        if (void *memory = pool->allocate(size))
+        {
+            return memory;
+        }
+    }
+    unsigned char *address = static_cast<unsigned char *>(::operator new(HeaderSize + size));
+    new (address) SlotHeader{nullptr, PiecePool::NoSlot};
+    return address + HeaderSize;
+}
+
+void Piece::operator delete(void *memory) noexcept
+{
+    if (!memory)
+    {
+        return;
+    }
+    SlotHeader *header = headerOf(memory);
+    if (header->pool)
+    {
+        header->pool->release(memory);
+    }
+    else
+    {
+        ::operator delete(header);
+    }
+}
@@ -0,0 +1,54 @@
+// Filename: pieceReserve.cpp
+// Description: Implementation of the PieceReserve class, which holds the pieces each side keeps off the board.
+
+// Main Classes:
+// - PieceReserve: Owns off-board pieces in fixed slots addressed by stable handles.
+
+// Main Functions:
+// - PieceReserve::Handle PieceReserve::handleFor(engine::ReserveSlot slot, Piece::Color color): Slot of a side.
+// - bool PieceReserve::store(Handle handle, std::unique_ptr<Piece> &piece): Moves a piece into an empty slot.
+// - std::unique_ptr<Piece> PieceReserve::take(Handle handle): Moves the held piece back out.
+
+// Special Features or Notes:
+// - Slots follow engine::ReserveSlot, so engineBridge copies each one straight into the engine's reserve.
+// - A slot holds one piece; storing into a full slot fails instead of dropping what is already there.
+
+// Usage or Context:
+// - Owned by the game loop in game.cpp; Portals load into and unload from their side's PortalReserve slot.
+
+#include "pieceReserve.h"
+
+constexpr PieceReserve::Handle PieceReserve::NoHandle;
+
+PieceReserve::Handle PieceReserve::handleFor(engine::ReserveSlot slot, Piece::Color color)
+{
+    return slot * 2 + (color == Piece::Color::White ? 0 : 1);
+}
+
+bool PieceReserve::store(Handle handle, std::unique_ptr<Piece> &piece)
+{
+    if (handle < 0 || handle >= static_cast<Handle>(slots.size()) || slots[handle] || !piece)
+    {
+        return false;
+    }
+    slots[handle] = std::move(piece);
+    return true;
+}
+
+std::unique_ptr<Piece> PieceReserve::take(Handle handle)
+{
+    if (handle < 0 || handle >= static_cast<Handle>(slots.size()))
+    {
+        return nullptr;
+    }
+    return std::move(slots[handle]);
+}
+
+const Piece *PieceReserve::get(Handle handle) const
+{
+    if (handle < 0 || handle >= static_cast<Handle>(slots.size()))
+    {
+        return nullptr;
+    }
+    return slots[handle].get();
+}
@@ -0,0 +1,300 @@
+// Filename: pieceScanBench.cpp
+// Description: Entry point of battlechess_piecescanbench, which times board scans over the piece list against the same scans over a PieceTable.
+
+// Main Functions:
+// - int main(int argc, char *argv[]): Runs each scan both ways on a full board and prints the time per scan.
+
+// Special Features or Notes:
+// - Options: --iterations N (default 20000), --repeat N (default 3).
+// - The scans are the ones the abilities make: friendly pawns for QueenOfBones::revive, enemies around every
+//   square for the GhostKnight stun, and the piece on every square for a full-board pass.
+// - The piece list side asks each piece through getType(), getColor() and getPosition() as the game code did;
+//   the table side is timed once with the table already built and once with a rebuild per scan, which is what
+//   an ability that builds its own table pays.
+// - Pieces are allocated from a PiecePool as in a game, and both sides must agree on every result.
+// - The fastest of the repeated runs is reported, which keeps other load on the machine from deciding the comparison.
+
+// Usage or Context:
+// - battlechess_piecescanbench --iterations 100000
+
+#include "pieceTable.h"
+#include "piecePool.h"
+#include "areaEffect.h"
+#include "utility.h"
+#include "globals.h"
+#include "pawn.h"
+#include "rook.h"
+#include "knight.h"
+#include "bishop.h"
+#include "queen.h"
+#include "king.h"
+#include "necroPawn.h"
+#include "necromancer.h"
+#include "ghostKnight.h"
+#include "deadLauncher.h"
+#include "queenOfBones.h"
+#include "ghoulKing.h"
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+namespace
+{
+    using Pieces = std::vector<std::unique_ptr<Piece>>;
+
+    // White fields the Necromancer army with NecroPawns and Pawns mixed, Black the standard army
+    void setUpBoard(Pieces &pieces, sf::Texture &texture)
+    {
+        int id = 0;
+        auto at = [](int col, int row)
+        { return sf::Vector2f(col * TILE_SIZE, row * TILE_SIZE); };
+
+        pieces.push_back(std::make_unique<Necromancer>(id++, texture, at(0, 0), Piece::Color::White));
+        pieces.push_back(std::make_unique<GhostKnight>(id++, texture, at(1, 0), Piece::Color::White));
+        pieces.push_back(std::make_unique<DeadLauncher>(id++, texture, at(2, 0), Piece::Color::White));
+        pieces.push_back(std::make_unique<GhoulKing>(id++, texture, at(3, 0), Piece::Color::White));
+        pieces.push_back(std::make_unique<QueenOfBones>(id++, texture, at(4, 0), Piece::Color::White));
+        pieces.push_back(std::make_unique<DeadLauncher>(id++, texture, at(5, 0), Piece::Color::White));
+        pieces.push_back(std::make_unique<GhostKnight>(id++, texture, at(6, 0), Piece::Color::White));
+        pieces.push_back(std::make_unique<Necromancer>(id++, texture, at(7, 0), Piece::Color::White));
+
+        pieces.push_back(std::make_unique<Rook>(id++, texture, at(0, 7), Piece::Color::Black));
+        pieces.push_back(std::make_unique<Knight>(id++, texture, at(1, 7), Piece::Color::Black));
+        pieces.push_back(std::make_unique<Bishop>(id++, texture, at(2, 7), Piece::Color::Black));
+        pieces.push_back(std::make_unique<King>(id++, texture, at(3, 7), Piece::Color::Black));
+        pieces.push_back(std::make_unique<Queen>(id++, texture, at(4, 7), Piece::Color::Black));
+        pieces.push_back(std::make_unique<Bishop>(id++, texture, at(5, 7), Piece::Color::Black));
+        pieces.push_back(std::make_unique<Knight>(id++, texture, at(6, 7), Piece::Color::Black));
+        pieces.push_back(std::make_unique<Rook>(id++, texture, at(7, 7), Piece::Color::Black));
+
+        // Pawns are interleaved with the back ranks in the list, as captures and respawns leave them in a game
+        for (int col = 0; col < BOARD_SIZE; ++col)
+        {
+            if (col % 2)
+            {
+                pieces.push_back(std::make_unique<NecroPawn>(id++, texture, at(col, 1), Piece::Color::White));
+            }
+            else
+            {
+                pieces.push_back(std::make_unique<Pawn>(id++, texture, at(col, 1), Piece::Color::White));
+            }
+            pieces.push_back(std::make_unique<Pawn>(id++, texture, at(col, 6), Piece::Color::Black));
+        }
+
+        // A few pieces in the middle so the adjacency scan finds enemies
+        pieces.push_back(std::make_unique<GhostKnight>(id++, texture, at(3, 4), Piece::Color::White));
+        pieces.push_back(std::make_unique<Knight>(id++, texture, at(4, 3), Piece::Color::Black));
+        pieces.push_back(std::make_unique<NecroPawn>(id++, texture, at(2, 3), Piece::Color::White));
+        pieces.push_back(std::make_unique<Bishop>(id++, texture, at(5, 4), Piece::Color::Black));
+    }
+
+    Piece::Color opponent(Piece::Color color)
+    {
+        return color == Piece::Color::White ? Piece::Color::Black : Piece::Color::White;
+    }
+
+    // Piece list scans
+
+    std::size_t listFriendlyPawns(const Pieces &pieces, Piece::Color color)
+    {
+        std::size_t count = 0;
+        for (const auto &piece : pieces)
+        {
+            if (piece->getColor() == color && (piece->getType() == "Pawn" || piece->getType() == "NecroPawn"))
+            {
+                ++count;
+            }
+        }
+        return count;
+    }
+
+    std::size_t listAdjacentEnemies(const Pieces &pieces, Piece::Color color)
+    {
+        std::size_t count = 0;
+        for (int sq = 0; sq < BOARD_SIZE * BOARD_SIZE; ++sq)
+        {
+            int col = sq % BOARD_SIZE;
+            int row = sq / BOARD_SIZE;
+            for (int dy = -1; dy <= 1; ++dy)
+            {
+                for (int dx = -1; dx <= 1; ++dx)
+                {
+                    int x = col + dx;
+                    int y = row + dy;
+                    if ((dx || dy) && x >= 0 && x < BOARD_SIZE && y >= 0 && y < BOARD_SIZE)
+                    {
+                        Piece *piece = getPieceAtPosition(sf::Vector2f(x * TILE_SIZE, y * TILE_SIZE), pieces);
+                        if (piece && piece->getColor() != color)
+                        {
+                            ++count;
+                        }
+                    }
+                }
+            }
+        }
+        return count;
+    }
+
+    std::size_t listOccupied(const Pieces &pieces)
+    {
+        std::size_t count = 0;
+        for (int sq = 0; sq < BOARD_SIZE * BOARD_SIZE; ++sq)
+        {
+            if (getPieceAtPosition(sf::Vector2f((sq % BOARD_SIZE) * TILE_SIZE, (sq / BOARD_SIZE) * TILE_SIZE), pieces))
+            {
+                ++count;
+            }
+        }
+        return count;
+    }
+
+    // PieceTable scans
+
+    std::size_t tableFriendlyPawns(const PieceTable &table, Piece::Color color)
+    {
+        return table.select(color, PieceTable::kindSet({engine::Pawn, engine::NecroPawn})).size();
+    }
+
+    std::size_t tableAdjacentEnemies(const PieceTable &table, Piece::Color color)
+    {
+        std::size_t count = 0;
+        PieceTable::SquareMask enemies = table.occupiedBy(opponent(color));
+        for (int sq = 0; sq < BOARD_SIZE * BOARD_SIZE; ++sq)
+        {
+            sf::Vector2f position((sq % BOARD_SIZE) * TILE_SIZE, (sq / BOARD_SIZE) * TILE_SIZE);
+            count += __builtin_popcountll(AreaEffect::adjacentSquares(position) & enemies);
+        }
+        return count;
+    }
+
+    std::size_t tableOccupied(const PieceTable &table)
+    {
+        std::size_t count = 0;
+        for (int sq = 0; sq < BOARD_SIZE * BOARD_SIZE; ++sq)
+        {
+            if (table.at(sq))
+            {
+                ++count;
+            }
+        }
+        return count;
+    }
+
+    struct Timing
+    {
+        double best = 0.0;
+        std::size_t result = 0;
+    };
+
+    template <typename Scan>
+    void timeScan(Timing &timing, int iterations, Scan scan)
+    {
+        std::size_t result = 0;
+        auto started = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; ++i)
+        {
+            result += scan();
+        }
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+        timing.best = timing.best > 0.0 ? std::min(timing.best, seconds) : seconds;
+        timing.result = result / iterations;
+    }
+
+    int parseCount(const std::string &option, const char *value)
+    {
+        int count = std::stoi(value);
+        if (count < 1)
+        {
+            throw std::runtime_error(option + " must be at least 1");
+        }
+        return count;
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    int iterations = 20000;
+    int repeat = 3;
+
+    try
+    {
+        for (int i = 1; i < argc; ++i)
+        {
+            std::string option = argv[i];
+            if ((option == "--iterations" || option == "--repeat") && i + 1 < argc)
+            {
+                (option == "--iterations" ? iterations : repeat) = parseCount(option, argv[++i]);
+            }
+            else
+            {
+                throw std::runtime_error("Unknown option " + option);
+            }
+        }
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << e.what() << "\nUsage: battlechess_piecescanbench [--iterations N] [--repeat N]" << std::endl;
+        return 1;
+    }
+
+    PiecePool pool;
+    PiecePool::Scope poolScope(pool);
+    sf::Texture texture;
+    Pieces pieces;
+    setUpBoard(pieces, texture);
+    PieceTable table(pieces);
+
+    const Piece::Color side = Piece::Color::White;
+    const char *names[] = {"friendly pawns", "adjacent enemies", "occupied squares"};
+    Timing list[3], built[3], rebuilt[3];
+
+    for (int run = 0; run < repeat; ++run)
+    {
+        timeScan(list[0], iterations, [&]
+                 { return listFriendlyPawns(pieces, side); });
+        timeScan(list[1], iterations, [&]
+                 { return listAdjacentEnemies(pieces, side); });
+        timeScan(list[2], iterations, [&]
+                 { return listOccupied(pieces); });
+
+        timeScan(built[0], iterations, [&]
+                 { return tableFriendlyPawns(table, side); });
+        timeScan(built[1], iterations, [&]
+                 { return tableAdjacentEnemies(table, side); });
+        timeScan(built[2], iterations, [&]
+                 { return tableOccupied(table); });
+
+        timeScan(rebuilt[0], iterations, [&]
+                 { table.rebuild(pieces); return tableFriendlyPawns(table, side); });
+        timeScan(rebuilt[1], iterations, [&]
+                 { table.rebuild(pieces); return tableAdjacentEnemies(table, side); });
+        timeScan(rebuilt[2], iterations, [&]
+                 { table.rebuild(pieces); return tableOccupied(table); });
+    }
+
+    std::cout << pieces.size() << " pieces, " << iterations << " scans, best of " << repeat << std::endl;
+    std::cout << std::left << std::setw(18) << "scan" << std::right << std::setw(8) << "result" << std::setw(14) << "list ns"
+              << std::setw(14) << "table ns" << std::setw(10) << "speedup" << std::setw(16) << "rebuild+table" << std::setw(10) << "speedup"
+              << std::endl;
+
+    bool agreed = true;
+    for (int scan = 0; scan < 3; ++scan)
+    {
+        double listNs = list[scan].best * 1e9 / iterations;
+        double builtNs = built[scan].best * 1e9 / iterations;
+        double rebuiltNs = rebuilt[scan].best * 1e9 / iterations;
+        std::cout << std::left << std::setw(18) << names[scan] << std::right << std::setw(8) << list[scan].result
+                  << std::fixed << std::setprecision(1) << std::setw(14) << listNs << std::setw(14) << builtNs
+                  << std::setw(9) << listNs / builtNs << "x" << std::setw(16) << rebuiltNs << std::setw(9) << listNs / rebuiltNs << "x"
+                  << std::endl;
+
+        if (built[scan].result != list[scan].result || rebuilt[scan].result != list[scan].result)
+        {
+            std::cerr << "Mismatch in " << names[scan] << ": table found " << built[scan].result << std::endl;
+            agreed = false;
+        }
+    }
+    return agreed ? 0 : 1;
+}
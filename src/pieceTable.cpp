@@ -0,0 +1,357 @@
+// Filename: pieceTable.cpp
+// Description: Implementation of the PieceTable class, which keeps the attributes of the piece list in parallel arrays.
+
+// Main Classes:
+// - PieceTable: Columns of kind, colour, square, flags and id for every piece, with a pointer back to each Piece.
+
+// Main Functions:
+// - void PieceTable::rebuild(const std::vector<std::unique_ptr<Piece>> &pieces): Reads the piece list into the columns.
+// - void PieceTable::sync(const std::vector<std::unique_ptr<Piece>> &pieces): Reads spawned pieces and drops departed ones.
+// - void PieceTable::update(const Piece &piece): Re-reads a piece that moved or changed side or flags.
+// - PieceTable::SquareMask PieceTable::squaresOf(Piece::Color color, KindSet kinds) const: Squares of a set of kinds.
+// - std::vector<Piece *> PieceTable::select(Piece::Color color, KindSet kinds) const: Pieces of a set of kinds.
+
+// Special Features or Notes:
+// - Kinds are engine::Kind, so a set of kinds is one 64-bit word and a kind test is a shift and a mask.
+// - getType() builds a string on every call, so the kind of each piece class is looked up once by its typeid
+//   and cached; later rebuilds only hash the type_info address.
+// - A square index per board square and a mask per side answer "what is on this square" and "who is around it"
+//   without touching the rows at all.
+// - Pieces only join the list at its end and leave it without reordering the rest, so sync() walks the list and
+//   the rows side by side comparing pointers; a piece seen out of order is simply read again.
+// - Piece::setPosition, setColor, setStunned and setStone call update() and ~Piece calls forget() on the table the piece
+//   is linked to, so moves made by any piece's rules reach it without the rules knowing about the table. The piece
+//   carries its row, and a count of rows per side on each square lets update() and forget() move one row in the square
+//   index and side masks without reading the others; only a row leaving a square it shared looks for the one left.
+
+// Usage or Context:
+// - One table per game, owned and installed by Game::runChessGame next to the piece list. AreaEffect (area captures,
+//   the GhostKnight stun) and QueenOfBones::revive sync it before scanning; without a game they read their own.
+// - src/pieceScanBench.cpp compares its scans against scans of the piece list.
+
+#include "pieceTable.h"
+#include <typeinfo>
+
+namespace
+{
+    // Open addressing on the type_info address; there are fewer piece classes than slots
+    struct KindCache
+    {
+        static constexpr std::size_t Slots = 64;
+        const std::type_info *types[Slots] = {};
+        engine::Kind kinds[Slots] = {};
+    };
+
+    engine::Kind kindOf(const Piece &piece)
+    {
+        thread_local KindCache cache;
+        const std::type_info &type = typeid(piece);
+        std::size_t slot = (reinterpret_cast<std::uintptr_t>(&type) >> 4) % KindCache::Slots;
+        for (std::size_t probe = 0; probe < KindCache::Slots; ++probe, slot = (slot + 1) % KindCache::Slots)
+        {
+            if (!cache.types[slot])
+            {
+                cache.types[slot] = &type;
+                cache.kinds[slot] = engine::kindFromName(piece.getType());
+                return cache.kinds[slot];
+            }
+            if (*cache.types[slot] == type)
+            {
+                return cache.kinds[slot];
+            }
+        }
+        return engine::kindFromName(piece.getType());
+    }
+
+    // NoKind (a type the engine does not know) is in no set
+    bool inSet(PieceTable::KindSet set, std::uint8_t kind)
+    {
+        return kind < engine::KindCount && (set >> kind & 1);
+    }
+
+    int squareOf(const sf::Vector2f &position)
+    {
+        int col = tileIndex(position.x);
+        int row = tileIndex(position.y);
+        if (position.x < 0 || position.y < 0 || col >= BOARD_SIZE || row >= BOARD_SIZE)
+        {
+            return PieceTable::OffBoard;
+        }
+        return row * BOARD_SIZE + col;
+    }
+
+    // Per thread, like the installed PiecePool
+    thread_local PieceTable *installedTable = nullptr;
+}
+
+constexpr int PieceTable::OffBoard;
+
+PieceTable::PieceTable()
+{
+    index();
+}
+
+PieceTable::PieceTable(const std::vector<std::unique_ptr<Piece>> &pieces)
+{
+    rebuild(pieces);
+}
+
+void PieceTable::resize(std::size_t count)
+{
+    kinds.resize(count);
+    colors.resize(count);
+    squares.resize(count);
+    flagBits.resize(count);
+    ids.resize(count);
+    views.resize(count);
+}
+
+void PieceTable::read(std::size_t row, Piece &piece)
+{
+    kinds[row] = kindOf(piece);
+    colors[row] = piece.getColor() == Piece::Color::White ? 0 : 1;
+    squares[row] = static_cast<std::int8_t>(squareOf(piece.getPosition()));
+    flagBits[row] = (piece.isStunned() ? Stunned : 0) | (piece.isStone() ? Stone : 0);
+    ids[row] = piece.getId();
+    views[row] = &piece;
+    if (linking)
+    {
+        piece.tableRow.table = this;
+        piece.tableRow.row = row;
+    }
+}
+
+// A row being dropped stops its piece reporting here; destroyed pieces have already cleared their view
+void PieceTable::unlink(std::size_t row)
+{
+    if (views[row] && views[row]->tableRow.table == this)
+    {
+        views[row]->tableRow.table = nullptr;
+    }
+}
+
+// Square index and side masks from the square column alone
+void PieceTable::index()
+{
+    rowAt.fill(-1);
+    occupiedBySide = {0, 0};
+    rowsOn[0].fill(0);
+    rowsOn[1].fill(0);
+    for (std::size_t row = 0; row < squares.size(); ++row)
+    {
+        enter(row);
+    }
+}
+
+bool PieceTable::holds(const Piece &piece) const
+{
+    return piece.tableRow.table == this && piece.tableRow.row < views.size() && views[piece.tableRow.row] == &piece;
+}
+
+void PieceTable::leave(std::size_t row)
+{
+    int square = squares[row];
+    if (square == OffBoard)
+    {
+        return;
+    }
+    if (--rowsOn[colors[row]][square] == 0)
+    {
+        occupiedBySide[colors[row]] &= ~(SquareMask(1) << square);
+    }
+    if (rowAt[square] == static_cast<std::int16_t>(row))
+    {
+        // Another row still on the square takes it over, the last one as index() would pick
+        rowAt[square] = -1;
+        if (rowsOn[0][square] + rowsOn[1][square] > 0)
+        {
+            for (std::size_t other = squares.size(); other-- > 0;)
+            {
+                if (other != row && squares[other] == square)
+                {
+                    rowAt[square] = static_cast<std::int16_t>(other);
+                    break;
+                }
+            }
+        }
+    }
+}
+
+void PieceTable::enter(std::size_t row)
+{
+    int square = squares[row];
+    if (square == OffBoard)
+    {
+        return;
+    }
+    ++rowsOn[colors[row]][square];
+    occupiedBySide[colors[row]] |= SquareMask(1) << square;
+    if (rowAt[square] < static_cast<std::int16_t>(row))
+    {
+        rowAt[square] = static_cast<std::int16_t>(row);
+    }
+}
+
+void PieceTable::rebuild(const std::vector<std::unique_ptr<Piece>> &pieces)
+{
+    for (std::size_t row = 0; row < views.size(); ++row)
+    {
+        unlink(row);
+    }
+    resize(pieces.size());
+    for (std::size_t row = 0; row < pieces.size(); ++row)
+    {
+        read(row, *pieces[row]);
+    }
+    index();
+}
+
+void PieceTable::sync(const std::vector<std::unique_ptr<Piece>> &pieces)
+{
+    // Rows whose piece is still in the list move up over the dropped ones, keeping list order
+    std::size_t kept = 0;
+    std::size_t row = 0;
+    std::size_t next = 0;
+    for (; next < pieces.size(); ++next, ++row, ++kept)
+    {
+        while (row < views.size() && views[row] != pieces[next].get())
+        {
+            unlink(row);
+            ++row;
+        }
+        if (row == views.size())
+        {
+            break;
+        }
+        if (row != kept)
+        {
+            kinds[kept] = kinds[row];
+            colors[kept] = colors[row];
+            squares[kept] = squares[row];
+            flagBits[kept] = flagBits[row];
+            ids[kept] = ids[row];
+            views[kept] = views[row];
+            if (linking)
+            {
+                views[kept]->tableRow.row = kept;
+            }
+        }
+    }
+    for (; row < views.size(); ++row)
+    {
+        unlink(row);
+    }
+
+    // Whatever follows joined the list since the last sync
+    resize(pieces.size());
+    for (; next < pieces.size(); ++next, ++kept)
+    {
+        read(kept, *pieces[next]);
+    }
+    index();
+}
+
+void PieceTable::update(const Piece &piece)
+{
+    if (!holds(piece))
+    {
+        return;
+    }
+    std::size_t row = piece.tableRow.row;
+    leave(row);
+    colors[row] = piece.getColor() == Piece::Color::White ? 0 : 1;
+    squares[row] = static_cast<std::int8_t>(squareOf(piece.getPosition()));
+    flagBits[row] = (piece.isStunned() ? Stunned : 0) | (piece.isStone() ? Stone : 0);
+    enter(row);
+}
+
+void PieceTable::forget(const Piece *piece)
+{
+    if (!holds(*piece))
+    {
+        return;
+    }
+    std::size_t row = piece->tableRow.row;
+    leave(row);
+    squares[row] = OffBoard;
+    views[row] = nullptr;
+}
+
+PieceTable *PieceTable::current()
+{
+    return installedTable;
+}
+
+PieceTable &PieceTable::synced(const std::vector<std::unique_ptr<Piece>> &pieces, PieceTable &fallback)
+{
+    PieceTable &table = installedTable ? *installedTable : fallback;
+    table.sync(pieces);
+    return table;
+}
+
+PieceTable::Scope::Scope(PieceTable &table)
+    : table(table), previous(installedTable)
+{
+    installedTable = &table;
+    table.linking = true;
+}
+
+PieceTable::Scope::~Scope()
+{
+    installedTable = previous;
+    table.linking = false;
+    for (std::size_t row = 0; row < table.views.size(); ++row)
+    {
+        table.unlink(row);
+    }
+}
+
+PieceTable::KindSet PieceTable::kindSet(std::initializer_list<engine::Kind> kinds)
+{
+    KindSet set = 0;
+    for (engine::Kind kind : kinds)
+    {
+        if (kind < engine::KindCount)
+        {
+            set |= KindSet(1) << kind;
+        }
+    }
+    return set;
+}
+
+Piece *PieceTable::at(int square) const
+{
+    if (square < 0 || square >= BOARD_SIZE * BOARD_SIZE || rowAt[square] < 0)
+    {
+        return nullptr;
+    }
+    return views[rowAt[square]];
+}
+
+PieceTable::SquareMask PieceTable::squaresOf(Piece::Color color, KindSet wanted) const
+{
+    std::uint8_t side = color == Piece::Color::White ? 0 : 1;
+    SquareMask found = 0;
+    for (std::size_t row = 0; row < kinds.size(); ++row)
+    {
+        if (colors[row] == side && squares[row] != OffBoard && inSet(wanted, kinds[row]))
+        {
+            found |= SquareMask(1) << squares[row];
+        }
+    }
+    return found;
+}
+
+std::vector<Piece *> PieceTable::select(Piece::Color color, KindSet wanted) const
+{
+    std::uint8_t side = color == Piece::Color::White ? 0 : 1;
+    std::vector<Piece *> found;
+    for (std::size_t row = 0; row < kinds.size(); ++row)
+    {
+        if (colors[row] == side && inSet(wanted, kinds[row]))
+        {
+            found.push_back(views[row]);
+        }
+    }
+    return found;
+}
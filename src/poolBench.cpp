@@ -0,0 +1,104 @@
+// Filename: poolBench.cpp
+// Description: Entry point of battlechess_poolbench, which measures how the work-stealing pool scales.
+
+// Main Functions:
+// - int main(int argc, char *argv[]): Runs parallel perft at 1, 2, 4 ... threads and prints speedup and efficiency.
+
+// Special Features or Notes:
+// - Options: --depth N (default 5), --threads N (default: all cores), --board 8|10|12 (default 8),
+//   --position "<notation>" (default: the start position of the chosen board).
+// - Perft is a fork/join search tree of uneven subtrees, the same shape as a parallel game-tree search,
+//   so the speedup shows how well idle workers find work by stealing.
+// - Every run must return the serial node count, otherwise the tool exits with an error.
+
+// Usage or Context:
+// - battlechess_poolbench --depth 6 --threads 16
+
+#include "engineMoveGen.h"
+#include "engineThreadPool.h"
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+#include <thread>
+
+namespace
+{
+    template <typename Geometry>
+    int runBench(const engine::BasicPosition<Geometry> &position, int depth, int maxThreads)
+    {
+        auto started = std::chrono::steady_clock::now();
+        std::uint64_t expected = engine::perft(position, depth);
+        double serialSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+        std::cout << "perft " << depth << ": " << expected << " nodes, serial " << std::fixed << std::setprecision(3)
+                  << serialSeconds << "s" << std::endl;
+        std::cout << std::setw(8) << "threads" << std::setw(12) << "seconds" << std::setw(16) << "nodes/s"
+                  << std::setw(10) << "speedup" << std::setw(12) << "efficiency" << std::endl;
+
+        for (int threads = 1; threads <= maxThreads; threads *= 2)
+        {
+            engine::ThreadPool pool(threads);
+            started = std::chrono::steady_clock::now();
+            std::uint64_t nodes = engine::perft(position, depth, pool);
+            double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+            if (nodes != expected)
+            {
+                std::cerr << "Error: parallel perft returned " << nodes << " nodes" << std::endl;
+                return 1;
+            }
+
+            double speedup = serialSeconds / std::max(seconds, 1e-9);
+            std::cout << std::setw(8) << threads << std::setw(12) << std::setprecision(3) << seconds
+                      << std::setw(16) << std::setprecision(0) << nodes / std::max(seconds, 1e-9)
+                      << std::setw(10) << std::setprecision(2) << speedup
+                      << std::setw(11) << std::setprecision(0) << speedup / threads * 100.0 << "%" << std::endl;
+
+            if (threads < maxThreads && threads * 2 > maxThreads)
+            {
+                threads = maxThreads / 2;
+            }
+        }
+        return 0;
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    int depth = 5;
+    int maxThreads = std::max(1u, std::thread::hardware_concurrency());
+    int board = engine::BOARD_DIM;
+    std::string notation;
+
+    try
+    {
+        for (int i = 1; i + 1 < argc; i += 2)
+        {
+            std::string flag = argv[i];
+            std::string value = argv[i + 1];
+            if (flag == "--depth")
+                depth = std::stoi(value);
+            else if (flag == "--threads")
+                maxThreads = std::max(1, std::stoi(value));
+            else if (flag == "--board")
+                board = std::stoi(value);
+            else if (flag == "--position")
+                notation = value;
+            else
+                throw std::runtime_error("Unknown option " + flag);
+        }
+
+        if (board == engine::Board10::dim)
+            return runBench(notation.empty() ? engine::Position10::startPosition() : engine::Position10::fromNotation(notation), depth, maxThreads);
+        if (board == engine::Board12::dim)
+            return runBench(notation.empty() ? engine::Position12::startPosition() : engine::Position12::fromNotation(notation), depth, maxThreads);
+        if (board != engine::BOARD_DIM)
+            throw std::runtime_error("Board must be 8, 10 or 12");
+        return runBench(notation.empty() ? engine::Position::startPosition() : engine::Position::fromNotation(notation), depth, maxThreads);
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << "Error: " << e.what() << std::endl;
+        std::cerr << "Usage: battlechess_poolbench [--depth N] [--threads N] [--board 8|10|12] [--position \"<notation>\"]" << std::endl;
+        return 1;
+    }
+}
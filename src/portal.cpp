@@ -7,15 +7,15 @@
 // Main Functions:
 // - bool Portal::canMoveTo(const sf::Vector2f &target, const std::vector<std::unique_ptr<Piece>> &pieces) const:
 //   Checks if the Portal can legally move to the specified target position on the chessboard.
-// - void Portal::highlightValidMoves(std::vector<std::vector<Square>> &board, const std::vector<std::unique_ptr<Piece>> &pieces) const:
+// - void Portal::highlightValidMoves(Board &board, const std::vector<std::unique_ptr<Piece>> &pieces) const:
 //   Highlights all valid moves for the Portal on the provided chessboard, considering its current position and game rules.
-// - void Portal::captureWithPortals(const sf::Vector2f &target, std::vector<std::unique_ptr<Piece>> &pieces, std::vector<Portal *> &portals, std::vector<std::vector<Square>> &board):
-//   Loads a friendly piece into a portal, and adds the piece pointer to all other portals.
-// - void Portal::teleport(sf::RenderWindow &window, std::vector<std::vector<Square>> &board, std::vector<std::unique_ptr<Piece>> &pieces, bool isWhiteTurn, std::vector<Portal *> &portals)
-//   Unloads a piece from a portal, and sets the piece pointer to null for all other portals
-// - void Portal::highlightValidUnloadPos(const sf::Vector2f &position, std::vector<std::vector<Square>> &board, const std::vector<std::unique_ptr<Piece>> &pieces)
+// - void Portal::captureWithPortals(const sf::Vector2f &target, std::vector<std::unique_ptr<Piece>> &pieces, PieceReserve &reserve, Board &board):
+//   Loads a friendly piece into the side's reserve slot, where every portal of the side can reach it.
+// - bool Portal::teleport(const sf::Vector2f &target, Board &board, std::vector<std::unique_ptr<Piece>> &pieces, PieceReserve &reserve)
+//   Unloads the piece from the side's reserve slot onto a square highlighted by highlightValidUnloadPos.
+// - void Portal::highlightValidUnloadPos(const sf::Vector2f &position, Board &board, const std::vector<std::unique_ptr<Piece>> &pieces)
 //   Highlight all valid places where a portal can unload a loaded piece.
-// - void Portal::highlightAdjacentPieces(std::vector<std::unique_ptr<Piece>> &pieces, std::vector<std::vector<Square>> &board, bool isWhiteTurn)
+// - void Portal::highlightAdjacentPieces(std::vector<std::unique_ptr<Piece>> &pieces, Board &board, bool isWhiteTurn)
 //   Highlights all pieces in the perimeter of a portal that can load into a portal.
 
 // Special Features or Notes:
@@ -24,6 +24,8 @@
 // - The Portal captures on movement into a space occupied by an opponent piece.
 // - The Portal has a special ability where any piece in a portals perimeter can enter a portal
 //   and exit out a portal prior to a portals movement for turn.
+// - The piece inside the portals is owned by the game's PieceReserve, so it is hashed and handed to the engine
+//   like any other piece and is not lost when a portal is captured or cloned.
 // - Inherits functionality from the Piece class.
 
 // Usage or Context:
@@ -32,7 +34,7 @@
 #include "portal.h"
 #include "utility.h"
 #include "globals.h"
-#include "square.h"
+#include "board.h"
 #include <vector>
 #include <iostream>
 
@@ -58,19 +60,20 @@ bool Portal::canMoveTo(const sf::Vector2f &target, const std::vector<std::unique
 }
 
 // Highlight valid moves for the Portal on the provided board
-void Portal::highlightValidMoves(std::vector<std::vector<Square>> &board, const std::vector<std::unique_ptr<Piece>> &pieces) const
+void Portal::highlightValidMoves(Board &board, const std::vector<std::unique_ptr<Piece>> &pieces) const
 {
+    Board::Highlights highlights;
     sf::Vector2f currentPosition = getPosition();
 
     // Convert the floating-point coordinates to integer indices
-    int row = static_cast<int>(currentPosition.y / TILE_SIZE);
-    int col = static_cast<int>(currentPosition.x / TILE_SIZE);
+    int row = tileIndex(currentPosition.y);
+    int col = tileIndex(currentPosition.x);
 
     // Ensure the indices are within the valid range of the board dimensions
     if (row >= 0 && row < BOARD_SIZE && col >= 0 && col < BOARD_SIZE)
     {
         // Highlight the current position in red
-        board[row][col].setHighlight(true, sf::Color::Green);
+        highlights.abilities |= Board::squareMask(row, col);
     }
 
     for (int i = 0; i < BOARD_SIZE; ++i)
@@ -82,11 +85,11 @@ void Portal::highlightValidMoves(std::vector<std::vector<Square>> &board, const
         {
             if (!isOpponentPiece(horizontalTarget, pieces, getColor()))
             {
-                board[static_cast<int>(currentPosition.y / TILE_SIZE)][i].setHighlight(true);
+                highlights.moves |= Board::squareMask(tileIndex(currentPosition.y), i);
             }
             else if (isOpponentPiece(horizontalTarget, pieces, getColor()))
             {
-                board[static_cast<int>(currentPosition.y / TILE_SIZE)][i].setHighlight(true, sf::Color::Red);
+                highlights.captures |= Board::squareMask(tileIndex(currentPosition.y), i);
             }
         }
 
@@ -97,17 +100,23 @@ void Portal::highlightValidMoves(std::vector<std::vector<Square>> &board, const
         {
             if (!isOpponentPiece(verticalTarget, pieces, getColor()))
             {
-                board[i][static_cast<int>(currentPosition.x / TILE_SIZE)].setHighlight(true);
+                highlights.moves |= Board::squareMask(i, tileIndex(currentPosition.x));
             }
             else if (isOpponentPiece(verticalTarget, pieces, getColor()))
             {
-                board[i][static_cast<int>(currentPosition.x / TILE_SIZE)].setHighlight(true, sf::Color::Red);
+                highlights.captures |= Board::squareMask(i, tileIndex(currentPosition.x));
             }
         }
     }
+    board.highlight(highlights);
 }
 
-void Portal::captureWithPortals(const sf::Vector2f &target, std::vector<std::unique_ptr<Piece>> &pieces, std::vector<Portal *> &portals, std::vector<std::vector<Square>> &board)
+bool Portal::canEnter(const Piece &piece)
+{
+    return piece.getType().find("King") == std::string::npos;
+}
+
+void Portal::captureWithPortals(const sf::Vector2f &target, std::vector<std::unique_ptr<Piece>> &pieces, PieceReserve &reserve, Board &board)
 {
     auto it = std::find_if(pieces.begin(), pieces.end(),
                            [&target](const std::unique_ptr<Piece> &piece)
@@ -115,172 +124,77 @@ void Portal::captureWithPortals(const sf::Vector2f &target, std::vector<std::uni
                                return piece->getPosition() == target;
                            });
 
-    if (it != pieces.end() && (*it)->getColor() == getColor())
+    if (it != pieces.end() && (*it)->getColor() == getColor() && canEnter(**it))
     {
-        Piece *capturedPiece = it->release(); // Store the captured piece
-        pieces.erase(it);                     // Remove the piece from the pieces vector
-
-        // Update all portals of the same color
-        for (auto &portal : portals)
+        if (isLoaded(reserve))
         {
-            if (portal->getColor() == getColor())
-            {
-                portal->pieceInPortal = capturedPiece;
-                portal->pieceLoaded = true;
+            std::cout << "Piece is already loaded." << std::endl;
+            return;
+        }
 
-                // Print details for debugging
-                std::cout << "Portal at position (" << portal->getPosition().x / TILE_SIZE << ", "
-                          << portal->getPosition().y / TILE_SIZE << ") has piece: ";
-                portal->pieceInPortal->print(std::cout);
-                std::cout << std::endl;
+        reserve.store(reserveHandle(), *it);
+        pieces.erase(it); // Remove the emptied entry from the pieces vector
 
-                // Clear the highlights for the adjacent squares
-                int col = portal->getPosition().x / TILE_SIZE;
-                int row = portal->getPosition().y / TILE_SIZE;
+        // Print details for debugging
+        std::cout << "Portal at position (" << getPosition().x / TILE_SIZE << ", "
+                  << getPosition().y / TILE_SIZE << ") has piece: ";
+        reserve.get(reserveHandle())->print(std::cout);
+        std::cout << std::endl;
 
-                for (const auto &dir : portal->directions)
-                {
-                    int newRow = row + dir[0];
-                    int newCol = col + dir[1];
+        // Clear the highlights for the adjacent squares
+        int col = tileIndex(getPosition().x);
+        int row = tileIndex(getPosition().y);
+        Board::SquareMask adjacent = 0;
 
-                    if (newRow >= 0 && newRow < BOARD_SIZE && newCol >= 0 && newCol < BOARD_SIZE)
-                    {
-                        board[newRow][newCol].setHighlight(false);
-                    }
-                }
-            }
+        for (const auto &dir : directions)
+        {
+            adjacent |= Board::squareMask(row + dir[0], col + dir[1]);
         }
+        board.clearHighlights(adjacent);
     }
 }
 
-void Portal::teleport(sf::RenderWindow &window, std::vector<std::vector<Square>> &board, std::vector<std::unique_ptr<Piece>> &pieces, bool isWhiteTurn, std::vector<Portal *> &portals)
+// Called with the click that follows highlightValidUnloadPos; any square but a highlighted one leaves the piece inside
+bool Portal::teleport(const sf::Vector2f &target, Board &board, std::vector<std::unique_ptr<Piece>> &pieces, PieceReserve &reserve)
 {
-    sf::Vector2f currentPosition = getPosition();
+    int clickRow = tileIndex(target.y);
+    int clickCol = tileIndex(target.x);
+    bool unloaded = false;
 
-    if (pieceLoaded)
+    if (!isLoaded(reserve))
     {
-        // Set unload highlights
-        highlightValidUnloadPos(currentPosition, board, pieces);
-
-        // Redraw the board
-        window.clear();
-        drawChessboard(window, board);
-        for (const auto &piece : pieces)
-        {
-            window.draw(piece->getSprite());
-        }
-        window.display();
-
-        bool validUnloadPositionSelected = false;
-
-        while (!validUnloadPositionSelected)
-        {
-            sf::Event event;
-            while (window.pollEvent(event))
-            {
-                if (event.type == sf::Event::MouseButtonPressed && event.mouseButton.button == sf::Mouse::Left)
-                {
-                    int clickX = event.mouseButton.x;
-                    int clickY = event.mouseButton.y;
-                    int clickRow = clickY / TILE_SIZE;
-                    int clickCol = clickX / TILE_SIZE;
-
-                    sf::Vector2f clickPosition(clickCol * TILE_SIZE, clickRow * TILE_SIZE);
-
-                    // Check if the clicked position is the portal itself
-                    if (clickPosition == currentPosition || !board[clickRow][clickCol].getHighlight())
-                    {
-                        std::cout << "Clicked on the portal itself or a non-highlighted position." << std::endl;
-
-                        // Clear all highlights
-                        for (int r = 0; r < BOARD_SIZE; ++r)
-                        {
-                            for (int c = 0; c < BOARD_SIZE; ++c)
-                            {
-                                board[r][c].setHighlight(false);
-                            }
-                        }
-
-                        // Redraw the board without highlights
-                        window.clear();
-                        drawChessboard(window, board);
-                        for (const auto &piece : pieces)
-                        {
-                            window.draw(piece->getSprite());
-                        }
-                        window.display();
-
-                        validUnloadPositionSelected = true;
-                        break;
-                    }
-
-                    // Check if the clicked position is highlighted
-                    if (board[clickRow][clickCol].getHighlight())
-                    {
-                        // Unload the piece from the portal
-                        pieceInPortal->setPosition(clickPosition);
-                        pieces.push_back(std::unique_ptr<Piece>(pieceInPortal));
-                        pieceInPortal = nullptr;
-                        pieceLoaded = false;
-                        validUnloadPositionSelected = true;
-
-                        std::cout << "Piece is unloaded from the portal!" << std::endl;
-
-                        // Clear all highlights after unloading the piece
-                        for (int r = 0; r < BOARD_SIZE; ++r)
-                        {
-                            for (int c = 0; c < BOARD_SIZE; ++c)
-                            {
-                                board[r][c].setHighlight(false);
-                            }
-                        }
-
-                        // Update all portals of the same color
-                        for (auto &portal : portals)
-                        {
-                            if (portal->getColor() == getColor())
-                            {
-                                portal->pieceInPortal = nullptr;
-                                portal->pieceLoaded = false;
-                            }
-                        }
-
-                        // Redraw the board without highlights
-                        window.clear();
-                        drawChessboard(window, board);
-                        for (const auto &piece : pieces)
-                        {
-                            window.draw(piece->getSprite());
-                        }
-                        window.display();
-                        break;
-                    }
-                }
-            }
-        }
+        std::cout << "No piece loaded in the portal." << std::endl;
+    }
+    else if (target == getPosition() || !board[clickRow][clickCol].getHighlight())
+    {
+        std::cout << "Clicked on the portal itself or a non-highlighted position." << std::endl;
     }
     else
     {
-        std::cout << "No piece loaded in the portal." << std::endl;
+        // Unload the piece from the portal; the slot is shared, so every portal of the side is empty again
+        std::unique_ptr<Piece> piece = reserve.take(reserveHandle());
+        piece->setPosition(target);
+        pieces.push_back(std::move(piece));
+        unloaded = true;
+
+        std::cout << "Piece is unloaded from the portal!" << std::endl;
     }
+
+    board.clearHighlights();
+    return unloaded;
 }
 
-void Portal::highlightValidUnloadPos(const sf::Vector2f &position, std::vector<std::vector<Square>> &board, const std::vector<std::unique_ptr<Piece>> &pieces)
+void Portal::highlightValidUnloadPos(const sf::Vector2f &position, Board &board, const std::vector<std::unique_ptr<Piece>> &pieces)
 {
+    Board::Highlights highlights;
     sf::Vector2f portalPosition = getPosition();
 
     // Clear all highlights before setting new ones
-    for (int r = 0; r < BOARD_SIZE; ++r)
-    {
-        for (int c = 0; c < BOARD_SIZE; ++c)
-        {
-            board[r][c].setHighlight(false);
-        }
-    }
+    board.clearHighlights();
 
     // Check the portal's position in terms of row and column
-    int col = portalPosition.x / TILE_SIZE;
-    int row = portalPosition.y / TILE_SIZE;
+    int col = tileIndex(portalPosition.x);
+    int row = tileIndex(portalPosition.y);
 
     for (const auto &dir : directions)
     {
@@ -304,16 +218,18 @@ void Portal::highlightValidUnloadPos(const sf::Vector2f &position, std::vector<s
             if (!isOccupied)
             {
                 // Highlight the square
-                board[newRow][newCol].setHighlight(true, sf::Color::Green);
+                highlights.abilities |= Board::squareMask(newRow, newCol);
             }
         }
     }
+    board.highlight(highlights);
 }
 
-void Portal::highlightAdjacentPieces(std::vector<std::unique_ptr<Piece>> &pieces, std::vector<std::vector<Square>> &board, bool isWhiteTurn)
+void Portal::highlightAdjacentPieces(std::vector<std::unique_ptr<Piece>> &pieces, Board &board, bool isWhiteTurn)
 {
-    int col = getPosition().x / TILE_SIZE;
-    int row = getPosition().y / TILE_SIZE;
+    Board::Highlights highlights;
+    int col = tileIndex(getPosition().x);
+    int row = tileIndex(getPosition().y);
 
     for (const auto &dir : directions)
     {
@@ -323,10 +239,11 @@ void Portal::highlightAdjacentPieces(std::vector<std::unique_ptr<Piece>> &pieces
         if (newRow >= 0 && newRow < BOARD_SIZE && newCol >= 0 && newCol < BOARD_SIZE)
         {
             Piece *adjacentPiece = getPieceAtPosition(sf::Vector2f(newCol * TILE_SIZE, newRow * TILE_SIZE), pieces);
-            if (adjacentPiece && (adjacentPiece->getColor() == (isWhiteTurn ? Piece::Color::White : Piece::Color::Black)))
+            if (adjacentPiece && (adjacentPiece->getColor() == (isWhiteTurn ? Piece::Color::White : Piece::Color::Black)) && canEnter(*adjacentPiece))
             {
-                board[newRow][newCol].setHighlight(true, sf::Color::Red);
+                highlights.captures |= Board::squareMask(newRow, newCol);
             }
         }
     }
+    board.highlight(highlights);
 }
\ No newline at end of file
@@ -7,7 +7,7 @@
 // Main Functions:
 // - bool Queen::canMoveTo(const sf::Vector2f &target, const std::vector<std::unique_ptr<Piece>> &pieces) const:
 //   Checks if the Queen can legally move to the specified target position on the chessboard.
-// - void Queen::highlightValidMoves(std::vector<std::vector<Square>> &board, const std::vector<std::unique_ptr<Piece>> &pieces) const:
+// - void Queen::highlightValidMoves(Board &board, const std::vector<std::unique_ptr<Piece>> &pieces) const:
 //   Highlights all valid moves for the Queen on the provided chessboard, considering its current position and game rules.
 
 // Special Features or Notes:
@@ -21,7 +21,7 @@
 #include "queen.h"
 #include "utility.h"
 #include "globals.h"
-#include "square.h"
+#include "board.h"
 #include <vector>
 
 // Determine if the Queen can move to a specified target position
@@ -46,8 +46,9 @@ bool Queen::canMoveTo(const sf::Vector2f &target, const std::vector<std::unique_
 }
 
 // Highlight valid moves for the Queen on the provided board
-void Queen::highlightValidMoves(std::vector<std::vector<Square>> &board, const std::vector<std::unique_ptr<Piece>> &pieces) const
+void Queen::highlightValidMoves(Board &board, const std::vector<std::unique_ptr<Piece>> &pieces) const
 {
+    Board::Highlights highlights;
     sf::Vector2f currentPosition = getPosition();
     Piece::Color currentPlayerColor = getColor();
 
@@ -59,11 +60,11 @@ void Queen::highlightValidMoves(std::vector<std::vector<Square>> &board, const s
         {
             if (!isOpponentPiece(horizontalTarget, pieces, currentPlayerColor))
             {
-                board[static_cast<int>(currentPosition.y / TILE_SIZE)][i].setHighlight(true);
+                highlights.moves |= Board::squareMask(tileIndex(currentPosition.y), i);
             }
             else if (isOpponentPiece(horizontalTarget, pieces, currentPlayerColor))
             {
-                board[static_cast<int>(currentPosition.y / TILE_SIZE)][i].setHighlight(true, sf::Color::Red);
+                highlights.captures |= Board::squareMask(tileIndex(currentPosition.y), i);
             }
         }
 
@@ -72,11 +73,11 @@ void Queen::highlightValidMoves(std::vector<std::vector<Square>> &board, const s
         {
             if (!isOpponentPiece(verticalTarget, pieces, currentPlayerColor))
             {
-                board[i][static_cast<int>(currentPosition.x / TILE_SIZE)].setHighlight(true);
+                highlights.moves |= Board::squareMask(i, tileIndex(currentPosition.x));
             }
             else if (isOpponentPiece(verticalTarget, pieces, currentPlayerColor))
             {
-                board[i][static_cast<int>(currentPosition.x / TILE_SIZE)].setHighlight(true, sf::Color::Red);
+                highlights.captures |= Board::squareMask(i, tileIndex(currentPosition.x));
             }
         }
     }
@@ -89,8 +90,8 @@ void Queen::highlightValidMoves(std::vector<std::vector<Square>> &board, const s
             // Check valid moves in each diagonal direction
             for (float i = 1; i < BOARD_SIZE; ++i)
             {
-                int newX = static_cast<int>(currentPosition.x / TILE_SIZE) + i * dx;
-                int newY = static_cast<int>(currentPosition.y / TILE_SIZE) + i * dy;
+                int newX = tileIndex(currentPosition.x) + i * dx;
+                int newY = tileIndex(currentPosition.y) + i * dy;
 
                 // Check if the new position is within the board bounds
                 if (newX >= 0 && newX < BOARD_SIZE && newY >= 0 && newY < BOARD_SIZE)
@@ -102,11 +103,11 @@ void Queen::highlightValidMoves(std::vector<std::vector<Square>> &board, const s
                     {
                         if (!isOpponentPiece(newPosition, pieces, currentPlayerColor))
                         {
-                            board[newY][newX].setHighlight(true);
+                            highlights.moves |= Board::squareMask(newY, newX);
                         }
                         else if (isOpponentPiece(newPosition, pieces, currentPlayerColor))
                         {
-                            board[newY][newX].setHighlight(true, sf::Color::Red);
+                            highlights.captures |= Board::squareMask(newY, newX);
                         }
 
                         // If the position is occupied by an opponent's piece, stop highlighting in this direction
@@ -129,4 +130,5 @@ void Queen::highlightValidMoves(std::vector<std::vector<Square>> &board, const s
             }
         }
     }
+    board.highlight(highlights);
 }
\ No newline at end of file
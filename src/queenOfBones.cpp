@@ -7,7 +7,7 @@
 // Main Functions:
 // - bool QueenOfBones::canMoveTo(const sf::Vector2f &target, const std::vector<std::unique_ptr<Piece>> &pieces) const:
 //   Checks if the QueenOfBones can legally move to the specified target position on the chessboard.
-// - void QueenOfBones::highlightValidMoves(std::vector<std::vector<Square>> &board, const std::vector<std::unique_ptr<Piece>> &pieces) const:
+// - void QueenOfBones::highlightValidMoves(Board &board, const std::vector<std::unique_ptr<Piece>> &pieces) const:
 //   Highlights all valid moves for the QueenOfBones on the provided chessboard, considering its current position and game rules.
 
 // Special Features or Notes:
@@ -24,7 +24,8 @@
 #include "textureManager.h"
 #include "utility.h"
 #include "globals.h"
-#include "square.h"
+#include "board.h"
+#include "pieceTable.h"
 #include <vector>
 #include <iostream>
 
@@ -51,8 +52,9 @@ bool QueenOfBones::canMoveTo(const sf::Vector2f &target, const std::vector<std::
 }
 
 // Highlight valid moves for the QueenOfBones on the provided board
-void QueenOfBones::highlightValidMoves(std::vector<std::vector<Square>> &board, const std::vector<std::unique_ptr<Piece>> &pieces) const
+void QueenOfBones::highlightValidMoves(Board &board, const std::vector<std::unique_ptr<Piece>> &pieces) const
 {
+    Board::Highlights highlights;
     sf::Vector2f currentPosition = getPosition();
     Piece::Color currentPlayerColor = getColor();
 
@@ -64,11 +66,11 @@ void QueenOfBones::highlightValidMoves(std::vector<std::vector<Square>> &board,
         {
             if (!isOpponentPiece(horizontalTarget, pieces, currentPlayerColor))
             {
-                board[static_cast<int>(currentPosition.y / TILE_SIZE)][i].setHighlight(true);
+                highlights.moves |= Board::squareMask(tileIndex(currentPosition.y), i);
             }
             else if (isOpponentPiece(horizontalTarget, pieces, currentPlayerColor))
             {
-                board[static_cast<int>(currentPosition.y / TILE_SIZE)][i].setHighlight(true, sf::Color::Red);
+                highlights.captures |= Board::squareMask(tileIndex(currentPosition.y), i);
             }
         }
 
@@ -77,11 +79,11 @@ void QueenOfBones::highlightValidMoves(std::vector<std::vector<Square>> &board,
         {
             if (!isOpponentPiece(verticalTarget, pieces, currentPlayerColor))
             {
-                board[i][static_cast<int>(currentPosition.x / TILE_SIZE)].setHighlight(true);
+                highlights.moves |= Board::squareMask(i, tileIndex(currentPosition.x));
             }
             else if (isOpponentPiece(verticalTarget, pieces, currentPlayerColor))
             {
-                board[i][static_cast<int>(currentPosition.x / TILE_SIZE)].setHighlight(true, sf::Color::Red);
+                highlights.captures |= Board::squareMask(i, tileIndex(currentPosition.x));
             }
         }
     }
@@ -94,8 +96,8 @@ void QueenOfBones::highlightValidMoves(std::vector<std::vector<Square>> &board,
             // Check valid moves in each diagonal direction
             for (float i = 1; i < BOARD_SIZE; ++i)
             {
-                int newX = static_cast<int>(currentPosition.x / TILE_SIZE) + i * dx;
-                int newY = static_cast<int>(currentPosition.y / TILE_SIZE) + i * dy;
+                int newX = tileIndex(currentPosition.x) + i * dx;
+                int newY = tileIndex(currentPosition.y) + i * dy;
 
                 // Check if the new position is within the board bounds
                 if (newX >= 0 && newX < BOARD_SIZE && newY >= 0 && newY < BOARD_SIZE)
@@ -108,11 +110,11 @@ void QueenOfBones::highlightValidMoves(std::vector<std::vector<Square>> &board,
                     {
                         if (!isOpponentPiece(newPosition, pieces, currentPlayerColor))
                         {
-                            board[newY][newX].setHighlight(true);
+                            highlights.moves |= Board::squareMask(newY, newX);
                         }
                         else if (isOpponentPiece(newPosition, pieces, currentPlayerColor))
                         {
-                            board[newY][newX].setHighlight(true, sf::Color::Red);
+                            highlights.captures |= Board::squareMask(newY, newX);
                         }
 
                         // If the position is occupied by an opponent's piece, stop highlighting in this direction
@@ -135,24 +137,15 @@ void QueenOfBones::highlightValidMoves(std::vector<std::vector<Square>> &board,
             }
         }
     }
+    board.highlight(highlights);
 }
 
 // Revive method for the QueenOfBones
 std::vector<Piece *> QueenOfBones::revive(std::vector<std::unique_ptr<Piece>> &pieces)
 {
-    std::vector<Piece *> sacrificablePawns;
-
-    for (const auto &piece : pieces)
-    {
-        if (piece->getColor() == getColor() &&
-            (piece->getType() == "Pawn" || piece->getType() == "NecroPawn"))
-        {
-            // Add each pawn to the vector
-            sacrificablePawns.push_back(piece.get());
-        }
-    }
-
-    return sacrificablePawns;
+    // Friendly pawns of either kind, found by scanning the kind and colour columns of the game's table
+    PieceTable fallback;
+    return PieceTable::synced(pieces, fallback).select(getColor(), PieceTable::kindSet({engine::Pawn, engine::NecroPawn}));
 }
 
 void QueenOfBones::handlePawnSacrifice(Piece *selectedPawn, std::vector<std::unique_ptr<Piece>> &pieces)
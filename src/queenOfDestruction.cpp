@@ -7,20 +7,18 @@
 // Main Functions:
 // - bool QueenOfDestruction::canMoveTo(const sf::Vector2f &target, const std::vector<std::unique_ptr<Piece>> &pieces) const:
 //   Checks if the QueenOfDestruction can legally move to the specified target position on the chessboard.
-// - void QueenOfDestruction::highlightValidMoves(std::vector<std::vector<Square>> &board, const std::vector<std::unique_ptr<Piece>> &pieces) const:
+// - void QueenOfDestruction::highlightValidMoves(Board &board, const std::vector<std::unique_ptr<Piece>> &pieces) const:
 //   Highlights all valid moves for the QueenOfDestruction on the provided chessboard, considering its current position and game rules.
-// - void QueenOfDestruction::massDestruction(const Piece *capturingPiece, std::vector<std::unique_ptr<Piece>> &pieces, std::vector<std::vector<Square>> &board)
+// - void QueenOfDestruction::massDestruction(const Piece *capturingPiece, std::vector<std::unique_ptr<Piece>> &pieces, const AreaEffect::QueenOfBonesFallen &onQueenOfBonesFallen)
 //   Upon dying, erases all enemy units in its line of sight.
-// - bool QueenOfDestruction::canMoveToIgnoringPiece(const sf::Vector2f &target, const std::vector<std::unique_ptr<Piece>> &pieces, const Piece *ignorePiece) const
-//   Track that the piece that captures the QueenOfDestruction does not block its line of sight.
-// - bool QueenOfDestruction::isPathClearIgnoringPiece(const sf::Vector2f &start, const sf::Vector2f &end, const std::vector<std::unique_ptr<Piece>> &pieces, const Piece *ignorePiece) const
-//   Works in conjunction with canMoveToIgnoringPiece.
 
 // Special Features or Notes:
 // - QueenOfDestruction is a level 2 Queen Piece that belongs to the Hellspawn guild.
 // - The QueenOfDestruction moves in straight, or vertical line in any direction, so long as the path is unobstructed.
 // - The QueenOfDestruction captures on movement into a space occupied by an opponent piece.
-// - Upon dying, QueenOfDestruction erases all enemy units in its line of sight.
+// - Upon dying, QueenOfDestruction erases all enemy units in its line of sight. The piece that captures her does not
+//   block her sight. Her lines and the removal come from AreaEffect, which also carries the destruction on when it
+//   reaches another QueenOfDestruction or a QueenOfBones.
 // - Inherits functionality from the Piece class.
 
 // Usage or Context:
@@ -29,8 +27,9 @@
 #include "queenOfDestruction.h"
 #include "utility.h"
 #include "globals.h"
-#include "square.h"
+#include "board.h"
 #include <vector>
+#include <iostream>
 
 // Determine if the QueenOfDestruction can move to a specified target position
 bool QueenOfDestruction::canMoveTo(const sf::Vector2f &target, const std::vector<std::unique_ptr<Piece>> &pieces) const
@@ -54,8 +53,9 @@ bool QueenOfDestruction::canMoveTo(const sf::Vector2f &target, const std::vector
 }
 
 // Highlight valid moves for the QueenOfDestruction on the provided board
-void QueenOfDestruction::highlightValidMoves(std::vector<std::vector<Square>> &board, const std::vector<std::unique_ptr<Piece>> &pieces) const
+void QueenOfDestruction::highlightValidMoves(Board &board, const std::vector<std::unique_ptr<Piece>> &pieces) const
 {
+    Board::Highlights highlights;
     sf::Vector2f currentPosition = getPosition();
     Piece::Color currentPlayerColor = getColor();
 
@@ -67,11 +67,11 @@ void QueenOfDestruction::highlightValidMoves(std::vector<std::vector<Square>> &b
         {
             if (!isOpponentPiece(horizontalTarget, pieces, currentPlayerColor))
             {
-                board[static_cast<int>(currentPosition.y / TILE_SIZE)][i].setHighlight(true);
+                highlights.moves |= Board::squareMask(tileIndex(currentPosition.y), i);
             }
             else if (isOpponentPiece(horizontalTarget, pieces, currentPlayerColor))
             {
-                board[static_cast<int>(currentPosition.y / TILE_SIZE)][i].setHighlight(true, sf::Color::Red);
+                highlights.captures |= Board::squareMask(tileIndex(currentPosition.y), i);
             }
         }
 
@@ -80,11 +80,11 @@ void QueenOfDestruction::highlightValidMoves(std::vector<std::vector<Square>> &b
         {
             if (!isOpponentPiece(verticalTarget, pieces, currentPlayerColor))
             {
-                board[i][static_cast<int>(currentPosition.x / TILE_SIZE)].setHighlight(true);
+                highlights.moves |= Board::squareMask(i, tileIndex(currentPosition.x));
             }
             else if (isOpponentPiece(verticalTarget, pieces, currentPlayerColor))
             {
-                board[i][static_cast<int>(currentPosition.x / TILE_SIZE)].setHighlight(true, sf::Color::Red);
+                highlights.captures |= Board::squareMask(i, tileIndex(currentPosition.x));
             }
         }
     }
@@ -97,8 +97,8 @@ void QueenOfDestruction::highlightValidMoves(std::vector<std::vector<Square>> &b
             // Check valid moves in each diagonal direction
             for (float i = 1; i < BOARD_SIZE; ++i)
             {
-                int newX = static_cast<int>(currentPosition.x / TILE_SIZE) + i * dx;
-                int newY = static_cast<int>(currentPosition.y / TILE_SIZE) + i * dy;
+                int newX = tileIndex(currentPosition.x) + i * dx;
+                int newY = tileIndex(currentPosition.y) + i * dy;
 
                 // Check if the new position is within the board bounds
                 if (newX >= 0 && newX < BOARD_SIZE && newY >= 0 && newY < BOARD_SIZE)
@@ -110,11 +110,11 @@ void QueenOfDestruction::highlightValidMoves(std::vector<std::vector<Square>> &b
                     {
                         if (!isOpponentPiece(newPosition, pieces, currentPlayerColor))
                         {
-                            board[newY][newX].setHighlight(true);
+                            highlights.moves |= Board::squareMask(newY, newX);
                         }
                         else if (isOpponentPiece(newPosition, pieces, currentPlayerColor))
                         {
-                            board[newY][newX].setHighlight(true, sf::Color::Red);
+                            highlights.captures |= Board::squareMask(newY, newX);
                         }
 
                         // If the position is occupied by an opponent's piece, stop highlighting in this direction
@@ -137,112 +137,13 @@ void QueenOfDestruction::highlightValidMoves(std::vector<std::vector<Square>> &b
             }
         }
     }
+    board.highlight(highlights);
 }
 
-void QueenOfDestruction::massDestruction(const Piece *capturingPiece, std::vector<std::unique_ptr<Piece>> &pieces, std::vector<std::vector<Square>> &board)
+void QueenOfDestruction::massDestruction(const Piece *capturingPiece, std::vector<std::unique_ptr<Piece>> &pieces, const AreaEffect::QueenOfBonesFallen &onQueenOfBonesFallen)
 {
-    sf::Vector2f currentPosition = getPosition();
-
-    // Vector to hold pointers to pieces to remove
-    std::vector<Piece *> piecesToRemove;
+    AreaEffect area(pieces);
+    AreaEffect::SquareMask destroyed = area.capture(area.massDestructionTargets(*this, capturingPiece), capturingPiece, onQueenOfBonesFallen);
 
-    // Identify all pieces that can be destroyed
-    for (const auto &piece : pieces)
-    {
-        if (piece.get() != this && piece.get() != capturingPiece) // Ensure we're not erasing the Queen or the capturing piece
-        {
-            sf::Vector2f currPiecePos = piece->getPosition();
-
-            if (canMoveToIgnoringPiece(currPiecePos, pieces, capturingPiece)) // Check move validity while ignoring capturing piece
-            {
-                piecesToRemove.push_back(piece.get()); // Store the pointer to the piece
-            }
-        }
-    }
-
-    // Remove identified pieces from the original vector
-    pieces.erase(
-        std::remove_if(
-            pieces.begin(),
-            pieces.end(),
-            [&piecesToRemove](const std::unique_ptr<Piece> &piece)
-            {
-                return std::find(piecesToRemove.begin(), piecesToRemove.end(), piece.get()) != piecesToRemove.end();
-            }),
-        pieces.end());
-
-    // Highlighting for debugging visualization
-    for (const auto &piece : piecesToRemove)
-    {
-        sf::Vector2f pos = piece->getPosition();
-        int x = static_cast<int>(pos.x / TILE_SIZE);
-        int y = static_cast<int>(pos.y / TILE_SIZE);
-
-        board[y][x].setHighlight(true, sf::Color::Red);
-        std::cout << "Identified piece for destruction at: (" << x << ", " << y << ")\n";
-    }
-
-    // Optionally, clear highlights after destruction
-    for (auto &row : board)
-    {
-        for (auto &square : row)
-        {
-            square.setHighlight(false);
-        }
-    }
-
-    std::cout << "Mass destruction completed.\n";
+    std::cout << "Mass destruction completed: " << __builtin_popcountll(destroyed) << " pieces destroyed.\n";
 }
-
-bool QueenOfDestruction::canMoveToIgnoringPiece(const sf::Vector2f &target, const std::vector<std::unique_ptr<Piece>> &pieces, const Piece *ignorePiece) const
-{
-    sf::Vector2f currentPosition = getPosition();
-
-    // QueenOfDestruction can only move in straight lines and diagonal lines
-    if ((target.x != currentPosition.x && target.y != currentPosition.y) &&
-        (std::abs(target.x - currentPosition.x) != std::abs(target.y - currentPosition.y)))
-    {
-        return false;
-    }
-
-    // Check if the path is clear, ignoring the capturing piece
-    if (!isPathClearIgnoringPiece(currentPosition, target, pieces, ignorePiece))
-    {
-        return false;
-    }
-
-    // Check if the target position is occupied by an opponent's piece
-    return !getPieceAtPosition(target, pieces) || isOpponentPiece(target, pieces, getColor());
-}
-
-// Helper function to check if path is clear, ignoring a specific piece
-bool QueenOfDestruction::isPathClearIgnoringPiece(const sf::Vector2f &start, const sf::Vector2f &end, const std::vector<std::unique_ptr<Piece>> &pieces, const Piece *ignorePiece) const
-{
-    // Calculate the direction vector by dividing the differences by TILE_SIZE
-    sf::Vector2f direction = {(end.x - start.x) / TILE_SIZE, (end.y - start.y) / TILE_SIZE};
-
-    // Normalize the direction to ensure it's either -1, 0, or 1
-    direction.x = direction.x != 0 ? direction.x / std::abs(direction.x) : 0;
-    direction.y = direction.y != 0 ? direction.y / std::abs(direction.y) : 0;
-
-    // Move to the first position to check
-    sf::Vector2f currentPos = start + sf::Vector2f(direction.x * TILE_SIZE, direction.y * TILE_SIZE);
-
-    // Traverse the path until the end position is reached
-    while (currentPos != end)
-    {
-        // Check if there's a piece at the current position, ignoring the specified piece
-        if (auto piece = getPieceAtPosition(currentPos, pieces))
-        {
-            if (piece != ignorePiece)
-            {
-                return false; // Path is not clear, a piece is blocking
-            }
-        }
-
-        // Move to the next position along the direction
-        currentPos += sf::Vector2f(direction.x * TILE_SIZE, direction.y * TILE_SIZE);
-    }
-
-    return true; // Path is clear
-}
\ No newline at end of file
@@ -7,16 +7,16 @@
 // Main Functions:
 // - bool QueenOfDomination::canMoveTo(const sf::Vector2f &target, const std::vector<std::unique_ptr<Piece>> &pieces) const:
 //   Checks if the QueenOfDomination can legally move to the specified target position on the chessboard.
-// - void QueenOfDomination::highlightValidMoves(std::vector<std::vector<Square>> &board, const std::vector<std::unique_ptr<Piece>> &pieces) const:
+// - void QueenOfDomination::highlightValidMoves(Board &board, const std::vector<std::unique_ptr<Piece>> &pieces) const:
 //   Highlights all valid moves for the QueenOfDomination on the provided chessboard, considering its current position and game rules.
-// - void QueenOfDomination::highlightAdjacentFriendlyPieces(std::vector<std::vector<Square>> &board, const std::vector<std::unique_ptr<Piece>> &pieces) const
+// - void QueenOfDomination::highlightAdjacentFriendlyPieces(Board &board, const std::vector<std::unique_ptr<Piece>> &pieces) const
 //   Highlights all friendly units in its perimeter in green.
-// - void QueenOfDomination::toggleAdjacentFriendlyHighlights(std::vector<std::vector<Square>> &board, const std::vector<std::unique_ptr<Piece>> &pieces) const
+// - void QueenOfDomination::toggleAdjacentFriendlyHighlights(Board &board, const std::vector<std::unique_ptr<Piece>> &pieces) const
 //   Toggle the highlighting of friendly units off and on.
-// - void QueenOfDomination::clearHighlights(std::vector<std::vector<Square>> &board) const
+// - void QueenOfDomination::clearHighlights(Board &board) const
 //   Clear highlights.
-// - void QueenOfDomination::applyDominationAbility(Piece *targetPiece, std::vector<std::unique_ptr<Piece>> &pieces, TextureManager &textureManager) const
-//   Grants a friendly unit Queen abilities until end of turn.
+// - Piece *QueenOfDomination::applyDominationAbility(Piece *targetPiece, std::vector<std::unique_ptr<Piece>> &pieces, TextureManager &textureManager) const
+//   Grants a friendly unit Queen abilities until end of turn and returns the Queen so its expiry can be scheduled.
 // - bool QueenOfDomination::hasUsedAbility() const
 //   Track that applyDominationAbility is only used once per turn.
 // - void QueenOfDomination::returnOriginalSprite(std::vector<std::unique_ptr<Piece>> &pieces, TextureManager &textureManager)
@@ -36,7 +36,7 @@
 #include "utility.h"
 #include "pieceFactory.h"
 #include "globals.h"
-#include "square.h"
+#include "board.h"
 #include <vector>
 #include <cmath>
 #include <iostream>
@@ -63,8 +63,9 @@ bool QueenOfDomination::canMoveTo(const sf::Vector2f &target, const std::vector<
 }
 
 // Highlight valid moves for the QueenOfDomination on the provided board
-void QueenOfDomination::highlightValidMoves(std::vector<std::vector<Square>> &board, const std::vector<std::unique_ptr<Piece>> &pieces) const
+void QueenOfDomination::highlightValidMoves(Board &board, const std::vector<std::unique_ptr<Piece>> &pieces) const
 {
+    Board::Highlights highlights;
     sf::Vector2f currentPosition = getPosition();
     Piece::Color currentPlayerColor = getColor();
 
@@ -76,11 +77,11 @@ void QueenOfDomination::highlightValidMoves(std::vector<std::vector<Square>> &bo
         {
             if (!isOpponentPiece(horizontalTarget, pieces, currentPlayerColor))
             {
-                board[static_cast<int>(currentPosition.y / TILE_SIZE)][i].setHighlight(true);
+                highlights.moves |= Board::squareMask(tileIndex(currentPosition.y), i);
             }
             else if (isOpponentPiece(horizontalTarget, pieces, currentPlayerColor))
             {
-                board[static_cast<int>(currentPosition.y / TILE_SIZE)][i].setHighlight(true, sf::Color::Red);
+                highlights.captures |= Board::squareMask(tileIndex(currentPosition.y), i);
             }
         }
 
@@ -89,11 +90,11 @@ void QueenOfDomination::highlightValidMoves(std::vector<std::vector<Square>> &bo
         {
             if (!isOpponentPiece(verticalTarget, pieces, currentPlayerColor))
             {
-                board[i][static_cast<int>(currentPosition.x / TILE_SIZE)].setHighlight(true);
+                highlights.moves |= Board::squareMask(i, tileIndex(currentPosition.x));
             }
             else if (isOpponentPiece(verticalTarget, pieces, currentPlayerColor))
             {
-                board[i][static_cast<int>(currentPosition.x / TILE_SIZE)].setHighlight(true, sf::Color::Red);
+                highlights.captures |= Board::squareMask(i, tileIndex(currentPosition.x));
             }
         }
     }
@@ -106,8 +107,8 @@ void QueenOfDomination::highlightValidMoves(std::vector<std::vector<Square>> &bo
             // Check valid moves in each diagonal direction
             for (float i = 1; i < BOARD_SIZE; ++i)
             {
-                int newX = static_cast<int>(currentPosition.x / TILE_SIZE) + i * dx;
-                int newY = static_cast<int>(currentPosition.y / TILE_SIZE) + i * dy;
+                int newX = tileIndex(currentPosition.x) + i * dx;
+                int newY = tileIndex(currentPosition.y) + i * dy;
 
                 // Check if the new position is within the board bounds
                 if (newX >= 0 && newX < BOARD_SIZE && newY >= 0 && newY < BOARD_SIZE)
@@ -119,11 +120,11 @@ void QueenOfDomination::highlightValidMoves(std::vector<std::vector<Square>> &bo
                     {
                         if (!isOpponentPiece(newPosition, pieces, currentPlayerColor))
                         {
-                            board[newY][newX].setHighlight(true);
+                            highlights.moves |= Board::squareMask(newY, newX);
                         }
                         else if (isOpponentPiece(newPosition, pieces, currentPlayerColor))
                         {
-                            board[newY][newX].setHighlight(true, sf::Color::Red);
+                            highlights.captures |= Board::squareMask(newY, newX);
                         }
 
                         // If the position is occupied by an opponent's piece, stop highlighting in this direction
@@ -146,10 +147,12 @@ void QueenOfDomination::highlightValidMoves(std::vector<std::vector<Square>> &bo
             }
         }
     }
+    board.highlight(highlights);
 }
 
-void QueenOfDomination::highlightAdjacentFriendlyPieces(std::vector<std::vector<Square>> &board, const std::vector<std::unique_ptr<Piece>> &pieces) const
+void QueenOfDomination::highlightAdjacentFriendlyPieces(Board &board, const std::vector<std::unique_ptr<Piece>> &pieces) const
 {
+    Board::Highlights highlights;
     sf::Vector2f currentPosition = getPosition();
 
     for (const auto &piece : pieces)
@@ -160,12 +163,12 @@ void QueenOfDomination::highlightAdjacentFriendlyPieces(std::vector<std::vector<
 
             if (distance <= TILE_SIZE * 1.5) // Adjust this threshold if needed
             {
-                int row = static_cast<int>(piece->getPosition().y / TILE_SIZE);
-                int col = static_cast<int>(piece->getPosition().x / TILE_SIZE);
+                int row = tileIndex(piece->getPosition().y);
+                int col = tileIndex(piece->getPosition().x);
 
                 if (row >= 0 && row < BOARD_SIZE && col >= 0 && col < BOARD_SIZE)
                 {
-                    board[row][col].setHighlight(true, sf::Color::Green);
+                    highlights.abilities |= Board::squareMask(row, col);
                     std::cout << "Highlighted square at: (" << piece->getPosition().x << ", " << piece->getPosition().y << ")" << std::endl;
                 }
                 else
@@ -175,9 +178,10 @@ void QueenOfDomination::highlightAdjacentFriendlyPieces(std::vector<std::vector<
             }
         }
     }
+    board.highlight(highlights);
 }
 
-void QueenOfDomination::toggleAdjacentFriendlyHighlights(std::vector<std::vector<Square>> &board, const std::vector<std::unique_ptr<Piece>> &pieces) const
+void QueenOfDomination::toggleAdjacentFriendlyHighlights(Board &board, const std::vector<std::unique_ptr<Piece>> &pieces) const
 {
     if (highlightsActive)
     {
@@ -191,22 +195,13 @@ void QueenOfDomination::toggleAdjacentFriendlyHighlights(std::vector<std::vector
     }
 }
 
-void QueenOfDomination::clearHighlights(std::vector<std::vector<Square>> &board) const
+void QueenOfDomination::clearHighlights(Board &board) const
 {
-    for (auto &row : board)
-    {
-        for (auto &square : row)
-        {
-            if (square.getHighlight())
-            {
-                square.setHighlight(false);
-            }
-        }
-    }
+    board.clearHighlights();
     highlightsActive = false;
 }
 
-void QueenOfDomination::applyDominationAbility(Piece *targetPiece, std::vector<std::unique_ptr<Piece>> &pieces, TextureManager &textureManager) const
+Piece *QueenOfDomination::applyDominationAbility(Piece *targetPiece, std::vector<std::unique_ptr<Piece>> &pieces, TextureManager &textureManager) const
 {
     // std::cout << "applyDominationAbility." << std::endl;
 
@@ -214,7 +209,7 @@ void QueenOfDomination::applyDominationAbility(Piece *targetPiece, std::vector<s
     {
         // Return if the target piece is invalid or the ability has been used
         std::cerr << "Ability already used or invalid target piece." << std::endl;
-        return;
+        return nullptr;
     }
 
     // Store the original type and position of the target piece
@@ -229,7 +224,7 @@ void QueenOfDomination::applyDominationAbility(Piece *targetPiece, std::vector<s
     if (!originalTexture)
     {
         std::cerr << "Failed to get the texture for: " << textureName << std::endl;
-        return;
+        return nullptr;
     }
 
     // Create a new QueenOfDomination with the original texture
@@ -245,6 +240,7 @@ void QueenOfDomination::applyDominationAbility(Piece *targetPiece, std::vector<s
     originalType = "None";
 
     // Find and replace the target piece
+    Piece *dominated = nullptr;
     auto it = std::find_if(pieces.begin(), pieces.end(),
                            [&targetPiece](const std::unique_ptr<Piece> &piece)
                            {
@@ -258,6 +254,7 @@ void QueenOfDomination::applyDominationAbility(Piece *targetPiece, std::vector<s
 
         // Add the new QueenOfDomination at the same position
         pieces.push_back(std::move(tempQueen));
+        dominated = pieces.back().get();
 
         std::cout << "Selected piece becomes a Queen until next turn!!" << std::endl;
     }
@@ -277,8 +274,8 @@ void QueenOfDomination::applyDominationAbility(Piece *targetPiece, std::vector<s
     // Mark this queen's ability as used
     abilityUsed = true;
 
-    // At the end of the turn, replace the QueenOfDomination with the original piece type
-    // This could be handled by the game loop or another function that restores the original piece
+    // The game's EffectScheduler replaces the QueenOfDomination with the original piece type when the effect expires
+    return dominated;
 }
 
 bool QueenOfDomination::hasUsedAbility() const
@@ -7,7 +7,7 @@
 // Main Functions:
 // - bool QueenOfIllusions::canMoveTo(const sf::Vector2f &target, const std::vector<std::unique_ptr<Piece>> &pieces) const:
 //   Checks if the QueenOfIllusions can legally move to the specified target position on the chessboard.
-// - void QueenOfIllusions::highlightValidMoves(std::vector<std::vector<Square>> &board, const std::vector<std::unique_ptr<Piece>> &pieces) const:
+// - void QueenOfIllusions::highlightValidMoves(Board &board, const std::vector<std::unique_ptr<Piece>> &pieces) const:
 //   Highlights all valid moves for the Queen on the provided chessboard, considering its current position and game rules.
 
 // Special Features or Notes:
@@ -21,7 +21,7 @@
 #include "queenOfIllusions.h"
 #include "utility.h"
 #include "globals.h"
-#include "square.h"
+#include "board.h"
 #include <vector>
 
 // Determine if the QueenOfIllusions can move to a specified target position
@@ -46,8 +46,9 @@ bool QueenOfIllusions::canMoveTo(const sf::Vector2f &target, const std::vector<s
 }
 
 // Highlight valid moves for the QueenOfIllusions on the provided board
-void QueenOfIllusions::highlightValidMoves(std::vector<std::vector<Square>> &board, const std::vector<std::unique_ptr<Piece>> &pieces) const
+void QueenOfIllusions::highlightValidMoves(Board &board, const std::vector<std::unique_ptr<Piece>> &pieces) const
 {
+    Board::Highlights highlights;
     sf::Vector2f currentPosition = getPosition();
     Piece::Color currentPlayerColor = getColor();
 
@@ -59,11 +60,11 @@ void QueenOfIllusions::highlightValidMoves(std::vector<std::vector<Square>> &boa
         {
             if (!isOpponentPiece(horizontalTarget, pieces, currentPlayerColor))
             {
-                board[static_cast<int>(currentPosition.y / TILE_SIZE)][i].setHighlight(true);
+                highlights.moves |= Board::squareMask(tileIndex(currentPosition.y), i);
             }
             else
             {
-                board[static_cast<int>(currentPosition.y / TILE_SIZE)][i].setHighlight(true, sf::Color::Red);
+                highlights.captures |= Board::squareMask(tileIndex(currentPosition.y), i);
             }
         }
 
@@ -72,11 +73,11 @@ void QueenOfIllusions::highlightValidMoves(std::vector<std::vector<Square>> &boa
         {
             if (!isOpponentPiece(verticalTarget, pieces, currentPlayerColor))
             {
-                board[i][static_cast<int>(currentPosition.x / TILE_SIZE)].setHighlight(true);
+                highlights.moves |= Board::squareMask(i, tileIndex(currentPosition.x));
             }
             else
             {
-                board[i][static_cast<int>(currentPosition.x / TILE_SIZE)].setHighlight(true, sf::Color::Red);
+                highlights.captures |= Board::squareMask(i, tileIndex(currentPosition.x));
             }
         }
     }
@@ -87,7 +88,7 @@ void QueenOfIllusions::highlightValidMoves(std::vector<std::vector<Square>> &boa
         if (piece->getColor() == currentPlayerColor && (piece->getType() == "Pawn" || piece->getType() == "YoungWiz"))
         {
             sf::Vector2f piecePosition = piece->getPosition();
-            board[static_cast<int>(piecePosition.y / TILE_SIZE)][static_cast<int>(piecePosition.x / TILE_SIZE)].setHighlight(true, sf::Color::Green);
+            highlights.abilities |= Board::squareMask(tileIndex(piecePosition.y), tileIndex(piecePosition.x));
         }
     }
 
@@ -99,8 +100,8 @@ void QueenOfIllusions::highlightValidMoves(std::vector<std::vector<Square>> &boa
             // Check valid moves in each diagonal direction
             for (int i = 1; i < BOARD_SIZE; ++i)
             {
-                int newX = static_cast<int>(currentPosition.x / TILE_SIZE) + i * dx;
-                int newY = static_cast<int>(currentPosition.y / TILE_SIZE) + i * dy;
+                int newX = tileIndex(currentPosition.x) + i * dx;
+                int newY = tileIndex(currentPosition.y) + i * dy;
 
                 // Check if the new position is within the board bounds
                 if (newX >= 0 && newX < BOARD_SIZE && newY >= 0 && newY < BOARD_SIZE)
@@ -112,11 +113,11 @@ void QueenOfIllusions::highlightValidMoves(std::vector<std::vector<Square>> &boa
                     {
                         if (!getPieceAtPosition(newPosition, pieces))
                         {
-                            board[newY][newX].setHighlight(true);
+                            highlights.moves |= Board::squareMask(newY, newX);
                         }
                         else if (isOpponentPiece(newPosition, pieces, currentPlayerColor))
                         {
-                            board[newY][newX].setHighlight(true, sf::Color::Red);
+                            highlights.captures |= Board::squareMask(newY, newX);
                             break; // Stop highlighting in this direction
                         }
                         else
@@ -136,10 +137,11 @@ void QueenOfIllusions::highlightValidMoves(std::vector<std::vector<Square>> &boa
             }
         }
     }
+    board.highlight(highlights);
 }
 
 // Define the swap function
-void QueenOfIllusions::swap(Piece *targetPiece, std::vector<std::vector<Square>> &board)
+void QueenOfIllusions::swap(Piece *targetPiece, Board &board)
 {
     // Get current positions
     sf::Vector2f queenPosition = getPosition();
@@ -151,21 +153,15 @@ void QueenOfIllusions::swap(Piece *targetPiece, std::vector<std::vector<Square>>
 
     /*
         // Update the board
-        int queenRow = queenPosition.y / TILE_SIZE;
-        int queenCol = queenPosition.x / TILE_SIZE;
-        int targetRow = targetPosition.y / TILE_SIZE;
-        int targetCol = targetPosition.x / TILE_SIZE;
+        int queenRow = tileIndex(queenPosition.y);
+        int queenCol = tileIndex(queenPosition.x);
+        int targetRow = tileIndex(targetPosition.y);
+        int targetCol = tileIndex(targetPosition.x);
 
         board[queenRow][queenCol].setPiece(targetPiece);
         board[targetRow][targetCol].setPiece(this);
         */
 
     // Clear highlights
-    for (int r = 0; r < BOARD_SIZE; ++r)
-    {
-        for (int c = 0; c < BOARD_SIZE; ++c)
-        {
-            board[r][c].setHighlight(false);
-        }
-    }
+    board.clearHighlights();
 }
\ No newline at end of file
@@ -0,0 +1,205 @@
+// Filename: resourceArchive.cpp
+// Description: Implementation of the ResourceArchive class, which reads and writes the packed resource file.
+
+// Main Classes:
+// - ResourceArchive: A read-only mapping of the archive with a name index, and the writer used at build time.
+
+// Main Functions:
+// - bool ResourceArchive::open(const std::string &path): Maps the archive and checks its header and index.
+// - const ResourceArchive::Entry *ResourceArchive::find(const std::string &name) const: Looks an entry up by name.
+// - bool ResourceArchive::write(const std::string &path, std::vector<Item> items): Writes an archive.
+
+// Special Features or Notes:
+// - The file is mapped with mmap where available, so opening it reads nothing but the pages touched later;
+//   elsewhere it is read into memory in one go.
+// - Every entry's offset and size are checked against the file length when it is opened, so a truncated
+//   archive is refused instead of read past its end.
+// - Entries start on 16-byte boundaries.
+
+// Usage or Context:
+// - Written by battlechess_pack (packMain.cpp) and read by the AssetLoader when the game starts.
+
+#include "resourceArchive.h"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+    struct Header
+    {
+        char magic[4];
+        std::uint32_t version;
+        std::uint32_t entryCount;
+        std::uint32_t reserved;
+    };
+
+    constexpr char Magic[4] = {'B', 'C', 'P', 'K'};
+    constexpr std::size_t DataAlignment = 16;
+
+    std::size_t alignUp(std::size_t value)
+    {
+        return (value + DataAlignment - 1) / DataAlignment * DataAlignment;
+    }
+}
+
+constexpr std::uint32_t ResourceArchive::Version;
+constexpr std::size_t ResourceArchive::NameLength;
+
+ResourceArchive::~ResourceArchive()
+{
+    close();
+}
+
+bool ResourceArchive::open(const std::string &path)
+{
+    close();
+
+#ifndef _WIN32
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        return false;
+    }
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size <= 0)
+    {
+        ::close(fd);
+        return false;
+    }
+    void *mapping = mmap(nullptr, static_cast<std::size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (mapping == MAP_FAILED)
+    {
+        return false;
+    }
+    base = static_cast<const unsigned char *>(mapping);
+    length = static_cast<std::size_t>(info.st_size);
+#else
+    std::ifstream file(path, std::ios::binary);
+    if (!file)
+    {
+        return false;
+    }
+    buffer.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    if (buffer.empty())
+    {
+        return false;
+    }
+    base = buffer.data();
+    length = buffer.size();
+#endif
+
+    Header header;
+    bool valid = length >= sizeof(Header);
+    if (valid)
+    {
+        std::memcpy(&header, base, sizeof(Header));
+        valid = std::memcmp(header.magic, Magic, sizeof(Magic)) == 0 && header.version == Version &&
+                header.entryCount <= (length - sizeof(Header)) / sizeof(Entry);
+    }
+    if (valid)
+    {
+        entryCount = header.entryCount;
+        for (std::size_t i = 0; i < entryCount && valid; ++i)
+        {
+            const Entry &e = entry(i);
+            valid = e.name[NameLength - 1] == '\0' && e.offset <= length && e.size <= length - e.offset &&
+                    (e.type != Type::Image || e.size == std::uint64_t(e.width) * e.height * 4);
+        }
+    }
+    if (!valid)
+    {
+        close();
+    }
+    return valid;
+}
+
+void ResourceArchive::close()
+{
+#ifndef _WIN32
+    if (base)
+    {
+        munmap(const_cast<unsigned char *>(base), length);
+    }
+#endif
+    buffer.clear();
+    base = nullptr;
+    length = 0;
+    entryCount = 0;
+}
+
+const ResourceArchive::Entry *ResourceArchive::entries() const
+{
+    return reinterpret_cast<const Entry *>(base + sizeof(Header));
+}
+
+const ResourceArchive::Entry *ResourceArchive::find(const std::string &name) const
+{
+    const Entry *first = entries();
+    const Entry *last = first + entryCount;
+    const Entry *it = std::lower_bound(first, last, name, [](const Entry &e, const std::string &key)
+                                       { return std::strncmp(e.name, key.c_str(), NameLength) < 0; });
+    if (it == last || std::strncmp(it->name, name.c_str(), NameLength) != 0)
+    {
+        return nullptr;
+    }
+    return it;
+}
+
+bool ResourceArchive::write(const std::string &path, std::vector<Item> items)
+{
+    std::sort(items.begin(), items.end(), [](const Item &a, const Item &b)
+              { return a.name < b.name; });
+
+    Header header;
+    std::memcpy(header.magic, Magic, sizeof(Magic));
+    header.version = Version;
+    header.entryCount = static_cast<std::uint32_t>(items.size());
+    header.reserved = 0;
+
+    std::vector<Entry> index(items.size());
+    std::size_t offset = alignUp(sizeof(Header) + index.size() * sizeof(Entry));
+    for (std::size_t i = 0; i < items.size(); ++i)
+    {
+        if (items[i].name.empty() || items[i].name.size() >= NameLength)
+        {
+            return false;
+        }
+        Entry &e = index[i];
+        std::memset(&e, 0, sizeof(Entry));
+        std::memcpy(e.name, items[i].name.data(), items[i].name.size());
+        e.type = items[i].type;
+        e.width = items[i].width;
+        e.height = items[i].height;
+        e.offset = offset;
+        e.size = items[i].bytes.size();
+        offset = alignUp(offset + items[i].bytes.size());
+    }
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file)
+    {
+        return false;
+    }
+    file.write(reinterpret_cast<const char *>(&header), sizeof(Header));
+    file.write(reinterpret_cast<const char *>(index.data()), static_cast<std::streamsize>(index.size() * sizeof(Entry)));
+
+    std::size_t written = sizeof(Header) + index.size() * sizeof(Entry);
+    const char padding[DataAlignment] = {};
+    for (std::size_t i = 0; i < items.size(); ++i)
+    {
+        file.write(padding, static_cast<std::streamsize>(index[i].offset - written));
+        file.write(reinterpret_cast<const char *>(items[i].bytes.data()), static_cast<std::streamsize>(items[i].bytes.size()));
+        written = index[i].offset + items[i].bytes.size();
+    }
+    return static_cast<bool>(file);
+}
@@ -7,7 +7,7 @@
 // Main Functions:
 // - bool Rook::canMoveTo(const sf::Vector2f &target, const std::vector<std::unique_ptr<Piece>> &pieces) const:
 //   Checks if the Rook can legally move to the specified target position on the chessboard.
-// - void Rook::highlightValidMoves(std::vector<std::vector<Square>> &board, const std::vector<std::unique_ptr<Piece>> &pieces) const:
+// - void Rook::highlightValidMoves(Board &board, const std::vector<std::unique_ptr<Piece>> &pieces) const:
 //   Highlights all valid moves for the Rook on the provided chessboard, considering its current position and game rules.
 
 // Special Features or Notes:
@@ -21,7 +21,7 @@
 #include "rook.h"
 #include "utility.h"
 #include "globals.h"
-#include "square.h"
+#include "board.h"
 #include <vector>
 
 // Determine if the Rook can move to a specified target position
@@ -46,8 +46,9 @@ bool Rook::canMoveTo(const sf::Vector2f &target, const std::vector<std::unique_p
 }
 
 // Highlight valid moves for the Rook on the provided board
-void Rook::highlightValidMoves(std::vector<std::vector<Square>> &board, const std::vector<std::unique_ptr<Piece>> &pieces) const
+void Rook::highlightValidMoves(Board &board, const std::vector<std::unique_ptr<Piece>> &pieces) const
 {
+    Board::Highlights highlights;
     sf::Vector2f currentPosition = getPosition();
 
     for (int i = 0; i < BOARD_SIZE; ++i)
@@ -59,11 +60,11 @@ void Rook::highlightValidMoves(std::vector<std::vector<Square>> &board, const st
         {
             if (!isOpponentPiece(horizontalTarget, pieces, getColor()))
             {
-                board[static_cast<int>(currentPosition.y / TILE_SIZE)][i].setHighlight(true);
+                highlights.moves |= Board::squareMask(tileIndex(currentPosition.y), i);
             }
             else if (isOpponentPiece(horizontalTarget, pieces, getColor()))
             {
-                board[static_cast<int>(currentPosition.y / TILE_SIZE)][i].setHighlight(true, sf::Color::Red);
+                highlights.captures |= Board::squareMask(tileIndex(currentPosition.y), i);
             }
         }
 
@@ -74,12 +75,13 @@ void Rook::highlightValidMoves(std::vector<std::vector<Square>> &board, const st
         {
             if (!isOpponentPiece(verticalTarget, pieces, getColor()))
             {
-                board[i][static_cast<int>(currentPosition.x / TILE_SIZE)].setHighlight(true);
+                highlights.moves |= Board::squareMask(i, tileIndex(currentPosition.x));
             }
             else if (isOpponentPiece(verticalTarget, pieces, getColor()))
             {
-                board[i][static_cast<int>(currentPosition.x / TILE_SIZE)].setHighlight(true, sf::Color::Red);
+                highlights.captures |= Board::squareMask(i, tileIndex(currentPosition.x));
             }
         }
     }
+    board.highlight(highlights);
 }
\ No newline at end of file
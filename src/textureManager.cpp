@@ -13,6 +13,27 @@ bool TextureManager::loadTexture(const std::string &name, const std::string &fil
     return true;
 }
 
+bool TextureManager::loadTexture(const std::string &name, const sf::Image &image)
+{
+    sf::Texture texture;
+    if (!texture.loadFromImage(image))
+    {
+        throw std::runtime_error("Failed to load " + name);
+    }
+    textures[name] = std::move(texture);
+    return true;
+}
+
+std::size_t TextureManager::memoryBytes() const
+{
+    std::size_t bytes = 0;
+    for (const auto &texture : textures)
+    {
+        bytes += std::size_t(texture.second.getSize().x) * texture.second.getSize().y * 4;
+    }
+    return bytes;
+}
+
 sf::Texture *TextureManager::getTexture(const std::string &name)
 {
     auto it = textures.find(name);
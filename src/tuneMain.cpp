@@ -0,0 +1,131 @@
+// Filename: tuneMain.cpp
+// Description: Entry point of the battlechess_tune tool, which fits evaluation weights to game results.
+
+// Main Functions:
+// - int main(int argc, char *argv[]): Loads records, tunes the weights and prints parameters and gemstone prices.
+
+// Special Features or Notes:
+// - Input is one record per line: "<position notation> ; <result>", result from White's view
+//   (1-0, 0-1, 1/2-1/2 or a number between 0 and 1). Lines starting with # are ignored.
+// - Options: --threads N, --epochs N, --rate X, --scale K, --start <params file>, --out <params file>.
+// - --threads sizes the ThreadPool that loads the records and computes the gradient; 0 (the default) means one
+//   thread per hardware thread.
+// - The parameter file can be loaded by the engine with "setoption name EvalFile value <path>".
+
+// Usage or Context:
+// - battlechess_tune games.txt --threads 16 --out eval.txt
+
+#include "engineTune.h"
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+
+int main(int argc, char *argv[])
+{
+    if (argc < 2)
+    {
+        std::cerr << "Usage: battlechess_tune <records> [--threads N] [--epochs N] [--rate X] [--scale K] [--start file] [--out file]" << std::endl;
+        return 1;
+    }
+
+    engine::TunerOptions options;
+    int threads = 0;
+    std::string recordsPath = argv[1];
+    std::string startPath;
+    std::string outPath;
+
+    try
+    {
+        for (int i = 2; i + 1 < argc; i += 2)
+        {
+            std::string flag = argv[i];
+            std::string value = argv[i + 1];
+            if (flag == "--threads")
+                threads = std::stoi(value);
+            else if (flag == "--epochs")
+                options.epochs = std::stoi(value);
+            else if (flag == "--rate")
+                options.learningRate = std::stod(value);
+            else if (flag == "--scale")
+                options.scaling = std::stod(value);
+            else if (flag == "--start")
+                startPath = value;
+            else if (flag == "--out")
+                outPath = value;
+            else
+                throw std::runtime_error("Unknown option " + flag);
+        }
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+
+    std::ifstream records(recordsPath);
+    if (!records)
+    {
+        std::cerr << "Error: unable to open " << recordsPath << std::endl;
+        return 1;
+    }
+
+    engine::ThreadPool pool(threads);
+    auto started = std::chrono::steady_clock::now();
+    std::size_t skipped = 0;
+    engine::TuningSet set = engine::loadTuningSet(records, skipped, pool);
+    double loadSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+    std::cerr << "Loaded " << set.size() << " positions (" << skipped << " skipped) in " << loadSeconds << "s" << std::endl;
+    if (set.size() == 0)
+    {
+        return 1;
+    }
+
+    engine::EvalParams start;
+    try
+    {
+        if (!startPath.empty())
+        {
+            start = engine::EvalParams::load(startPath);
+        }
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+
+    engine::Tuner tuner(set, options, pool);
+    engine::EvalParams tuned = tuner.run(start, [&](int epoch, double loss)
+                                         {
+        if (epoch == 1 || epoch % 50 == 0)
+        {
+            std::cerr << "epoch " << epoch << " loss " << std::setprecision(6) << loss << " (K " << tuner.scaling() << ")" << std::endl;
+        } });
+
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+    std::cerr << "Tuned in " << seconds << "s" << std::endl;
+
+    if (!outPath.empty())
+    {
+        std::ofstream out(outPath);
+        tuned.save(out);
+        if (!out)
+        {
+            std::cerr << "Error: unable to write " << outPath << std::endl;
+            return 1;
+        }
+    }
+    else
+    {
+        tuned.save(std::cout);
+    }
+
+    std::cout << "\nSuggested gemstone costs (current -> suggested):" << std::endl;
+    for (const engine::GemstoneSuggestion &suggestion : engine::suggestGemstoneCosts(tuned))
+    {
+        std::cout << std::left << std::setw(20) << engine::kindName(suggestion.kind) << suggestion.current << " -> " << suggestion.suggested << std::endl;
+    }
+    return 0;
+}
@@ -5,20 +5,17 @@
 // - bool isPathClear(const sf::Vector2f &start, const sf::Vector2f &end, const std::vector<std::unique_ptr<Piece>> &pieces):
 //   Checks that a path is clear when moving a piece on the board.
 //
-// - void loadTextures(std::vector<std::unique_ptr<Piece>> &pieces):
-//   Loads the textures for the pieces, scales thems, and then places them in their positions on the chess board.
+// - void createPieces(GameContext &context, std::vector<std::unique_ptr<Piece>> &pieces):
+//   Sets up the starting pieces, numbering them with the game's IDs.
 //
-// - void pushPawn(std::vector<std::unique_ptr<Piece>> &pieces, sf::Texture &pawnTexture, const sf::Vector2f &position, Piece::Color pieceColor):
+// - void pushPawn(GameContext &context, std::vector<std::unique_ptr<Piece>> &pieces, sf::Texture &pawnTexture, const sf::Vector2f &position, Piece::Color pieceColor):
 //   Pushes a Pawn on the board at the target location.
 //
 // - Piece* getPieceAtPosition(const sf::Vector2f &position, const std::vector<std::unique_ptr<Piece>> &pieces):
 //   Retrieves the piece located at the specified position on the board.
 //
 // - bool isOpponentPiece(const sf::Vector2f &position, const std::vector<std::unique_ptr<Piece>> &pieces, Piece::Color currentPlayerColor):
-//   Determines if the piece at the specified position belongs to the opponent.
-//
-// - void drawChessboard(sf::RenderWindow &window, std::vector<std::vector<Square>> &board):
-//   Renders the chessboard by drawing each square to the window.
+//   Determines if the piece at the specified position belongs to the opponent and can be captured (is not stone).
 //
 // - sf::Vector2i getUserInput():
 //   Captures the user's keyboard input to determine the movement direction.
@@ -100,80 +97,6 @@ bool isPathClear(const sf::Vector2f &start, const sf::Vector2f &end, const std::
     return true; // Path is clear
 }
 
-/**
- * @brief Checks if the path between the starting position and the ending position is clear of any pieces.
- *
- * @param start The starting position on the board as an sf::Vector2f.
- * @param end The ending position on the board as an sf::Vector2f.
- * @param pieces A vector of unique pointers to Piece objects representing all the pieces on the board.
- * @return true if the path is clear.
- * @return false if any piece is blocking the path.
- */
-void loadTextures(TextureManager &textureManager)
-{
-    // Load textures
-    textureManager.loadTexture("WhiteRook", "../resources/WhiteRook.png");
-    textureManager.loadTexture("BlackRook", "../resources/BlackRook.png");
-    textureManager.loadTexture("WhiteBishop", "../resources/WhiteBishop.png");
-    textureManager.loadTexture("BlackBishop", "../resources/BlackBishop.png");
-    textureManager.loadTexture("WhitePawn", "../resources/WhitePawn.png");
-    textureManager.loadTexture("BlackPawn", "../resources/BlackPawn.png");
-    textureManager.loadTexture("WhiteKnight", "../resources/WhiteKnight.png");
-    textureManager.loadTexture("BlackKnight", "../resources/BlackKnight.png");
-    textureManager.loadTexture("WhiteKing", "../resources/WhiteKing.png");
-    textureManager.loadTexture("BlackKing", "../resources/BlackKing.png");
-    textureManager.loadTexture("WhiteQueen", "../resources/WhiteQueen.png");
-    textureManager.loadTexture("BlackQueen", "../resources/BlackQueen.png");
-    textureManager.loadTexture("WhiteWizard", "../resources/WhiteWizard.png");
-    textureManager.loadTexture("BlackWizard", "../resources/BlackWizard.png");
-    textureManager.loadTexture("WhiteNecromancer", "../resources/WhiteNecromancer.png");
-    textureManager.loadTexture("BlackNecromancer", "../resources/BlackNecromancer.png");
-    textureManager.loadTexture("WhiteNecroPawn", "../resources/WhiteNecroPawn.png");
-    textureManager.loadTexture("BlackNecroPawn", "../resources/BlackNecroPawn.png");
-    textureManager.loadTexture("WhiteBeastKnight", "../resources/WhiteBeastKnight.png");
-    textureManager.loadTexture("BlackBeastKnight", "../resources/BlackBeastKnight.png");
-    textureManager.loadTexture("WhiteBoulderThrower", "../resources/WhiteBoulderThrower.png");
-    textureManager.loadTexture("BlackBoulderThrower", "../resources/BlackBoulderThrower.png");
-    textureManager.loadTexture("WhiteHowler", "../resources/WhiteHowler.png");
-    textureManager.loadTexture("BlackHowler", "../resources/BlackHowler.png");
-    textureManager.loadTexture("WhiteProwler", "../resources/WhiteProwler.png");
-    textureManager.loadTexture("BlackProwler", "../resources/BlackProwler.png");
-    textureManager.loadTexture("WhiteHellPawn", "../resources/WhiteHellPawn.png");
-    textureManager.loadTexture("BlackHellPawn", "../resources/BlackHellPawn.png");
-    textureManager.loadTexture("WhiteYoungWiz", "../resources/WhiteYoungWiz.png");
-    textureManager.loadTexture("BlackYoungWiz", "../resources/BlackYoungWiz.png");
-    textureManager.loadTexture("WhitePawnHopper", "../resources/WhitePawnHopper.png");
-    textureManager.loadTexture("BlackPawnHopper", "../resources/BlackPawnHopper.png");
-    textureManager.loadTexture("WhiteBeastDruid", "../resources/WhiteBeastDruid.png");
-    textureManager.loadTexture("BlackBeastDruid", "../resources/BlackBeastDruid.png");
-    textureManager.loadTexture("WhiteGhostKnight", "../resources/WhiteGhostKnight.png");
-    textureManager.loadTexture("BlackGhostKnight", "../resources/BlackGhostKnight.png");
-    textureManager.loadTexture("WhiteFamiliar", "../resources/WhiteFamiliar.png");
-    textureManager.loadTexture("BlackFamiliar", "../resources/BlackFamiliar.png");
-    textureManager.loadTexture("WhiteDeadLauncher", "../resources/WhiteDeadLauncher.png");
-    textureManager.loadTexture("BlackDeadLauncher", "../resources/BlackDeadLauncher.png");
-    textureManager.loadTexture("WhitePortal", "../resources/WhitePortal.png");
-    textureManager.loadTexture("BlackPortal", "../resources/BlackPortal.png");
-    textureManager.loadTexture("WhiteBeholder", "../resources/WhiteBeholder.png");
-    textureManager.loadTexture("BlackBeholder", "../resources/BlackBeholder.png");
-    textureManager.loadTexture("WhiteQueenOfIllusions", "../resources/WhiteQueenOfIllusions.png");
-    textureManager.loadTexture("BlackQueenOfIllusions", "../resources/BlackQueenOfIllusions.png");
-    textureManager.loadTexture("WhiteQueenOfBones", "../resources/WhiteQueenOfBones.png");
-    textureManager.loadTexture("BlackQueenOfBones", "../resources/BlackQueenOfBones.png");
-    textureManager.loadTexture("WhiteQueenOfDomination", "../resources/WhiteQueenOfDomination.png");
-    textureManager.loadTexture("BlackQueenOfDomination", "../resources/BlackQueenOfDomination.png");
-    textureManager.loadTexture("WhiteQueenOfDestruction", "../resources/WhiteQueenOfDestruction.png");
-    textureManager.loadTexture("BlackQueenOfDestruction", "../resources/BlackQueenOfDestruction.png");
-    textureManager.loadTexture("WhiteGhoulKing", "../resources/WhiteGhoulKing.png");
-    textureManager.loadTexture("BlackGhoulKing", "../resources/BlackGhoulKing.png");
-    textureManager.loadTexture("WhiteWizardKing", "../resources/WhiteWizardKing.png");
-    textureManager.loadTexture("BlackWizardKing", "../resources/BlackWizardKing.png");
-    textureManager.loadTexture("WhiteFrogKing", "../resources/WhiteFrogKing.png");
-    textureManager.loadTexture("BlackFrogKing", "../resources/BlackFrogKing.png");
-    textureManager.loadTexture("WhiteHellKing", "../resources/WhiteHellKing.png");
-    textureManager.loadTexture("BlackHellKing", "../resources/BlackHellKing.png");
-}
-
 /**
  * @brief Checks if the path between the starting position and the ending position is clear of any pieces.
  *
@@ -184,109 +107,111 @@ void loadTextures(TextureManager &textureManager)
  * @return false if any piece is blocking the path.
  */
 
-void createPieces(TextureManager &textureManager, std::vector<std::unique_ptr<Piece>> &pieces)
+void createPieces(GameContext &context, std::vector<std::unique_ptr<Piece>> &pieces)
 {
+    TextureManager &textureManager = context.getTextures();
+
     // Clear the pieces vector before adding new pieces
     pieces.clear();
 
     // Add new pieces to the pieces vector
-    int id = getNextID();
+    int id = context.nextId();
     pieces.push_back(std::make_unique<DeadLauncher>(id, *textureManager.getTexture("WhiteDeadLauncher"), sf::Vector2f(0, 0), Piece::Color::White));
 
-    id = getNextID();
+    id = context.nextId();
     pieces.push_back(std::make_unique<Portal>(id, *textureManager.getTexture("BlackPortal"), sf::Vector2f(TILE_SIZE * (BOARD_SIZE - 1), TILE_SIZE * (BOARD_SIZE - 1)), Piece::Color::Black));
 
-    id = getNextID();
+    id = context.nextId();
     pieces.push_back(std::make_unique<Portal>(id, *textureManager.getTexture("BlackPortal"), sf::Vector2f(TILE_SIZE * (BOARD_SIZE - 1), TILE_SIZE * (BOARD_SIZE - 5)), Piece::Color::Black));
 
-    id = getNextID();
+    id = context.nextId();
     pieces.push_back(std::make_unique<Beholder>(id, *textureManager.getTexture("WhiteBeholder"), sf::Vector2f(560, 0), Piece::Color::White));
 
-    id = getNextID();
+    id = context.nextId();
     pieces.push_back(std::make_unique<BoulderThrower>(id, *textureManager.getTexture("BlackBoulderThrower"), sf::Vector2f(TILE_SIZE * (BOARD_SIZE - 8), TILE_SIZE * (BOARD_SIZE - 1)), Piece::Color::Black));
 
-    id = getNextID();
+    id = context.nextId();
     pieces.push_back(std::make_unique<Howler>(id, *textureManager.getTexture("WhiteHowler"), sf::Vector2f(160, 0), Piece::Color::White));
 
-    id = getNextID();
+    id = context.nextId();
     pieces.push_back(std::make_unique<BeastDruid>(id, *textureManager.getTexture("BlackBeastDruid"), sf::Vector2f(TILE_SIZE * (BOARD_SIZE - 3), TILE_SIZE * (BOARD_SIZE - 1)), Piece::Color::Black));
 
-    id = getNextID();
+    id = context.nextId();
     pieces.push_back(std::make_unique<Wizard>(id, *textureManager.getTexture("WhiteWizard"), sf::Vector2f(400, 0), Piece::Color::White));
 
-    id = getNextID();
+    id = context.nextId();
     pieces.push_back(std::make_unique<Necromancer>(id, *textureManager.getTexture("BlackNecromancer"), sf::Vector2f(TILE_SIZE * (BOARD_SIZE - 6), TILE_SIZE * (BOARD_SIZE - 1)), Piece::Color::Black));
 
-    id = getNextID();
+    id = context.nextId();
     pieces.push_back(std::make_unique<Prowler>(id, *textureManager.getTexture("WhiteProwler"), sf::Vector2f(80, 0), Piece::Color::White));
 
-    id = getNextID();
+    id = context.nextId();
     pieces.push_back(std::make_unique<Familiar>(id, *textureManager.getTexture("BlackFamiliar"), sf::Vector2f(TILE_SIZE * (BOARD_SIZE - 2), TILE_SIZE * (BOARD_SIZE - 1)), Piece::Color::Black));
 
-    id = getNextID();
+    id = context.nextId();
     pieces.push_back(std::make_unique<GhostKnight>(id, *textureManager.getTexture("WhiteGhostKnight"), sf::Vector2f(480, 0), Piece::Color::White));
 
-    id = getNextID();
+    id = context.nextId();
     pieces.push_back(std::make_unique<BeastKnight>(id, *textureManager.getTexture("BlackBeastKnight"), sf::Vector2f(TILE_SIZE * (BOARD_SIZE - 7), TILE_SIZE * (BOARD_SIZE - 1)), Piece::Color::Black));
 
-    id = getNextID();
+    id = context.nextId();
     pieces.push_back(std::make_unique<Pawn>(id, *textureManager.getTexture("WhitePawn"), sf::Vector2f(0, 80), Piece::Color::White));
 
-    id = getNextID();
+    id = context.nextId();
     pieces.push_back(std::make_unique<Pawn>(id, *textureManager.getTexture("BlackPawn"), sf::Vector2f(TILE_SIZE * (BOARD_SIZE - 1), TILE_SIZE * (BOARD_SIZE - 2)), Piece::Color::Black));
 
-    id = getNextID();
+    id = context.nextId();
     pieces.push_back(std::make_unique<Pawn>(id, *textureManager.getTexture("WhitePawn"), sf::Vector2f(80, 80), Piece::Color::White));
 
-    id = getNextID();
+    id = context.nextId();
     pieces.push_back(std::make_unique<HellPawn>(id, *textureManager.getTexture("BlackHellPawn"), sf::Vector2f(TILE_SIZE * (BOARD_SIZE - 2), TILE_SIZE * (BOARD_SIZE - 2)), Piece::Color::Black));
 
-    id = getNextID();
+    id = context.nextId();
     pieces.push_back(std::make_unique<HellPawn>(id, *textureManager.getTexture("WhiteHellPawn"), sf::Vector2f(160, 80), Piece::Color::White));
 
-    id = getNextID();
+    id = context.nextId();
     pieces.push_back(std::make_unique<Pawn>(id, *textureManager.getTexture("BlackPawn"), sf::Vector2f(TILE_SIZE * (BOARD_SIZE - 3), TILE_SIZE * (BOARD_SIZE - 2)), Piece::Color::Black));
 
-    id = getNextID();
+    id = context.nextId();
     pieces.push_back(std::make_unique<Pawn>(id, *textureManager.getTexture("WhitePawn"), sf::Vector2f(240, 80), Piece::Color::White));
 
-    id = getNextID();
+    id = context.nextId();
     pieces.push_back(std::make_unique<PawnHopper>(id, *textureManager.getTexture("BlackPawnHopper"), sf::Vector2f(TILE_SIZE * (BOARD_SIZE - 4), TILE_SIZE * (BOARD_SIZE - 2)), Piece::Color::Black));
 
-    id = getNextID();
+    id = context.nextId();
     pieces.push_back(std::make_unique<NecroPawn>(id, *textureManager.getTexture("WhiteNecroPawn"), sf::Vector2f(320, 80), Piece::Color::White));
 
-    id = getNextID();
+    id = context.nextId();
     pieces.push_back(std::make_unique<NecroPawn>(id, *textureManager.getTexture("BlackNecroPawn"), sf::Vector2f(TILE_SIZE * (BOARD_SIZE - 5), TILE_SIZE * (BOARD_SIZE - 2)), Piece::Color::Black));
 
-    id = getNextID();
+    id = context.nextId();
     pieces.push_back(std::make_unique<Pawn>(id, *textureManager.getTexture("WhitePawn"), sf::Vector2f(400, 80), Piece::Color::White));
 
-    id = getNextID();
+    id = context.nextId();
     pieces.push_back(std::make_unique<Pawn>(id, *textureManager.getTexture("BlackPawn"), sf::Vector2f(TILE_SIZE * (BOARD_SIZE - 6), TILE_SIZE * (BOARD_SIZE - 2)), Piece::Color::Black));
 
-    id = getNextID();
+    id = context.nextId();
     pieces.push_back(std::make_unique<Pawn>(id, *textureManager.getTexture("WhitePawn"), sf::Vector2f(480, 80), Piece::Color::White));
 
-    id = getNextID();
+    id = context.nextId();
     pieces.push_back(std::make_unique<Pawn>(id, *textureManager.getTexture("BlackPawn"), sf::Vector2f(TILE_SIZE * (BOARD_SIZE - 7), TILE_SIZE * (BOARD_SIZE - 2)), Piece::Color::Black));
 
-    id = getNextID();
+    id = context.nextId();
     pieces.push_back(std::make_unique<YoungWiz>(id, *textureManager.getTexture("WhiteYoungWiz"), sf::Vector2f(560, 80), Piece::Color::White));
 
-    id = getNextID();
+    id = context.nextId();
     pieces.push_back(std::make_unique<Pawn>(id, *textureManager.getTexture("BlackPawn"), sf::Vector2f(TILE_SIZE * (BOARD_SIZE - 8), TILE_SIZE * (BOARD_SIZE - 2)), Piece::Color::Black));
 
-    id = getNextID();
+    id = context.nextId();
     pieces.push_back(std::make_unique<GhoulKing>(id, *textureManager.getTexture("WhiteGhoulKing"), sf::Vector2f(240, 0), Piece::Color::White));
 
-    id = getNextID();
+    id = context.nextId();
     pieces.push_back(std::make_unique<FrogKing>(id, *textureManager.getTexture("BlackFrogKing"), sf::Vector2f(TILE_SIZE * (BOARD_SIZE - 5), TILE_SIZE * (BOARD_SIZE - 1)), Piece::Color::Black));
 
-    id = getNextID();
+    id = context.nextId();
     pieces.push_back(std::make_unique<QueenOfBones>(id, *textureManager.getTexture("WhiteQueenOfBones"), sf::Vector2f(320, 0), Piece::Color::White));
 
-    id = getNextID();
+    id = context.nextId();
     pieces.push_back(std::make_unique<QueenOfIllusions>(id, *textureManager.getTexture("BlackQueenOfIllusions"), sf::Vector2f(TILE_SIZE * (BOARD_SIZE - 4), TILE_SIZE * (BOARD_SIZE - 1)), Piece::Color::Black));
 
     float scaleFactor = TILE_SIZE / static_cast<float>(std::max(textureManager.getTexture("WhiteRook")->getSize().x, textureManager.getTexture("WhiteRook")->getSize().y));
@@ -301,14 +226,15 @@ void createPieces(TextureManager &textureManager, std::vector<std::unique_ptr<Pi
 /**
  * @brief Pushes a new pawn piece to the vector of pieces.
  *
+ * @param context The game the pawn's ID is taken from.
  * @param pieces A vector of unique pointers to Piece objects representing all the pieces on the board.
  * @param pawnTexture The texture to be used for the pawn.
  * @param position The position on the board where the pawn should be placed.
  * @param color The color of the pawn (Piece::Color::White or Piece::Color::Black).
  */
-void pushPawn(std::vector<std::unique_ptr<Piece>> &pieces, sf::Texture &pawnTexture, const sf::Vector2f &position, Piece::Color pieceColor)
+void pushPawn(GameContext &context, std::vector<std::unique_ptr<Piece>> &pieces, sf::Texture &pawnTexture, const sf::Vector2f &position, Piece::Color pieceColor)
 {
-    int id = getNextID();
+    int id = context.nextId();
     auto pawn = std::make_unique<Pawn>(id, pawnTexture, position, pieceColor);
     pawn->getSprite().setScale(static_cast<float>(TILE_SIZE) / pawnTexture.getSize().x, static_cast<float>(TILE_SIZE) / pawnTexture.getSize().y);
     pieces.push_back(std::move(pawn));
@@ -317,14 +243,15 @@ void pushPawn(std::vector<std::unique_ptr<Piece>> &pieces, sf::Texture &pawnText
 /**
  * @brief Pushes a new pawn piece to the vector of pieces.
  *
+ * @param context The game the necroPawn's ID is taken from.
  * @param pieces A vector of unique pointers to Piece objects representing all the pieces on the board.
  * @param necroPawnTexture The texture to be used for the pawn.
  * @param position The position on the board where the pawn should be placed.
  * @param color The color of the necroPawn (Piece::Color::White or Piece::Color::Black).
  */
-void pushNecroPawn(std::vector<std::unique_ptr<Piece>> &pieces, sf::Texture &necroPawnTexture, const sf::Vector2f &position, Piece::Color pieceColor)
+void pushNecroPawn(GameContext &context, std::vector<std::unique_ptr<Piece>> &pieces, sf::Texture &necroPawnTexture, const sf::Vector2f &position, Piece::Color pieceColor)
 {
-    int id = getNextID();
+    int id = context.nextId();
     auto necroPawn = std::make_unique<NecroPawn>(id, necroPawnTexture, position, pieceColor);
     necroPawn->getSprite().setScale(static_cast<float>(TILE_SIZE) / necroPawnTexture.getSize().x, static_cast<float>(TILE_SIZE) / necroPawnTexture.getSize().y);
 
@@ -357,37 +284,21 @@ Piece *getPieceAtPosition(const sf::Vector2f &position, const std::vector<std::u
  * @param pieces A vector of unique pointers to Piece objects representing all the pieces on the board.
  * @param currentPlayerColor The color of the current player.
  * @return true If the piece at the specified position belongs to the opponent.
- * @return false If there is no piece at the specified position or the piece belongs to the current player.
+ * @return false If there is no piece at the specified position, the piece belongs to the current player, or it is stone.
  */
 bool isOpponentPiece(const sf::Vector2f &position, const std::vector<std::unique_ptr<Piece>> &pieces, Piece::Color currentPlayerColor)
 {
     for (const auto &piece : pieces)
     {
+        // A piece turned to stone cannot be captured, so it only blocks, as in the engine
         if (piece->getPosition() == position && piece->getColor() != currentPlayerColor)
         {
-            return true;
+            return !piece->isStone();
         }
     }
     return false;
 }
 
-/**
- * @brief Draws the chessboard on the provided window.
- *
- * @param window The SFML RenderWindow where the chessboard will be drawn.
- * @param board A 2D vector of Square objects representing the chessboard.
- */
-void drawChessboard(sf::RenderWindow &window, std::vector<std::vector<Square>> &board)
-{
-    for (int row = 0; row < BOARD_SIZE; ++row)
-    {
-        for (int col = 0; col < BOARD_SIZE; ++col)
-        {
-            board[row][col].draw(window);
-        }
-    }
-}
-
 /**
  * @brief Captures user input from the keyboard to determine movement direction.
  *
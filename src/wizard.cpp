@@ -7,7 +7,7 @@
 // Main Functions:
 // - bool Wizard::canMoveTo(const sf::Vector2f &target, const std::vector<std::unique_ptr<Piece>> &pieces) const:
 //   Determines if the Wizard can move to a given target position based on its movement rules.
-// - void Wizard::highlightValidMoves(std::vector<std::vector<Square>> &board, const std::vector<std::unique_ptr<Piece>> &pieces) const:
+// - void Wizard::highlightValidMoves(Board &board, const std::vector<std::unique_ptr<Piece>> &pieces) const:
 //   Highlights all valid moves for the Wizard on the provided chessboard.
 // - void Wizard::capture(const sf::Vector2f &target, std::vector<std::unique_ptr<Piece>> &pieces):
 //   Captures an opponent's piece at the given target position.
@@ -40,8 +40,9 @@ bool Wizard::canMoveTo(const sf::Vector2f &target, const std::vector<std::unique
 }
 
 // Highlight valid moves for the Wizard on the provided board
-void Wizard::highlightValidMoves(std::vector<std::vector<Square>> &board, const std::vector<std::unique_ptr<Piece>> &pieces) const
+void Wizard::highlightValidMoves(Board &board, const std::vector<std::unique_ptr<Piece>> &pieces) const
 {
+    Board::Highlights highlights;
     sf::Vector2f currentPosition = getPosition();
     Piece::Color currentPlayerColor = getColor();
 
@@ -53,8 +54,8 @@ void Wizard::highlightValidMoves(std::vector<std::vector<Square>> &board, const
             // Check valid moves in each diagonal direction
             for (float i = 1; i < BOARD_SIZE; ++i)
             {
-                int newX = static_cast<int>(currentPosition.x / TILE_SIZE) + i * dx;
-                int newY = static_cast<int>(currentPosition.y / TILE_SIZE) + i * dy;
+                int newX = tileIndex(currentPosition.x) + i * dx;
+                int newY = tileIndex(currentPosition.y) + i * dy;
 
                 // Check if the new position is within the board bounds
                 if (newX >= 0 && newX < BOARD_SIZE && newY >= 0 && newY < BOARD_SIZE)
@@ -66,11 +67,11 @@ void Wizard::highlightValidMoves(std::vector<std::vector<Square>> &board, const
                     {
                         if (!getPieceAtPosition(newPosition, pieces))
                         {
-                            board[newY][newX].setHighlight(true);
+                            highlights.moves |= Board::squareMask(newY, newX);
                         }
                         else if (isOpponentPiece(newPosition, pieces, currentPlayerColor))
                         {
-                            board[newY][newX].setHighlight(true, sf::Color::Red); // Highlight the capture position
+                            highlights.captures |= Board::squareMask(newY, newX); // Highlight the capture position
                             break;                                                // Stop if an opponent's piece is found (no further moves in this direction)
                         }
                         else
@@ -90,6 +91,7 @@ void Wizard::highlightValidMoves(std::vector<std::vector<Square>> &board, const
             }
         }
     }
+    board.highlight(highlights);
 }
 
 // Eliminates the opponent piece in the targetted space
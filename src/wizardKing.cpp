@@ -7,9 +7,9 @@
 // Main Functions:
 // - bool WizardKing::canMoveTo(const sf::Vector2f &target, const std::vector<std::unique_ptr<Piece>> &pieces) const:
 //   Checks if the WizardKing can legally move to the specified target position on the chessboard.
-// - void WizardKing::highlightValidMoves(std::vector<std::vector<Square>> &board, const std::vector<std::unique_ptr<Piece>> &pieces) const:
+// - void WizardKing::highlightValidMoves(Board &board, const std::vector<std::unique_ptr<Piece>> &pieces) const:
 //   Highlights all valid moves for the WizardKing on the provided chessboard, considering its current position and game rules.
-// - void WizardKing::highlightCaptureZones(std::vector<std::vector<Square>> &board, const std::vector<std::unique_ptr<Piece>> &pieces) const
+// - void WizardKing::highlightCaptureZones(Board &board, const std::vector<std::unique_ptr<Piece>> &pieces) const
 //   Highlights all enemies in a vertical line of sight from the WizardKing.
 // - void WizardKing::capture(const sf::Vector2f &target, std::vector<std::unique_ptr<Piece>> &pieces)
 //   Unique capture method. Captures regular like a King Piece, but can also capture from a distance using vertical line of sight.
@@ -31,7 +31,7 @@
 #include "wizardKing.h"
 #include "utility.h"
 #include "globals.h"
-#include "square.h"
+#include "board.h"
 #include <vector>
 
 // Determine if the WizardKing can move to a specified target position
@@ -49,8 +49,9 @@ bool WizardKing::canMoveTo(const sf::Vector2f &target, const std::vector<std::un
 }
 
 // Highlight valid moves for the WizardKing on the provided board
-void WizardKing::highlightValidMoves(std::vector<std::vector<Square>> &board, const std::vector<std::unique_ptr<Piece>> &pieces) const
+void WizardKing::highlightValidMoves(Board &board, const std::vector<std::unique_ptr<Piece>> &pieces) const
 {
+    Board::Highlights highlights;
     sf::Vector2f currentPosition = getPosition();
     std::vector<sf::Vector2f> moves = {
         {currentPosition.x, currentPosition.y + TILE_SIZE},
@@ -64,35 +65,34 @@ void WizardKing::highlightValidMoves(std::vector<std::vector<Square>> &board, co
 
     for (const auto &move : moves)
     {
-        int col = move.x / TILE_SIZE;
-        int row = move.y / TILE_SIZE;
+        int col = tileIndex(move.x);
+        int row = tileIndex(move.y);
 
         // space is occupied by an opponent piece
         if (col >= 0 && col < BOARD_SIZE && row >= 0 && row < BOARD_SIZE && canMoveTo(move, pieces) && isOpponentPiece(move, pieces, getColor()))
         {
-            board[row][col].setHighlight(true, sf::Color::Red);
+            highlights.captures |= Board::squareMask(row, col);
         }
         // space is unoccupied
         else if (col >= 0 && col < BOARD_SIZE && row >= 0 && row < BOARD_SIZE && canMoveTo(move, pieces))
         {
-            board[row][col].setHighlight(true);
+            highlights.moves |= Board::squareMask(row, col);
         }
     }
+    board.highlight(highlights);
 }
 
-void WizardKing::highlightCaptureZones(std::vector<std::vector<Square>> &board, const std::vector<std::unique_ptr<Piece>> &pieces) const
+void WizardKing::highlightCaptureZones(Board &board, const std::vector<std::unique_ptr<Piece>> &pieces) const
 {
     sf::Vector2f currentPosition = getPosition();
-    int startX = static_cast<int>(currentPosition.x / TILE_SIZE);
-    int startY = static_cast<int>(currentPosition.y / TILE_SIZE);
+    int startX = tileIndex(currentPosition.x);
+    int startY = tileIndex(currentPosition.y);
+    Board::Highlights highlights;
 
-    // Define a lambda to check if a position is within bounds and should be highlighted
-    auto highlightPosition = [&](int col, int row, sf::Color color)
+    // Define a lambda to collect a capture square; squares off the board add nothing
+    auto highlightPosition = [&](int col, int row)
     {
-        if (col >= 0 && col < BOARD_SIZE && row >= 0 && row < BOARD_SIZE)
-        {
-            board[row][col].setHighlight(true, color);
-        }
+        highlights.captures |= Board::squareMask(row, col);
     };
 
     // Check vertical movement upwards
@@ -106,7 +106,7 @@ void WizardKing::highlightCaptureZones(std::vector<std::vector<Square>> &board,
             // Highlight if the target is an opponent piece
             if (isOpponentPiece(target, pieces, getColor()))
             {
-                highlightPosition(startX, row, sf::Color::Red);
+                highlightPosition(startX, row);
                 break; // Stop after highlighting an opponent piece
             }
         }
@@ -123,11 +123,12 @@ void WizardKing::highlightCaptureZones(std::vector<std::vector<Square>> &board,
             // Highlight if the target is an opponent piece
             if (isOpponentPiece(target, pieces, getColor()))
             {
-                highlightPosition(startX, row, sf::Color::Red);
+                highlightPosition(startX, row);
                 break; // Stop after highlighting an opponent piece
             }
         }
     }
+    board.highlight(highlights);
 }
 
 void WizardKing::capture(const sf::Vector2f &target, std::vector<std::unique_ptr<Piece>> &pieces)
@@ -7,7 +7,7 @@
 // Main Functions:
 // - bool YoungWiz::canMoveTo(const sf::Vector2f &target, const std::vector<std::unique_ptr<Piece>> &pieces) const:
 //   Checks if the YoungWiz can legally move to the specified target position on the chessboard.
-// - void YoungWiz::highlightValidMoves(std::vector<std::vector<Square>> &board, const std::vector<std::unique_ptr<Piece>> &pieces) const:
+// - void YoungWiz::highlightValidMoves(Board &board, const std::vector<std::unique_ptr<Piece>> &pieces) const:
 //   Highlights all valid moves for the YoungWiz on the provided chessboard, considering its current position and game rules.
 
 // Special Features or Notes:
@@ -23,7 +23,7 @@
 #include "youngWiz.h"
 #include "utility.h"
 #include "globals.h"
-#include "square.h"
+#include "board.h"
 #include <vector>
 
 // Determine if the YoungWiz can move to a specified target position
@@ -41,10 +41,10 @@ bool YoungWiz::canMoveTo(const sf::Vector2f &target, const std::vector<std::uniq
     // Check for forward movement
     if (target.x == currentPosition.x)
     {
-        // Single step forward
+        // Single step forward onto an empty square, or a capture of the opponent ahead without moving
         if (target.y == currentPosition.y + direction * TILE_SIZE)
         {
-            return true;
+            return !getPieceAtPosition(target, pieces) || isOpponentPiece(target, pieces, getColor());
         }
         // Double step forward on first move
         else if (target.y == currentPosition.y + 2 * direction * TILE_SIZE &&
@@ -66,8 +66,9 @@ bool YoungWiz::canMoveTo(const sf::Vector2f &target, const std::vector<std::uniq
 }
 
 // Highlight valid moves for the Youngwiz on the provided board
-void YoungWiz::highlightValidMoves(std::vector<std::vector<Square>> &board, const std::vector<std::unique_ptr<Piece>> &pieces) const
+void YoungWiz::highlightValidMoves(Board &board, const std::vector<std::unique_ptr<Piece>> &pieces) const
 {
+    Board::Highlights highlights;
     sf::Vector2f currentPosition = getPosition();
     float direction = (getColor() == Piece::Color::White) ? 1.0f : -1.0f; // White moves down, Black moves up
 
@@ -77,11 +78,11 @@ void YoungWiz::highlightValidMoves(std::vector<std::vector<Square>> &board, cons
     {
         if (!getPieceAtPosition(singleStep, pieces))
         {
-            board[static_cast<int>(singleStep.y / TILE_SIZE)][static_cast<int>(singleStep.x / TILE_SIZE)].setHighlight(true);
+            highlights.moves |= Board::squareMask(tileIndex(singleStep.y), tileIndex(singleStep.x));
         }
         else
         {
-            board[static_cast<int>(singleStep.y / TILE_SIZE)][static_cast<int>(singleStep.x / TILE_SIZE)].setHighlight(true, sf::Color::Red);
+            highlights.captures |= Board::squareMask(tileIndex(singleStep.y), tileIndex(singleStep.x));
         }
     }
 
@@ -92,7 +93,7 @@ void YoungWiz::highlightValidMoves(std::vector<std::vector<Square>> &board, cons
          (getColor() == Piece::Color::Black && currentPosition.y == 6 * TILE_SIZE)) &&
         canMoveTo(doubleStep, pieces))
     {
-        board[static_cast<int>(doubleStep.y / TILE_SIZE)][static_cast<int>(doubleStep.x / TILE_SIZE)].setHighlight(true);
+        highlights.moves |= Board::squareMask(tileIndex(doubleStep.y), tileIndex(doubleStep.x));
     }
 
     // Highlight diagonal captures
@@ -100,15 +101,16 @@ void YoungWiz::highlightValidMoves(std::vector<std::vector<Square>> &board, cons
     if (diagonalLeft.x >= 0 && diagonalLeft.x < BOARD_SIZE * TILE_SIZE && diagonalLeft.y >= 0 && diagonalLeft.y < BOARD_SIZE * TILE_SIZE &&
         canMoveTo(diagonalLeft, pieces))
     {
-        board[static_cast<int>(diagonalLeft.y / TILE_SIZE)][static_cast<int>(diagonalLeft.x / TILE_SIZE)].setHighlight(true, sf::Color::Red);
+        highlights.captures |= Board::squareMask(tileIndex(diagonalLeft.y), tileIndex(diagonalLeft.x));
     }
 
     sf::Vector2f diagonalRight = sf::Vector2f(currentPosition.x + TILE_SIZE, currentPosition.y + direction * TILE_SIZE);
     if (diagonalRight.x >= 0 && diagonalRight.x < BOARD_SIZE * TILE_SIZE && diagonalRight.y >= 0 && diagonalRight.y < BOARD_SIZE * TILE_SIZE &&
         canMoveTo(diagonalRight, pieces))
     {
-        board[static_cast<int>(diagonalRight.y / TILE_SIZE)][static_cast<int>(diagonalRight.x / TILE_SIZE)].setHighlight(true, sf::Color::Red);
+        highlights.captures |= Board::squareMask(tileIndex(diagonalRight.y), tileIndex(diagonalRight.x));
     }
+    board.highlight(highlights);
 }
 
 // Eliminates the opponent piece in the targetted space